@@ -23,6 +23,7 @@
 #include "share/allocator/ob_tenant_mutil_allocator_mgr.h"
 #include "share/ob_tenant_info_proxy.h"
 #include "share/ob_unit_getter.h"
+#include "share/ob_cluster_version.h"         // GET_MIN_DATA_VERSION
 #include "share/rc/ob_tenant_base.h"
 #include "share/rc/ob_tenant_module_init_ctx.h"
 #include "storage/tx_storage/ob_ls_map.h"
@@ -519,9 +520,28 @@ int ObLogService::update_palf_options_except_disk_usage_limit_size()
   } else {
     PalfOptions palf_opts;
     common::ObCompressorType compressor_type = LZ4_COMPRESSOR;
+    common::ObCompressorType storage_compressor_type = LZ4_COMPRESSOR;
+    // compressed LogEntry can not be read by observers of old version, compress log only after
+    // all observers of the tenant are upgraded. This function is called again when the
+    // data version changes, as it's a tenant parameter.
+    bool enable_storage_compress = false;
+    uint64_t tenant_data_version = 0;
+    int tmp_ret = OB_SUCCESS;
+    if (!tenant_config->log_storage_compress_all) {
+    } else if (OB_TMP_FAIL(GET_MIN_DATA_VERSION(MTL_ID(), tenant_data_version))) {
+      CLOG_LOG(WARN, "get tenant data version failed, disable log storage compress", K(tmp_ret), K(MTL_ID()));
+    } else if (tenant_data_version < DATA_VERSION_4_2_0_0) {
+      CLOG_LOG(INFO, "log storage compress is not supported with current data version",
+               K(MTL_ID()), K(tenant_data_version));
+    } else {
+      enable_storage_compress = true;
+    }
     if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor_type(
                 tenant_config->log_transport_compress_func, compressor_type))) {
       CLOG_LOG(ERROR, "log_transport_compress_func invalid.", K(ret));
+    } else if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor_type(
+                tenant_config->log_storage_compress_func, storage_compressor_type))) {
+      CLOG_LOG(ERROR, "log_storage_compress_func invalid.", K(ret));
     //需要获取log_disk_usage_limit_size
     } else if (OB_FAIL(palf_env_->get_options(palf_opts))) {
       CLOG_LOG(WARN, "palf get_options failed", K(ret));
@@ -532,6 +552,8 @@ int ObLogService::update_palf_options_except_disk_usage_limit_size()
       palf_opts.disk_options_.log_disk_throttling_maximum_duration_ = tenant_config->log_disk_throttling_maximum_duration;
       palf_opts.compress_options_.enable_transport_compress_ = tenant_config->log_transport_compress_all;
       palf_opts.compress_options_.transport_compress_func_ = compressor_type;
+      palf_opts.storage_compress_options_.enable_storage_compress_ = enable_storage_compress;
+      palf_opts.storage_compress_options_.storage_compress_func_ = storage_compressor_type;
       palf_opts.rebuild_replica_log_lag_threshold_ = tenant_config->_rebuild_replica_log_lag_threshold;
       palf_opts.disk_options_.log_writer_parallelism_ = tenant_config->_log_writer_parallelism;
       if (OB_FAIL(palf_env_->update_options(palf_opts))) {
@@ -99,5 +99,172 @@ int LogHotCache::read(const LSN &read_begin_lsn,
   return ret;
 }
 
+LogColdCacheKey::LogColdCacheKey()
+  : tenant_id_(OB_INVALID_TENANT_ID),
+    palf_id_(INVALID_PALF_ID),
+    version_(0),
+    chunk_lsn_val_(LOG_INVALID_LSN_VAL)
+{}
+
+LogColdCacheKey::LogColdCacheKey(const uint64_t tenant_id,
+                                 const int64_t palf_id,
+                                 const int64_t version,
+                                 const uint64_t chunk_lsn_val)
+  : tenant_id_(tenant_id),
+    palf_id_(palf_id),
+    version_(version),
+    chunk_lsn_val_(chunk_lsn_val)
+{}
+
+bool LogColdCacheKey::is_valid() const
+{
+  return is_valid_tenant_id(tenant_id_) && is_valid_palf_id(palf_id_)
+      && 0 < version_ && LOG_INVALID_LSN_VAL != chunk_lsn_val_;
+}
+
+bool LogColdCacheKey::operator ==(const ObIKVCacheKey &other) const
+{
+  const LogColdCacheKey &other_key = reinterpret_cast<const LogColdCacheKey &>(other);
+  return tenant_id_ == other_key.tenant_id_
+      && palf_id_ == other_key.palf_id_
+      && version_ == other_key.version_
+      && chunk_lsn_val_ == other_key.chunk_lsn_val_;
+}
+
+uint64_t LogColdCacheKey::hash() const
+{
+  uint64_t hash_val = 0;
+  hash_val = murmurhash(&tenant_id_, sizeof(tenant_id_), hash_val);
+  hash_val = murmurhash(&palf_id_, sizeof(palf_id_), hash_val);
+  hash_val = murmurhash(&version_, sizeof(version_), hash_val);
+  hash_val = murmurhash(&chunk_lsn_val_, sizeof(chunk_lsn_val_), hash_val);
+  return hash_val;
+}
+
+int LogColdCacheKey::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || buf_len < size()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), KP(buf), K(buf_len), K(size()));
+  } else {
+    key = new (buf) LogColdCacheKey(tenant_id_, palf_id_, version_, chunk_lsn_val_);
+  }
+  return ret;
+}
+
+int LogColdCacheValue::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || buf_len < size()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), KP(buf), K(buf_len), K(size()));
+  } else if (!is_valid()) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(WARN, "invalid cache value", K(ret), KPC(this));
+  } else {
+    char *data_buf = buf + sizeof(*this);
+    MEMCPY(data_buf, buf_, buf_len_);
+    value = new (buf) LogColdCacheValue(data_buf, buf_len_);
+  }
+  return ret;
+}
+
+int64_t LogColdCache::global_version_ = 0;
+
+LogColdCache &LogColdCache::get_instance()
+{
+  static LogColdCache instance;
+  return instance;
+}
+
+int64_t LogColdCache::alloc_version()
+{
+  return ATOMIC_AAF(&global_version_, 1);
+}
+
+LogColdCache::LogColdCache()
+  : read_size_(0),
+    hit_count_(0),
+    read_count_(0),
+    last_print_time_(0),
+    is_inited_(false)
+{}
+
+int LogColdCache::init(const char *cache_name, const int64_t priority)
+{
+  int ret = OB_SUCCESS;
+  if (is_inited_) {
+    ret = OB_INIT_TWICE;
+  } else if (OB_FAIL(ObKVCache<LogColdCacheKey, LogColdCacheValue>::init(cache_name, priority))) {
+    PALF_LOG(WARN, "init kv cache failed", K(ret), K(cache_name), K(priority));
+  } else {
+    is_inited_ = true;
+    PALF_LOG(INFO, "LogColdCache init success", K(ret), K(cache_name), K(priority));
+  }
+  return ret;
+}
+
+void LogColdCache::destroy()
+{
+  is_inited_ = false;
+  ObKVCache<LogColdCacheKey, LogColdCacheValue>::destroy();
+}
+
+int LogColdCache::get_chunk(const LogColdCacheKey &key,
+                            const LogColdCacheValue *&value,
+                            ObKVCacheHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  value = NULL;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!key.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), K(key));
+  } else if (OB_FAIL(get(key, value, handle))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      PALF_LOG(WARN, "get chunk from LogColdCache failed", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(value) || !value->is_valid()) {
+    ret = OB_ERR_UNEXPECTED;
+    PALF_LOG(ERROR, "chunk in LogColdCache is invalid", K(ret), K(key), KPC(value));
+  }
+  return ret;
+}
+
+int LogColdCache::put_chunk(const LogColdCacheKey &key, const char *buf, const int64_t buf_len)
+{
+  int ret = OB_SUCCESS;
+  const LogColdCacheValue value(buf, buf_len);
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!key.is_valid() || !value.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid arguments", K(ret), K(key), K(value));
+  } else if (OB_FAIL(put(key, value, true /*overwrite*/))) {
+    PALF_LOG(WARN, "put chunk into LogColdCache failed", K(ret), K(key), K(value));
+  }
+  return ret;
+}
+
+void LogColdCache::stat(const bool is_hit, const int64_t read_size)
+{
+  int64_t total_read_size = 0, hit_cnt = 0, read_cnt = 0;
+  if (is_hit) {
+    hit_cnt = ATOMIC_AAF(&hit_count_, 1);
+    total_read_size = ATOMIC_AAF(&read_size_, read_size);
+  }
+  read_cnt = ATOMIC_AAF(&read_count_, 1);
+  if (palf_reach_time_interval(PALF_STAT_PRINT_INTERVAL_US, last_print_time_)) {
+    read_cnt = read_cnt == 0 ? 1 : read_cnt;
+    PALF_LOG(INFO, "[PALF STAT COLD CACHE HIT RATE]", "read_size", total_read_size, K(hit_cnt),
+        K(read_cnt), "hit rate", hit_cnt * 1.0 / read_cnt);
+    hit_count_ = 0;
+    read_size_ = 0;
+    read_count_ = 0;
+  }
+}
+
 } // end namespace palf
 } // end namespace oceanbase
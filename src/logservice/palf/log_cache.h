@@ -14,6 +14,8 @@
 #define OCEANBASE_PALF_LOG_CACHE_
 
 #include <cstdint>                                       // int64_t
+#include "share/cache/ob_kv_storecache.h"                // ObKVCache
+#include "lib/utility/ob_print_utils.h"                  // TO_STRING_KV
 
 namespace oceanbase
 {
@@ -44,7 +46,88 @@ private:
   bool is_inited_;
 };
 
+// The key of LogColdCache, a chunk is CHUNK_SIZE bytes of log in one block which begins at
+// 'chunk_lsn'. 'version' is allocated by LogStorage and changes whenever the logs on disk may
+// be rewritten, such as truncate and flashback, so that stale chunks will never be hit.
+class LogColdCacheKey : public common::ObIKVCacheKey
+{
+public:
+  LogColdCacheKey();
+  LogColdCacheKey(const uint64_t tenant_id,
+                  const int64_t palf_id,
+                  const int64_t version,
+                  const uint64_t chunk_lsn_val);
+  ~LogColdCacheKey() {}
+  bool is_valid() const;
+  virtual bool operator ==(const common::ObIKVCacheKey &other) const override;
+  virtual uint64_t get_tenant_id() const override { return tenant_id_; }
+  virtual uint64_t hash() const override;
+  virtual int64_t size() const override { return sizeof(*this); }
+  virtual int deep_copy(char *buf, const int64_t buf_len, common::ObIKVCacheKey *&key) const override;
+  TO_STRING_KV(K_(tenant_id), K_(palf_id), K_(version), K_(chunk_lsn_val));
+private:
+  uint64_t tenant_id_;
+  int64_t palf_id_;
+  int64_t version_;
+  uint64_t chunk_lsn_val_;
+};
+
+class LogColdCacheValue : public common::ObIKVCacheValue
+{
+public:
+  LogColdCacheValue() : buf_(NULL), buf_len_(0) {}
+  LogColdCacheValue(const char *buf, const int64_t buf_len) : buf_(buf), buf_len_(buf_len) {}
+  ~LogColdCacheValue() {}
+  bool is_valid() const { return NULL != buf_ && 0 < buf_len_; }
+  const char *get_buf() const { return buf_; }
+  int64_t get_buf_len() const { return buf_len_; }
+  virtual int64_t size() const override { return sizeof(*this) + buf_len_; }
+  virtual int deep_copy(char *buf, const int64_t buf_len, common::ObIKVCacheValue *&value) const override;
+  TO_STRING_KV(KP_(buf), K_(buf_len));
+private:
+  const char *buf_;
+  int64_t buf_len_;
+};
+
+// Shared cache of logs read from disk, it serves the readers which lag behind LogHotCache,
+// such as CDC, archive and lagging followers. Logs are cached by chunk, and several
+// subsequent chunks are read ahead in one io when missing, because these readers almost
+// always read logs sequentially.
+class LogColdCache : public common::ObKVCache<LogColdCacheKey, LogColdCacheValue>
+{
+public:
+  static LogColdCache &get_instance();
+  // Each LogStorage allocates a version which is unique in the process.
+  static int64_t alloc_version();
+  LogColdCache();
+  ~LogColdCache() {}
+  int init(const char *cache_name, const int64_t priority);
+  void destroy();
+  bool is_inited() const { return is_inited_; }
+  // @retval
+  //   OB_SUCCESS
+  //   OB_ENTRY_NOT_EXIST
+  int get_chunk(const LogColdCacheKey &key,
+                const LogColdCacheValue *&value,
+                common::ObKVCacheHandle &handle);
+  int put_chunk(const LogColdCacheKey &key, const char *buf, const int64_t buf_len);
+  void stat(const bool is_hit, const int64_t read_size);
+public:
+  static constexpr int64_t CHUNK_SIZE = 64 * 1024;
+  static constexpr int64_t READ_AHEAD_CHUNK_CNT = 8;
+private:
+  static int64_t global_version_;
+  int64_t read_size_;
+  int64_t hit_count_;
+  int64_t read_count_;
+  int64_t last_print_time_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(LogColdCache);
+};
+
 } // end namespace palf
 } // end namespace oceanbase
 
+#define OB_LOG_COLD_CACHE oceanbase::palf::LogColdCache::get_instance()
+
 #endif // OCEANBASE_LOGSERVICE_LOG_CACHE_
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "log_compression.h"
+#include "lib/allocator/ob_malloc.h"            // ob_malloc
+#include "lib/compress/ob_compressor_pool.h"    // ObCompressorPool
+#include "lib/ob_errno.h"                       // errno
+#include "share/rc/ob_tenant_base.h"            // MTL_ID
+#include "log_define.h"                         // MAX_LOG_BODY_SIZE
+#include "log_entry.h"                          // LogEntry
+
+namespace oceanbase
+{
+using namespace common;
+namespace palf
+{
+
+void LogCompressionBuf::destroy()
+{
+  if (NULL != buf_) {
+    ob_free(buf_);
+    buf_ = NULL;
+  }
+  buf_len_ = 0;
+  tenant_id_ = OB_INVALID_TENANT_ID;
+}
+
+int LogCompressionBuf::reserve(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t tenant_id = is_valid_tenant_id(MTL_ID()) ? MTL_ID() : OB_SERVER_TENANT_ID;
+  if (size <= 0) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(size));
+  } else if (size <= buf_len_ && tenant_id == tenant_id_) {
+    // buf is large enough
+  } else {
+    char *new_buf = NULL;
+    if (OB_ISNULL(new_buf = static_cast<char *>(ob_malloc(size, ObMemAttr(tenant_id, "LogCompression"))))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      PALF_LOG(WARN, "allocate memory failed", K(ret), K(size), K(tenant_id));
+    } else {
+      destroy();
+      buf_ = new_buf;
+      buf_len_ = size;
+      tenant_id_ = tenant_id;
+    }
+  }
+  return ret;
+}
+
+void LogCompressionBuf::shrink(const int64_t max_len)
+{
+  if (buf_len_ > max_len) {
+    destroy();
+  }
+}
+
+int LogCompression::compress(const ObCompressorType compressor_type,
+                             const char *log_data,
+                             const int64_t data_len,
+                             LogCompressionBuf &buf,
+                             int64_t &compressed_len,
+                             bool &is_compressed)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  int64_t max_overflow_size = 0;
+  int64_t pos = 0;
+  is_compressed = false;
+  compressed_len = 0;
+  if (NULL == log_data || data_len <= 0 || data_len > MAX_LOG_BODY_SIZE) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(log_data), K(data_len));
+  } else if (data_len < MIN_COMPRESS_DATA_LEN
+             || NONE_COMPRESSOR == compressor_type
+             || INVALID_COMPRESSOR == compressor_type) {
+    // no need compress
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(data_len, max_overflow_size))) {
+    PALF_LOG(WARN, "get_max_overflow_size failed", K(ret), K(compressor_type), K(data_len));
+  } else if (OB_FAIL(buf.reserve(HEADER_SIZE + data_len + max_overflow_size))) {
+    PALF_LOG(WARN, "reserve buf failed", K(ret), K(data_len), K(max_overflow_size));
+  } else if (OB_FAIL(serialization::encode_i16(buf.get_buf(), HEADER_SIZE, pos, MAGIC))
+             || OB_FAIL(serialization::encode_i16(buf.get_buf(), HEADER_SIZE, pos, static_cast<int16_t>(compressor_type)))
+             || OB_FAIL(serialization::encode_i32(buf.get_buf(), HEADER_SIZE, pos, static_cast<int32_t>(data_len)))) {
+    PALF_LOG(WARN, "encode compressed header failed", K(ret), K(pos));
+  } else if (OB_FAIL(compressor->compress(log_data, data_len, buf.get_buf() + HEADER_SIZE,
+                                          buf.get_buf_len() - HEADER_SIZE, compressed_len))) {
+    PALF_LOG(WARN, "compress failed", K(ret), K(compressor_type), K(data_len), K(buf));
+  } else if (HEADER_SIZE + compressed_len >= data_len) {
+    // compressing is not worthwhile
+    compressed_len = 0;
+  } else {
+    compressed_len += HEADER_SIZE;
+    is_compressed = true;
+  }
+  return ret;
+}
+
+int LogCompression::decompress(LogEntry &entry, LogCompressionBuf &buf)
+{
+  int ret = OB_SUCCESS;
+  const LogEntryHeader &header = entry.get_header();
+  const int64_t header_len = LogEntryHeader::HEADER_SER_SIZE;
+  int64_t data_len = 0;
+  int64_t real_data_len = 0;
+  int64_t pos = 0;
+  LogEntryHeader new_header;
+  if (!header.is_compressed()) {
+    // no need decompress
+  } else if (OB_FAIL(get_data_len(entry.get_data_buf(), entry.get_data_len(), data_len))) {
+    PALF_LOG(WARN, "get_data_len failed", K(ret), K(entry));
+  } else if (OB_FAIL(buf.reserve(header_len + data_len))) {
+    PALF_LOG(WARN, "reserve buf failed", K(ret), K(entry), K(data_len));
+  } else if (OB_FAIL(decompress(entry.get_data_buf(), entry.get_data_len(), buf.get_buf() + header_len,
+                                data_len, real_data_len))) {
+    PALF_LOG(WARN, "decompress failed", K(ret), K(entry), K(data_len));
+  } else if (OB_FAIL(new_header.generate_header(buf.get_buf() + header_len, real_data_len, header.get_scn()))) {
+    PALF_LOG(WARN, "generate_header failed", K(ret), K(entry), K(real_data_len));
+  } else if (OB_FAIL(new_header.serialize(buf.get_buf(), header_len, pos))) {
+    PALF_LOG(WARN, "serialize LogEntryHeader failed", K(ret), K(new_header));
+  } else if (FALSE_IT(pos = 0)) {
+  } else if (OB_FAIL(entry.deserialize(buf.get_buf(), header_len + real_data_len, pos))) {
+    PALF_LOG(WARN, "deserialize LogEntry failed", K(ret), K(new_header), K(real_data_len));
+  } else {
+    PALF_LOG(TRACE, "decompress LogEntry success", K(entry), K(real_data_len));
+  }
+  return ret;
+}
+
+int LogCompression::decompress(const char *compressed_data,
+                               const int64_t compressed_len,
+                               char *buf,
+                               const int64_t buf_len,
+                               int64_t &data_len)
+{
+  int ret = OB_SUCCESS;
+  ObCompressorType compressor_type = INVALID_COMPRESSOR;
+  ObCompressor *compressor = NULL;
+  int64_t expected_data_len = 0;
+  data_len = 0;
+  if (NULL == buf || buf_len <= 0) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(buf), K(buf_len));
+  } else if (OB_FAIL(parse_header_(compressed_data, compressed_len, compressor_type, expected_data_len))) {
+    PALF_LOG(WARN, "parse_header_ failed", K(ret), K(compressed_len));
+  } else if (buf_len < expected_data_len) {
+    ret = OB_BUF_NOT_ENOUGH;
+    PALF_LOG(WARN, "buf not enough", K(ret), K(buf_len), K(expected_data_len));
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    PALF_LOG(WARN, "get_compressor failed", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->decompress(compressed_data + HEADER_SIZE, compressed_len - HEADER_SIZE,
+                                            buf, buf_len, data_len))) {
+    PALF_LOG(WARN, "decompress failed", K(ret), K(compressor_type), K(compressed_len), K(buf_len));
+  } else if (expected_data_len != data_len) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(WARN, "decompressed data len mismatch", K(ret), K(expected_data_len), K(data_len));
+  }
+  return ret;
+}
+
+int LogCompression::get_data_len(const char *compressed_data,
+                                 const int64_t compressed_len,
+                                 int64_t &data_len)
+{
+  ObCompressorType unused_compressor_type = INVALID_COMPRESSOR;
+  return parse_header_(compressed_data, compressed_len, unused_compressor_type, data_len);
+}
+
+int LogCompression::parse_header_(const char *compressed_data,
+                                  const int64_t compressed_len,
+                                  ObCompressorType &compressor_type,
+                                  int64_t &data_len)
+{
+  int ret = OB_SUCCESS;
+  int16_t magic = 0;
+  int16_t type = 0;
+  int32_t len = 0;
+  int64_t pos = 0;
+  if (NULL == compressed_data || compressed_len <= HEADER_SIZE) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), KP(compressed_data), K(compressed_len));
+  } else if (OB_FAIL(serialization::decode_i16(compressed_data, HEADER_SIZE, pos, &magic))
+             || OB_FAIL(serialization::decode_i16(compressed_data, HEADER_SIZE, pos, &type))
+             || OB_FAIL(serialization::decode_i32(compressed_data, HEADER_SIZE, pos, &len))) {
+    PALF_LOG(WARN, "decode compressed header failed", K(ret), K(pos));
+  } else if (MAGIC != magic || type <= NONE_COMPRESSOR || type >= MAX_COMPRESSOR
+             || len <= 0 || len > MAX_LOG_BODY_SIZE) {
+    ret = OB_INVALID_DATA;
+    PALF_LOG(WARN, "invalid compressed header", K(ret), K(magic), K(type), K(len));
+  } else {
+    compressor_type = static_cast<ObCompressorType>(type);
+    data_len = len;
+  }
+  return ret;
+}
+
+} // end namespace palf
+} // end namespace oceanbase
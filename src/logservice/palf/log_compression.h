@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_COMPRESSION_
+#define OCEANBASE_LOGSERVICE_LOG_COMPRESSION_
+
+#include "lib/ob_define.h"
+#include "lib/compress/ob_compress_util.h"      // ObCompressorType
+#include "lib/utility/ob_print_utils.h"         // TO_STRING_KV
+#include "lib/utility/ob_macro_utils.h"         // DISALLOW_COPY_AND_ASSIGN
+
+namespace oceanbase
+{
+namespace palf
+{
+class LogEntry;
+
+// The buffer used to compress or decompress log, it's reused until destroy.
+// The memory is charged to the tenant of current thread, and is reallocated when the buffer is
+// reused by another tenant.
+class LogCompressionBuf
+{
+public:
+  LogCompressionBuf() : buf_(NULL), buf_len_(0), tenant_id_(OB_INVALID_TENANT_ID) {}
+  ~LogCompressionBuf() { destroy(); }
+  void destroy();
+  int reserve(const int64_t size);
+  // free buf if it's larger than max_len, a long-lived buf should not hold memory of large logs
+  void shrink(const int64_t max_len);
+  char *get_buf() { return buf_; }
+  int64_t get_buf_len() const { return buf_len_; }
+  TO_STRING_KV(KP_(buf), K_(buf_len), K_(tenant_id));
+private:
+  char *buf_;
+  int64_t buf_len_;
+  uint64_t tenant_id_;
+  DISALLOW_COPY_AND_ASSIGN(LogCompressionBuf);
+};
+
+// The data of compressed LogEntry, the format is:
+// | magic(2B) | compressor type(2B) | original data len(4B) | compressed data |
+//
+// A LogEntry is compressed once by leader before allocating lsn, the compressed data is stored
+// on disk, sent to followers and archived as is, and the data checksum of LogEntryHeader is
+// calculated on compressed data. PalfIterator decompresses LogEntry when it's accessed, so the
+// consumers, such as replay and CDC, always see the original data.
+class LogCompression
+{
+public:
+  // @brief compress log data
+  // @param[out] is_compressed, false if compressing is not worthwhile, buf is not filled then.
+  static int compress(const common::ObCompressorType compressor_type,
+                      const char *log_data,
+                      const int64_t data_len,
+                      LogCompressionBuf &buf,
+                      int64_t &compressed_len,
+                      bool &is_compressed);
+  // @brief decompress data of entry and reset entry to the decompressed LogEntry, which is
+  // located in buf. Do nothing if entry is not compressed.
+  static int decompress(LogEntry &entry, LogCompressionBuf &buf);
+  static int decompress(const char *compressed_data,
+                        const int64_t compressed_len,
+                        char *buf,
+                        const int64_t buf_len,
+                        int64_t &data_len);
+  static int get_data_len(const char *compressed_data,
+                          const int64_t compressed_len,
+                          int64_t &data_len);
+public:
+  static constexpr int16_t MAGIC = 0x4C43;  // 'LC' means LOG COMPRESSED
+  static constexpr int64_t HEADER_SIZE = 8;
+  // log smaller than this is not compressed
+  static constexpr int64_t MIN_COMPRESS_DATA_LEN = 1024;
+  // the compression buf reused by submitting threads is kept if it's not larger than this
+  static constexpr int64_t MAX_CACHED_BUF_LEN = 256 * 1024;
+private:
+  static int parse_header_(const char *compressed_data,
+                           const int64_t compressed_len,
+                           common::ObCompressorType &compressor_type,
+                           int64_t &data_len);
+};
+
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif // OCEANBASE_LOGSERVICE_LOG_COMPRESSION_
@@ -88,6 +88,14 @@ void LogEntryHeader::update_header_checksum_()
 int LogEntryHeader::generate_header(const char *log_data,
                                     const int64_t data_len,
                                     const SCN &scn)
+{
+  return generate_header(log_data, data_len, scn, false);
+}
+
+int LogEntryHeader::generate_header(const char *log_data,
+                                    const int64_t data_len,
+                                    const SCN &scn,
+                                    const bool is_compressed)
 {
   int ret = OB_SUCCESS;
   if (NULL == log_data || data_len <= 0 || !scn.is_valid()) {
@@ -98,6 +106,9 @@ int LogEntryHeader::generate_header(const char *log_data,
     log_size_ = data_len;
     scn_ = scn;
     data_checksum_ = common::ob_crc64(log_data, data_len);
+    if (is_compressed) {
+      flag_ = (flag_ | LogEntryHeader::COMPRESSED_MASK);
+    }
     // update header checksum after all member vars assigned
     (void) update_header_checksum_();
     PALF_LOG(TRACE, "generate_header", KPC(this));
@@ -30,6 +30,11 @@ public:
   int generate_header(const char *log_data,
                       const int64_t data_len,
                       const share::SCN &scn);
+  // @param[in]: is_compressed, whether log_data is a compressed payload, see log_compression.h
+  int generate_header(const char *log_data,
+                      const int64_t data_len,
+                      const share::SCN &scn,
+                      const bool is_compressed);
   LogEntryHeader& operator=(const LogEntryHeader &header);
   void reset();
   bool is_valid() const;
@@ -38,6 +43,7 @@ public:
   const share::SCN get_scn() const { return scn_; }
   int64_t get_data_checksum() const { return data_checksum_; }
   bool check_header_integrity() const;
+  bool is_compressed() const { return (flag_ & COMPRESSED_MASK) > 0; }
 
   // @brief: generate padding log entry
   // @param[in]: padding_data_len, the data len of padding entry(the group_size_ in LogGroupEntry
@@ -74,6 +80,7 @@ private:
 private:
   static constexpr int16_t LOG_ENTRY_HEADER_VERSION = 1;
   static constexpr int64_t PADDING_TYPE_MASK = 1 << 1;
+  static constexpr int64_t COMPRESSED_MASK = 1 << 2;
 private:
   int16_t magic_;
   int16_t version_;
@@ -81,6 +88,8 @@ private:
   share::SCN scn_;
   int64_t data_checksum_;
   // The lowest bit is used for parity check.
+  // The second bit from last is used for padding type flag.
+  // The third bit from last is used for checking whether the log data is compressed.
   int64_t flag_;
 };
 }
@@ -26,7 +26,6 @@ LogIOWorkerWrapper::LogIOWorkerWrapper()
       log_writer_parallelism_(-1),
       log_io_workers_(NULL),
       throttle_(),
-      round_robin_idx_(-1),
       is_inited_(false) {}
 
 
@@ -38,7 +37,6 @@ LogIOWorkerWrapper::~LogIOWorkerWrapper()
 void LogIOWorkerWrapper::destroy()
 {
   is_inited_ = false;
-  round_robin_idx_ = -1;
   throttle_.reset();
   destory_and_free_log_io_workers_();
   // reset after destory_and_free_log_io_workers_
@@ -67,7 +65,6 @@ int LogIOWorkerWrapper::init(const LogIOWorkerConfig &config,
     is_user_tenant_ = is_user_tenant(tenant_id);
     log_writer_parallelism_ = config.io_worker_num_;
     throttle_.reset();
-    round_robin_idx_ = 0;
     is_inited_ = true;
     LOG_INFO("success to init LogIOWorkerWrapper", K(config), K(tenant_id), KPC(this));
   }
@@ -229,7 +226,9 @@ int64_t LogIOWorkerWrapper::palf_id_to_index_(const int64_t palf_id)
       OB_ASSERT(false);
     }
     // NB: SYS_LOG_IO_WORKER_INDEX is 0, others should not use this LogIOWorker.
-    index = (round_robin_idx_++ % hash_factor) + 1;
+    // palf_ids of user log streams are allocated in sequence, modulo spreads them evenly and keeps
+    // the mapping stable no matter in which order log streams are created or loaded.
+    index = (palf_id % hash_factor) + 1;
     PALF_LOG(INFO, "palf_id_to_index_ success", KPC(this), K(palf_id), K(index));
     OB_ASSERT(index < log_writer_parallelism_);
   }
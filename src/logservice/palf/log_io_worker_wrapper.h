@@ -34,12 +34,12 @@ public:
   int start();
   void stop();
   void wait();
-  // NB: nowdays, this interface can only be called when create_palf_handle_impl!!! otherwise, round_robin_idx_
-  // will not be correct.
+  // Log streams are sharded to LogIOWorkers by palf_id, so a log stream is always served by the same
+  // LogIOWorker, and logs of it are batched and flushed in order by that worker.
   LogIOWorker *get_log_io_worker(const int64_t palf_id);
   int notify_need_writing_throttling(const bool &need_throtting);
   int64_t get_last_working_time() const;
-  TO_STRING_KV(K_(is_inited), K_(is_user_tenant), K_(log_writer_parallelism), KP(log_io_workers_), K_(round_robin_idx));
+  TO_STRING_KV(K_(is_inited), K_(is_user_tenant), K_(log_writer_parallelism), KP(log_io_workers_));
 
 private:
   int create_and_init_log_io_workers_(const LogIOWorkerConfig &config,
@@ -61,7 +61,6 @@ private:
   // The layout of LogIOWorker: | sys log ioworker | others |
   LogIOWorker *log_io_workers_;
   LogWritingThrottle throttle_;
-  int64_t round_robin_idx_;
   bool is_inited_;
 };
 
@@ -237,9 +237,11 @@ public:
   virtual int get_lagged_member_list(const LSN &dst_lsn, ObMemberList &lagged_list);
   virtual bool is_all_committed_log_slided_out(LSN &prev_lsn, int64_t &prev_log_id, LSN &committed_end_lsn) const;
   // ================= log sync part begin
+  // @param[in] is_compressed, whether buf is compressed by LogCompression
   virtual int submit_log(const char *buf,
                  const int64_t buf_len,
                  const share::SCN &ref_scn,
+                 const bool is_compressed,
                  LSN &lsn,
                  share::SCN &scn);
   virtual int submit_group_log(const LSN &lsn,
@@ -396,6 +398,7 @@ private:
                               const LogType &log_type,
                               const char *log_data,
                               const int64_t data_len,
+                              const bool is_compressed,
                               bool &is_need_handle);
   int append_to_group_log_(const LSN &lsn,
                            const int64_t log_id,
@@ -403,6 +406,7 @@ private:
                            const int64_t log_entry_size,
                            const char *log_data,
                            const int64_t data_len,
+                           const bool is_compressed,
                            bool &is_need_handle);
   int handle_next_submit_log_(bool &is_committed_lsn_updated);
   int handle_committed_log_();
@@ -15,6 +15,7 @@
 #include "lib/ob_errno.h"            // OB_INVALID_ARGUMENT
 #include "log_reader_utils.h"        // ReadBuf
 #include "palf_handle_impl.h"        // LogHotCache
+#include "log_cache.h"               // LogColdCache
 #include "share/scn.h"
 
 namespace oceanbase
@@ -38,6 +39,7 @@ LogStorage::LogStorage() :
     update_manifest_cb_(),
     plugins_(NULL),
     hot_cache_(NULL),
+    cold_cache_version_(0),
     is_inited_(false)
 {}
 
@@ -69,6 +71,7 @@ int LogStorage::init(const char *base_dir, const char *sub_dir, const LSN &base_
                               hot_cache))) {
     PALF_LOG(WARN, "LogStorage do_init_ failed", K(ret), K(base_dir), K(sub_dir), K(palf_id));
   } else {
+    update_cold_cache_version_();
     PALF_LOG(INFO, "LogStorage init success", K(ret), K(base_dir), K(sub_dir),
              K(palf_id), K(base_lsn));
   }
@@ -103,6 +106,7 @@ int LogStorage::load_manifest_for_meta_storage(block_id_t &expected_next_block_i
 void LogStorage::destroy()
 {
   is_inited_ = false;
+  ATOMIC_STORE(&cold_cache_version_, 0);
   logical_block_size_ = 0;
   palf_id_ = INVALID_PALF_ID;
   need_append_block_header_ = false;
@@ -272,6 +276,8 @@ int LogStorage::pread(const LSN &read_lsn, const int64_t in_read_size, ReadBuf &
       && OB_SUCCESS == (hot_cache_->read(read_lsn, in_read_size, read_buf.buf_, out_read_size))
       && out_read_size > 0) {
     // read data from hot_cache successfully
+  } else if (OB_SUCCESS == read_from_cold_cache_(read_lsn, in_read_size, read_buf, out_read_size)) {
+    // read data from cold cache successfully
   } else if (OB_FAIL(inner_pread_(read_lsn, in_read_size, need_read_with_block_header, read_buf, out_read_size))) {
     PALF_LOG(WARN, "inner_pread_ failed", K(ret), K(read_lsn), K(in_read_size), KPC(this));
   } else {
@@ -337,6 +343,7 @@ int LogStorage::inner_truncate_(const LSN &lsn)
     PALF_LOG(WARN, "block_mgr_ truncate success", K(ret), K(lsn), KPC(this));
   } else {
     reset_log_tail_for_last_block_(lsn, true);
+    update_cold_cache_version_();
     PALF_LOG(INFO, "inner_truncate_ success", K(ret), K(lsn), KPC(this));
   }
   return ret;
@@ -391,6 +398,7 @@ int LogStorage::truncate_prefix_blocks(const LSN &lsn)
              KPC(this));
 		reset_log_tail_for_last_block_(lsn, false);
     block_mgr_.reset(lsn_2_block(lsn, logical_block_size_));
+    update_cold_cache_version_();
   }
   PALF_EVENT("truncate_prefix_blocks success", palf_id_, K(ret), KPC(this),
              K(lsn), K(block_id), K(min_block_id), K(max_block_id),
@@ -419,6 +427,7 @@ int LogStorage::begin_flashback(const LSN &start_lsn_of_block)
     ObSpinLockGuard guard(tail_info_lock_);
     // In process of flashback, each block after start_lsn_of_block is still readable.
     readable_log_tail_ = origin_log_tail;
+    update_cold_cache_version_();
     PALF_EVENT("[BEGIN STORAGE FLASHBACK]", palf_id_, KPC(this), K(start_lsn_of_block));
   }
   return ret;
@@ -450,6 +459,7 @@ int LogStorage::end_flashback(const LSN &start_lsn_of_block)
   } else {
 		ObSpinLockGuard guard(tail_info_lock_);
     readable_log_tail_ = log_tail_;
+    update_cold_cache_version_();
     PALF_EVENT("[END STORAGE FLASHBACK]", palf_id_, KPC(this), K(start_lsn_of_block));
   }
   return ret;
@@ -876,6 +886,157 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   return ret;
 }
 
+// Logs are cached by chunk, a chunk is cached only when it's full and below the readable log
+// tail, the tail of logs is always read from disk. The chunk is located by its offset in
+// block, therefore, a chunk never crosses blocks.
+int LogStorage::read_from_cold_cache_(const LSN &read_lsn,
+                                      const int64_t in_read_size,
+                                      ReadBuf &read_buf,
+                                      int64_t &out_read_size)
+{
+  int ret = OB_SUCCESS;
+  // NB: load version before log tail, the version is updated after log tail is reset.
+  const int64_t version = ATOMIC_LOAD(&cold_cache_version_);
+  const LSN log_tail = get_readable_log_tail_guarded_by_lock_();
+  const block_id_t read_block_id = lsn_2_block(read_lsn, logical_block_size_);
+  const LSN curr_block_start_lsn = LSN(read_block_id * logical_block_size_);
+  const LSN curr_block_end_lsn = LSN((read_block_id + 1) * logical_block_size_);
+  const LSN max_readable_lsn = MIN(log_tail, curr_block_end_lsn);
+  const LSN read_end_lsn = MIN(max_readable_lsn, read_lsn + in_read_size);
+  const uint64_t tenant_id = MTL_ID();
+  const int64_t chunk_size = LogColdCache::CHUNK_SIZE;
+  LogColdCache &cold_cache = OB_LOG_COLD_CACHE;
+  block_id_t min_block_id = LOG_INVALID_BLOCK_ID;
+  block_id_t max_block_id = LOG_INVALID_BLOCK_ID;
+  ReadBuf load_buf;
+  LSN load_start_lsn, load_end_lsn;
+  LSN curr_lsn = read_lsn;
+  out_read_size = 0;
+  if (0 >= version || false == cold_cache.is_inited() || false == is_valid_tenant_id(tenant_id)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (read_lsn >= read_end_lsn) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_FAIL(get_block_id_range(min_block_id, max_block_id))) {
+    PALF_LOG(TRACE, "get_block_id_range failed", K(ret), K_(palf_id));
+  } else if (read_block_id < min_block_id) {
+    // the block has been recycled, read from disk to return OB_ERR_OUT_OF_LOWER_BOUND.
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    while (OB_SUCC(ret) && curr_lsn < read_end_lsn) {
+      const LSN chunk_lsn = curr_block_start_lsn
+          + lower_align(lsn_2_offset(curr_lsn, logical_block_size_), chunk_size);
+      const LSN chunk_end_lsn = MIN(chunk_lsn + chunk_size, curr_block_end_lsn);
+      const LogColdCacheKey key(tenant_id, palf_id_, version, chunk_lsn.val_);
+      const LogColdCacheValue *value = NULL;
+      ObKVCacheHandle handle;
+      const char *src_buf = NULL;
+      int64_t copy_size = 0;
+      bool is_hit = true;
+      if (chunk_end_lsn > max_readable_lsn) {
+        // the last chunk is not full, read it from disk
+        break;
+      } else if (load_buf.is_valid() && curr_lsn >= load_start_lsn && curr_lsn < load_end_lsn) {
+        // the chunk has been read ahead
+        src_buf = load_buf.buf_ + (curr_lsn - load_start_lsn);
+        copy_size = MIN(read_end_lsn, chunk_end_lsn) - curr_lsn;
+      } else if (OB_SUCC(cold_cache.get_chunk(key, value, handle))) {
+        src_buf = value->get_buf() + (curr_lsn - chunk_lsn);
+        copy_size = MIN(read_end_lsn, chunk_end_lsn) - curr_lsn;
+      } else if (OB_ENTRY_NOT_EXIST != ret) {
+        PALF_LOG(WARN, "get chunk from LogColdCache failed", K(ret), K(key));
+      } else if (FALSE_IT(free_read_buf(load_buf))) {
+      } else if (OB_FAIL(load_cold_cache_chunks_(chunk_lsn, max_readable_lsn, version, load_buf,
+              load_end_lsn))) {
+        PALF_LOG(WARN, "load_cold_cache_chunks_ failed", K(ret), K(chunk_lsn), K(max_readable_lsn),
+            K_(palf_id));
+      } else {
+        // only the chunk missed is counted as miss, the chunks read ahead are copied as hits
+        load_start_lsn = chunk_lsn;
+        src_buf = load_buf.buf_ + (curr_lsn - load_start_lsn);
+        copy_size = MIN(read_end_lsn, chunk_end_lsn) - curr_lsn;
+        is_hit = false;
+      }
+      if (OB_SUCC(ret)) {
+        cold_cache.stat(is_hit, copy_size);
+        MEMCPY(read_buf.buf_ + out_read_size, src_buf, copy_size);
+        out_read_size += copy_size;
+        curr_lsn = curr_lsn + copy_size;
+      }
+    }
+    if (version != ATOMIC_LOAD(&cold_cache_version_)) {
+      // logs are truncated or rebuilt while copying, the bytes copied may be stale
+      out_read_size = 0;
+    }
+    // the rest of logs will be read from disk by caller.
+    ret = (0 < out_read_size ? OB_SUCCESS : OB_ENTRY_NOT_EXIST);
+  }
+  free_read_buf(load_buf);
+  PALF_LOG(TRACE, "read_from_cold_cache_ finished", K(ret), K_(palf_id), K(read_lsn), K(in_read_size),
+      K(out_read_size), K(version), K(log_tail));
+  return ret;
+}
+
+// Read subsequent full chunks from disk in one io and put them into LogColdCache.
+int LogStorage::load_cold_cache_chunks_(const LSN &chunk_lsn,
+                                        const LSN &max_readable_lsn,
+                                        const int64_t version,
+                                        ReadBuf &load_buf,
+                                        LSN &load_end_lsn)
+{
+  int ret = OB_SUCCESS;
+  const int64_t chunk_size = LogColdCache::CHUNK_SIZE;
+  const block_id_t block_id = lsn_2_block(chunk_lsn, logical_block_size_);
+  const LSN curr_block_end_lsn = LSN((block_id + 1) * logical_block_size_);
+  const uint64_t tenant_id = MTL_ID();
+  int64_t load_size = 0;
+  int64_t out_read_size = 0;
+  load_end_lsn = chunk_lsn;
+  for (int64_t i = 0; i < LogColdCache::READ_AHEAD_CHUNK_CNT; i++) {
+    const LSN chunk_end_lsn = MIN(load_end_lsn + chunk_size, curr_block_end_lsn);
+    if (chunk_end_lsn > max_readable_lsn || load_end_lsn >= curr_block_end_lsn) {
+      break;
+    } else {
+      load_end_lsn = chunk_end_lsn;
+    }
+  }
+  load_size = load_end_lsn - chunk_lsn;
+  if (0 >= load_size) {
+    ret = OB_ERR_UNEXPECTED;
+    PALF_LOG(ERROR, "no full chunk can be loaded", K(ret), K(chunk_lsn), K(max_readable_lsn));
+  } else if (OB_FAIL(alloc_read_buf("LogColdCache", load_size, load_buf))) {
+    PALF_LOG(WARN, "alloc_read_buf failed", K(ret), K(load_size));
+  } else if (OB_FAIL(log_reader_.pread(block_id, get_phy_offset_(chunk_lsn), load_size,
+          load_buf, out_read_size))) {
+    PALF_LOG(WARN, "LogReader pread failed", K(ret), K(block_id), K(chunk_lsn), K(load_size));
+  } else if (out_read_size != load_size) {
+    ret = OB_ERR_UNEXPECTED;
+    PALF_LOG(WARN, "read size is not as expected", K(ret), K(chunk_lsn), K(load_size),
+        K(out_read_size));
+  } else {
+    for (LSN lsn = chunk_lsn; lsn < load_end_lsn; lsn = lsn + chunk_size) {
+      const LogColdCacheKey key(tenant_id, palf_id_, version, lsn.val_);
+      const int64_t size = MIN(lsn + chunk_size, load_end_lsn) - lsn;
+      int tmp_ret = OB_SUCCESS;
+      // NB: failing to put into cache has no effect on reading.
+      if (OB_SUCCESS != (tmp_ret = OB_LOG_COLD_CACHE.put_chunk(key, load_buf.buf_ + (lsn - chunk_lsn), size))) {
+        PALF_LOG(TRACE, "put_chunk failed", K(tmp_ret), K(key));
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    free_read_buf(load_buf);
+  }
+  return ret;
+}
+
+void LogStorage::update_cold_cache_version_()
+{
+  // NB: only logs of data storage are cached.
+  if (NULL != hot_cache_) {
+    ATOMIC_STORE(&cold_cache_version_, LogColdCache::alloc_version());
+  }
+}
+
 void LogStorage::reset_log_tail_for_last_block_(const LSN &lsn, bool last_block_exist)
 {
   ObSpinLockGuard guard(tail_info_lock_);
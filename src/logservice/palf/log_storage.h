@@ -176,6 +176,19 @@ private:
                    const bool need_read_block_header,
                    ReadBuf &read_buf,
                    int64_t &out_read_size);
+  // @retval
+  //   OB_SUCCESS
+  //   OB_ENTRY_NOT_EXIST, nothing has been read from LogColdCache, need read from disk.
+  int read_from_cold_cache_(const LSN &read_lsn,
+                            const int64_t in_read_size,
+                            ReadBuf &read_buf,
+                            int64_t &out_read_size);
+  int load_cold_cache_chunks_(const LSN &chunk_lsn,
+                              const LSN &max_readable_lsn,
+                              const int64_t version,
+                              ReadBuf &load_buf,
+                              LSN &load_end_lsn);
+  void update_cold_cache_version_();
   void reset_log_tail_for_last_block_(const LSN &lsn, bool last_block_exist);
   int update_manifest_(const block_id_t expected_next_block_id, const bool in_restart = false);
 private:
@@ -199,6 +212,8 @@ private:
   LogPlugins *plugins_;
   char block_header_serialize_buf_[MAX_INFO_BLOCK_SIZE];
   LogHotCache *hot_cache_;
+  // version of logs in LogColdCache, 0 means LogColdCache is disabled.
+  int64_t cold_cache_version_;
   bool is_inited_;
 };
 
@@ -259,6 +274,10 @@ int LogStorage::load(const char *base_dir,
       PALF_LOG(WARN, "load_last_block_ failed", KR(ret), KPC(this), K(entry_header), K(lsn));
     } else {
     }
+    if (OB_SUCC(ret)) {
+      // NB: the log tail is unknown before loading, enable LogColdCache after that.
+      update_cold_cache_version_();
+    }
     PALF_LOG(INFO, "LogStorage load finish", KR(ret), KPC(this), K(min_block_id), K(max_block_id));
   }
   return ret;
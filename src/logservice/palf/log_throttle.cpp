@@ -35,6 +35,7 @@ void LogThrottlingStat::reset()
 void LogWritingThrottle::reset()
 {
   last_update_ts_ = OB_INVALID_TIMESTAMP;
+  next_throttling_ts_ = OB_INVALID_TIMESTAMP;
   need_writing_throttling_notified_ = false;
   appended_log_size_cur_round_ = 0;
   decay_factor_ = 0;
@@ -82,7 +83,13 @@ int LogWritingThrottle::throttling(const int64_t throttling_size,
                                                              cur_unrecyclable_size, decay_factor_, time_interval))) {
         LOG_WARN("failed to get_throttling_interval", KPC(this));
       }
-      int64_t remain_interval_us = time_interval;
+      // reserve the interval after those reserved by other log io workers, otherwise concurrent
+      // workers sleep at the same time and the total writing speed grows with the worker count.
+      const int64_t cur_ts = ObClockGenerator::getClock();
+      const int64_t start_ts = MAX(cur_ts, next_throttling_ts_);
+      next_throttling_ts_ = start_ts + time_interval;
+      int64_t remain_interval_us = next_throttling_ts_ - cur_ts;
+      const int64_t total_interval_us = remain_interval_us;
       bool has_freed_up_space = false;
       // release lock_ in progress of usleep, therefore, accessing shared members in LogWritingThrottle need be guarded by lock
       // in following code block.
@@ -103,7 +110,7 @@ int LogWritingThrottle::throttling(const int64_t throttling_size,
       }
       // hold lock_ after ulseep, therefore, accessing shared members in LogWritingThrottle no need be guarded by lock.
       lock_.lock();
-      stat_.after_throttling(time_interval - remain_interval_us, throttling_size);
+      stat_.after_throttling(total_interval_us - remain_interval_us, throttling_size);
     } else if (need_throttling_with_options_not_guarded_by_lock_()) {
       stat_.after_throttling(0, throttling_size);
     }
@@ -175,6 +182,7 @@ int LogWritingThrottle::update_throtting_options_guarded_by_lock_(IPalfEnvImpl *
           if (has_unrecyclable_space_changed || need_start_throttling) {
             // reset appended_log_size_cur_round_ when unrecyclable_disk_space_ changed
             appended_log_size_cur_round_ = 0;
+            next_throttling_ts_ = OB_INVALID_TIMESTAMP;
           }
           throttling_options_ = new_throttling_options;
           if (need_start_throttling) {
@@ -207,6 +215,7 @@ void LogWritingThrottle::clean_up_not_guarded_by_lock_()
 {
   //do not reset submitted_seq_  && handled_seq_ && last_update_ts_ && stat_
   appended_log_size_cur_round_ = 0;
+  next_throttling_ts_ = OB_INVALID_TIMESTAMP;
   decay_factor_ = 0;
   throttling_options_.reset();
 }
@@ -190,6 +190,7 @@ PalfEnvImpl::PalfEnvImpl() : palf_meta_lock_(common::ObLatchIds::PALF_ENV_LOCK),
                              palf_handle_impl_map_(64),  // 指定min_size=64
                              last_palf_epoch_(0),
                              rebuild_replica_log_lag_threshold_(0),
+                             storage_compress_options_(),
                              diskspace_enough_(true),
                              tenant_id_(0),
                              is_inited_(false),
@@ -354,6 +355,7 @@ void PalfEnvImpl::destroy()
   tmp_log_dir_[0] = '\0';
   disk_options_wrapper_.reset();
   rebuild_replica_log_lag_threshold_ = 0;
+  storage_compress_options_.reset();
 }
 
 // NB: not thread safe
@@ -897,6 +899,7 @@ int PalfEnvImpl::update_options(const PalfOptions &options)
   } else if (OB_FAIL(log_rpc_.update_transport_compress_options(options.compress_options_))) {
     PALF_LOG(WARN, "update_transport_compress_options failed", K(ret), K(options));
   } else if (FALSE_IT(rebuild_replica_log_lag_threshold_ = options.rebuild_replica_log_lag_threshold_)) {
+  } else if (FALSE_IT(storage_compress_options_ = options.storage_compress_options_)) {
   } else if (OB_FAIL(check_can_update_log_disk_options_(options.disk_options_))) {
     PALF_LOG(WARN, "check_can_update_log_disk_options_ failed", K(options));
   } else if (OB_FAIL(disk_options_wrapper_.update_disk_options(options.disk_options_))) {
@@ -915,6 +918,7 @@ int PalfEnvImpl::get_options(PalfOptions &options)
   } else {
     options.disk_options_ = disk_options_wrapper_.get_disk_opts_for_recycling_blocks();
     options.compress_options_ = log_rpc_.get_compress_opts();
+    options.storage_compress_options_ = storage_compress_options_;
     options.rebuild_replica_log_lag_threshold_ = rebuild_replica_log_lag_threshold_;
   }
   return ret;
@@ -197,6 +197,7 @@ public:
   // should be removed in version 4.2.0.0
   virtual int update_replayable_point(const SCN &replayable_scn) = 0;
   virtual int get_throttling_options(PalfThrottleOptions &option) = 0;
+  virtual const PalfStorageCompressOptions &get_storage_compress_options() const = 0;
   VIRTUAL_TO_STRING_KV("IPalfEnvImpl", "Dummy");
 
 };
@@ -266,6 +267,8 @@ public:
   int64_t get_tenant_id() override final;
   int update_replayable_point(const SCN &replayable_scn) override final;
   int get_throttling_options(PalfThrottleOptions &option);
+  const PalfStorageCompressOptions &get_storage_compress_options() const override final
+  {return storage_compress_options_;}
   INHERIT_TO_STRING_KV("IPalfEnvImpl", IPalfEnvImpl, K_(self), K_(log_dir), K_(disk_options_wrapper),
       KPC(log_alloc_mgr_));
   // =================== disk space management ==================
@@ -377,6 +380,7 @@ private:
   // last_palf_epoch_ is used to assign increasing epoch for each palf instance.
   int64_t last_palf_epoch_;
   int64_t rebuild_replica_log_lag_threshold_;//for rebuild test
+  PalfStorageCompressOptions storage_compress_options_;
 
   LogIOWorkerConfig log_io_worker_config_;
   bool diskspace_enough_;
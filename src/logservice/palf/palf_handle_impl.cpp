@@ -25,6 +25,7 @@
 #include "election/interface/election_priority.h"
 #include "palf_iterator.h"                             // Iterator
 #include "palf_env_impl.h"                             // IPalfEnvImpl::
+#include "log_compression.h"                           // LogCompression
 
 namespace oceanbase
 {
@@ -387,6 +388,26 @@ int PalfHandleImpl::submit_log(
     ret = OB_INVALID_ARGUMENT;
     PALF_LOG(WARN, "invalid argument", K_(palf_id), KP(buf), K(buf_len), K(ref_scn));
   } else {
+    // compress log before allocating lsn, the size of log in group buffer is fixed then.
+    // the compressed log is copied into group buffer by sw_, so the buf is reused by the thread.
+    static thread_local LogCompressionBuf compression_buf;
+    const PalfStorageCompressOptions &compress_opts = palf_env_impl_->get_storage_compress_options();
+    const char *log_buf = buf;
+    int64_t log_buf_len = buf_len;
+    bool is_compressed = false;
+    int tmp_ret = OB_SUCCESS;
+    if (compress_opts.enable_storage_compress_) {
+      int64_t compressed_len = 0;
+      if (OB_SUCCESS != (tmp_ret = LogCompression::compress(compress_opts.storage_compress_func_, buf, buf_len,
+          compression_buf, compressed_len, is_compressed))) {
+        // write the original log if compressing failed
+        PALF_LOG_RET(WARN, tmp_ret, "compress log failed", K_(palf_id), K(buf_len), K(compress_opts));
+        is_compressed = false;
+      } else if (is_compressed) {
+        log_buf = compression_buf.get_buf();
+        log_buf_len = compressed_len;
+      }
+    }
     RLockGuard guard(lock_);
     if (false == palf_env_impl_->check_disk_space_enough()) {
       ret = OB_LOG_OUTOF_DISK_SPACE;
@@ -398,17 +419,18 @@ int PalfHandleImpl::submit_log(
       PALF_LOG(WARN, "cannot submit_log", KPC(this), KP(buf), K(buf_len), "role",
           state_mgr_.get_role(), "state", state_mgr_.get_state(), "proposal_id",
           state_mgr_.get_proposal_id(), K(opts), "mode_mgr can_append", mode_mgr_.can_append());
-    } else if (OB_FAIL(sw_.submit_log(buf, buf_len, ref_scn, lsn, scn))) {
+    } else if (OB_FAIL(sw_.submit_log(log_buf, log_buf_len, ref_scn, is_compressed, lsn, scn))) {
       if (OB_EAGAIN != ret) {
-        PALF_LOG(WARN, "submit_log failed", KPC(this), KP(buf), K(buf_len));
+        PALF_LOG(WARN, "submit_log failed", KPC(this), KP(buf), K(buf_len), K(log_buf_len), K(is_compressed));
       }
     } else {
-      PALF_LOG(TRACE, "submit_log success", K(ret), KPC(this), K(buf_len), K(lsn), K(scn));
+      PALF_LOG(TRACE, "submit_log success", K(ret), KPC(this), K(buf_len), K(log_buf_len), K(lsn), K(scn));
       if (palf_reach_time_interval(PALF_STAT_PRINT_INTERVAL_US, append_size_stat_time_us_)) {
         PALF_LOG(INFO, "[PALF STAT APPEND DATA SIZE]", KPC(this), "append size", lsn.val_ - last_record_append_lsn_.val_);
         last_record_append_lsn_ = lsn;
       }
     }
+    compression_buf.shrink(LogCompression::MAX_CACHED_BUF_LEN);
   }
   return ret;
 }
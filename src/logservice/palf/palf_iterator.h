@@ -14,6 +14,7 @@
 #define OCEANBASE_LOGSERVICE_PALF_ITERATOR_
 #include "log_iterator_impl.h"           // LogIteratorImpl
 #include "log_iterator_storage.h"        // LogIteratorStorage
+#include "log_compression.h"             // LogCompression
 //#include "log_define.h"                  // PALF_INITIAL_PROPOSAL_ID
 namespace oceanbase
 {
@@ -27,7 +28,7 @@ template <class PalfIteratorStorage, class LogEntryType>
 class PalfIterator
 {
 public:
-  PalfIterator() : iterator_storage_(), iterator_impl_(), need_print_error_(true), is_inited_(false) {}
+  PalfIterator() : iterator_storage_(), iterator_impl_(), decompress_buf_(), need_print_error_(true), is_inited_(false) {}
   ~PalfIterator() {destroy();}
 
   int init(const LSN &start_offset,
@@ -81,6 +82,7 @@ public:
       is_inited_ = false;
       iterator_impl_.destroy();
       iterator_storage_.destroy();
+      decompress_buf_.destroy();
     }
   }
 
@@ -177,6 +179,8 @@ public:
       ret = OB_NOT_INIT;
     } else if (OB_FAIL(iterator_impl_.get_entry(entry, lsn, unused_is_raw_write)) && OB_ITER_END != ret) {
       PALF_LOG(WARN, "PalfIterator get_entry failed", K(ret), K(entry), K(lsn), KPC(this));
+    } else if (OB_SUCC(ret) && OB_FAIL(decompress_entry_(entry))) {
+      PALF_LOG(WARN, "PalfIterator decompress_entry_ failed", K(ret), K(entry), K(lsn), KPC(this));
     } else {
       PALF_LOG(TRACE, "PalfIterator get_entry success", K(ret), KPC(this),
           K(entry), K(lsn));
@@ -192,6 +196,8 @@ public:
       ret = OB_NOT_INIT;
     } else if (OB_FAIL(iterator_impl_.get_entry(entry, lsn, unused_is_raw_write)) && OB_ITER_END != ret) {
       PALF_LOG(WARN, "PalfIterator get_entry failed", K(ret), K(entry), K(lsn), KPC(this));
+    } else if (OB_SUCC(ret) && OB_FAIL(decompress_entry_(entry))) {
+      PALF_LOG(WARN, "PalfIterator decompress_entry_ failed", K(ret), K(entry), K(lsn), KPC(this));
     } else {
       buffer = entry.get_data_buf() - entry.get_header_size();
       PALF_LOG(TRACE, "PalfIterator get_entry success", K(ret), KPC(this), K(entry));
@@ -278,6 +284,8 @@ private:
       ret = OB_NOT_INIT;
     } else if (OB_FAIL(iterator_impl_.get_entry(entry, lsn, is_raw_write)) && OB_ITER_END != ret) {
       PALF_LOG(WARN, "PalfIterator get_entry failed", K(ret), K(entry), K(lsn), KPC(this));
+    } else if (OB_SUCC(ret) && OB_FAIL(decompress_entry_(entry))) {
+      PALF_LOG(WARN, "PalfIterator decompress_entry_ failed", K(ret), K(entry), K(lsn), KPC(this));
     } else {
       buffer = entry.get_data_buf();
       nbytes = entry.get_data_len();
@@ -307,9 +315,23 @@ private:
     return ret;
   }
 
+  // LogEntry compressed by leader is decompressed when it's accessed, so the consumers always see
+  // the original log. LogGroupEntry and LogMetaEntry are returned as is.
+  int decompress_entry_(LogEntry &entry)
+  {
+    return LogCompression::decompress(entry, decompress_buf_);
+  }
+  template <class EntryType>
+  int decompress_entry_(EntryType &entry)
+  {
+    UNUSED(entry);
+    return OB_SUCCESS;
+  }
+
 private:
   PalfIteratorStorage iterator_storage_;
   LogIteratorImpl<LogEntryType> iterator_impl_;
+  LogCompressionBuf decompress_buf_;
   bool need_print_error_;
   bool is_inited_;
 };
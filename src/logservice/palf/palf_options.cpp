@@ -24,12 +24,14 @@ void PalfOptions::reset()
 {
   disk_options_.reset();
   compress_options_.reset();
+  storage_compress_options_.reset();
   rebuild_replica_log_lag_threshold_ = 0;
 }
 
 bool PalfOptions::is_valid() const
 {
-  return disk_options_.is_valid() && compress_options_.is_valid() && (rebuild_replica_log_lag_threshold_ >= 0);
+  return disk_options_.is_valid() && compress_options_.is_valid() && storage_compress_options_.is_valid()
+    && (rebuild_replica_log_lag_threshold_ >= 0);
 }
 
 void PalfDiskOptions::reset()
@@ -109,6 +111,32 @@ PalfTransportCompressOptions &PalfTransportCompressOptions::operator=(const Palf
   return *this;
 }
 
+void PalfStorageCompressOptions::reset()
+{
+  enable_storage_compress_ = false;
+  storage_compress_func_ = ObCompressorType::INVALID_COMPRESSOR;
+}
+
+bool PalfStorageCompressOptions::is_valid() const
+{
+  return !enable_storage_compress_ || (ObCompressorType::INVALID_COMPRESSOR != storage_compress_func_);
+}
+
+// read by PalfHandleImpl without lock, the order of assigning matters
+PalfStorageCompressOptions &PalfStorageCompressOptions::operator=(const PalfStorageCompressOptions &other)
+{
+  if (!other.enable_storage_compress_) {
+    enable_storage_compress_ = other.enable_storage_compress_;
+    MEM_BARRIER();
+    storage_compress_func_ = other.storage_compress_func_;
+  } else {
+    storage_compress_func_ = other.storage_compress_func_;
+    MEM_BARRIER();
+    enable_storage_compress_ = other.enable_storage_compress_;
+  }
+  return *this;
+}
+
 static const char *access_mode_strs[] = {
   "INVALID_ACCESS_MODE",
   "APPEND",
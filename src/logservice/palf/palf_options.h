@@ -169,10 +169,30 @@ public:
                K(transport_compress_func_));
 };
 
+// Options of compressing LogEntry before writing to disk, see log_compression.h
+struct PalfStorageCompressOptions
+{
+public:
+  PalfStorageCompressOptions() :
+    enable_storage_compress_(false),
+    storage_compress_func_(ObCompressorType::INVALID_COMPRESSOR)
+  {}
+  ~PalfStorageCompressOptions() { reset(); }
+  void reset();
+  bool is_valid() const;
+  PalfStorageCompressOptions &operator=(const PalfStorageCompressOptions &other);
+public:
+  bool enable_storage_compress_;
+  ObCompressorType storage_compress_func_;
+  TO_STRING_KV(K(enable_storage_compress_),
+               K(storage_compress_func_));
+};
+
 struct PalfOptions
 {
   PalfOptions() : disk_options_(),
                   compress_options_(),
+                  storage_compress_options_(),
                   rebuild_replica_log_lag_threshold_(0)
   {}
   ~PalfOptions() { reset(); }
@@ -180,10 +200,12 @@ struct PalfOptions
   bool is_valid() const;
   TO_STRING_KV(K(disk_options_),
                K(compress_options_),
+               K(storage_compress_options_),
                K(rebuild_replica_log_lag_threshold_));
 public:
   PalfDiskOptions disk_options_;
   PalfTransportCompressOptions compress_options_;
+  PalfStorageCompressOptions storage_compress_options_;
   int64_t rebuild_replica_log_lag_threshold_;
 };
 
@@ -100,6 +100,7 @@
 #include "share/scheduler/ob_dag_warning_history_mgr.h"
 #include "share/longops_mgr/ob_longops_mgr.h"
 #include "logservice/palf/election/interface/election.h"
+#include "logservice/palf/log_cache.h"
 #include "storage/ddl/ob_ddl_redo_log_writer.h"
 #include "observer/ob_server_utils.h"
 #include "observer/table_load/ob_table_load_partition_calc.h"
@@ -348,6 +349,8 @@ int ObServer::init(const ObServerOptions &opts, const ObPLogWriterCfg &log_cfg)
       LOG_ERROR("init storage failed", KR(ret));
     } else if (OB_FAIL(init_tx_data_cache())) {
       LOG_ERROR("init tx data cache failed", KR(ret));
+    } else if (OB_FAIL(init_log_cold_cache())) {
+      LOG_ERROR("init log cold cache failed", KR(ret));
     } else if (OB_FAIL(locality_manager_.init(self_addr_,
                                               &sql_proxy_))) {
       LOG_ERROR("init locality manager failed", KR(ret));
@@ -617,6 +620,10 @@ void ObServer::destroy()
     OB_TX_DATA_KV_CACHE.destroy();
     FLOG_INFO("tx data kv cache destroyed");
 
+    FLOG_INFO("begin to destroy log cold cache");
+    OB_LOG_COLD_CACHE.destroy();
+    FLOG_INFO("log cold cache destroyed");
+
     FLOG_INFO("begin to destroy location service");
     location_service_.destroy();
     FLOG_INFO("location service destroyed");
@@ -986,6 +993,16 @@ int ObServer::start()
             "replay_log_cost_us", ObTimeUtility::current_time() - schema_refreshed_ts);
       }
     }
+
+    // warm up block cache in background, server starts without it on failure
+    if (OB_SUCC(ret) && !stop_ && OB_STORE_CACHE.get_block_cache_snapshot().is_inited()) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = OB_STORE_CACHE.get_block_cache_snapshot().start())) {
+        LOG_WARN("fail to start block cache snapshot, skip warming up", KR(tmp_ret));
+      } else {
+        FLOG_INFO("start to warm up block cache in background");
+      }
+    }
   }
 
   if (OB_FAIL(ret)) {
@@ -1145,6 +1162,10 @@ int ObServer::stop()
     TG_STOP(lib::TGDefIDs::DiskUseReport);
     FLOG_INFO("disk usage report task stopped");
 
+    FLOG_INFO("begin to stop block cache snapshot");
+    OB_STORE_CACHE.get_block_cache_snapshot().stop();
+    FLOG_INFO("block cache snapshot stopped");
+
     FLOG_INFO("begin to stop ob server block mgr");
     OB_SERVER_BLOCK_MGR.stop();
     FLOG_INFO("ob server block mgr stopped");
@@ -1534,6 +1555,10 @@ int ObServer::wait()
     tenant_srs_mgr_.wait();
     FLOG_INFO("wait tenant srs manager success");
 
+    FLOG_INFO("begin to wait block cache snapshot");
+    OB_STORE_CACHE.get_block_cache_snapshot().wait();
+    FLOG_INFO("wait block cache snapshot success");
+
     FLOG_INFO("begin to wait ob_server_block_mgr");
     OB_SERVER_BLOCK_MGR.wait();
     FLOG_INFO("wait ob_server_block_mgr success");
@@ -2572,6 +2597,15 @@ int ObServer::init_tx_data_cache()
   return ret;
 }
 
+int ObServer::init_log_cold_cache()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(OB_LOG_COLD_CACHE.init("log_cold_cache", 1 /* cache priority */))) {
+    LOG_WARN("init OB_LOG_COLD_CACHE failed", KR(ret));
+  }
+  return ret;
+}
+
 int ObServer::get_network_speed_from_sysfs(int64_t &network_speed)
 {
   int ret = OB_SUCCESS;
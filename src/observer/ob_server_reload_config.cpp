@@ -173,6 +173,7 @@ int ObServerReloadConfig::operator()()
       io_config.data_storage_io_timeout_ms_ = GCONF._data_storage_io_timeout / 1000L;
       io_config.data_storage_warning_tolerance_time_ = GCONF.data_storage_warning_tolerance_time;
       io_config.data_storage_error_tolerance_time_ = GCONF.data_storage_error_tolerance_time;
+      io_config.read_batch_merge_gap_ = GCONF._io_read_batch_merge_gap;
       if (!is_arbitration_mode
           && OB_FAIL(ObIOManager::get_instance().set_io_config(io_config))) {
         real_ret = ret;
@@ -1429,6 +1429,14 @@ int ObMultiTenant::modify_tenant_io(const uint64_t tenant_id, const ObUnitConfig
       LOG_WARN("tenant config is invalid", K(ret), K(tenant_id));
     } else {
       io_config.callback_thread_count_ = tenant_config->_io_callback_thread_count;
+      io_config.unit_config_.min_bandwidth_ = tenant_config->_io_min_bandwidth;
+      io_config.unit_config_.max_bandwidth_ = tenant_config->_io_max_bandwidth;
+      if (io_config.unit_config_.max_bandwidth_ > 0
+          && io_config.unit_config_.max_bandwidth_ < io_config.unit_config_.min_bandwidth_) {
+        LOG_WARN("max bandwidth is smaller than min bandwidth, ignore max bandwidth", K(tenant_id),
+            K(io_config.unit_config_));
+        io_config.unit_config_.max_bandwidth_ = 0;
+      }
       static const char *trace_mod_name = "io_tracer";
       io_config.enable_io_tracer_ = 0 == strncasecmp(trace_mod_name, GCONF.leak_mod_to_check.get_value(), strlen(trace_mod_name));
       if (OB_FAIL(OB_IO_MANAGER.refresh_tenant_io_config(tenant_id, io_config))) {
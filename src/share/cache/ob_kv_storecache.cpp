@@ -465,6 +465,24 @@ int ObKVGlobalCache::get(
   return ret;
 }
 
+int ObKVGlobalCache::batch_get(
+  const int64_t cache_id,
+  const ObIKVCacheKey *const *keys,
+  const int64_t count,
+  const ObIKVCacheValue **pvalues,
+  ObKVMemBlockHandle **mb_handles,
+  int64_t &hit_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else if (OB_FAIL(map_.batch_get(cache_id, keys, count, pvalues, mb_handles, hit_cnt))) {
+    COMMON_LOG(WARN, "fail to batch get values from map, ", K(ret), K(cache_id), K(count));
+  }
+  return ret;
+}
+
 int ObKVGlobalCache::erase(const int64_t cache_id, const ObIKVCacheKey &key)
 {
   int ret = OB_SUCCESS;
@@ -714,6 +732,22 @@ int ObKVGlobalCache::set_priority(const int64_t cache_id, const int64_t priority
   return ret;
 }
 
+int ObKVGlobalCache::set_evict_listener(const int64_t cache_id, ObIKVCacheEvictListener *listener)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVGlobalCache has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(cache_id < 0) || OB_UNLIKELY(cache_id >= MAX_CACHE_NUM)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(cache_id), K(ret));
+  } else {
+    lib::ObMutexGuard guard(mutex_);
+    ATOMIC_STORE(&configs_[cache_id].evict_listener_, listener);
+  }
+  return ret;
+}
+
 void ObKVGlobalCache::wash()
 {
   if (OB_LIKELY(inited_ && !stopped_)) {
@@ -61,6 +61,8 @@ public:
   int init(const char *cache_name, const int64_t priority = 1);
   void destroy();
   int set_priority(const int64_t priority);
+  // @listener is notified with kvpairs of this cache before they are washed out of memory
+  int set_evict_listener(ObIKVCacheEvictListener *listener);
   virtual int put(const Key &key, const Value &value, bool overwrite = true);
   virtual int put_and_fetch(
     const Key &key,
@@ -69,6 +71,9 @@ public:
     ObKVCacheHandle &handle,
     bool overwrite = true);
   virtual int get(const Key &key, const Value *&pvalue, ObKVCacheHandle &handle);
+  // Get values of @count keys in a batch, the buckets of keys are prefetched and protected by
+  // one hazard version. pvalues[i] is NULL and handles[i] is reset if keys[i] is not in cache.
+  int batch_get(const Key *const *keys, const int64_t count, const Value **pvalues, ObKVCacheHandle *handles);
   int get_iterator(ObKVCacheIterator &iter);
   virtual int erase(const Key &key);
   virtual int alloc(
@@ -86,6 +91,7 @@ public:
   int64_t store_size(const uint64_t tenant_id = OB_SYS_TENANT_ID) const;
   int64_t get_cache_id() const { return cache_id_; }
 private:
+  static const int64_t MAX_BATCH_GET_CNT = 64;
   bool inited_;
   int64_t cache_id_;
 };
@@ -174,6 +180,7 @@ private:
   int create_working_set(const ObKVCacheInstKey &inst_key, ObWorkingSet *&working_set);
   int delete_working_set(ObWorkingSet *working_set);
   int set_priority(const int64_t cache_id, const int64_t priority);
+  int set_evict_listener(const int64_t cache_id, ObIKVCacheEvictListener *listener);
   int put(
     const int64_t cache_id,
     const ObIKVCacheKey &key,
@@ -228,6 +235,13 @@ private:
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&mb_handle);
+  int batch_get(
+    const int64_t cache_id,
+    const ObIKVCacheKey *const *keys,
+    const int64_t count,
+    const ObIKVCacheValue **pvalues,
+    ObKVMemBlockHandle **mb_handles,
+    int64_t &hit_cnt);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
   void revert(ObKVMemBlockHandle *mb_handle);
   void wash();
@@ -358,6 +372,9 @@ public:
    */
   template <class Key, class Value>
   int get_next_kvpair(const Key *&key, const Value *&value, ObKVCacheHandle &handle);
+  // @get_cnt: out, times the kvpair is got since it is put into cache
+  template <class Key, class Value>
+  int get_next_kvpair(const Key *&key, const Value *&value, ObKVCacheHandle &handle, int64_t &get_cnt);
   void reset();
 private:
   int64_t cache_id_;
@@ -455,6 +472,19 @@ int ObKVCache<Key, Value>::set_priority(const int64_t priority)
   return ret;
 }
 
+template <class Key, class Value>
+int ObKVCache<Key, Value>::set_evict_listener(ObIKVCacheEvictListener *listener)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_FAIL(ObKVGlobalCache::get_instance().set_evict_listener(cache_id_, listener))) {
+    COMMON_LOG(WARN, "Fail to set evict listener, ", K(ret));
+  }
+  return ret;
+}
+
 template <class Key, class Value>
 int64_t ObKVCache<Key, Value>::size(const uint64_t tenant_id) const
 {
@@ -618,6 +648,58 @@ int ObKVCache<Key, Value>::get(const Key &key, const Value *&pvalue, ObKVCacheHa
   return ret;
 }
 
+template <class Key, class Value>
+int ObKVCache<Key, Value>::batch_get(
+    const Key *const *keys,
+    const int64_t count,
+    const Value **pvalues,
+    ObKVCacheHandle *handles)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCache has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(nullptr == keys || count <= 0 || nullptr == pvalues || nullptr == handles)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument, ", K(ret), KP(keys), K(count), KP(pvalues), KP(handles));
+  } else {
+    const ObIKVCacheKey *batch_keys[MAX_BATCH_GET_CNT];
+    const ObIKVCacheValue *batch_values[MAX_BATCH_GET_CNT];
+    ObKVMemBlockHandle *mb_handles[MAX_BATCH_GET_CNT];
+    for (int64_t begin = 0; OB_SUCC(ret) && begin < count; begin += MAX_BATCH_GET_CNT) {
+      const int64_t batch_cnt = MIN(count - begin, MAX_BATCH_GET_CNT);
+      int64_t hit_cnt = 0;
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        handles[begin + i].reset();
+        batch_keys[i] = keys[begin + i];
+        batch_values[i] = nullptr;
+        mb_handles[i] = nullptr;
+      }
+      if (OB_FAIL(ObKVGlobalCache::get_instance().batch_get(
+          cache_id_, batch_keys, batch_cnt, batch_values, mb_handles, hit_cnt))) {
+        COMMON_LOG(WARN, "Fail to batch get value from ObKVGlobalCache, ", K(ret), K(batch_cnt));
+      }
+      // handles of got values are held even if failed, they are released with handles
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        pvalues[begin + i] = reinterpret_cast<const Value *>(batch_values[i]);
+        handles[begin + i].mb_handle_ = mb_handles[i];
+#ifdef ENABLE_DEBUG_LOG
+        if (nullptr != mb_handles[i]) {
+          ObKVCacheHandleRefChecker::get_instance().handle_ref_inc(handles[begin + i]);
+        }
+#endif
+      }
+    }
+    if (OB_FAIL(ret)) {
+      for (int64_t i = 0; i < count; ++i) {
+        pvalues[i] = nullptr;
+        handles[i].reset();
+      }
+    }
+  }
+  return ret;
+}
+
 template <class Key, class Value>
 int ObKVCache<Key, Value>::erase(const Key &key)
 {
@@ -685,6 +767,17 @@ int ObKVCacheIterator::get_next_kvpair(
     const Key *&key,
     const Value *&value,
     ObKVCacheHandle &handle)
+{
+  int64_t get_cnt = 0;
+  return get_next_kvpair(key, value, handle, get_cnt);
+}
+
+template <class Key, class Value>
+int ObKVCacheIterator::get_next_kvpair(
+    const Key *&key,
+    const Value *&value,
+    ObKVCacheHandle &handle,
+    int64_t &get_cnt)
 {
   int ret = OB_SUCCESS;
   ObKVCacheMap::Node node;
@@ -703,6 +796,8 @@ int ObKVCacheIterator::get_next_kvpair(
         if (common::OB_ENTRY_NOT_EXIST == ret) {
           if (pos_ >= map_->bucket_num_) {
             ret = OB_ITER_END;
+          } else if (FALSE_IT(allocator_.reuse())) {
+            // nodes of handle list are all popped, reuse memory of them
           } else if (OB_FAIL(map_->multi_get(cache_id_, pos_++, handle_list_))) {
             COMMON_LOG(WARN, "Fail to multi get from map, ", K(ret));
           }
@@ -716,6 +811,7 @@ int ObKVCacheIterator::get_next_kvpair(
     handle.reset();
     key = reinterpret_cast<const Key*>(node.key_);
     value = reinterpret_cast<const Value*>(node.value_);
+    get_cnt = node.get_cnt_;
     handle.mb_handle_ = node.mb_handle_;
 #ifdef ENABLE_DEBUG_LOG
     ObKVCacheHandleRefChecker::get_instance().handle_ref_inc(handle);
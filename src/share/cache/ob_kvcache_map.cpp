@@ -132,7 +132,7 @@ void ObKVCacheMap::destroy()
 int ObKVCacheMap::put(
   ObKVCacheInst &inst,
   const ObIKVCacheKey &key,
-  const ObKVCachePair *kvpair,
+  ObKVCachePair *kvpair,
   ObKVMemBlockHandle *mb_handle,
   bool overwrite)
 {
@@ -230,6 +230,7 @@ int ObKVCacheMap::put(
           if (NULL != iter) {
             internal_map_erase(prev, iter, new_node->next_);
           }
+          kvpair->magic_ = ObKVCachePair::KVPAIR_PUT_MAGIC_NUM;
 
         }
       }
@@ -248,92 +249,167 @@ int ObKVCacheMap::get(
   int ret = OB_SUCCESS;
   uint64_t hash_code = 0;
 
-
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     COMMON_LOG(WARN, "The ObKVCacheMap has not been inited, ", K(ret));
   } else if (OB_FAIL(key.hash(hash_code))) {
     COMMON_LOG(WARN, "Failed to get kvcache key hash", K(ret));
   } else {
-    uint64_t bucket_pos = hash_code % bucket_num_;
-    hash_code += cache_id;
-
-    Node *iter = NULL;
-    Node *prev = NULL;
-    int64_t iter_get_cnt = 0;
-    int64_t mb_get_cnt = 0;
-    int64_t mb_handle_kv_cnt = 0;
-    ObKVCachePolicy mb_policy = LFU;
-
     GlobalHazardVersionGuard hazard_guard(global_hazard_version_);
     if (OB_FAIL(hazard_guard.get_ret())) {
       COMMON_LOG(WARN, "Fail to acquire hazard version", K(ret));
-    } else {
-      Node *&bucket_ptr = get_bucket_node(bucket_pos);
-      iter = bucket_ptr;
-      bool is_equal = false;
-      while (NULL != iter && OB_SUCC(ret)) {
-        if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
-          if (hash_code == iter->hash_code_) {
-            if (OB_FAIL(key.equal(*iter->key_, is_equal))) {
-              COMMON_LOG(WARN, "Failed to check kvcache key equal", K(ret));
-            } else if (is_equal) {
-              pvalue = iter->value_;
-              out_handle = iter->mb_handle_;
+    } else if (OB_FAIL(internal_get(cache_id, key, hash_code, pvalue, out_handle))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        COMMON_LOG(WARN, "Fail to get kvcache node", K(ret));
+      }
+    }
+  }
 
-              mb_get_cnt = ATOMIC_AAF(&out_handle->get_cnt_, 1);
-              mb_handle_kv_cnt = out_handle->kv_cnt_;
-              ++out_handle->recent_get_cnt_;
-              iter_get_cnt = ++ iter->get_cnt_;
-              iter->inst_->status_.total_hit_cnt_.inc();
-              mb_policy = out_handle->policy_;
+  return ret;
+}
 
-              break;
-            }
+int ObKVCacheMap::batch_get(
+    const int64_t cache_id,
+    const ObIKVCacheKey *const *keys,
+    const int64_t count,
+    const ObIKVCacheValue **pvalues,
+    ObKVMemBlockHandle **out_handles,
+    int64_t &hit_cnt)
+{
+  int ret = OB_SUCCESS;
+  hit_cnt = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCacheMap has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(nullptr == keys || count <= 0 || nullptr == pvalues || nullptr == out_handles)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument", K(ret), KP(keys), K(count), KP(pvalues), KP(out_handles));
+  } else {
+    GlobalHazardVersionGuard hazard_guard(global_hazard_version_);
+    uint64_t hash_codes[BATCH_GET_PREFETCH_CNT];
+    if (OB_FAIL(hazard_guard.get_ret())) {
+      COMMON_LOG(WARN, "Fail to acquire hazard version", K(ret));
+    }
+    for (int64_t begin = 0; OB_SUCC(ret) && begin < count; begin += BATCH_GET_PREFETCH_CNT) {
+      const int64_t end = MIN(count, begin + BATCH_GET_PREFETCH_CNT);
+      // hash all keys and prefetch their bucket slots, then prefetch the first nodes of
+      // buckets, so that the memory latency of probing different buckets overlaps
+      for (int64_t i = begin; OB_SUCC(ret) && i < end; ++i) {
+        pvalues[i] = nullptr;
+        out_handles[i] = nullptr;
+        if (OB_ISNULL(keys[i])) {
+          ret = OB_INVALID_ARGUMENT;
+          COMMON_LOG(WARN, "Invalid null key", K(ret), K(i));
+        } else if (OB_FAIL(keys[i]->hash(hash_codes[i - begin]))) {
+          COMMON_LOG(WARN, "Failed to get kvcache key hash", K(ret), K(i));
+        } else {
+          __builtin_prefetch(&get_bucket_node(hash_codes[i - begin] % bucket_num_));
+        }
+      }
+      for (int64_t i = begin; OB_SUCC(ret) && i < end; ++i) {
+        const Node *node = get_bucket_node(hash_codes[i - begin] % bucket_num_);
+        if (nullptr != node) {
+          __builtin_prefetch(node);
+        }
+      }
+      for (int64_t i = begin; OB_SUCC(ret) && i < end; ++i) {
+        if (OB_FAIL(internal_get(cache_id, *keys[i], hash_codes[i - begin], pvalues[i], out_handles[i]))) {
+          if (OB_ENTRY_NOT_EXIST != ret) {
+            COMMON_LOG(WARN, "Fail to get kvcache node", K(ret), K(i));
+          } else {
+            pvalues[i] = nullptr;
+            out_handles[i] = nullptr;
+            ret = OB_SUCCESS;
           }
-          store_->de_handle_ref(iter->mb_handle_);
+        } else {
+          ++hit_cnt;
         }
-        iter = iter->next_;
       }
+    }
+  }
+  return ret;
+}
 
-      if (OB_FAIL(ret)) {
-      } else if (NULL == iter) {
-        ret = OB_ENTRY_NOT_EXIST;
+// Caller should hold the hazard version.
+int ObKVCacheMap::internal_get(
+    const int64_t cache_id,
+    const ObIKVCacheKey &key,
+    const uint64_t key_hash,
+    const ObIKVCacheValue *&pvalue,
+    ObKVMemBlockHandle *&out_handle)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t bucket_pos = key_hash % bucket_num_;
+  const uint64_t hash_code = key_hash + cache_id;
+  Node *iter = NULL;
+  Node *prev = NULL;
+  int64_t iter_get_cnt = 0;
+  int64_t mb_get_cnt = 0;
+  int64_t mb_handle_kv_cnt = 0;
+  ObKVCachePolicy mb_policy = LFU;
+
+  Node *&bucket_ptr = get_bucket_node(bucket_pos);
+  iter = bucket_ptr;
+  bool is_equal = false;
+  while (NULL != iter && OB_SUCC(ret)) {
+    if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
+      if (hash_code == iter->hash_code_) {
+        if (OB_FAIL(key.equal(*iter->key_, is_equal))) {
+          COMMON_LOG(WARN, "Failed to check kvcache key equal", K(ret));
+        } else if (is_equal) {
+          pvalue = iter->value_;
+          out_handle = iter->mb_handle_;
+
+          mb_get_cnt = ATOMIC_AAF(&out_handle->get_cnt_, 1);
+          mb_handle_kv_cnt = out_handle->kv_cnt_;
+          ++out_handle->recent_get_cnt_;
+          iter_get_cnt = ++ iter->get_cnt_;
+          iter->inst_->status_.total_hit_cnt_.inc();
+          mb_policy = out_handle->policy_;
+
+          break;
+        }
+      }
+      store_->de_handle_ref(iter->mb_handle_);
+    }
+    iter = iter->next_;
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (NULL == iter) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    if (LRU == mb_policy && need_modify_cache(iter_get_cnt, mb_get_cnt, mb_handle_kv_cnt)) {
+      int tmp_ret = OB_SUCCESS;
+      ObBucketWLockGuard guard(bucket_lock_, bucket_pos);
+      if (OB_TMP_FAIL(guard.get_ret())) {
+        COMMON_LOG(WARN, "Fail to write lock bucket, ", K(tmp_ret), K(bucket_pos));
       } else {
-        if (LRU == mb_policy && need_modify_cache(iter_get_cnt, mb_get_cnt, mb_handle_kv_cnt)) {
-          int tmp_ret = OB_SUCCESS;
-          ObBucketWLockGuard guard(bucket_lock_, bucket_pos);
-          if (OB_TMP_FAIL(guard.get_ret())) {
-            COMMON_LOG(WARN, "Fail to write lock bucket, ", K(tmp_ret), K(bucket_pos));
-          } else {
-            prev = NULL;
-            iter = bucket_ptr;
-            bool is_equal = false;
-            while (NULL != iter && OB_LIKELY(OB_SUCCESS == tmp_ret)) {
-              if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
-                if (hash_code == iter->hash_code_) {
-                  if (OB_TMP_FAIL(key.equal(*iter->key_, is_equal))) {
-                    COMMON_LOG(WARN, "Failed to check kvcache key equal", K(tmp_ret));
-                  } else if (is_equal) {
-                    ObKVMemBlockHandle *old_handle = iter->mb_handle_;
-                    if (OB_TMP_FAIL(internal_data_move(prev, iter, bucket_ptr))) {
-                      COMMON_LOG(WARN, "Fail to move node to LFU block, ", K(tmp_ret));
-                    }
-                    store_->de_handle_ref(old_handle);
-                    break;
-                  }
+        prev = NULL;
+        iter = bucket_ptr;
+        bool is_equal = false;
+        while (NULL != iter && OB_LIKELY(OB_SUCCESS == tmp_ret)) {
+          if (store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
+            if (hash_code == iter->hash_code_) {
+              if (OB_TMP_FAIL(key.equal(*iter->key_, is_equal))) {
+                COMMON_LOG(WARN, "Failed to check kvcache key equal", K(tmp_ret));
+              } else if (is_equal) {
+                ObKVMemBlockHandle *old_handle = iter->mb_handle_;
+                if (OB_TMP_FAIL(internal_data_move(prev, iter, bucket_ptr))) {
+                  COMMON_LOG(WARN, "Fail to move node to LFU block, ", K(tmp_ret));
                 }
-                store_->de_handle_ref(iter->mb_handle_);
+                store_->de_handle_ref(old_handle);
+                break;
               }
-              prev = iter;
-              iter = iter->next_;
             }
+            store_->de_handle_ref(iter->mb_handle_);
           }
+          prev = iter;
+          iter = iter->next_;
         }
       }
-    }  // hazard version guard
+    }
   }
-
   return ret;
 }
 
@@ -32,6 +32,7 @@ class ObKVCacheMap
   static constexpr int64_t BUCKET_SIZE_ARRAY[BUCKET_SIZE_ARRAY_LEN] = {MIN_BUCKET_SIZE, MIN_BUCKET_SIZE << 4,  MIN_BUCKET_SIZE << 8, DEFAULT_BUCKET_SIZE};
   static const int64_t HAZARD_VERSION_THREAD_WAITING_THRESHOLD = 512;
   static const int64_t DEFAULT_LFU_THRESHOLD_BASE = 2;
+  static const int64_t BATCH_GET_PREFETCH_CNT = 16;
 public:
   ObKVCacheMap();
   virtual ~ObKVCacheMap();
@@ -46,7 +47,7 @@ public:
   int put(
     ObKVCacheInst &inst,
     const ObIKVCacheKey &key,
-    const ObKVCachePair *kvpair,
+    ObKVCachePair *kvpair,
     ObKVMemBlockHandle *mb_handle,
     bool overwrite = true);
   int get(
@@ -54,6 +55,15 @@ public:
     const ObIKVCacheKey &key,
     const ObIKVCacheValue *&pvalue,
     ObKVMemBlockHandle *&out_handle);
+  // Get values of @count keys with one hazard version guard, buckets of keys are prefetched
+  // before probing. pvalues[i] and out_handles[i] are NULL if keys[i] is not in cache.
+  int batch_get(
+    const int64_t cache_id,
+    const ObIKVCacheKey *const *keys,
+    const int64_t count,
+    const ObIKVCacheValue **pvalues,
+    ObKVMemBlockHandle **out_handles,
+    int64_t &hit_cnt);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
   void print_hazard_version_info();
 private:
@@ -89,6 +99,12 @@ private:
   };
 private:
   int multi_get(const int64_t cache_id, const int64_t pos, common::ObList<Node, common::ObArenaAllocator> &list);
+  int internal_get(
+    const int64_t cache_id,
+    const ObIKVCacheKey &key,
+    const uint64_t key_hash,
+    const ObIKVCacheValue *&pvalue,
+    ObKVMemBlockHandle *&out_handle);
   void internal_map_erase(Node *&prev, Node *&iter, Node *&bucket_ptr);
   void internal_map_replace(Node *&prev, Node *&iter, Node *&bucket_ptr);
   int internal_data_move(Node *&prev, Node *&iter, Node *&bucket_ptr);
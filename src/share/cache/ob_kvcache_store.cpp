@@ -1234,6 +1234,12 @@ int ObKVCacheStore::do_wash_mb(ObKVMemBlockHandle *mb_handle, void *&buf, int64_
         (void) ATOMIC_SAF(&mb_handle->inst_->status_.lfu_mb_cnt_, 1);
       }
     }
+    if (NULL != mb_handle->inst_ && NULL != mb_handle->inst_->status_.config_) {
+      ObIKVCacheEvictListener *listener = mb_handle->inst_->status_.config_->evict_listener_;
+      if (NULL != listener) {
+        mb_handle->mem_block_->notify_evict(*listener);
+      }
+    }
     buf = mb_handle->mem_block_;
     mb_size = mb_handle->mem_block_->get_align_size();
     mb_handle->mem_block_->~ObKVStoreMemBlock();
@@ -21,7 +21,8 @@ namespace common
  */
 ObKVCacheConfig::ObKVCacheConfig()
   : is_valid_(false),
-    priority_(0)
+    priority_(0),
+    evict_listener_(NULL)
 {
   MEMSET(cache_name_, 0, MAX_CACHE_NAME_LENGTH);
 }
@@ -31,6 +32,7 @@ void ObKVCacheConfig::reset()
   is_valid_ = false;
   priority_ = 0;
   MEMSET(cache_name_, 0, MAX_CACHE_NAME_LENGTH);
+  evict_listener_ = NULL;
 }
 
 /**
@@ -252,6 +254,7 @@ int ObKVStoreMemBlock::alloc(
   //if has found store pos, then store the kv
   if (OB_SUCC(ret)) {
     kvpair = reinterpret_cast<ObKVCachePair *>(&(buffer_[old_atomic_pos.buffer]));
+    kvpair->magic_ = ObKVCachePair::KVPAIR_MAGIC_NUM;
     kvpair->size_ = static_cast<int32_t>(align_kv_size);
     kvpair->key_ = reinterpret_cast<ObIKVCacheKey *>(&(buffer_[old_atomic_pos.buffer + sizeof(ObKVCachePair)]));
     kvpair->value_ = reinterpret_cast<ObIKVCacheValue *>(&(buffer_[old_atomic_pos.buffer
@@ -261,6 +264,23 @@ int ObKVStoreMemBlock::alloc(
   return ret;
 }
 
+void ObKVStoreMemBlock::notify_evict(ObIKVCacheEvictListener &listener) const
+{
+  const int64_t size = atomic_pos_.buffer;
+  int64_t pos = 0;
+  while (pos < size) {
+    const ObKVCachePair *kvpair = reinterpret_cast<const ObKVCachePair *>(&(buffer_[pos]));
+    if (OB_UNLIKELY(kvpair->size_ <= 0)) {
+      COMMON_LOG_RET(ERROR, OB_ERR_UNEXPECTED, "invalid kvpair size", K(pos), K(size), K(kvpair->size_));
+      break;
+    } else if (ObKVCachePair::KVPAIR_PUT_MAGIC_NUM == kvpair->magic_
+        && NULL != kvpair->key_ && NULL != kvpair->value_) {
+      listener.on_evict(*kvpair->key_, *kvpair->value_);
+    }
+    pos += kvpair->size_;
+  }
+}
+
 /*
  * -----------------------------------------------------------ObKVMemBlockHandle------------------------------------------------
  */
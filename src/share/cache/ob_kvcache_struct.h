@@ -57,6 +57,16 @@ public:
   virtual int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const = 0;
 };
 
+// Notified with kvpairs of a cache before their memory block is freed, kvpairs can not be
+// accessed after on_evict returns.
+class ObIKVCacheEvictListener
+{
+public:
+  ObIKVCacheEvictListener() {}
+  virtual ~ObIKVCacheEvictListener() {}
+  virtual void on_evict(const ObIKVCacheKey &key, const ObIKVCacheValue &value) = 0;
+};
+
 struct ObKVCachePair
 {
   uint32_t magic_;
@@ -64,6 +74,8 @@ struct ObKVCachePair
   ObIKVCacheKey *key_;
   ObIKVCacheValue *value_;
   static const uint32_t KVPAIR_MAGIC_NUM = 0x4B564B56;  //"KVKV"
+  // kvpair has been put into map, only these kvpairs are notified to evict listener
+  static const uint32_t KVPAIR_PUT_MAGIC_NUM = 0x4B565055;  //"KVPU"
   ObKVCachePair()
       : magic_(KVPAIR_MAGIC_NUM), size_(0), key_(NULL), value_(NULL)
   {
@@ -88,6 +100,8 @@ public:
   static int64_t get_align_size(const int64_t key_size, const int64_t value_size);
   int store(const ObIKVCacheKey &key, const ObIKVCacheValue &value, ObKVCachePair *&kvpair);
   int alloc(const int64_t key_size, const int64_t value_size, const int64_t align_kv_size, ObKVCachePair *&kvpair);
+  // notify all kvpairs put into map, should be called when nobody else refers to the block
+  void notify_evict(ObIKVCacheEvictListener &listener) const;
   inline int64_t get_payload_size() const
   {
     return payload_size_;
@@ -177,6 +191,7 @@ public:
   bool is_valid_;
   int64_t priority_;
   char cache_name_[MAX_CACHE_NAME_LENGTH];
+  ObIKVCacheEvictListener *evict_listener_;
 };
 
 struct ObKVCacheStatus
@@ -232,6 +232,9 @@ int ObTenantIOClock::init(const ObTenantIOConfig &io_config, const ObIOUsage *io
     if (OB_SUCC(ret)) {
       unit_clock_.iops_ = unit_config.max_iops_;
       unit_clock_.last_ns_ = 0;
+      bw_reservation_clock_.last_ns_ = 0;
+      bw_limitation_clock_.last_ns_ = 0;
+      update_bandwidth_clocks(unit_config);
       io_usage_ = io_usage;
       is_inited_ = true;
     }
@@ -247,6 +250,8 @@ void ObTenantIOClock::destroy()
   }
   other_group_clock_.destroy();
   group_clocks_.destroy();
+  bw_reservation_clock_.reset();
+  bw_limitation_clock_.reset();
   io_usage_ = nullptr;
 }
 
@@ -267,6 +272,7 @@ int ObTenantIOClock::calc_phyqueue_clock(ObPhyQueue *phy_queue, const ObIOReques
     phy_queue->proportion_ts_ = current_ts;
   } else {
     const int64_t current_ts = ObTimeUtility::fast_current_time();
+    const int64_t io_size = max(req.io_info_.size_, req.io_size_);
     uint64_t cur_queue_index = phy_queue->queue_index_;
     if (cur_queue_index < 0 || (cur_queue_index >= group_clocks_.count() && cur_queue_index != INT64_MAX)) {
       ret = OB_INVALID_ARGUMENT;
@@ -277,22 +283,24 @@ int ObTenantIOClock::calc_phyqueue_clock(ObPhyQueue *phy_queue, const ObIOReques
       double iops_scale = 0;
       bool is_io_ability_valid = true;
       if (OB_FAIL(ObIOCalibration::get_instance().get_iops_scale(req.get_mode(),
-                                                                 max(req.io_info_.size_, req.io_size_),
+                                                                 io_size,
                                                                  iops_scale,
                                                                  is_io_ability_valid))) {
         LOG_WARN("get iops scale failed", K(ret), K(req));
       } else if (OB_UNLIKELY(is_io_ability_valid == false)) {
-        //unlimited
+        //unlimited, except the bandwidth which doesn't depend on io ability
         const int64_t current_ts = ObTimeUtility::fast_current_time();
         phy_queue->reservation_ts_ = current_ts;
         phy_queue->group_limitation_ts_ = current_ts;
         phy_queue->tenant_limitation_ts_ = current_ts;
         phy_queue->proportion_ts_ = current_ts;
+        calc_bandwidth_clock(current_ts, io_size, phy_queue);
       } else if (OB_FAIL(mclock.calc_phy_clock(current_ts, iops_scale, weight_scale, phy_queue))) {
         LOG_WARN("calculate clock of the request failed", K(ret), K(mclock), K(weight_scale));
       } else {
         // ensure not exceed max iops of the tenant
         unit_clock_.atom_update(current_ts, iops_scale, phy_queue->tenant_limitation_ts_);
+        calc_bandwidth_clock(current_ts, io_size, phy_queue);
       }
     }
   }
@@ -361,6 +369,10 @@ int ObTenantIOClock::adjust_reservation_clock(ObPhyQueue *phy_queue, const ObIOR
       LOG_WARN("get iops scale failed", K(ret), K(req));
     } else if (OB_FAIL(mclock.dial_back_reservation_clock(iops_scale))) {
       LOG_WARN("dial back reservation clock failed", K(ret), K(iops_scale), K(req), K(mclock));
+    } else if (bw_reservation_clock_.iops_ > 0) {
+      const int64_t io_size = max(req.io_info_.size_, req.io_size_);
+      const int64_t delta_ns = static_cast<int64_t>(1000L * 1000L * 1000L * static_cast<double>(io_size) / bw_reservation_clock_.iops_);
+      ATOMIC_SAF(&bw_reservation_clock_.last_ns_, delta_ns);
     }
   }
   return ret;
@@ -400,6 +412,7 @@ int ObTenantIOClock::update_io_clocks(const ObTenantIOConfig &io_config)
       }
       if (OB_SUCC(ret)) {
         unit_clock_.iops_ = io_config.unit_config_.max_iops_;
+        update_bandwidth_clocks(io_config.unit_config_);
         is_inited_ = true;
       }
     }
@@ -491,6 +504,33 @@ ObMClock &ObTenantIOClock::get_mclock(const int64_t queue_index)
   return io_clock;
 }
 
+// The bandwidth clocks are charged by bytes of the request, so that a tenant issuing large
+// ios can't exhaust the disk with the same iops as a tenant issuing small ios.
+// Either of iops reservation and bandwidth reservation is satisfied, the request is reserved.
+// Both of iops limitation and bandwidth limitation need to be satisfied.
+void ObTenantIOClock::calc_bandwidth_clock(const int64_t current_ts, const int64_t io_size, ObPhyQueue *phy_queue)
+{
+  if (io_size > 0 && OB_NOT_NULL(phy_queue)) {
+    const double bw_scale = 1.0 / io_size;
+    if (bw_reservation_clock_.iops_ > 0) {
+      int64_t bw_reservation_ts = INT64_MAX;
+      bw_reservation_clock_.atom_update(current_ts, bw_scale, bw_reservation_ts);
+      phy_queue->reservation_ts_ = min(phy_queue->reservation_ts_, bw_reservation_ts);
+    }
+    if (bw_limitation_clock_.iops_ > 0) {
+      int64_t bw_limitation_ts = 0;
+      bw_limitation_clock_.atom_update(current_ts, bw_scale, bw_limitation_ts);
+      phy_queue->tenant_limitation_ts_ = max(phy_queue->tenant_limitation_ts_, bw_limitation_ts);
+    }
+  }
+}
+
+void ObTenantIOClock::update_bandwidth_clocks(const ObTenantIOConfig::UnitConfig &unit_config)
+{
+  bw_reservation_clock_.iops_ = unit_config.min_bandwidth_;
+  bw_limitation_clock_.iops_ = unit_config.max_bandwidth_;
+}
+
 double ObTenantIOClock::get_weight_scale(const int64_t queue_index)
 {
   double weight_scale = 1;
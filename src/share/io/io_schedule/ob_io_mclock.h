@@ -67,9 +67,11 @@ public:
   int64_t get_min_proportion_ts();
   void stop_clock(const uint64_t index);
   TO_STRING_KV(K(is_inited_), "group_clocks", group_clocks_, "other_clock", other_group_clock_,
-      K_(unit_clock), K(io_config_), K(io_usage_));
+      K_(unit_clock), K_(bw_reservation_clock), K_(bw_limitation_clock), K(io_config_), K(io_usage_));
 private:
   ObMClock &get_mclock(const int64_t queue_index);
+  void calc_bandwidth_clock(const int64_t current_ts, const int64_t io_size, ObPhyQueue *phy_queue);
+  void update_bandwidth_clocks(const ObTenantIOConfig::UnitConfig &unit_config);
   double get_weight_scale(const int64_t queue_index);
   int64_t calc_iops(const int64_t iops, const int64_t percentage);
   int64_t calc_weight(const int64_t weight, const int64_t percentage);
@@ -78,6 +80,9 @@ private:
   ObSEArray<ObMClock, GROUP_START_NUM> group_clocks_;
   ObMClock other_group_clock_;
   ObAtomIOClock unit_clock_;
+  // bandwidth clocks of the tenant, a request of n bytes costs n / bandwidth seconds
+  ObAtomIOClock bw_reservation_clock_;
+  ObAtomIOClock bw_limitation_clock_;
   ObTenantIOConfig io_config_;
   const ObIOUsage *io_usage_;
 };
@@ -312,6 +312,134 @@ bool ObIOInfo::is_valid() const
     && (flag_.is_read() || nullptr != buf_);
 }
 
+/******************             IOBatchCallback              **********************/
+static constexpr int64_t BATCH_CALLBACK_ALIGN_SIZE = 16;
+
+ObIOBatchCallback::ObIOBatchCallback()
+  : ranges_(nullptr), range_count_(0), is_copied_(false)
+{
+
+}
+
+ObIOBatchCallback::~ObIOBatchCallback()
+{
+  if (is_copied_) {
+    for (int64_t i = 0; i < range_count_; ++i) {
+      if (nullptr != ranges_[i].callback_) {
+        ranges_[i].callback_->~ObIOCallback();
+        ranges_[i].callback_ = nullptr;
+      }
+    }
+  }
+  ranges_ = nullptr;
+  range_count_ = 0;
+  is_copied_ = false;
+}
+
+int ObIOBatchCallback::set_ranges(Range *ranges, const int64_t range_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_copied_)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("copied batch callback can not be reset", K(ret), K(*this));
+  } else if (OB_UNLIKELY(nullptr == ranges || range_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(ranges), K(range_count));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < range_count; ++i) {
+      if (OB_UNLIKELY(nullptr == ranges[i].callback_ || ranges[i].offset_ < 0 || ranges[i].size_ <= 0)) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("invalid range", K(ret), K(i), K(ranges[i]));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ranges_ = ranges;
+      range_count_ = range_count;
+    }
+  }
+  return ret;
+}
+
+const char *ObIOBatchCallback::get_range_data(const int64_t range_idx)
+{
+  const char *data = nullptr;
+  if (OB_LIKELY(range_idx >= 0 && range_idx < range_count_)) {
+    data = ranges_[range_idx].callback_->get_data();
+  }
+  return data;
+}
+
+int64_t ObIOBatchCallback::get_range_data_size(const int64_t range_idx, const int64_t data_size) const
+{
+  int64_t range_data_size = 0;
+  if (OB_LIKELY(range_idx >= 0 && range_idx < range_count_)) {
+    const Range &range = ranges_[range_idx];
+    range_data_size = min(range.size_, max(0, data_size - range.offset_));
+  }
+  return range_data_size;
+}
+
+int64_t ObIOBatchCallback::size() const
+{
+  int64_t size = upper_align(sizeof(ObIOBatchCallback), BATCH_CALLBACK_ALIGN_SIZE)
+      + upper_align(range_count_ * sizeof(Range), BATCH_CALLBACK_ALIGN_SIZE);
+  for (int64_t i = 0; i < range_count_; ++i) {
+    size += upper_align(ranges_[i].callback_->size(), BATCH_CALLBACK_ALIGN_SIZE);
+  }
+  return size;
+}
+
+int ObIOBatchCallback::inner_process(const char *data_buffer, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < range_count_; ++i) {
+    const Range &range = ranges_[i];
+    const int64_t range_data_size = get_range_data_size(i, size);
+    if (OB_FAIL(range.callback_->process(
+        nullptr == data_buffer ? nullptr : data_buffer + range.offset_, range_data_size))) {
+      LOG_WARN("process range callback failed", K(ret), K(i), K(range), K(size));
+    }
+  }
+  return ret;
+}
+
+int ObIOBatchCallback::inner_deep_copy(char *buf, const int64_t buf_len, ObIOCallback *&copied_callback) const
+{
+  int ret = OB_SUCCESS;
+  copied_callback = nullptr;
+  if (OB_UNLIKELY(nullptr == buf || buf_len <= 0 || range_count_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(buf_len), K_(range_count));
+  } else if (OB_UNLIKELY(buf_len < size())) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LOG_WARN("buf_len not enough", K(ret), K(buf_len), K(size()));
+  } else {
+    int64_t pos = upper_align(sizeof(ObIOBatchCallback), BATCH_CALLBACK_ALIGN_SIZE);
+    ObIOBatchCallback *batch_callback = new (buf) ObIOBatchCallback();
+    batch_callback->ranges_ = reinterpret_cast<Range *>(buf + pos);
+    batch_callback->is_copied_ = true;
+    pos += upper_align(range_count_ * sizeof(Range), BATCH_CALLBACK_ALIGN_SIZE);
+    for (int64_t i = 0; OB_SUCC(ret) && i < range_count_; ++i) {
+      const int64_t callback_size = upper_align(ranges_[i].callback_->size(), BATCH_CALLBACK_ALIGN_SIZE);
+      Range *range = new (batch_callback->ranges_ + i) Range();
+      range->offset_ = ranges_[i].offset_;
+      range->size_ = ranges_[i].size_;
+      if (OB_FAIL(ranges_[i].callback_->deep_copy(buf + pos, callback_size, range->callback_))) {
+        LOG_WARN("deep copy range callback failed", K(ret), K(i), K(ranges_[i]));
+      } else {
+        batch_callback->range_count_ = i + 1;
+        pos += callback_size;
+      }
+    }
+    if (OB_FAIL(ret)) {
+      batch_callback->~ObIOBatchCallback();
+    } else {
+      copied_callback = batch_callback;
+    }
+  }
+  return ret;
+}
+
 /******************             IOTimeLog              **********************/
 
 ObIOTimeLog::ObIOTimeLog()
@@ -863,7 +991,7 @@ void ObPhyQueue::reset_queue_info()
 
 /******************             IOHandle              **********************/
 ObIOHandle::ObIOHandle()
-  : req_(nullptr)
+  : req_(nullptr), range_idx_(-1)
 {
 }
 
@@ -873,7 +1001,7 @@ ObIOHandle::~ObIOHandle()
 }
 
 ObIOHandle::ObIOHandle(const ObIOHandle &other)
-  : req_(nullptr)
+  : req_(nullptr), range_idx_(-1)
 {
   *this = other;
 }
@@ -885,6 +1013,8 @@ ObIOHandle& ObIOHandle::operator=(const ObIOHandle &other)
     if (OB_NOT_NULL(other.req_)) {
     	if (OB_FAIL(set_request(*other.req_))) {
     		LOG_ERROR("set io request failed", K(ret));
+    	} else {
+    		range_idx_ = other.range_idx_;
     	}
     }
   }
@@ -901,6 +1031,34 @@ int ObIOHandle::set_request(ObIORequest &req)
   return ret;
 }
 
+int ObIOHandle::get_range_handle(const int64_t range_idx, ObIOHandle &range_handle) const
+{
+  int ret = OB_SUCCESS;
+  ObIOBatchCallback *batch_callback = get_batch_callback();
+  if (OB_ISNULL(batch_callback)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("not a batch io request", K(ret), K(*this));
+  } else if (OB_UNLIKELY(range_idx < 0 || range_idx >= batch_callback->get_range_count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid range idx", K(ret), K(range_idx), K(*batch_callback));
+  } else if (OB_FAIL(range_handle.set_request(*req_))) {
+    LOG_WARN("set io request failed", K(ret), K(*this));
+  } else {
+    range_handle.range_idx_ = range_idx;
+  }
+  return ret;
+}
+
+ObIOBatchCallback *ObIOHandle::get_batch_callback() const
+{
+  // only requests of aio_read_batch have batch callback, which is never used alone
+  ObIOBatchCallback *batch_callback = nullptr;
+  if (OB_NOT_NULL(req_) && OB_NOT_NULL(req_->copied_callback_)) {
+    batch_callback = dynamic_cast<ObIOBatchCallback *>(req_->copied_callback_);
+  }
+  return batch_callback;
+}
+
 bool ObIOHandle::is_empty() const
 {
   return nullptr == req_;
@@ -1024,7 +1182,12 @@ const char *ObIOHandle::get_buffer()
 {
   const char *buf = nullptr;
   if (OB_NOT_NULL(req_) && req_->is_finished_) {
-    buf = req_->get_data();
+    ObIOBatchCallback *batch_callback = nullptr;
+    if (range_idx_ < 0) {
+      buf = req_->get_data();
+    } else if (OB_NOT_NULL(batch_callback = get_batch_callback())) {
+      buf = batch_callback->get_range_data(range_idx_);
+    }
   }
   return buf;
 }
@@ -1040,7 +1203,15 @@ const char *ObIOHandle::get_physical_buffer()
 
 int64_t ObIOHandle::get_data_size() const
 {
-  return OB_NOT_NULL(req_) ? req_->get_data_size() : 0;
+  int64_t data_size = 0;
+  ObIOBatchCallback *batch_callback = nullptr;
+  if (OB_ISNULL(req_)) {
+  } else if (range_idx_ < 0) {
+    data_size = req_->get_data_size();
+  } else if (OB_NOT_NULL(batch_callback = get_batch_callback())) {
+    data_size = batch_callback->get_range_data_size(range_idx_, req_->get_data_size());
+  }
+  return data_size;
 }
 
 int64_t ObIOHandle::get_rt() const
@@ -1055,6 +1226,7 @@ void ObIOHandle::reset()
     req_->dec_ref("handle_dec"); // ref for handle
     req_ = nullptr;
   }
+  range_idx_ = -1;
 }
 
 void ObIOHandle::cancel()
@@ -1066,14 +1238,15 @@ void ObIOHandle::cancel()
 
 /******************             TenantIOConfig              **********************/
 ObTenantIOConfig::UnitConfig::UnitConfig()
-  : min_iops_(0), max_iops_(0), weight_(0)
+  : min_iops_(0), max_iops_(0), weight_(0), min_bandwidth_(0), max_bandwidth_(0)
 {
 
 }
 
 bool ObTenantIOConfig::UnitConfig::is_valid() const
 {
-  return min_iops_ > 0 && max_iops_ >= min_iops_ && weight_ >= 0;
+  return min_iops_ > 0 && max_iops_ >= min_iops_ && weight_ >= 0
+      && min_bandwidth_ >= 0 && (0 == max_bandwidth_ || max_bandwidth_ >= min_bandwidth_);
 }
 
 ObTenantIOConfig::GroupConfig::GroupConfig()
@@ -1159,7 +1332,9 @@ bool ObTenantIOConfig::operator ==(const ObTenantIOConfig &other) const
     LOG_INFO("callback thread count not equal", K(callback_thread_count_), K(other.callback_thread_count_));
   } else if (unit_config_.weight_ != other.unit_config_.weight_
       || unit_config_.max_iops_ != other.unit_config_.max_iops_
-      || unit_config_.min_iops_ != other.unit_config_.min_iops_) {
+      || unit_config_.min_iops_ != other.unit_config_.min_iops_
+      || unit_config_.min_bandwidth_ != other.unit_config_.min_bandwidth_
+      || unit_config_.max_bandwidth_ != other.unit_config_.max_bandwidth_) {
     LOG_INFO("unit config not equal", K(unit_config_), K(other.unit_config_));
   } else if (enable_io_tracer_ != other.enable_io_tracer_) {
     LOG_INFO("enable io tracer not equal", K(enable_io_tracer_), K(other.enable_io_tracer_));
@@ -162,6 +162,38 @@ public:
   ObIOCallback *callback_;
 };
 
+// Callback of a read request merged from several nearby reads by ObIOManager::aio_read_batch.
+// Callbacks of the merged reads are deep copied together with it, and each of them
+// processes the data of its own range.
+class ObIOBatchCallback : public ObIOCallback
+{
+public:
+  struct Range
+  {
+    Range() : offset_(0), size_(0), callback_(nullptr) {}
+    TO_STRING_KV(K_(offset), K_(size), KP_(callback));
+    int64_t offset_; // relative to the offset of merged request
+    int64_t size_;
+    ObIOCallback *callback_;
+  };
+  ObIOBatchCallback();
+  virtual ~ObIOBatchCallback();
+  // @ranges should live until this callback is deep copied
+  int set_ranges(Range *ranges, const int64_t range_count);
+  int64_t get_range_count() const { return range_count_; }
+  const char *get_range_data(const int64_t range_idx);
+  int64_t get_range_data_size(const int64_t range_idx, const int64_t data_size) const;
+  virtual const char *get_data() override { return nullptr; }
+  virtual int64_t size() const override;
+  virtual int inner_process(const char *data_buffer, const int64_t size) override;
+  virtual int inner_deep_copy(char *buf, const int64_t buf_len, ObIOCallback *&copied_callback) const override;
+  TO_STRING_KV(K_(range_count), K_(is_copied));
+private:
+  Range *ranges_;
+  int64_t range_count_;
+  bool is_copied_; // callbacks of ranges are owned if copied
+};
+
 template <typename T>
 class ObRefHolder
 {
@@ -326,6 +358,8 @@ public:
   ObIOHandle(const ObIOHandle &other);
   ObIOHandle &operator=(const ObIOHandle &other);
   int set_request(ObIORequest &req);
+  // Set @range_handle to read the @range_idx range of the request merged by aio_read_batch
+  int get_range_handle(const int64_t range_idx, ObIOHandle &range_handle) const;
   bool is_empty() const;
   bool is_valid() const;
 
@@ -337,12 +371,14 @@ public:
   int get_fs_errno(int &io_errno) const;
   void reset();
   void cancel();
-  TO_STRING_KV("io_request", to_cstring(req_));
+  TO_STRING_KV("io_request", to_cstring(req_), K_(range_idx));
 private:
   void estimate();
+  ObIOBatchCallback *get_batch_callback() const;
 
 private:
   ObIORequest *req_;
+  int64_t range_idx_; // index of range in batch callback, -1 if the whole request
 };
 
 
@@ -353,10 +389,13 @@ public:
   {
     UnitConfig();
     bool is_valid() const;
-    TO_STRING_KV(K_(min_iops), K_(max_iops), K_(weight));
+    TO_STRING_KV(K_(min_iops), K_(max_iops), K_(weight), K_(min_bandwidth), K_(max_bandwidth));
     int64_t min_iops_;
     int64_t max_iops_;
     int64_t weight_;
+    // bytes per second of the tenant, 0 means no reservation or no limitation
+    int64_t min_bandwidth_;
+    int64_t max_bandwidth_;
   };
 
   struct GroupConfig
@@ -406,7 +445,7 @@ struct ObAtomIOClock final
   void atom_update(const int64_t current_ts, const double iops_scale, int64_t &deadline_ts);
   void reset();
   TO_STRING_KV(K_(iops), K_(last_ns));
-  int64_t iops_;
+  int64_t iops_; // or bytes per second for bandwidth clock
   int64_t last_ns_; // the unit is nano sescond for max iops of 1 billion
 };
 
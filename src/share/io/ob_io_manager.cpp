@@ -212,6 +212,81 @@ int ObIOManager::aio_write(const ObIOInfo &info, ObIOHandle &handle)
   return ret;
 }
 
+int ObIOManager::aio_read_batch(const ObIArray<ObIOInfo> &infos, ObIArray<ObIOHandle> &handles)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<int64_t, 16> sorted_idxs;
+  handles.reset();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("io manager not inited", K(ret), K(is_inited_));
+  } else if (OB_UNLIKELY(!is_working_)) {
+    ret = OB_STATE_NOT_MATCH;
+    LOG_WARN("io manager not working", K(ret), K(is_working_));
+  } else if (OB_FAIL(handles.prepare_allocate(infos.count()))) {
+    LOG_WARN("prepare allocate io handles failed", K(ret), K(infos.count()));
+  } else if (OB_FAIL(sorted_idxs.reserve(infos.count()))) {
+    LOG_WARN("reserve sorted idxs failed", K(ret), K(infos.count()));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < infos.count(); ++i) {
+      const ObIOInfo &info = infos.at(i);
+      if (OB_UNLIKELY(!info.is_valid() || !info.flag_.is_read())) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("invalid argument", K(ret), K(i), K(info), K(lbt()));
+      } else if (OB_FAIL(sorted_idxs.push_back(i))) {
+        LOG_WARN("push back idx failed", K(ret), K(i));
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    std::sort(sorted_idxs.begin(), sorted_idxs.end(), [&infos](const int64_t left, const int64_t right) {
+      const ObIOFd &left_fd = infos.at(left).fd_;
+      const ObIOFd &right_fd = infos.at(right).fd_;
+      bool bret = false;
+      if (left_fd.device_handle_ != right_fd.device_handle_) {
+        bret = left_fd.device_handle_ < right_fd.device_handle_;
+      } else if (left_fd.first_id_ != right_fd.first_id_) {
+        bret = left_fd.first_id_ < right_fd.first_id_;
+      } else if (left_fd.second_id_ != right_fd.second_id_) {
+        bret = left_fd.second_id_ < right_fd.second_id_;
+      } else {
+        bret = infos.at(left).offset_ < infos.at(right).offset_;
+      }
+      return bret;
+    });
+    const int64_t merge_gap = io_config_.read_batch_merge_gap_;
+    int64_t start = 0;
+    while (OB_SUCC(ret) && start < sorted_idxs.count()) {
+      const ObIOInfo &first_info = infos.at(sorted_idxs.at(start));
+      int64_t end_offset = first_info.offset_ + first_info.size_;
+      int64_t end = start + 1;
+      for (; end < sorted_idxs.count(); ++end) {
+        const ObIOInfo &next_info = infos.at(sorted_idxs.at(end));
+        const int64_t next_end_offset = max(end_offset, next_info.offset_ + next_info.size_);
+        if (!can_merge_read(first_info, next_info)
+            || next_info.offset_ - end_offset > merge_gap
+            || next_end_offset - first_info.offset_ > MAX_BATCH_READ_SIZE) {
+          break;
+        } else {
+          end_offset = next_end_offset;
+        }
+      }
+      if (1 == end - start) {
+        if (OB_FAIL(tenant_aio(first_info, handles.at(sorted_idxs.at(start))))) {
+          LOG_WARN("inner aio failed", K(ret), K(first_info));
+        }
+      } else if (OB_FAIL(merged_aio_read(infos, sorted_idxs, start, end, end_offset, handles))) {
+        LOG_WARN("merged aio read failed", K(ret), K(start), K(end), K(end_offset));
+      }
+      start = end;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    handles.reset();
+  }
+  return ret;
+}
+
 int ObIOManager::pread(ObIOInfo &info, int64_t &read_size)
 {
   int ret = OB_SUCCESS;
@@ -326,6 +401,60 @@ int ObIOManager::tenant_aio(const ObIOInfo &info, ObIOHandle &handle)
   return ret;
 }
 
+bool ObIOManager::can_merge_read(const ObIOInfo &left, const ObIOInfo &right)
+{
+  // sync read uses user buffer, read without callback has no one to dispatch data
+  return left.tenant_id_ == right.tenant_id_
+      && left.fd_ == right.fd_
+      && left.flag_.get_group_id() == right.flag_.get_group_id()
+      && left.flag_.is_unlimited() == right.flag_.is_unlimited()
+      && !left.flag_.is_sync() && !right.flag_.is_sync()
+      && !left.flag_.is_detect() && !right.flag_.is_detect()
+      && nullptr != left.callback_ && nullptr != right.callback_;
+}
+
+int ObIOManager::merged_aio_read(
+    const ObIArray<ObIOInfo> &infos,
+    const ObIArray<int64_t> &sorted_idxs,
+    const int64_t start,
+    const int64_t end,
+    const int64_t end_offset,
+    ObIArray<ObIOHandle> &handles)
+{
+  int ret = OB_SUCCESS;
+  const ObIOInfo &first_info = infos.at(sorted_idxs.at(start));
+  ObSEArray<ObIOBatchCallback::Range, 16> ranges;
+  ObIOBatchCallback batch_callback;
+  ObIOInfo merged_info = first_info;
+  ObIOHandle merged_handle;
+  for (int64_t i = start; OB_SUCC(ret) && i < end; ++i) {
+    const ObIOInfo &info = infos.at(sorted_idxs.at(i));
+    ObIOBatchCallback::Range range;
+    range.offset_ = info.offset_ - first_info.offset_;
+    range.size_ = info.size_;
+    range.callback_ = info.callback_;
+    if (OB_FAIL(ranges.push_back(range))) {
+      LOG_WARN("push back range failed", K(ret), K(range));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(batch_callback.set_ranges(ranges.get_data(), ranges.count()))) {
+    LOG_WARN("set batch callback ranges failed", K(ret), K(ranges));
+  } else {
+    merged_info.size_ = end_offset - first_info.offset_;
+    merged_info.callback_ = &batch_callback;
+    if (OB_FAIL(tenant_aio(merged_info, merged_handle))) {
+      LOG_WARN("inner aio failed", K(ret), K(merged_info));
+    }
+  }
+  for (int64_t i = start; OB_SUCC(ret) && i < end; ++i) {
+    if (OB_FAIL(merged_handle.get_range_handle(i - start, handles.at(sorted_idxs.at(i))))) {
+      LOG_WARN("get range handle failed", K(ret), K(i), K(start), K(merged_handle));
+    }
+  }
+  return ret;
+}
+
 int ObIOManager::adjust_tenant_clock()
 {
   int ret = OB_SUCCESS;
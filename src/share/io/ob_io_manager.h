@@ -44,6 +44,12 @@ public:
 
   int aio_write(const ObIOInfo &info, ObIOHandle &handle);
 
+  // Read all @infos asynchronously, @handles[i] is the handle of @infos[i].
+  // Nearby reads of the same file with callbacks are merged into one io request if the gap
+  // between them is not larger than read_batch_merge_gap_ of io config, the data of each read
+  // is processed by its own callback.
+  int aio_read_batch(const ObIArray<ObIOInfo> &infos, ObIArray<ObIOHandle> &handles);
+
   int pread(ObIOInfo &info, int64_t &read_size);
 
   int pwrite(ObIOInfo &info, int64_t &write_size);
@@ -79,9 +85,17 @@ private:
   friend class ObTenantIOManager;
   static const int64_t DEFAULT_MEMORY_LIMIT = 10L * 1024L * 1024L * 1024L; // 10GB
   static const int32_t DEFAULT_QUEUE_DEPTH = 10000;
+  static const int64_t MAX_BATCH_READ_SIZE = 2L * 1024L * 1024L; // 2MB
   ObIOManager();
   ~ObIOManager();
   int tenant_aio(const ObIOInfo &info, ObIOHandle &handle);
+  static bool can_merge_read(const ObIOInfo &left, const ObIOInfo &right);
+  int merged_aio_read(const ObIArray<ObIOInfo> &infos,
+                      const ObIArray<int64_t> &sorted_idxs,
+                      const int64_t start,
+                      const int64_t end,
+                      const int64_t end_offset,
+                      ObIArray<ObIOHandle> &handles);
   int adjust_tenant_clock();
   DISABLE_COPY_ASSIGN(ObIOManager);
 private:
@@ -54,6 +54,7 @@ void ObIOConfig::set_default_value()
   data_storage_error_tolerance_time_ = 300L * 1000L * 1000L; // 300s
   disk_io_thread_count_ = 8;
   data_storage_io_timeout_ms_ = 120L * 1000L; // 120s
+  read_batch_merge_gap_ = 16L * 1024L; // 16KB, same as parameter seed
 }
 
 bool ObIOConfig::is_valid() const
@@ -63,7 +64,8 @@ bool ObIOConfig::is_valid() const
       && data_storage_warning_tolerance_time_ > 0
       && data_storage_error_tolerance_time_ >= data_storage_warning_tolerance_time_
       && disk_io_thread_count_ > 0 && disk_io_thread_count_ % 2 == 0 && disk_io_thread_count_ <= MAX_IO_THREAD_COUNT
-      && data_storage_io_timeout_ms_ > 0;
+      && data_storage_io_timeout_ms_ > 0
+      && read_batch_merge_gap_ >= 0;
 }
 
 void ObIOConfig::reset()
@@ -74,6 +76,7 @@ void ObIOConfig::reset()
   data_storage_error_tolerance_time_ = 0;
   disk_io_thread_count_ = 0;
   data_storage_io_timeout_ms_ = 0;
+  read_batch_merge_gap_ = 0;
 }
 
 /******************             IOMemoryPool              **********************/
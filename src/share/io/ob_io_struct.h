@@ -45,7 +45,8 @@ public:
       K(data_storage_warning_tolerance_time_),
       K(data_storage_error_tolerance_time_),
       K(disk_io_thread_count_),
-      K(data_storage_io_timeout_ms_));
+      K(data_storage_io_timeout_ms_),
+      K(read_batch_merge_gap_));
 
 public:
   static const int64_t MAX_IO_THREAD_COUNT = 32 * 2;
@@ -57,6 +58,8 @@ public:
   // resource related
   int64_t disk_io_thread_count_;
   int64_t data_storage_io_timeout_ms_;
+  // max gap between reads merged by aio_read_batch
+  int64_t read_batch_merge_gap_;
 };
 
 template<int64_t SIZE>
@@ -0,0 +1,410 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#include "share/ob_io_uring.h"
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+
+// io_uring_getevents_arg is needed to wait completion with timeout
+#if defined(IORING_FEAT_EXT_ARG) && defined(__NR_io_uring_setup)
+#define OB_IO_URING_SUPPORTED
+#endif
+
+using namespace oceanbase::common;
+
+namespace oceanbase {
+namespace share {
+
+ObIOUring::ObIOUring()
+  : ring_fd_(-1),
+    sqpoll_(false),
+    sq_entries_(0),
+    cq_entries_(0),
+    sq_ptr_(nullptr),
+    cq_ptr_(nullptr),
+    sq_ring_size_(0),
+    cq_ring_size_(0),
+    sqes_(nullptr),
+    sqes_size_(0),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_mask_(nullptr),
+    sq_flags_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_mask_(nullptr),
+    cqes_(nullptr),
+    unsubmitted_cnt_(0),
+    is_flushing_(false),
+    lock_()
+{
+}
+
+ObIOUring::~ObIOUring()
+{
+  destroy();
+}
+
+#ifdef OB_IO_URING_SUPPORTED
+int ObIOUring::init(const uint32_t max_events, const bool sqpoll)
+{
+  int ret = OB_SUCCESS;
+  struct io_uring_params params;
+  MEMSET(&params, 0, sizeof(params));
+  if (OB_UNLIKELY(is_inited())) {
+    ret = OB_INIT_TWICE;
+    SHARE_LOG(WARN, "init twice", K(ret), K(*this));
+  } else if (OB_UNLIKELY(0 == max_events)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "invalid argument", K(ret), K(max_events));
+  } else {
+    if (sqpoll) {
+      params.flags |= IORING_SETUP_SQPOLL;
+      params.sq_thread_idle = SQ_THREAD_IDLE_MS;
+    }
+    if ((ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, max_events, &params))) < 0) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "Fail to setup io_uring, ", K(ret), K(max_events), K(sqpoll), K(errno), KERRMSG);
+    } else if (0 == (params.features & IORING_FEAT_EXT_ARG)) {
+      ret = OB_NOT_SUPPORTED;
+      SHARE_LOG(WARN, "io_uring of current kernel doesn't support wait with timeout",
+          K(ret), K(params.features));
+    } else {
+      sqpoll_ = sqpoll;
+      sq_entries_ = params.sq_entries;
+      cq_entries_ = params.cq_entries;
+      sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+      cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+      sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+      if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        cq_ring_size_ = sq_ring_size_;
+      }
+      sq_ptr_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+          ring_fd_, IORING_OFF_SQ_RING);
+      if (MAP_FAILED == sq_ptr_) {
+        sq_ptr_ = nullptr;
+        ret = OB_IO_ERROR;
+        SHARE_LOG(WARN, "Fail to mmap io_uring sq ring, ", K(ret), K_(sq_ring_size), KERRMSG);
+      } else if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        cq_ptr_ = sq_ptr_;
+      } else if (MAP_FAILED == (cq_ptr_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING))) {
+        cq_ptr_ = nullptr;
+        ret = OB_IO_ERROR;
+        SHARE_LOG(WARN, "Fail to mmap io_uring cq ring, ", K(ret), K_(cq_ring_size), KERRMSG);
+      }
+      if (OB_SUCC(ret)) {
+        void *sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            ring_fd_, IORING_OFF_SQES);
+        if (MAP_FAILED == sqes) {
+          ret = OB_IO_ERROR;
+          SHARE_LOG(WARN, "Fail to mmap io_uring sqes, ", K(ret), K_(sqes_size), KERRMSG);
+        } else {
+          char *sq = static_cast<char *>(sq_ptr_);
+          char *cq = static_cast<char *>(cq_ptr_);
+          sqes_ = static_cast<struct io_uring_sqe *>(sqes);
+          sq_head_ = reinterpret_cast<uint32_t *>(sq + params.sq_off.head);
+          sq_tail_ = reinterpret_cast<uint32_t *>(sq + params.sq_off.tail);
+          sq_mask_ = reinterpret_cast<uint32_t *>(sq + params.sq_off.ring_mask);
+          sq_flags_ = reinterpret_cast<uint32_t *>(sq + params.sq_off.flags);
+          cq_head_ = reinterpret_cast<uint32_t *>(cq + params.cq_off.head);
+          cq_tail_ = reinterpret_cast<uint32_t *>(cq + params.cq_off.tail);
+          cq_mask_ = reinterpret_cast<uint32_t *>(cq + params.cq_off.ring_mask);
+          cqes_ = reinterpret_cast<struct io_uring_cqe *>(cq + params.cq_off.cqes);
+          // sqes are always used in ring order, so the index array is fixed
+          uint32_t *sq_array = reinterpret_cast<uint32_t *>(sq + params.sq_off.array);
+          for (uint32_t i = 0; i < sq_entries_; ++i) {
+            sq_array[i] = i;
+          }
+          unsubmitted_cnt_ = 0;
+          is_flushing_ = false;
+          SHARE_LOG(INFO, "io_uring setup", K(*this), K(params.features));
+        }
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  }
+  return ret;
+}
+
+void ObIOUring::destroy()
+{
+  if (nullptr != sqes_) {
+    ::munmap(sqes_, sqes_size_);
+  }
+  if (nullptr != cq_ptr_ && cq_ptr_ != sq_ptr_) {
+    ::munmap(cq_ptr_, cq_ring_size_);
+  }
+  if (nullptr != sq_ptr_) {
+    ::munmap(sq_ptr_, sq_ring_size_);
+  }
+  if (ring_fd_ >= 0) {
+    ::close(ring_fd_);
+  }
+  ring_fd_ = -1;
+  sqpoll_ = false;
+  sq_entries_ = 0;
+  cq_entries_ = 0;
+  sq_ptr_ = nullptr;
+  cq_ptr_ = nullptr;
+  sq_ring_size_ = 0;
+  cq_ring_size_ = 0;
+  sqes_ = nullptr;
+  sqes_size_ = 0;
+  sq_head_ = nullptr;
+  sq_tail_ = nullptr;
+  sq_mask_ = nullptr;
+  sq_flags_ = nullptr;
+  cq_head_ = nullptr;
+  cq_tail_ = nullptr;
+  cq_mask_ = nullptr;
+  cqes_ = nullptr;
+  unsubmitted_cnt_ = 0;
+  is_flushing_ = false;
+}
+
+int ObIOUring::submit(const struct iocb &cb)
+{
+  int ret = OB_SUCCESS;
+  bool need_flush = false;
+  uint8_t opcode = 0;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "io_uring not init", K(ret));
+  } else if (IO_CMD_PREAD == cb.aio_lio_opcode) {
+    opcode = IORING_OP_READ;
+  } else if (IO_CMD_PWRITE == cb.aio_lio_opcode) {
+    opcode = IORING_OP_WRITE;
+  } else {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "not supported io command", K(ret), K(cb.aio_lio_opcode));
+  }
+  if (OB_SUCC(ret)) {
+    ObSpinLockGuard guard(lock_);
+    const uint32_t tail = *sq_tail_;
+    if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+      ret = OB_EAGAIN;
+    } else {
+      struct io_uring_sqe *sqe = &sqes_[tail & *sq_mask_];
+      MEMSET(sqe, 0, sizeof(*sqe));
+      sqe->opcode = opcode;
+      sqe->fd = cb.aio_fildes;
+      sqe->addr = reinterpret_cast<uint64_t>(cb.u.c.buf);
+      sqe->len = static_cast<uint32_t>(cb.u.c.nbytes);
+      sqe->off = static_cast<uint64_t>(cb.u.c.offset);
+      sqe->user_data = reinterpret_cast<uint64_t>(cb.data);
+      __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+      ++unsubmitted_cnt_;
+      if (!is_flushing_) {
+        is_flushing_ = true;
+        need_flush = true;
+      }
+    }
+  }
+  // the request is published to kernel, io_uring_enter failure is retried by following flush
+  if (need_flush && OB_FAIL(flush())) {
+    SHARE_LOG(WARN, "flush io_uring failed", K(ret), K(*this));
+    ret = OB_SUCCESS;
+  }
+  return ret;
+}
+
+int ObIOUring::flush()
+{
+  int ret = OB_SUCCESS;
+  bool is_done = false;
+  while (!is_done) {
+    int64_t to_submit = 0;
+    {
+      ObSpinLockGuard guard(lock_);
+      if (0 == unsubmitted_cnt_) {
+        is_flushing_ = false;
+        is_done = true;
+      } else {
+        to_submit = unsubmitted_cnt_;
+        unsubmitted_cnt_ = 0;
+      }
+    }
+    if (!is_done) {
+      int sys_ret = 0;
+      if (sqpoll_) {
+        // make sure the kernel thread sees new tail before checking its state
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (__atomic_load_n(sq_flags_, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP) {
+          ret = enter(0, 0, IORING_ENTER_SQ_WAKEUP, nullptr, sys_ret);
+        }
+      } else {
+        while (OB_SUCC(ret) && to_submit > 0) {
+          if (OB_SUCC(enter(static_cast<uint32_t>(to_submit), 0, 0, nullptr, sys_ret))) {
+            to_submit -= sys_ret;
+          }
+        }
+      }
+      if (OB_FAIL(ret)) {
+        // give back the unsubmitted for next flush
+        ObSpinLockGuard guard(lock_);
+        unsubmitted_cnt_ += to_submit;
+        is_flushing_ = false;
+        is_done = true;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIOUring::enter(
+    const uint32_t to_submit,
+    const uint32_t min_complete,
+    const uint32_t flags,
+    const struct timespec *timeout,
+    int &sys_ret)
+{
+  int ret = OB_SUCCESS;
+  struct io_uring_getevents_arg arg;
+  MEMSET(&arg, 0, sizeof(arg));
+  void *argp = nullptr;
+  size_t argsz = 0;
+  uint32_t enter_flags = flags;
+  if (nullptr != timeout) {
+    arg.ts = reinterpret_cast<uint64_t>(timeout);
+    argp = &arg;
+    argsz = sizeof(arg);
+    enter_flags |= IORING_ENTER_EXT_ARG;
+  }
+  sys_ret = static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete,
+      enter_flags, argp, argsz));
+  if (sys_ret >= 0) {
+  } else if (EINTR == errno || ETIME == errno) {
+    sys_ret = 0;
+  } else if (EAGAIN == errno || EBUSY == errno) {
+    // kernel is out of resource or completion queue is overflowed, retry later
+    sys_ret = 0;
+    ret = OB_EAGAIN;
+  } else {
+    ret = OB_IO_ERROR;
+    SHARE_LOG(WARN, "Fail to enter io_uring, ", K(ret), K(to_submit), K(min_complete), K(flags),
+        K(errno), KERRMSG);
+  }
+  return ret;
+}
+
+int64_t ObIOUring::reap(const int64_t max_nr, struct io_event *events)
+{
+  int64_t cnt = 0;
+  uint32_t head = *cq_head_;
+  const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  while (head != tail && cnt < max_nr) {
+    const struct io_uring_cqe &cqe = cqes_[head & *cq_mask_];
+    events[cnt].data = reinterpret_cast<void *>(cqe.user_data);
+    events[cnt].obj = nullptr;
+    events[cnt].res = cqe.res;
+    events[cnt].res2 = 0;
+    ++head;
+    ++cnt;
+  }
+  if (cnt > 0) {
+    __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+  }
+  return cnt;
+}
+
+int ObIOUring::get_events(
+    const int64_t min_nr,
+    const int64_t max_nr,
+    const struct timespec *timeout,
+    struct io_event *events,
+    int64_t &complete_cnt)
+{
+  int ret = OB_SUCCESS;
+  complete_cnt = 0;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "io_uring not init", K(ret));
+  } else if (OB_UNLIKELY(min_nr < 0 || max_nr <= 0 || min_nr > max_nr || nullptr == events)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "invalid argument", K(ret), K(min_nr), K(max_nr), KP(events));
+  } else {
+    if (ATOMIC_LOAD(&unsubmitted_cnt_) > 0) {
+      // left by failed flush of submitter
+      bool need_flush = false;
+      {
+        ObSpinLockGuard guard(lock_);
+        if (!is_flushing_ && unsubmitted_cnt_ > 0) {
+          is_flushing_ = true;
+          need_flush = true;
+        }
+      }
+      if (need_flush && OB_FAIL(flush())) {
+        SHARE_LOG(WARN, "flush io_uring failed", K(ret), K(*this));
+        ret = OB_SUCCESS;
+      }
+    }
+    complete_cnt = reap(max_nr, events);
+  }
+  if (OB_SUCC(ret) && complete_cnt < min_nr) {
+    int sys_ret = 0;
+    if (OB_FAIL(enter(0, static_cast<uint32_t>(min_nr - complete_cnt), IORING_ENTER_GETEVENTS,
+        timeout, sys_ret))) {
+      if (OB_EAGAIN == ret) {
+        ret = OB_SUCCESS;
+      }
+    }
+    complete_cnt += reap(max_nr - complete_cnt, events + complete_cnt);
+  }
+  return ret;
+}
+
+#else
+
+int ObIOUring::init(const uint32_t max_events, const bool sqpoll)
+{
+  int ret = OB_NOT_SUPPORTED;
+  SHARE_LOG(WARN, "io_uring is not supported by current build", K(ret), K(max_events), K(sqpoll));
+  return ret;
+}
+
+void ObIOUring::destroy()
+{
+}
+
+int ObIOUring::submit(const struct iocb &cb)
+{
+  UNUSED(cb);
+  return OB_NOT_SUPPORTED;
+}
+
+int ObIOUring::get_events(
+    const int64_t min_nr,
+    const int64_t max_nr,
+    const struct timespec *timeout,
+    struct io_event *events,
+    int64_t &complete_cnt)
+{
+  UNUSEDx(min_nr, max_nr, timeout, events);
+  complete_cnt = 0;
+  return OB_NOT_SUPPORTED;
+}
+
+#endif
+
+} /* namespace share */
+} /* namespace oceanbase */
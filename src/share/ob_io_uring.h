@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef SRC_SHARE_OB_IO_URING_H_
+#define SRC_SHARE_OB_IO_URING_H_
+
+#include <libaio.h>
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/utility/ob_print_utils.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace oceanbase {
+namespace share {
+
+// A minimal io_uring ring driven by raw syscalls, used by ObLocalDevice as an alternative
+// of libaio context. Requests are prepared as libaio iocb and completions are returned as
+// libaio io_event, so the io channel works with both of them.
+//
+// Submission is thread safe. Requests pushed while another thread is entering kernel are
+// submitted by that thread in the same io_uring_enter call, so concurrent senders share
+// syscalls. With SQPOLL, the kernel thread polls submission queue and io_uring_enter is
+// only called to wake it up.
+//
+// Completion is reaped by a single thread. Kernel cancels requests of exited thread, so the
+// submitting threads should live until their requests complete, as io senders do.
+class ObIOUring
+{
+public:
+  ObIOUring();
+  ~ObIOUring();
+  int init(const uint32_t max_events, const bool sqpoll);
+  void destroy();
+  bool is_inited() const { return ring_fd_ >= 0; }
+  // Only IO_CMD_PREAD and IO_CMD_PWRITE are supported.
+  // Return OB_EAGAIN if submission queue is full.
+  int submit(const struct iocb &cb);
+  // Wait at least @min_nr completions until @timeout, fill at most @max_nr events.
+  int get_events(
+      const int64_t min_nr,
+      const int64_t max_nr,
+      const struct timespec *timeout,
+      struct io_event *events,
+      int64_t &complete_cnt);
+  TO_STRING_KV(K_(ring_fd), K_(sq_entries), K_(cq_entries), K_(sqpoll), K_(unsubmitted_cnt),
+      K_(is_flushing));
+
+private:
+  static const uint32_t SQ_THREAD_IDLE_MS = 10;
+  int flush();
+  int enter(
+      const uint32_t to_submit,
+      const uint32_t min_complete,
+      const uint32_t flags,
+      const struct timespec *timeout,
+      int &sys_ret);
+  int64_t reap(const int64_t max_nr, struct io_event *events);
+
+private:
+  int ring_fd_;
+  bool sqpoll_;
+  uint32_t sq_entries_;
+  uint32_t cq_entries_;
+  void *sq_ptr_;
+  void *cq_ptr_;
+  int64_t sq_ring_size_;
+  int64_t cq_ring_size_;
+  struct io_uring_sqe *sqes_;
+  int64_t sqes_size_;
+  // submission queue
+  uint32_t *sq_head_;
+  uint32_t *sq_tail_;
+  uint32_t *sq_mask_;
+  uint32_t *sq_flags_;
+  // completion queue
+  uint32_t *cq_head_;
+  uint32_t *cq_tail_;
+  uint32_t *cq_mask_;
+  struct io_uring_cqe *cqes_;
+  // pushed into submission queue but not notified to kernel yet
+  int64_t unsubmitted_cnt_;
+  bool is_flushing_;
+  common::ObSpinLock lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObIOUring);
+};
+
+} /* namespace share */
+} /* namespace oceanbase */
+
+#endif /* SRC_SHARE_OB_IO_URING_H_ */
@@ -18,6 +18,7 @@
 #include "share/ob_errno.h"
 #include "share/config/ob_server_config.h"
 #include "share/ob_resource_limit.h"
+#include "lib/utility/ob_tracepoint.h"
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "storage/slog/ob_storage_logger_manager.h"
 
@@ -1017,7 +1018,20 @@ int ObLocalDevice::io_setup(
     int sys_ret = 0;
     ObLocalIOContext *local_context = nullptr;
     local_context = new (buf) ObLocalIOContext();
-    if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
+    if (GCONF._enable_io_uring) {
+      int tmp_ret = OB_SUCCESS;
+#ifdef ERRSIM
+      tmp_ret = OB_E(EventTable::EN_IO_SETUP) OB_SUCCESS;
+#endif
+      if (OB_SUCCESS != tmp_ret) {
+        SHARE_LOG(WARN, "ERRSIM io_uring setup failure, use libaio instead", K(tmp_ret));
+      } else if (OB_TMP_FAIL(local_context->uring_.init(max_events, GCONF._io_uring_sqpoll))) {
+        SHARE_LOG(WARN, "Fail to setup io_uring, use libaio instead", K(tmp_ret), K(max_events));
+      }
+    }
+    if (local_context->uring_.is_inited()) {
+      io_context = local_context;
+    } else if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
       ret = OB_IO_ERROR;
       SHARE_LOG(WARN, "Fail to setup io context, ", K(ret), K(sys_ret), KERRMSG);
     } else {
@@ -1026,6 +1040,7 @@ int ObLocalDevice::io_setup(
   }
 
   if (OB_FAIL(ret) && nullptr != buf) {
+    static_cast<ObLocalIOContext *>(buf)->~ObLocalIOContext();
     allocator_.free(buf);
   }
   return ret;
@@ -1047,10 +1062,14 @@ int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
   } else {
     int sys_ret = 0;
-    if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
+    if (local_io_context->uring_.is_inited()) {
+      local_io_context->~ObLocalIOContext();
+      allocator_.free(io_context);
+    } else if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
       ret = OB_IO_ERROR;
       SHARE_LOG(WARN, "Fail to destroy io context, ", K(ret), K(sys_ret), KERRMSG);
     } else {
+      local_io_context->~ObLocalIOContext();
       allocator_.free(io_context);
     }
   }
@@ -1147,6 +1166,12 @@ int ObLocalDevice::io_submit(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (local_io_context->uring_.is_inited()) {
+    if (OB_FAIL(local_io_context->uring_.submit(local_iocb->iocb_))) {
+      if (OB_EAGAIN != ret) {
+        SHARE_LOG(WARN, "Fail to submit io_uring request, ", K(ret));
+      }
+    }
   } else {
     iocbp = &(local_iocb->iocb_);
     int submit_ret = ::io_submit(local_io_context->io_context_, 1, &iocbp);
@@ -1179,6 +1204,9 @@ int ObLocalDevice::io_cancel(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (local_io_context->uring_.is_inited()) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(DEBUG, "io_uring request can't be canceled", K(ret));
   } else {
     int sys_ret = 0;
     if ((sys_ret = ::io_cancel(local_io_context->io_context_, &(local_iocb->iocb_), &local_event)) < 0) {
@@ -1211,6 +1239,18 @@ int ObLocalDevice::io_getevents(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (local_io_context->uring_.is_inited()) {
+    int64_t complete_cnt = 0;
+    {
+      oceanbase::lib::Thread::WaitGuard guard(oceanbase::lib::Thread::WAIT_FOR_IO_EVENT);
+      ret = local_io_context->uring_.get_events(min_nr, local_io_events->max_event_cnt_, timeout,
+          local_io_events->io_events_, complete_cnt);
+    }
+    if (OB_FAIL(ret)) {
+      SHARE_LOG(WARN, "Fail to get io_uring events, ", K(ret));
+    } else {
+      local_io_events->complete_io_cnt_ = complete_cnt;
+    }
   } else {
     int sys_ret = 0;
     {
@@ -16,6 +16,7 @@
 #include <libaio.h>
 #include "lib/allocator/ob_fifo_allocator.h"
 #include "common/storage/ob_io_device.h"
+#include "share/ob_io_uring.h"
 
 namespace oceanbase {
 namespace share {
@@ -35,11 +36,12 @@ private:
 class ObLocalIOContext : public common::ObIOContext
 {
 public:
-  ObLocalIOContext() : io_context_() {}
+  ObLocalIOContext() : io_context_(), uring_() {}
   virtual ~ObLocalIOContext() {}
 private:
   friend class ObLocalDevice;
   io_context_t io_context_;
+  ObIOUring uring_; // used instead of libaio context if inited
 };
 
 class ObLocalIOEvents : public common::ObIOEvents
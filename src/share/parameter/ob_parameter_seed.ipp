@@ -223,6 +223,11 @@ DEF_BOOL(enable_sql_operator_dump, OB_CLUSTER_PARAMETER, "True", "specifies whet
 DEF_CAP(_chunk_row_store_mem_limit, OB_CLUSTER_PARAMETER, "0M", "[0M,]",
         "the maximum size of memory used by ChunkRowStore, 0 means follow operator's setting. Range: [0, +∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(_chunk_row_store_compress_func, OB_CLUSTER_PARAMETER, "none",
+                     common::ObConfigCompressFuncChecker,
+                     "compressor used for blocks dumped by ChunkRowStore. "
+                     "Values: none, lz4_1.0, snappy_1.0, zlib_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_STR_WITH_CHECKER(tableapi_transport_compress_func, OB_CLUSTER_PARAMETER, "none",
                      common::ObConfigCompressFuncChecker,
                      "compressor used for tableAPI query result. Values: none, lz4_1.0, snappy_1.0, zlib_1.0, zstd_1.0 zstd 1.3.8",
@@ -398,6 +403,10 @@ DEF_INT(_pushdown_storage_level, OB_TENANT_PARAMETER, "3", "[0, 3]",
         "the level of storage pushdown. Range: [0, 3] "
         "0: disabled, 1:blockscan, 2: blockscan & filter, 3: blockscan & filter & aggregate",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_skip_index_max_column_count, OB_TENANT_PARAMETER, "8", "[0, 64]",
+        "max number of columns with min/max skip index built in major sstable index blocks. Range: [0, 64] "
+        "0: disabled",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_WORK_AREA_POLICY(workarea_size_policy, OB_TENANT_PARAMETER, "AUTO", "policy used to size SQL working areas (MANUAL/AUTO)",
               ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_temporary_file_io_area_size, OB_TENANT_PARAMETER, "1", "[0, 50)",
@@ -505,6 +514,18 @@ DEF_STR_WITH_CHECKER(log_transport_compress_func, OB_TENANT_PARAMETER, "lz4_1.0"
                      "compressor used for log transport. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
                      ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_BOOL(log_storage_compress_all, OB_TENANT_PARAMETER, "False",
+         "If this option is set to true, compress log entries before writing them to clog disk, "
+         "the compressed logs are also sent to followers and archived. "
+         "It takes effect only after the data version of tenant is upgraded to 4.2.0.0. "
+         "The default is false(no compression)",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_STR_WITH_CHECKER(log_storage_compress_func, OB_TENANT_PARAMETER, "lz4_1.0",
+                     common::ObConfigCompressFuncChecker,
+                     "compressor used for log storage. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 //DEF_BOOL(enable_clog_persistence_compress, OB_TENANT_PARAMETER, "False",
 //         "If this option is set to true, use compression for clog persistence. "
 //         "The default is false(no compression)",
@@ -817,6 +838,18 @@ DEF_INT_WITH_CHECKER(disk_io_thread_count, OB_CLUSTER_PARAMETER, "8",
 DEF_INT(_io_callback_thread_count, OB_TENANT_PARAMETER, "8", "[1,64]",
         "The number of io callback threads. The default value is 8. Range: [1,64] in integer",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_io_min_bandwidth, OB_TENANT_PARAMETER, "0M", "[0M,)",
+        "the disk bandwidth per second reserved for the tenant on each server, "
+        "0 means no bandwidth reservation. Range: [0M,)",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_io_max_bandwidth, OB_TENANT_PARAMETER, "0M", "[0M,)",
+        "the max disk bandwidth per second of the tenant on each server, "
+        "0 means no bandwidth limitation. Range: [0M,)",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_io_read_batch_merge_gap, OB_CLUSTER_PARAMETER, "16K", "[0K,2M]",
+        "reads of a batch in the same file are merged into one io if the gap between them is not "
+        "larger than this value, 0 means only adjacent reads are merged. Range: [0K,2M]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_BOOL(_enable_parallel_minor_merge, OB_TENANT_PARAMETER, "True",
          "specifies whether enable parallel minor merge. "
@@ -856,6 +889,29 @@ DEF_BOOL(_enable_compaction_diagnose, OB_CLUSTER_PARAMETER, "False",
 DEF_STR(_force_skip_encoding_partition_id, OB_CLUSTER_PARAMETER, "",
         "force the specified partition to major without encoding row store, only for emergency!",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_scan_merge_read_ahead_size, OB_CLUSTER_PARAMETER, "2M", "[0M, 64M]",
+        "io budget of micro blocks read ahead from all sstables when a scan merges more than one sstable, "
+        "0 means read ahead is disabled. Range: [0M, 64M]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_micro_block_decoder_cache_size, OB_CLUSTER_PARAMETER, "1K", "[1K,64K]",
+        "max size of the initialized column decoders cached along with each encoded data micro block "
+        "in block cache, a larger size caches decoders of more columns. Range: [1K,64K]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR(_micro_block_ssd_cache_path, OB_CLUSTER_PARAMETER, "",
+        "path of the local file used as the second tier of data micro block cache, "
+        "it is better placed on a device faster than data files",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_CAP(_micro_block_ssd_cache_size, OB_CLUSTER_PARAMETER, "0M", "[0M,)",
+        "size of the second tier of data micro block cache on local file, "
+        "0 means the second tier is disabled. Range: [0M,)",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_STR(_block_cache_snapshot_path, OB_CLUSTER_PARAMETER, "",
+        "path of the local file recording hot micro blocks of block caches, which are loaded "
+        "in background after restart. Empty means disabled",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_CAP(_block_cache_warm_up_io_rate, OB_CLUSTER_PARAMETER, "64M", "[1M,)",
+        "io bandwidth per second used to load block cache snapshot at startup. Range: [1M,)",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(_private_buffer_size, OB_CLUSTER_PARAMETER, "16K", "[0B,)"
          "the trigger remaining data size within transaction for immediate logging, 0B represents not trigger immediate logging"
          "Range: [0B, total size of memory]",
@@ -1285,6 +1341,13 @@ DEF_BOOL(enable_sql_extension, OB_TENANT_PARAMETER, "False",
 DEF_BOOL(_enable_block_file_punch_hole, OB_CLUSTER_PARAMETER, "False",
          "specifies whether to punch whole when free blocks in block_file",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether to use io_uring instead of libaio for local device async io",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_BOOL(_io_uring_sqpoll, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether io_uring uses kernel submission queue polling thread, "
+         "only takes effect when _enable_io_uring is true",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 DEF_BOOL(_enable_trace_session_leak, OB_CLUSTER_PARAMETER, "False",
          "specifies whether to enable tracing session leak",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
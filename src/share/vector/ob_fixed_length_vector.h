@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SHARE_VECTOR_OB_FIXED_LENGTH_VECTOR_H_
+#define OCEANBASE_SHARE_VECTOR_OB_FIXED_LENGTH_VECTOR_H_
+
+#include "share/vector/ob_i_vector.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Values of fixed length type are stored in array of %ValueType, kernels can access the
+// values by get_data() in tight loop.
+template <typename ValueType>
+class ObFixedLengthVector final : public ObBitmapNullVectorBase
+{
+public:
+  ObFixedLengthVector(ValueType *data, sql::ObBitVector *nulls)
+    : ObBitmapNullVectorBase(VEC_FIXED, nulls), data_(data) {}
+  virtual ~ObFixedLengthVector() {}
+
+  OB_INLINE ValueType *get_data() { return data_; }
+  OB_INLINE const ValueType *get_data() const { return data_; }
+  OB_INLINE const ValueType &get_value(const int64_t idx) const { return data_[idx]; }
+  OB_INLINE void set_value(const int64_t idx, const ValueType &value)
+  {
+    data_[idx] = value;
+    unset_null(idx);
+  }
+
+  OB_INLINE void get_payload(const int64_t idx,
+                             const char *&payload,
+                             ObLength &length) const override
+  {
+    payload = reinterpret_cast<const char *>(data_ + idx);
+    length = sizeof(ValueType);
+  }
+  OB_INLINE void set_payload(const int64_t idx,
+                             const void *payload,
+                             const ObLength length) override
+  {
+    OB_ASSERT(sizeof(ValueType) == length);
+    MEMCPY(data_ + idx, payload, sizeof(ValueType));
+    unset_null(idx);
+  }
+
+  INHERIT_TO_STRING_KV("bitmap_null_vector", ObBitmapNullVectorBase,
+                       KP_(data), "value_size", sizeof(ValueType));
+private:
+  ValueType *data_;
+};
+
+} // end namespace common
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SHARE_VECTOR_OB_FIXED_LENGTH_VECTOR_H_
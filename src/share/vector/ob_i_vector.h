@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SHARE_VECTOR_OB_I_VECTOR_H_
+#define OCEANBASE_SHARE_VECTOR_OB_I_VECTOR_H_
+
+#include "share/vector/ob_vector_define.h"
+#include "sql/engine/ob_bit_vector.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Interface of one column of batch rows, see VectorFormat for the memory layouts.
+//
+// Vector never owns memory, it's built on the buffers given by caller, e.g.: the reserved
+// buffer of expression in frame. The virtual interfaces are for generic code, performance
+// critical kernels should dispatch by format and access the concrete vector directly.
+class ObIVector
+{
+public:
+  explicit ObIVector(const VectorFormat format) : format_(format) {}
+  virtual ~ObIVector() {}
+  OB_INLINE VectorFormat get_format() const { return format_; }
+
+  // may return true even if no row is null
+  virtual bool has_null() const = 0;
+  virtual bool is_null(const int64_t idx) const = 0;
+  virtual void set_null(const int64_t idx) = 0;
+  virtual void get_payload(const int64_t idx, const char *&payload, ObLength &length) const = 0;
+  // Set value of row %idx, the payload is copied by fixed length vector,
+  // and referenced by others.
+  virtual void set_payload(const int64_t idx, const void *payload, const ObLength length) = 0;
+
+  // Convert rows not skipped to datums, the datums reference the payload of vector.
+  void to_datums(ObDatum *datums, const sql::ObBitVector &skip, const int64_t size) const
+  {
+    const char *payload = NULL;
+    ObLength length = 0;
+    for (int64_t i = 0; i < size; i++) {
+      if (skip.at(i)) {
+      } else if (is_null(i)) {
+        datums[i].set_null();
+      } else {
+        get_payload(i, payload, length);
+        datums[i].ptr_ = payload;
+        datums[i].pack_ = static_cast<uint32_t>(length);
+      }
+    }
+  }
+
+  VIRTUAL_TO_STRING_KV(K_(format));
+protected:
+  VectorFormat format_;
+};
+
+// Base of vectors which mark nulls in null bitmap, one bit for each row.
+// %nulls_ can be NULL if no row is null and set_null() is never called.
+class ObBitmapNullVectorBase : public ObIVector
+{
+public:
+  ObBitmapNullVectorBase(const VectorFormat format, sql::ObBitVector *nulls)
+    : ObIVector(format), nulls_(nulls), has_null_(false) {}
+  virtual ~ObBitmapNullVectorBase() {}
+
+  OB_INLINE bool has_null() const override { return has_null_; }
+  OB_INLINE bool is_null(const int64_t idx) const override
+  {
+    return has_null_ && nulls_->at(idx);
+  }
+  OB_INLINE void set_null(const int64_t idx) override
+  {
+    nulls_->set(idx);
+    has_null_ = true;
+  }
+  OB_INLINE void unset_null(const int64_t idx)
+  {
+    if (has_null_) {
+      nulls_->unset(idx);
+    }
+  }
+  OB_INLINE const sql::ObBitVector *get_nulls() const { return nulls_; }
+  OB_INLINE sql::ObBitVector *get_nulls() { return nulls_; }
+  // Null bitmap is filled by caller directly.
+  OB_INLINE void set_has_null(const bool has_null) { has_null_ = has_null; }
+  void reset_nulls(const int64_t size)
+  {
+    if (NULL != nulls_) {
+      nulls_->reset(size);
+    }
+    has_null_ = false;
+  }
+
+  INHERIT_TO_STRING_KV("vector", ObIVector, KP_(nulls), K_(has_null));
+protected:
+  sql::ObBitVector *nulls_;
+  bool has_null_;
+};
+
+} // end namespace common
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SHARE_VECTOR_OB_I_VECTOR_H_
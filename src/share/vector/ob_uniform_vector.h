@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SHARE_VECTOR_OB_UNIFORM_VECTOR_H_
+#define OCEANBASE_SHARE_VECTOR_OB_UNIFORM_VECTOR_H_
+
+#include "share/vector/ob_i_vector.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Vector of ObDatum, the same layout as the batch result of expression, the datum of row i
+// is datums_[i] for uniform vector and datums_[0] for uniform const vector.
+template <bool IS_CONST>
+class ObUniformVector final : public ObIVector
+{
+public:
+  explicit ObUniformVector(ObDatum *datums)
+    : ObIVector(IS_CONST ? VEC_UNIFORM_CONST : VEC_UNIFORM), datums_(datums) {}
+  virtual ~ObUniformVector() {}
+
+  OB_INLINE ObDatum *get_datums() { return datums_; }
+  OB_INLINE const ObDatum *get_datums() const { return datums_; }
+  OB_INLINE ObDatum &get_datum(const int64_t idx) { return datums_[IS_CONST ? 0 : idx]; }
+  OB_INLINE const ObDatum &get_datum(const int64_t idx) const
+  {
+    return datums_[IS_CONST ? 0 : idx];
+  }
+
+  OB_INLINE bool has_null() const override { return true; }
+  OB_INLINE bool is_null(const int64_t idx) const override { return get_datum(idx).is_null(); }
+  OB_INLINE void set_null(const int64_t idx) override { get_datum(idx).set_null(); }
+  OB_INLINE void get_payload(const int64_t idx,
+                             const char *&payload,
+                             ObLength &length) const override
+  {
+    payload = get_datum(idx).ptr_;
+    length = get_datum(idx).len_;
+  }
+  OB_INLINE void set_payload(const int64_t idx,
+                             const void *payload,
+                             const ObLength length) override
+  {
+    ObDatum &datum = get_datum(idx);
+    datum.ptr_ = static_cast<const char *>(payload);
+    datum.pack_ = static_cast<uint32_t>(length);
+  }
+
+  INHERIT_TO_STRING_KV("vector", ObIVector, KP_(datums));
+private:
+  ObDatum *datums_;
+};
+
+typedef ObUniformVector<false> ObUniformBatchVector;
+typedef ObUniformVector<true> ObUniformConstVector;
+
+} // end namespace common
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SHARE_VECTOR_OB_UNIFORM_VECTOR_H_
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SHARE_VECTOR_OB_VECTOR_DEFINE_H_
+#define OCEANBASE_SHARE_VECTOR_OB_VECTOR_DEFINE_H_
+
+#include "share/datum/ob_datum.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Memory layout of one column of batch rows:
+//
+//  VEC_FIXED:         values of fixed length type are stored contiguously, e.g.: int64_t[],
+//                     nulls are marked in null bitmap.
+//  VEC_UNIFORM:       ObDatum array, the same as the batch result of expression.
+//  VEC_UNIFORM_CONST: one ObDatum for all rows, e.g.: the result of const expression.
+enum VectorFormat : uint8_t
+{
+  VEC_INVALID = 0,
+  VEC_FIXED,
+  VEC_UNIFORM,
+  VEC_UNIFORM_CONST,
+  VEC_MAX_FORMAT
+};
+
+OB_INLINE bool is_uniform_format(const VectorFormat format)
+{
+  return VEC_UNIFORM == format || VEC_UNIFORM_CONST == format;
+}
+
+OB_INLINE bool is_bitmap_null_format(const VectorFormat format)
+{
+  return VEC_FIXED == format;
+}
+
+// Value length of type in fixed length vector, return 0 if type can not be stored in
+// fixed length vector.
+OB_INLINE int64_t get_fixed_length(const ObObjDatumMapType map_type)
+{
+  int64_t length = 0;
+  if (OBJ_DATUM_8BYTE_DATA == map_type) {
+    length = sizeof(int64_t);
+  } else if (OBJ_DATUM_4BYTE_DATA == map_type) {
+    length = sizeof(int32_t);
+  }
+  return length;
+}
+
+} // end namespace common
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SHARE_VECTOR_OB_VECTOR_DEFINE_H_
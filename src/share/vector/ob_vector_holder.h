@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SHARE_VECTOR_OB_VECTOR_HOLDER_H_
+#define OCEANBASE_SHARE_VECTOR_OB_VECTOR_HOLDER_H_
+
+#include "share/vector/ob_fixed_length_vector.h"
+#include "share/vector/ob_uniform_vector.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// Hold one vector object of any format in inner buffer, so that the vector built for
+// each batch needs no memory allocation.
+class ObVectorHolder
+{
+public:
+  ObVectorHolder() : vec_(NULL) {}
+  ~ObVectorHolder() { reset(); }
+  void reset()
+  {
+    if (NULL != vec_) {
+      vec_->~ObIVector();
+      vec_ = NULL;
+    }
+  }
+  template <typename VecType, typename... Args>
+  VecType *make(Args &&...args)
+  {
+    static_assert(sizeof(VecType) <= BUF_SIZE, "vector object is too large");
+    reset();
+    VecType *vec = new (buf_) VecType(std::forward<Args>(args)...);
+    vec_ = vec;
+    return vec;
+  }
+  OB_INLINE ObIVector *get() const { return vec_; }
+  OB_INLINE bool is_valid() const { return NULL != vec_; }
+
+  TO_STRING_KV(KPC_(vec));
+private:
+  static const int64_t BUF_SIZE = MAX(sizeof(ObFixedLengthVector<int64_t>),
+                                      sizeof(ObUniformBatchVector));
+  alignas(ObIVector) char buf_[BUF_SIZE];
+  ObIVector *vec_;
+  DISALLOW_COPY_AND_ASSIGN(ObVectorHolder);
+};
+
+} // end namespace common
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SHARE_VECTOR_OB_VECTOR_HOLDER_H_
@@ -596,7 +596,19 @@ int ObStaticEngineCG::check_vectorize_supported(bool &support,
         LOG_WARN("failed to get_phy_op_type", K(op), K(type));
       } else {
       if (ObOperatorFactory::is_vectorized(type)) {
-        support = true;
+        if (log_op_def::LOG_EXPR_VALUES == op->get_type()) {
+          // Values with few rows, such as single row insert, gain nothing from vectorization,
+          // do not vectorize plan for them. But they still output batch if other operators
+          // vectorize the plan.
+          auto values = static_cast<ObLogExprValues *>(op);
+          const int64_t col_cnt = values->get_output_exprs().count();
+          if (col_cnt > 0 && values->get_value_exprs().count() / col_cnt
+                             >= ObExprValuesSpec::MIN_VECTORIZE_ROW_CNT) {
+            support = true;
+          }
+        } else {
+          support = true;
+        }
       }
       // Additional check to overwrite support value
       if (log_op_def::LOG_TABLE_SCAN == op->get_type()) {
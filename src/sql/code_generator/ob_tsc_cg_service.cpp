@@ -786,8 +786,13 @@ int ObTscCgService::generate_pushdown_aggr_ctdef(const ObLogTableScan &op,
         LOG_WARN("aggr expr is null", K(ret));
       } else if (aggr_expr->get_real_param_exprs().empty()) {
         OZ(scan_ctdef.aggregate_column_ids_.push_back(OB_COUNT_AGG_PD_COLUMN_ID));
-      } else if (OB_ISNULL(param_expr = aggr_expr->get_param_expr(0)) ||
-                 OB_UNLIKELY(!param_expr->is_column_ref_expr())) {
+      } else if (OB_ISNULL(param_expr = aggr_expr->get_param_expr(0))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("param expr is null", K(ret));
+      } else if (T_FUN_SUM == aggr_expr->get_expr_type() &&
+                 OB_FALSE_IT(param_expr = ObRawExprUtils::skip_implicit_cast(param_expr))) {
+        // sum param may be casted to result type, storage sums the column directly
+      } else if (OB_UNLIKELY(!param_expr->is_column_ref_expr())) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("expected basic column", K(ret), K(param_expr));
       } else if (OB_FALSE_IT(col_expr = static_cast<ObColumnRefRawExpr *>(param_expr))) {
@@ -18,6 +18,7 @@
 #include "observer/omt/ob_tenant_config_mgr.h"
 #include "lib/charset/ob_charset.h"
 #include "src/sql/engine/expr/ob_expr_util.h"
+#include "sql/engine/expr/ob_expr_vector.h"
 
 namespace oceanbase
 {
@@ -1811,51 +1812,54 @@ int ObHashGroupByOp::next_batch(bool is_from_row_store,
   return ret;
 }
 
-void ObHashGroupByOp::calc_groupby_exprs_hash_batch(
+int ObHashGroupByOp::calc_groupby_exprs_hash_batch(
   ObIArray<ObExpr *> &groupby_exprs, const ObBatchRows &child_brs)
 {
   uint64_t seed = 99194853094755497L;
-  int64_t ret = OB_SUCCESS;
+  int ret = OB_SUCCESS;
   if (ObThreeStageAggrStage::FIRST_STAGE == MY_SPEC.aggr_stage_ && !has_calc_base_hash_) {
     // first calc hash values of groupby_expr
-    for (int64_t i = 0; i < MY_SPEC.aggr_code_idx_ + 1; ++i) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < MY_SPEC.aggr_code_idx_ + 1; ++i) {
       ObExpr *expr = groupby_exprs.at(i);
       if (OB_ISNULL(expr)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unexpected status: groupby exprs is null", K(ret));
       } else {
-        ObBatchDatumHashFunc hash_func = expr->basic_funcs_->murmur_hash_v2_batch_;
         const bool is_batch_seed = (i > 0);
-        hash_func(base_hash_vals_,
-                  expr->locate_batch_datums(eval_ctx_), expr->is_batch_result(),
-                  *child_brs.skip_, child_brs.size_,
-                  is_batch_seed ? base_hash_vals_ : &seed,
-                  is_batch_seed);
+        if (OB_FAIL(ObExprVectorUtil::murmur_hash_v2_batch(*expr, eval_ctx_, base_hash_vals_,
+                                                           *child_brs.skip_, child_brs.size_,
+                                                           is_batch_seed ? base_hash_vals_ : &seed,
+                                                           is_batch_seed))) {
+          LOG_WARN("failed to calc hash value of groupby expr", K(ret));
+        }
       }
     }
-    has_calc_base_hash_ = true;
-    start_calc_hash_idx_ = MY_SPEC.aggr_code_idx_ + 1;
+    if (OB_SUCC(ret)) {
+      has_calc_base_hash_ = true;
+      start_calc_hash_idx_ = MY_SPEC.aggr_code_idx_ + 1;
+    }
   }
-  if (0 < start_calc_hash_idx_) {
+  if (OB_SUCC(ret) && 0 < start_calc_hash_idx_) {
     for (int64_t i = 0; i < child_brs.size_; ++i) {
       if (!child_brs.skip_->exist(i)) {
         hash_vals_[i] = base_hash_vals_[i];
       }
     }
   }
-  for (int64_t i = start_calc_hash_idx_; i < groupby_exprs.count(); ++i) {
+  for (int64_t i = start_calc_hash_idx_; OB_SUCC(ret) && i < groupby_exprs.count(); ++i) {
     ObExpr *expr = groupby_exprs.at(i);
     if (OB_ISNULL(expr)) {
     } else {
-      ObBatchDatumHashFunc hash_func = expr->basic_funcs_->murmur_hash_v2_batch_;
       const bool is_batch_seed = (i > 0);
-      hash_func(hash_vals_,
-                expr->locate_batch_datums(eval_ctx_), expr->is_batch_result(),
-                *child_brs.skip_, child_brs.size_,
-                is_batch_seed ? hash_vals_ : &seed,
-                is_batch_seed);
+      if (OB_FAIL(ObExprVectorUtil::murmur_hash_v2_batch(*expr, eval_ctx_, hash_vals_,
+                                                         *child_brs.skip_, child_brs.size_,
+                                                         is_batch_seed ? hash_vals_ : &seed,
+                                                         is_batch_seed))) {
+        LOG_WARN("failed to calc hash value of groupby expr", K(ret));
+      }
     }
   }
+  return ret;
 }
 
 int ObHashGroupByOp::eval_groupby_exprs_batch(const ObChunkDatumStore::StoredRow **store_rows,
@@ -1954,8 +1958,10 @@ int ObHashGroupByOp::batch_process_duplicate_data(
       //       and evenly several times, so we should implement don't calculate aggregate functions
       //       and output the duplicate data
       int64_t tmp_group_cnt = 0;
-      if (nullptr == store_rows) {
-        calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
+      if (nullptr != store_rows) {
+      } else if (OB_FAIL(calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs))) {
+        LOG_WARN("failed to calc groupby exprs hash batch", K(ret));
+      } else {
         local_group_rows_.prefetch(child_brs, hash_vals_);
       }
       for (int64_t i = 0; OB_SUCC(ret) && i < child_brs.size_; i++) {
@@ -2213,8 +2219,10 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
   } else if (no_non_distinct_aggr_) {
     // no groupby exprs, don't calculate the last duplicate data for non-distinct aggregate
   } else {
-    if (!group_rows_arr_.is_valid_ && nullptr == store_rows) {
-      calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
+    if (group_rows_arr_.is_valid_ || nullptr != store_rows) {
+    } else if (OB_FAIL(calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs))) {
+      LOG_WARN("failed to calc groupby exprs hash batch", K(ret));
+    } else {
       local_group_rows_.prefetch(child_brs, hash_vals_);
       batch_hash_calculated = true;
     }
@@ -2235,7 +2243,9 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
           aggr_code = aggr_code_datum->get_int();
           if (aggr_code < MY_SPEC.dist_aggr_group_idxes_.count()) {
             if (!batch_hash_calculated) {
-              calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
+              if (OB_FAIL(calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs))) {
+                LOG_WARN("failed to calc groupby exprs hash batch", K(ret));
+              }
               batch_hash_calculated = true;
             }
             ++distinct_data_idx;
@@ -2274,13 +2284,16 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
                   && !need_start_dump(input_rows, est_part_cnt, force_check_dump))) {
         // add new local group
         if (!batch_hash_calculated) {
-          calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
+          if (OB_FAIL(calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs))) {
+            LOG_WARN("failed to calc groupby exprs hash batch", K(ret));
+          }
           batch_hash_calculated = true;
         }
         ++agged_row_cnt_;
         ++agged_group_cnt_;
         ObGroupRowItem *tmp_gr_item = NULL;
-        if (OB_FAIL(alloc_group_item(tmp_gr_item))) {
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(alloc_group_item(tmp_gr_item))) {
           LOG_WARN("failed to alloc group item", K(ret));
         } else {
           tmp_gr_item->is_expr_row_ = true;
@@ -2298,7 +2311,9 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
         }
       } else {
         if (!batch_hash_calculated) {
-          calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
+          if (OB_FAIL(calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs))) {
+            LOG_WARN("failed to calc groupby exprs hash batch", K(ret));
+          }
           batch_hash_calculated = true;
         }
         // need dump
@@ -2306,7 +2321,7 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
         group_rows_arr_.is_valid_ = false;
         batch_row_gri_ptrs_[i] = NULL;
         curr_gr_item.hash_ = hash_vals_[i];
-        if (OB_UNLIKELY(NULL == bloom_filter)) {
+        if (OB_SUCC(ret) && OB_UNLIKELY(NULL == bloom_filter)) {
           if (OB_FAIL(setup_dump_env(part_id, max(input_rows, loop_cnt), parts, part_cnt,
                                     bloom_filter))) {
             LOG_WARN("setup dump environment failed", K(ret));
@@ -402,8 +402,8 @@ private:
                  const ObBatchRows *&child_brs);
   int eval_groupby_exprs_batch(const ObChunkDatumStore::StoredRow **store_rows,
                                const ObBatchRows &child_brs);
-  void calc_groupby_exprs_hash_batch(ObIArray<ObExpr *> &groupby_exprs,
-                                     const ObBatchRows &child_brs);
+  int calc_groupby_exprs_hash_batch(ObIArray<ObExpr *> &groupby_exprs,
+                                    const ObBatchRows &child_brs);
 
   int group_child_batch_rows(const ObChunkDatumStore::StoredRow **store_rows,
                              const int64_t input_rows,
@@ -488,7 +488,8 @@ ObChunkDatumStore::ObChunkDatumStore(common::ObIAllocator *alloc /* = NULL */)
     mem_hold_(0), mem_used_(0), max_hold_mem_(0),
     allocator_(NULL == alloc ? &inner_allocator_ : alloc),
     row_extend_size_(0), callback_(nullptr), batch_ctx_(NULL),
-    tmp_dump_blk_(nullptr)
+    tmp_dump_blk_(nullptr), compressor_(NULL), dumped_blk_sizes_(),
+    compress_buf_(NULL), compress_buf_size_(0)
 {
   io_.fd_ = -1;
   io_.dir_id_ = -1;
@@ -519,6 +520,31 @@ int ObChunkDatumStore::init(int64_t mem_limit,
   min_blk_size_ = INT64_MAX;
   io_.fd_ = -1;
   row_extend_size_ = row_extend_size;
+  dumped_blk_sizes_.set_attr(ObMemAttr(tenant_id, label, mem_ctx_id));
+  ObCompressorType compressor_type = NONE_COMPRESSOR;
+  if (OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(
+      GCONF._chunk_row_store_compress_func, compressor_type))) {
+    LOG_WARN("get spill compressor type failed", K(ret));
+  } else if (OB_FAIL(set_compressor_type(compressor_type))) {
+    LOG_WARN("set spill compressor failed", K(ret), K(compressor_type));
+  }
+  return ret;
+}
+
+int ObChunkDatumStore::set_compressor_type(const ObCompressorType type)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = NULL;
+  if (is_file_open()) {
+    ret = OB_STATE_NOT_MATCH;
+    LOG_WARN("can not change compressor after dumped", K(ret), K(type), K_(io_.fd));
+  } else if (NONE_COMPRESSOR == type || INVALID_COMPRESSOR == type) {
+    compressor_ = NULL;
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor))) {
+    LOG_WARN("get compressor failed", K(ret), K(type));
+  } else {
+    compressor_ = compressor;
+  }
   return ret;
 }
 
@@ -536,6 +562,7 @@ void ObChunkDatumStore::reset()
   }
   file_size_ = 0;
   n_block_in_file_ = 0;
+  dumped_blk_sizes_.reset();
 
   while (!blocks_.is_empty()) {
     Block *item = blocks_.remove_first();
@@ -552,6 +579,7 @@ void ObChunkDatumStore::reset()
   cur_blk_ = NULL;
   cur_blk_buffer_ = nullptr;
   free_tmp_dump_blk(); // just in case, not necessary. tmp block always freed instantly after use
+  free_compress_buf();
   while (!free_list_.is_empty()) {
     Block *item = free_list_.remove_first();
     mem_hold_ -= item->get_buffer()->mem_size();
@@ -764,12 +792,11 @@ inline int ObChunkDatumStore::dump_one_block(BlockBuffer *item)
                                       item->get_block()->blk_size_);
       tmp_dump_blk_->rows_ = item->get_block()->rows_;
       tmp_dump_blk_->get_buffer()->fast_advance(item->data_size() - BlockBuffer::HEAD_SIZE);
-      if (OB_FAIL(write_file(tmp_dump_blk_->get_buffer()->data(),
-                             tmp_dump_blk_->get_buffer()->capacity()))) {
+      if (OB_FAIL(write_block(tmp_dump_blk_->get_buffer()))) {
         LOG_WARN("write block to file failed");
       }
     }
-  } else if (OB_FAIL(write_file(item->data(), item->capacity()))) {
+  } else if (OB_FAIL(write_block(item))) {
     LOG_WARN("write block to file failed");
   }
   if (OB_SUCC(ret)) {
@@ -783,6 +810,74 @@ inline int ObChunkDatumStore::dump_one_block(BlockBuffer *item)
   return ret;
 }
 
+int ObChunkDatumStore::write_block(BlockBuffer *item)
+{
+  int ret = OB_SUCCESS;
+  if (NULL == compressor_) {
+    if (OB_FAIL(write_file(item->data(), item->capacity()))) {
+      LOG_WARN("write block to file failed", K(ret));
+    }
+  } else {
+    const int64_t head_size = sizeof(CompressedBlockHeader);
+    const int64_t data_size = item->data_size();
+    int64_t max_overflow_size = 0;
+    int64_t compressed_size = 0;
+    int64_t dump_size = 0;
+    if (OB_FAIL(compressor_->get_max_overflow_size(data_size, max_overflow_size))) {
+      LOG_WARN("get max overflow size failed", K(ret), K(data_size));
+    } else if (OB_FAIL(ensure_compress_buf(head_size + data_size + max_overflow_size))) {
+      LOG_WARN("prepare compress buffer failed", K(ret), K(data_size), K(max_overflow_size));
+    } else if (OB_FAIL(compressor_->compress(item->data(), data_size, compress_buf_ + head_size,
+                                             compress_buf_size_ - head_size, compressed_size))) {
+      LOG_WARN("compress block failed", K(ret), K(data_size));
+    } else if (head_size + compressed_size >= item->capacity()) {
+      // not compressible, dump the original block
+      dump_size = item->capacity();
+      if (OB_FAIL(write_file(item->data(), dump_size))) {
+        LOG_WARN("write block to file failed", K(ret));
+      }
+    } else {
+      CompressedBlockHeader *header = new (compress_buf_) CompressedBlockHeader();
+      header->blk_size_ = item->get_block()->blk_size_;
+      header->data_size_ = static_cast<uint32_t>(data_size);
+      header->compressed_size_ = static_cast<uint32_t>(compressed_size);
+      dump_size = head_size + compressed_size;
+      if (OB_FAIL(write_file(compress_buf_, dump_size))) {
+        LOG_WARN("write compressed block to file failed", K(ret), KPC(header));
+      }
+    }
+    if (OB_SUCC(ret) && OB_FAIL(dumped_blk_sizes_.push_back(dump_size))) {
+      LOG_WARN("push back dumped block size failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObChunkDatumStore::ensure_compress_buf(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (size > compress_buf_size_) {
+    free_compress_buf();
+    const int64_t buf_size = next_pow2(size);
+    if (OB_ISNULL(compress_buf_ = static_cast<char *>(alloc_blk_mem(buf_size, false)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc compress buffer failed", K(ret), K(buf_size));
+    } else {
+      compress_buf_size_ = buf_size;
+    }
+  }
+  return ret;
+}
+
+void ObChunkDatumStore::free_compress_buf()
+{
+  if (NULL != compress_buf_) {
+    free_blk_mem(compress_buf_, compress_buf_size_);
+    compress_buf_ = NULL;
+    compress_buf_size_ = 0;
+  }
+}
+
 // only clean memory data
 int ObChunkDatumStore::clean_memory_data(bool reuse)
 {
@@ -865,6 +960,7 @@ int ObChunkDatumStore::dump(bool reuse, bool all_dump, int64_t dumped_size)
       }
     }
     free_tmp_dump_blk();
+    free_compress_buf();
     if (all_dump && (mem_used_ != 0 || (!reuse && mem_hold_ != 0) || blocks_.get_size() != 0)) {
       LOG_WARN("hold mem after dump", K_(mem_used), K(reuse), K_(mem_hold),
           K(blocks_.get_size()), K(free_list_.get_size()));
@@ -2485,6 +2581,12 @@ int ObChunkDatumStore::Iterator::read_next_blk()
       LOG_WARN("aio wait failed", K(ret));
     }
   }
+  if (OB_SUCC(ret) && store_->is_dump_compressed()
+      && reinterpret_cast<CompressedBlockHeader *>(aio_blk_)->magic_check()) {
+    if (OB_FAIL(decompress_aio_blk())) {
+      LOG_WARN("decompress block failed", K(ret));
+    }
+  }
   if (OB_SUCC(ret) && !aio_blk_->magic_check()) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("read corrupt data", K(ret), K(aio_blk_->magic_),
@@ -2539,18 +2641,70 @@ int ObChunkDatumStore::Iterator::prefetch_next_blk()
 {
   int ret = OB_SUCCESS;
   CK(NULL == aio_blk_);
-  const int64_t block_size = store_->min_blk_size_;
-  if (OB_FAIL(alloc_block(aio_blk_, block_size))) {
+  int64_t block_size = store_->min_blk_size_;
+  int64_t read_size = 0;
+  if (OB_FAIL(ret)) {
+  } else if (store_->is_dump_compressed()) {
+    // dumped blocks are variable-length, read exactly the next one
+    const int64_t blk_idx = cur_nth_blk_ + 1;
+    if (OB_UNLIKELY(blk_idx < 0 || blk_idx >= store_->dumped_blk_sizes_.count())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected dumped block index", K(ret), K(blk_idx),
+               K(store_->dumped_blk_sizes_.count()));
+    } else {
+      read_size = store_->dumped_blk_sizes_.at(blk_idx);
+      block_size = read_size + sizeof(BlockBuffer);
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(alloc_block(aio_blk_, block_size))) {
     LOG_WARN("allocate block buffer failed", K(ret));
   } else {
     aio_blk_buf_ = aio_blk_->get_buffer();
-    if (OB_FAIL(aio_read((char *)aio_blk_, aio_blk_buf_->capacity()))) {
+    read_size = store_->is_dump_compressed() ? read_size : aio_blk_buf_->capacity();
+    if (OB_FAIL(aio_read((char *)aio_blk_, read_size))) {
       LOG_WARN("aio read failed", K(ret));
     }
   }
   return ret;
 }
 
+int ObChunkDatumStore::Iterator::decompress_aio_blk()
+{
+  int ret = OB_SUCCESS;
+  const CompressedBlockHeader *header = reinterpret_cast<CompressedBlockHeader *>(aio_blk_);
+  Block *blk = NULL;
+  int64_t data_size = 0;
+  if (OB_UNLIKELY(sizeof(*header) + header->compressed_size_ > aio_blk_buf_->capacity())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("read corrupt compressed block", K(ret), KPC(header), K(aio_blk_buf_->capacity()));
+  } else if (OB_FAIL(alloc_block(blk, header->blk_size_ + sizeof(BlockBuffer)))) {
+    LOG_WARN("alloc block failed", K(ret), KPC(header));
+  } else {
+    BlockBuffer *blk_buf = blk->get_buffer();
+    if (OB_FAIL(store_->compressor_->decompress(header->compressed_data(),
+                                                header->compressed_size_,
+                                                reinterpret_cast<char *>(blk),
+                                                blk_buf->capacity(),
+                                                data_size))) {
+      LOG_WARN("decompress block failed", K(ret), KPC(header));
+    } else if (OB_UNLIKELY(data_size != header->data_size_ || !blk->magic_check()
+                           || blk->blk_size_ != header->blk_size_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("decompressed block mismatch", K(ret), KPC(header), K(data_size), KPC(blk));
+    }
+    if (OB_SUCC(ret)) {
+      free_block(aio_blk_, aio_blk_buf_->mem_size());
+      aio_blk_ = blk;
+      aio_blk_buf_ = blk_buf;
+    } else {
+      const bool force_free = true;
+      free_block(blk, blk_buf->mem_size(), force_free);
+    }
+  }
+  return ret;
+}
+
 int ObChunkDatumStore::Iterator::alloc_block(Block *&blk, const int64_t size)
 {
   int ret = OB_SUCCESS;
@@ -15,6 +15,8 @@
 
 #include "share/ob_define.h"
 #include "lib/container/ob_se_array.h"
+#include "lib/container/ob_array.h"
+#include "lib/compress/ob_compressor_pool.h"
 #include "lib/allocator/page_arena.h"
 #include "lib/utility/ob_print_utils.h"
 #include "lib/list/ob_dlist.h"
@@ -482,6 +484,21 @@ public:
     char payload_[0];
   } __attribute__((packed));
 
+  // Head of block dumped with compression, followed by the compressed block head and used
+  // payload. The unused tail of block is not dumped.
+  struct CompressedBlockHeader
+  {
+    static const int64_t MAGIC = 0xbc054e02d8536316;
+    CompressedBlockHeader() : magic_(MAGIC), blk_size_(0), data_size_(0), compressed_size_(0) {}
+    inline bool magic_check() const { return MAGIC == magic_; }
+    inline const char *compressed_data() const { return reinterpret_cast<const char *>(this + 1); }
+    TO_STRING_KV(K_(magic), K_(blk_size), K_(data_size), K_(compressed_size));
+    int64_t magic_;
+    uint32_t blk_size_;  // blk_size_ of the original block
+    uint32_t data_size_; // size of block head and used payload before compression
+    uint32_t compressed_size_;
+  } __attribute__((packed));
+
   struct BlockList
   {
   public:
@@ -769,6 +786,7 @@ public:
     inline void set_read_mem_iter_end() { iter_end_flag_ |= MEM_ITER_END; }
     int prefetch_next_blk();
     int read_next_blk();
+    int decompress_aio_blk();
     int aio_read(char *buf, const int64_t size);
     int aio_wait();
     int alloc_block(Block *&blk, const int64_t size);
@@ -991,6 +1009,10 @@ public:
   void set_dumped(bool dumped) { enable_dump_ = dumped; }
   inline int64_t get_mem_limit() { return mem_limit_; }
   void set_block_size(const int64_t size) { default_block_size_ = size; }
+  // Compress blocks dumped to temp file, must be set before dump.
+  // NONE_COMPRESSOR disables compression.
+  int set_compressor_type(const common::ObCompressorType type);
+  inline bool is_dump_compressed() const { return NULL != compressor_; }
   inline int64_t get_block_cnt() const { return n_blocks_; }
   inline int64_t get_block_list_cnt() { return blocks_.get_size(); }
   inline int64_t get_row_cnt() const { return row_cnt_; }
@@ -1081,6 +1103,9 @@ private:
       mem_used_ += used;
     }
   inline int dump_one_block(BlockBuffer *item);
+  int write_block(BlockBuffer *item);
+  int ensure_compress_buf(const int64_t size);
+  void free_compress_buf();
 
   int write_file(void *buf, int64_t size);
   int read_file(
@@ -1176,6 +1201,13 @@ private:
   BatchCtx *batch_ctx_;
   Block *tmp_dump_blk_;
 
+  // spill compression, dumped blocks are variable-length when compressor is set,
+  // the dumped size of each block is recorded for reading.
+  common::ObCompressor *compressor_;
+  common::ObArray<int64_t> dumped_blk_sizes_;
+  char *compress_buf_;
+  int64_t compress_buf_size_;
+
   DISALLOW_COPY_AND_ASSIGN(ObChunkDatumStore);
 };
 
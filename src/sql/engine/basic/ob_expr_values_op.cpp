@@ -188,7 +188,8 @@ ObExprValuesOp::ObExprValuesOp(ObExecContext &exec_ctx,
     cm_(CM_NONE),
     err_log_service_(get_eval_ctx()),
     err_log_rt_def_(),
-    has_sequence_(false)
+    has_sequence_(false),
+    batch_calc_(false)
 {
 }
 
@@ -222,6 +223,19 @@ int ObExprValuesOp::inner_open()
       LOG_WARN("unexpected child cnt", K(child_cnt_), K(ret));
     }
   }
+  if (OB_SUCC(ret) && MY_SPEC.is_vectorized()) {
+    // Rows are calculated into the datums of batch one by one, which needs output exprs to be
+    // batch result. Sequence child, array binding params and error logging are calculated
+    // row by row, one row per batch.
+    batch_calc_ = !has_sequence_
+                  && !MY_SPEC.contain_ab_param_
+                  && !MY_SPEC.err_log_ct_def_.is_error_logging_;
+    for (int64_t i = 0; batch_calc_ && i < MY_SPEC.output_.count(); ++i) {
+      if (OB_ISNULL(MY_SPEC.output_.at(i)) || !MY_SPEC.output_.at(i)->is_batch_result()) {
+        batch_calc_ = false;
+      }
+    }
+  }
   return ret;
 }
 
@@ -295,6 +309,53 @@ int ObExprValuesOp::inner_get_next_row()
   return ret;
 }
 
+int ObExprValuesOp::inner_get_next_batch(const int64_t max_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+  int64_t size = 0;
+  if (!batch_calc_) {
+    batch_info_guard.set_batch_size(1);
+    batch_info_guard.set_batch_idx(0);
+    if (OB_FAIL(inner_get_next_row())) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("get next row failed", K(ret));
+      }
+    } else {
+      size = 1;
+    }
+  } else {
+    // Each row has its own value exprs, so rows are still calculated one by one, but the
+    // per row work of inner_get_next_row() (status check, error logging) is done once for
+    // the batch. Column conversion is left to the DML operator, row by row.
+    const int64_t batch_size = std::min(max_row_cnt, MY_SPEC.max_batch_size_);
+    GET_PHY_PLAN_CTX(ctx_)->set_autoinc_id_tmp(0);
+    batch_info_guard.set_batch_size(batch_size);
+    if (OB_FAIL(try_check_status())) {
+      LOG_WARN("check physical plan status faild", K(ret));
+    }
+    while (OB_SUCC(ret) && size < batch_size) {
+      batch_info_guard.set_batch_idx(size);
+      clear_evaluated_flag();
+      if (OB_FAIL(calc_next_row())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("calc next row failed", K(ret), K(size));
+        }
+      } else {
+        ++size;
+      }
+    }
+  }
+  if (OB_ITER_END == ret) {
+    ret = OB_SUCCESS;
+    brs_.end_ = true;
+  }
+  if (OB_SUCC(ret)) {
+    brs_.size_ = size;
+  }
+  return ret;
+}
+
 void ObExprValuesOp::update_src_meta(ObDatumMeta &src_meta, const ObObjMeta &src_obj_meta, const ObAccuracy &src_obj_acc)
 {
   src_meta.type_ = src_obj_meta.get_type();
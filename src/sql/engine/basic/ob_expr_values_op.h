@@ -38,6 +38,9 @@ public:
       ins_values_batch_opt_(false)
   { }
 
+  // plan is vectorized for values with at least this number of rows
+  static const int64_t MIN_VECTORIZE_ROW_CNT = 16;
+
   int64_t get_value_count() const { return values_.count(); }
   int64_t get_is_strict_json_desc_count() const { return is_strict_json_desc_.count(); }
   virtual int serialize(char *buf,
@@ -68,6 +71,8 @@ public:
 
   virtual int inner_get_next_row() override;
 
+  virtual int inner_get_next_batch(const int64_t max_row_cnt) override;
+
   virtual int inner_close() override;
 
   virtual void destroy() override { ObOperator::destroy(); }
@@ -92,6 +97,8 @@ private:
   ObErrLogService err_log_service_;
   ObErrLogRtDef err_log_rt_def_;
   bool has_sequence_;
+  // calculate multiple rows into one batch, otherwise output one row per batch
+  bool batch_calc_;
 };
 
 } // end namespace sql
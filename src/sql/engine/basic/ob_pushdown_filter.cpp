@@ -11,6 +11,10 @@
  */
 
 #define USING_LOG_PREFIX SQL_ENG
+
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 #include "ob_pushdown_filter.h"
 #include "sql/engine/ob_physical_plan.h"
 #include "sql/engine/ob_exec_context.h"
@@ -19,6 +23,10 @@
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 #include "storage/blocksstable/ob_datum_row.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
+#include "sql/engine/expr/ob_expr_like.h"
+#include "sql/engine/px/p2p_datahub/ob_p2p_dh_msg.h"
+#include "share/ob_cluster_version.h"
 
 namespace oceanbase
 {
@@ -32,7 +40,8 @@ ObPushdownFilterFactory::PDFilterAllocFunc ObPushdownFilterFactory::PD_FILTER_AL
   ObPushdownFilterFactory::alloc<ObPushdownBlackFilterNode, BLACK_FILTER>,
   ObPushdownFilterFactory::alloc<ObPushdownWhiteFilterNode, WHITE_FILTER>,
   ObPushdownFilterFactory::alloc<ObPushdownAndFilterNode, AND_FILTER>,
-  ObPushdownFilterFactory::alloc<ObPushdownOrFilterNode, OR_FILTER>
+  ObPushdownFilterFactory::alloc<ObPushdownOrFilterNode, OR_FILTER>,
+  ObPushdownFilterFactory::alloc<ObPushdownDynamicFilterNode, DYNAMIC_FILTER>
 };
 
 ObPushdownFilterFactory::FilterExecutorAllocFunc ObPushdownFilterFactory::FILTER_EXECUTOR_ALLOC[PushdownExecutorType::MAX_EXECUTOR_TYPE] =
@@ -40,7 +49,8 @@ ObPushdownFilterFactory::FilterExecutorAllocFunc ObPushdownFilterFactory::FILTER
   ObPushdownFilterFactory::alloc<ObBlackFilterExecutor, ObPushdownBlackFilterNode, BLACK_FILTER_EXECUTOR>,
   ObPushdownFilterFactory::alloc<ObWhiteFilterExecutor, ObPushdownWhiteFilterNode, WHITE_FILTER_EXECUTOR>,
   ObPushdownFilterFactory::alloc<ObAndFilterExecutor, ObPushdownAndFilterNode, AND_FILTER_EXECUTOR>,
-  ObPushdownFilterFactory::alloc<ObOrFilterExecutor, ObPushdownOrFilterNode, OR_FILTER_EXECUTOR>
+  ObPushdownFilterFactory::alloc<ObOrFilterExecutor, ObPushdownOrFilterNode, OR_FILTER_EXECUTOR>,
+  ObPushdownFilterFactory::alloc<ObDynamicFilterExecutor, ObPushdownDynamicFilterNode, DYNAMIC_FILTER_EXECUTOR>
 };
 
 OB_SERIALIZE_MEMBER(ObPushdownFilterNode, type_, n_child_, col_ids_);
@@ -50,6 +60,7 @@ OB_SERIALIZE_MEMBER((ObPushdownBlackFilterNode,ObPushdownFilterNode),
                     column_exprs_, filter_exprs_);
 OB_SERIALIZE_MEMBER((ObPushdownWhiteFilterNode,ObPushdownFilterNode),
                     expr_, op_type_);
+OB_SERIALIZE_MEMBER((ObPushdownDynamicFilterNode,ObPushdownWhiteFilterNode));
 
 int ObPushdownBlackFilterNode::merge(ObIArray<ObPushdownFilterNode*> &merged_node)
 {
@@ -105,7 +116,8 @@ const common::ObCmpOp ObPushdownWhiteFilterNode::WHITE_OP_TO_CMP_OP[] = {
   CO_MAX, // WHITE_OP_BT
   CO_MAX, // WHITE_OP_IN
   CO_MAX, // WHITE_OP_NU
-  CO_MAX  // WHITE_OP_NN
+  CO_MAX, // WHITE_OP_NN
+  CO_MAX  // WHITE_OP_LI
 };
 
 int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
@@ -139,6 +151,9 @@ int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
     case T_FUN_SYS_ISNULL:
       op_type_ = WHITE_OP_NU;
       break;
+    case T_OP_LIKE:
+      op_type_ = WHITE_OP_LI;
+      break;
     default:
       ret = OB_ERR_UNEXPECTED;
       break;
@@ -162,6 +177,10 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
     LOG_WARN("Unexpected first child expr: nullptr", K(ret));
   } else if (ObRawExpr::EXPR_COLUMN_REF != child->get_expr_class()) {
     need_check = false;
+  } else if (T_OP_LIKE == raw_expr->get_expr_type()) {
+    if (OB_FAIL(is_like_white_mode(raw_expr, need_check))) {
+      LOG_WARN("Failed to check like white filter", K(ret));
+    }
   } else {
     const ObObjMeta &col_meta = child->get_result_meta();
     for (int64_t i = 1; OB_SUCC(ret) && need_check && i < raw_expr->get_param_count(); i++) {
@@ -189,6 +208,7 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
       case T_OP_GT:
       case T_OP_NE:
       case T_FUN_SYS_ISNULL:
+      case T_OP_LIKE:
         is_white = true;
         break;
       default:
@@ -198,6 +218,40 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
   return ret;
 }
 
+// Like is matched on the stored string directly, so the column should be varchar
+// without padding, and be compared with the collation of the column.
+int ObPushdownFilterConstructor::is_like_white_mode(const ObRawExpr *raw_expr, bool &is_white)
+{
+  int ret = OB_SUCCESS;
+  const ObRawExpr *col_expr = nullptr;
+  const ObRawExpr *pattern_expr = nullptr;
+  const ObRawExpr *escape_expr = nullptr;
+  is_white = false;
+  if (OB_ISNULL(raw_expr)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null argument", K(ret));
+  } else if (T_OP_LIKE != raw_expr->get_expr_type() || 3 != raw_expr->get_param_count()
+             || lib::is_oracle_mode()) {
+  } else if (OB_ISNULL(col_expr = raw_expr->get_param_expr(0))
+             || OB_ISNULL(pattern_expr = raw_expr->get_param_expr(1))
+             || OB_ISNULL(escape_expr = raw_expr->get_param_expr(2))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null child expr", K(ret), KP(col_expr), KP(pattern_expr), KP(escape_expr));
+  } else if (ObRawExpr::EXPR_COLUMN_REF != col_expr->get_expr_class()
+             || !pattern_expr->is_const_expr()
+             || !escape_expr->is_const_expr()) {
+  } else {
+    const ObObjMeta &col_meta = col_expr->get_result_meta();
+    const ObObjMeta &pattern_meta = pattern_expr->get_result_meta();
+    is_white = ObVarcharType == col_meta.get_type()
+        && (ObVarcharType == pattern_meta.get_type() || ObCharType == pattern_meta.get_type())
+        && col_meta.get_collation_type() == pattern_meta.get_collation_type()
+        && col_meta.get_collation_type()
+           == raw_expr->get_result_type().get_calc_collation_type();
+  }
+  return ret;
+}
+
 int ObPushdownFilterConstructor::create_black_filter_node(
     ObRawExpr *raw_expr,
     ObPushdownFilterNode *&filter_node)
@@ -292,6 +346,72 @@ int ObPushdownFilterConstructor::create_white_filter_node(
   return ret;
 }
 
+int ObPushdownFilterConstructor::is_dynamic_filter_mode(const ObRawExpr *raw_expr, bool &is_dynamic)
+{
+  int ret = OB_SUCCESS;
+  const ObRawExpr *child = nullptr;
+  is_dynamic = false;
+  if (OB_ISNULL(raw_expr)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null argument", K(ret));
+  } else if (T_OP_RUNTIME_FILTER != raw_expr->get_expr_type()
+             || 1 != raw_expr->get_param_count()) {
+    // bloom filter and multi join keys are executed as black filter
+  } else if (GET_MIN_CLUSTER_VERSION() < CLUSTER_VERSION_4_2_0_0) {
+    // dynamic filter node can not be deserialized by observers of old version
+  } else if (RuntimeFilterType::RANGE != raw_expr->get_runtime_filter_type()
+             && RuntimeFilterType::IN != raw_expr->get_runtime_filter_type()) {
+  } else if (OB_ISNULL(child = raw_expr->get_param_expr(0))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null child expr", K(ret));
+  } else if (ObRawExpr::EXPR_COLUMN_REF == child->get_expr_class()
+             && !child->get_result_meta().is_lob_storage()) {
+    is_dynamic = true;
+  }
+  return ret;
+}
+
+int ObPushdownFilterConstructor::create_dynamic_filter_node(
+    ObRawExpr *raw_expr,
+    ObPushdownFilterNode *&filter_node)
+{
+  int ret = OB_SUCCESS;
+  ObExpr *expr = nullptr;
+  ObSEArray<ObRawExpr *, 4> column_exprs;
+  ObPushdownDynamicFilterNode *dynamic_filter_node = nullptr;
+  if (OB_ISNULL(raw_expr)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null raw expr", K(ret));
+  } else if (OB_FAIL(static_cg_.generate_rt_expr(*raw_expr, expr))) {
+    LOG_WARN("Failed to generate rt expr", K(ret));
+  } else if (OB_FAIL(ObRawExprUtils::extract_column_exprs(raw_expr, column_exprs))) {
+    LOG_WARN("Failed to extract column exprs", K(ret));
+  } else if (1 != column_exprs.count()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected dynamic filter expr, column exprs count not 1", K(ret), K(column_exprs.count()));
+  } else if (OB_FAIL(factory_.alloc(PushdownFilterType::DYNAMIC_FILTER, 0, filter_node))) {
+    LOG_WARN("Failed to alloc pushdown filter", K(ret));
+  } else if (OB_ISNULL(filter_node)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Dynamic filter node is null", K(ret));
+  } else if (FALSE_IT(dynamic_filter_node = static_cast<ObPushdownDynamicFilterNode *>(filter_node))) {
+  } else if (OB_FAIL(dynamic_filter_node->set_op_type(
+              RuntimeFilterType::RANGE == raw_expr->get_runtime_filter_type() ? T_OP_BTW : T_OP_IN))) {
+    LOG_WARN("Failed to set dynamic filter op type", K(ret), K(raw_expr->get_runtime_filter_type()));
+  } else {
+    ObColumnRefRawExpr *sub_ref_expr = static_cast<ObColumnRefRawExpr *>(column_exprs.at(0));
+    if (OB_FAIL(dynamic_filter_node->col_ids_.init(column_exprs.count()))) {
+      LOG_WARN("Failed to init col ids", K(ret));
+    } else if (OB_FAIL(dynamic_filter_node->col_ids_.push_back(sub_ref_expr->get_column_id()))) {
+      LOG_WARN("Failed to push back col id", K(ret));
+    } else {
+      dynamic_filter_node->expr_ = expr;
+      LOG_DEBUG("[PUSHDOWN] dynamic_filter_node", K(*raw_expr), K(*expr), K(dynamic_filter_node->col_ids_));
+    }
+  }
+  return ret;
+}
+
 int ObPushdownFilterConstructor::merge_filter_node(
     ObPushdownFilterNode *dst,
     ObPushdownFilterNode *other,
@@ -374,11 +494,18 @@ int ObPushdownFilterConstructor::generate(ObRawExpr *raw_expr, ObPushdownFilterN
 {
   int ret = OB_SUCCESS;
   bool is_white = false;
+  bool is_dynamic = false;
   ObItemType op_type = T_INVALID;
   ObPushdownFilterNode *filter_node = nullptr;
   if (OB_ISNULL(raw_expr) || OB_ISNULL(alloc_)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid null parameter", K(ret), KP(raw_expr), KP(alloc_));
+  } else if (OB_FAIL(is_dynamic_filter_mode(raw_expr, is_dynamic))) {
+    LOG_WARN("Failed to check dynamic filter", K(ret));
+  } else if (is_dynamic) {
+    if (OB_FAIL(create_dynamic_filter_node(raw_expr, filter_node))) {
+      LOG_WARN("Failed to create dynamic pushdown filter node", K(ret));
+    }
   } else if (OB_FAIL(is_white_mode(raw_expr, is_white))) {
     LOG_WARN("Failed to get filter type", K(ret));
   } else if (is_white) {
@@ -995,6 +1122,8 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
     check_null_params();
     if (WHITE_OP_IN == filter_.get_op_type() && OB_FAIL(init_obj_set())) {
       LOG_WARN("Failed to init Object hash set in filter node", K(ret));
+    } else if (WHITE_OP_LI == filter_.get_op_type() && OB_FAIL(init_like_matcher())) {
+      LOG_WARN("Failed to init like matcher in filter node", K(ret));
     }
   }
   return ret;
@@ -1003,7 +1132,9 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
 void ObWhiteFilterExecutor::check_null_params()
 {
   null_param_contained_ = false;
-  for (int64_t i = 0; !null_param_contained_ && i < params_.count(); i++) {
+  // null escape of like means the default one, only null pattern matters
+  const int64_t param_cnt = WHITE_OP_LI == filter_.get_op_type() ? MIN(1, params_.count()) : params_.count();
+  for (int64_t i = 0; !null_param_contained_ && i < param_cnt; i++) {
     if ((lib::is_mysql_mode() && params_.at(i).is_null())
         || (lib::is_oracle_mode() && params_.at(i).is_null_oracle())) {
       null_param_contained_ = true;
@@ -1033,6 +1164,21 @@ int ObWhiteFilterExecutor::init_obj_set()
   return ret;
 }
 
+int ObWhiteFilterExecutor::init_like_matcher()
+{
+  int ret = OB_SUCCESS;
+  like_matcher_.reset();
+  if (OB_UNLIKELY(2 != params_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected params count of like filter", K(ret), K_(params));
+  } else if (null_param_contained_) {
+    // nothing matches null pattern
+  } else if (OB_FAIL(like_matcher_.init(params_.at(0), params_.at(1)))) {
+    LOG_WARN("Failed to init like matcher", K(ret), K_(params));
+  }
+  return ret;
+}
+
 int ObWhiteFilterExecutor::exist_in_obj_set(const ObObj &obj, bool &is_exist) const
 {
   int ret = param_set_.exist_refactored(obj);
@@ -1048,6 +1194,240 @@ int ObWhiteFilterExecutor::exist_in_obj_set(const ObObj &obj, bool &is_exist) co
   return ret;
 }
 
+void ObWhiteFilterLikeMatcher::reset()
+{
+  is_inited_ = false;
+  mode_ = GENERAL;
+  cs_type_ = CS_TYPE_INVALID;
+  escape_wc_ = 0;
+  pattern_.reset();
+  literal_.reset();
+}
+
+int ObWhiteFilterLikeMatcher::init(const ObObj &pattern, const ObObj &escape)
+{
+  int ret = OB_SUCCESS;
+  ObString escape_str;
+  ObCollationType escape_cs_type = escape.get_collation_type();
+  reset();
+  if (OB_UNLIKELY(pattern.is_null() || !pattern.is_string_type())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid like pattern", K(ret), K(pattern));
+  } else if (escape.is_null() || escape.get_string().empty()) {
+    // same as like expr, use '\\' by default
+    escape_str.assign_ptr("\\", 1);
+    escape_cs_type = CS_TYPE_UTF8MB4_BIN;
+  } else {
+    escape_str = escape.get_string();
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(ObExprLike::calc_escape_wc(escape_cs_type, escape_str, escape_wc_))) {
+    LOG_WARN("Failed to calc escape wc", K(ret), K(escape_str), K(escape_cs_type));
+  } else {
+    cs_type_ = pattern.get_collation_type();
+    pattern_ = pattern.get_string();
+    analyze_pattern();
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObWhiteFilterLikeMatcher::analyze_pattern()
+{
+  mode_ = GENERAL;
+  // '%' and '_' are single byte in both collations, bytes of multi-byte utf8 chars are >= 0x80
+  if (CS_TYPE_UTF8MB4_BIN == cs_type_ || CS_TYPE_BINARY == cs_type_) {
+    const char *ptr = pattern_.ptr();
+    const int64_t len = pattern_.length();
+    int64_t start = 0;
+    int64_t end = len;
+    while (start < end && '%' == ptr[start]) {
+      ++start;
+    }
+    while (end > start && '%' == ptr[end - 1]) {
+      --end;
+    }
+    bool is_literal = true;
+    for (int64_t i = start; is_literal && i < end; ++i) {
+      const uint8_t c = static_cast<uint8_t>(ptr[i]);
+      if ('%' == c || '_' == c) {
+        is_literal = false;
+      } else if (escape_wc_ < 0x80 ? c == escape_wc_ : c >= 0x80) {
+        // escape char, or may be part of a multi-byte escape char
+        is_literal = false;
+      }
+    }
+    if (is_literal) {
+      const bool leading = start > 0;
+      const bool trailing = end < len;
+      literal_.assign_ptr(ptr + start, static_cast<int32_t>(end - start));
+      if (literal_.empty()) {
+        mode_ = leading ? ALL : EXACT;
+      } else if (leading && trailing) {
+        mode_ = SUBSTRING;
+      } else if (leading) {
+        mode_ = SUFFIX;
+      } else if (trailing) {
+        mode_ = PREFIX;
+      } else {
+        mode_ = EXACT;
+      }
+    }
+  }
+}
+
+int ObWhiteFilterLikeMatcher::match(const ObString &text, bool &matched) const
+{
+  int ret = OB_SUCCESS;
+  matched = false;
+  const int64_t text_len = text.length();
+  const int64_t lit_len = literal_.length();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Like matcher not inited", K(ret));
+  } else {
+    switch (mode_) {
+      case ALL: {
+        matched = true;
+        break;
+      }
+      case EXACT: {
+        matched = text_len == lit_len && 0 == MEMCMP(text.ptr(), literal_.ptr(), lit_len);
+        break;
+      }
+      case PREFIX: {
+        matched = text_len >= lit_len && 0 == MEMCMP(text.ptr(), literal_.ptr(), lit_len);
+        break;
+      }
+      case SUFFIX: {
+        matched = text_len >= lit_len
+            && 0 == MEMCMP(text.ptr() + text_len - lit_len, literal_.ptr(), lit_len);
+        break;
+      }
+      case SUBSTRING: {
+        matched = nullptr != substring_search(text.ptr(), text_len, literal_.ptr(), lit_len);
+        break;
+      }
+      default: {
+        if (text.empty() && pattern_.empty()) {
+          matched = true;
+        } else {
+          matched = ObCharset::wildcmp(cs_type_, text, pattern_, escape_wc_,
+                                       static_cast<int32_t>('_'), static_cast<int32_t>('%'));
+        }
+        break;
+      }
+    }
+  }
+  return ret;
+}
+
+// Compare the first and the last byte of @lit with 16 candidate positions at once,
+// memcmp is only called for positions both bytes hit.
+const char *ObWhiteFilterLikeMatcher::substring_search(
+    const char *text,
+    const int64_t text_len,
+    const char *lit,
+    const int64_t lit_len)
+{
+  const char *res = nullptr;
+  if (OB_UNLIKELY(lit_len <= 0)) {
+    res = text;
+  } else if (text_len < lit_len) {
+  } else if (1 == lit_len) {
+    res = static_cast<const char *>(memchr(text, lit[0], text_len));
+  } else {
+    int64_t pos = 0;
+#if defined(__x86_64__)
+    const __m128i first = _mm_set1_epi8(lit[0]);
+    const __m128i last = _mm_set1_epi8(lit[lit_len - 1]);
+    for (; nullptr == res && pos + lit_len - 1 + 16 <= text_len; pos += 16) {
+      const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + pos));
+      const __m128i block_last = _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(text + pos + lit_len - 1));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+          _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+      while (0 != mask && nullptr == res) {
+        const int64_t offset = pos + __builtin_ctz(mask);
+        if (0 == MEMCMP(text + offset + 1, lit + 1, lit_len - 2)) {
+          res = text + offset;
+        }
+        mask &= mask - 1;
+      }
+    }
+#endif
+    if (nullptr == res && pos + lit_len <= text_len) {
+      res = static_cast<const char *>(MEMMEM(text + pos, text_len - pos, lit, lit_len));
+    }
+  }
+  return res;
+}
+
+int ObDynamicFilterExecutor::init_evaluated_datums()
+{
+  // params are filled by prepare_data() after the runtime filter msg is ready
+  params_.reset();
+  null_param_contained_ = false;
+  data_state_ = NOT_READY;
+  return OB_SUCCESS;
+}
+
+int ObDynamicFilterExecutor::prepare_data()
+{
+  int ret = OB_SUCCESS;
+  ObExecContext &exec_ctx = op_.get_eval_ctx().exec_ctx_;
+  ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx = nullptr;
+  const ObExpr *expr = filter_.expr_;
+  if (NOT_READY != data_state_) {
+  } else if (OB_ISNULL(expr) || OB_UNLIKELY(1 != expr->arg_cnt_) || OB_ISNULL(expr->args_[0])) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected runtime filter expr", K(ret), KPC(expr));
+  } else if (OB_ISNULL(join_filter_ctx = static_cast<ObExprJoinFilter::ObExprJoinFilterContext *>(
+              exec_ctx.get_expr_op_ctx(expr->expr_ctx_id_)))) {
+    // join filter ctx may be null in das, keep all rows
+    data_state_ = ALWAYS_TRUE;
+  } else {
+    if (join_filter_ctx->is_first_) {
+      join_filter_ctx->start_time_ = ObTimeUtility::current_time();
+      join_filter_ctx->is_first_ = false;
+    }
+    if (OB_FAIL(ObExprJoinFilter::check_rf_ready(exec_ctx, join_filter_ctx))) {
+      LOG_WARN("Failed to check runtime filter ready", K(ret));
+    } else if (!join_filter_ctx->is_ready() || OB_ISNULL(join_filter_ctx->rf_msg_)) {
+      // check again for the next micro block
+    } else {
+      ObP2PDatahubMsgBase *rf_msg = join_filter_ctx->rf_msg_;
+      const ObExpr &col_expr = *expr->args_[0];
+      // datums in the msg are of the join key type of the other side, they can be used
+      // as params of the column only if the key compare func is the column's own one
+      const ObDatumCmpFuncType col_cmp_func = lib::is_oracle_mode()
+          ? col_expr.basic_funcs_->null_last_cmp_ : col_expr.basic_funcs_->null_first_cmp_;
+      bool is_applicable = false;
+      if (!rf_msg->is_active()) {
+        data_state_ = ALWAYS_TRUE;
+      } else if (rf_msg->is_empty()) {
+        data_state_ = ALWAYS_FALSE;
+      } else if (1 != join_filter_ctx->cmp_funcs_.count()
+                 || col_cmp_func != join_filter_ctx->cmp_funcs_.at(0).cmp_func_) {
+        data_state_ = ALWAYS_TRUE;
+      } else if (OB_FAIL(rf_msg->prepare_storage_white_filter_data(col_expr, params_, is_applicable))) {
+        LOG_WARN("Failed to prepare white filter data", K(ret), KPC(rf_msg));
+      } else if (!is_applicable) {
+        data_state_ = ALWAYS_TRUE;
+      } else {
+        check_null_params();
+        if (WHITE_OP_IN == filter_.get_op_type() && OB_FAIL(init_obj_set())) {
+          LOG_WARN("Failed to init Object hash set in filter node", K(ret));
+        } else {
+          data_state_ = DATA_PREPARED;
+        }
+      }
+      LOG_DEBUG("[PUSHDOWN] dynamic filter prepared", K(ret), K_(data_state), K_(params));
+    }
+  }
+  return ret;
+}
+
 ObBlackFilterExecutor::~ObBlackFilterExecutor()
 {
   if (nullptr != eval_infos_) {
@@ -1417,6 +1797,13 @@ int ObFilterExecutorConstructor::apply(
         }
         break;
       }
+      case DYNAMIC_FILTER: {
+        ret = create_filter_executor<ObDynamicFilterExecutor, DYNAMIC_FILTER_EXECUTOR>(filter_tree, filter_executor, op);
+        if (OB_FAIL(ret)) {
+          LOG_WARN("failed to create filter executor", K(ret));
+        }
+        break;
+      }
       default:
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unexpected filter type", K(ret));
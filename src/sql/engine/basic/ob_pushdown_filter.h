@@ -56,6 +56,7 @@ enum PushdownFilterType
   WHITE_FILTER,
   AND_FILTER,
   OR_FILTER,
+  DYNAMIC_FILTER,
   MAX_FILTER_TYPE
 };
 
@@ -65,6 +66,7 @@ enum PushdownExecutorType
   WHITE_FILTER_EXECUTOR,
   AND_FILTER_EXECUTOR,
   OR_FILTER_EXECUTOR,
+  DYNAMIC_FILTER_EXECUTOR,
   MAX_EXECUTOR_TYPE
 };
 
@@ -174,7 +176,7 @@ enum ObWhiteFilterOperatorType
   WHITE_OP_IN, // in (1, 2, 3)
   WHITE_OP_NU, // is null
   WHITE_OP_NN, // is not null
-  // WHITE_OP_LI, // like
+  WHITE_OP_LI, // like 'abc%', params are pattern and escape
   WHITE_OP_MAX,
 };
 class ObPushdownWhiteFilterNode : public ObPushdownFilterNode
@@ -199,6 +201,20 @@ private:
   ObWhiteFilterOperatorType op_type_;
 };
 
+// Runtime filter (range/in) of PX join, params are filled by the runtime
+// filter msg when it is ready, and then executed as a white filter.
+class ObPushdownDynamicFilterNode : public ObPushdownWhiteFilterNode
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  ObPushdownDynamicFilterNode(common::ObIAllocator &alloc)
+      : ObPushdownWhiteFilterNode(alloc)
+  {
+    type_ = PushdownFilterType::DYNAMIC_FILTER;
+  }
+  ~ObPushdownDynamicFilterNode() {}
+};
+
 class ObPushdownFilterExecutor;
 class ObPushdownFilterNode;
 class ObPushdownFilterFactory
@@ -247,8 +263,11 @@ public:
 
 private:
   int is_white_mode(const ObRawExpr* raw_expr, bool &is_white);
+  int is_like_white_mode(const ObRawExpr *raw_expr, bool &is_white);
   int create_black_filter_node(ObRawExpr *raw_expr, ObPushdownFilterNode *&filter_tree);
   int create_white_filter_node(ObRawExpr *raw_expr, ObPushdownFilterNode *&filter_tree);
+  int is_dynamic_filter_mode(const ObRawExpr *raw_expr, bool &is_dynamic);
+  int create_dynamic_filter_node(ObRawExpr *raw_expr, ObPushdownFilterNode *&filter_tree);
   int merge_filter_node(
       ObPushdownFilterNode *dst,
       ObPushdownFilterNode *other,
@@ -307,7 +326,9 @@ public:
 
   // interface for storage
   virtual OB_INLINE bool is_filter_black_node() const { return type_ == BLACK_FILTER_EXECUTOR; }
-  virtual OB_INLINE bool is_filter_white_node() const { return type_ == WHITE_FILTER_EXECUTOR; }
+  virtual OB_INLINE bool is_filter_white_node() const
+  { return type_ == WHITE_FILTER_EXECUTOR || type_ == DYNAMIC_FILTER_EXECUTOR; }
+  virtual OB_INLINE bool is_filter_dynamic_node() const { return type_ == DYNAMIC_FILTER_EXECUTOR; }
   virtual OB_INLINE bool is_filter_node() const { return is_filter_black_node() || is_filter_white_node(); }
   virtual OB_INLINE bool is_logic_and_node() const { return type_ == AND_FILTER_EXECUTOR; }
   virtual OB_INLINE bool is_logic_or_node() const { return type_ == OR_FILTER_EXECUTOR; }
@@ -429,6 +450,48 @@ private:
   ObBitVector *skip_bit_;
 };
 
+// Pattern of LIKE white filter, analyzed once when the filter params are evaluated.
+// For binary collations, patterns with only leading / trailing '%' are matched by
+// memcmp / substring search on the stored string directly, others go to wildcmp.
+class ObWhiteFilterLikeMatcher
+{
+public:
+  enum MatchMode
+  {
+    GENERAL = 0,   // 'a_b%c', wildcmp of the collation
+    ALL,           // '%', any not null string
+    EXACT,         // 'abc'
+    PREFIX,        // 'abc%'
+    SUFFIX,        // '%abc'
+    SUBSTRING,     // '%abc%'
+  };
+  ObWhiteFilterLikeMatcher() { reset(); }
+  ~ObWhiteFilterLikeMatcher() {}
+  void reset();
+  int init(const common::ObObj &pattern, const common::ObObj &escape);
+  int match(const common::ObString &text, bool &matched) const;
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  OB_INLINE MatchMode get_mode() const { return mode_; }
+  // pattern without the leading and trailing '%', valid if mode is not GENERAL
+  OB_INLINE const common::ObString &get_literal() const { return literal_; }
+  // first occurrence of @lit in @text, nullptr if not found
+  static const char *substring_search(
+      const char *text,
+      const int64_t text_len,
+      const char *lit,
+      const int64_t lit_len);
+  TO_STRING_KV(K_(is_inited), K_(mode), K_(cs_type), K_(escape_wc), K_(pattern), K_(literal));
+private:
+  void analyze_pattern();
+private:
+  bool is_inited_;
+  MatchMode mode_;
+  common::ObCollationType cs_type_;
+  int32_t escape_wc_;
+  common::ObString pattern_;
+  common::ObString literal_;
+};
+
 class ObWhiteFilterExecutor : public ObPushdownFilterExecutor
 {
 public:
@@ -456,16 +519,19 @@ public:
   bool is_obj_set_created() const { return param_set_.created(); };
   OB_INLINE ObWhiteFilterOperatorType get_op_type() const
   { return filter_.get_op_type(); }
+  OB_INLINE const ObWhiteFilterLikeMatcher &get_like_matcher() const { return like_matcher_; }
   INHERIT_TO_STRING_KV("ObPushdownWhiteFilterExecutor", ObPushdownFilterExecutor,
                        K_(null_param_contained), K_(params), K(param_set_.created()),
-                       K_(filter));
-private:
+                       K_(like_matcher), K_(filter));
+protected:
   void check_null_params();
   int init_obj_set();
-private:
+  int init_like_matcher();
+protected:
   bool null_param_contained_;
   common::ObFixedArray<common::ObObj, common::ObIAllocator> params_;
   common::hash::ObHashSet<common::ObObj> param_set_;
+  ObWhiteFilterLikeMatcher like_matcher_;
   ObPushdownWhiteFilterNode &filter_;
 };
 
@@ -504,6 +570,37 @@ private:
   ObPushdownOrFilterNode &filter_;
 };
 
+class ObDynamicFilterExecutor : public ObWhiteFilterExecutor
+{
+public:
+  enum DataState
+  {
+    NOT_READY = 0,    // runtime filter msg is not ready yet
+    DATA_PREPARED,    // params are filled, execute as white filter
+    ALWAYS_TRUE,      // runtime filter can not be applied in storage, keep all rows
+    ALWAYS_FALSE,     // runtime filter is empty, no row matches
+  };
+  ObDynamicFilterExecutor(common::ObIAllocator &alloc,
+                          ObPushdownDynamicFilterNode &filter,
+                          ObPushdownOperator &op)
+      : ObWhiteFilterExecutor(alloc, filter, op),
+      data_state_(NOT_READY)
+  {
+    type_ = PushdownExecutorType::DYNAMIC_FILTER_EXECUTOR;
+  }
+  ~ObDynamicFilterExecutor() {}
+  virtual int init_evaluated_datums() override;
+  // check the runtime filter msg and fill white filter params when it is ready
+  int prepare_data();
+  OB_INLINE bool is_data_prepared() const { return DATA_PREPARED == data_state_; }
+  OB_INLINE bool is_filter_always_true() const
+  { return NOT_READY == data_state_ || ALWAYS_TRUE == data_state_; }
+  OB_INLINE bool is_filter_always_false() const { return ALWAYS_FALSE == data_state_; }
+  INHERIT_TO_STRING_KV("ObWhiteFilterExecutor", ObWhiteFilterExecutor, K_(data_state));
+private:
+  DataState data_state_;
+};
+
 class ObFilterExecutorConstructor
 {
 public:
@@ -139,6 +139,10 @@ int ObTableInsertUpOp::inner_open()
     LOG_WARN("fail to init replace row store", K(ret));
   } else if (OB_FAIL(inner_open_with_das())) {
     LOG_WARN("inner open with das failed", K(ret));
+  } else if (child_->is_vectorized()
+             && OB_FAIL(child_brs_holder_.init(child_->get_spec().output_,
+                                               child_->get_eval_ctx()))) {
+    LOG_WARN("init child brs holder failed", K(ret));
   } else {
     const ObInsertUpCtDef *insert_up_ctdef = MY_SPEC.insert_up_ctdefs_.at(0);
     const ObDASInsCtDef &das_ins_ctdef = insert_up_ctdef->ins_ctdef_->das_ctdef_;
@@ -242,6 +246,7 @@ int ObTableInsertUpOp::inner_rescan()
 
   if (OB_SUCC(ret)) {
     insert_up_rtdefs_.release_array();
+    child_brs_holder_.reset();
     if (OB_UNLIKELY(iter_end_)) {
       //do nothing
     } else if (OB_FAIL(init_insert_up_rtdef())) {
@@ -832,6 +837,25 @@ int ObTableInsertUpOp::get_next_row_from_child()
   return ret;
 }
 
+int ObTableInsertUpOp::get_next_batch_from_child(const int64_t max_row_cnt,
+                                                 const ObBatchRows *&child_brs)
+{
+  int ret = OB_SUCCESS;
+  clear_evaluated_flag();
+  // the first row of last batch may be overwritten by conflict rows, restore it before child
+  // reuses its output
+  if (OB_FAIL(child_brs_holder_.restore())) {
+    LOG_WARN("fail to restore child batch", K(ret));
+  } else if (OB_FAIL(child_->get_next_batch(max_row_cnt, child_brs))) {
+    LOG_WARN("fail to get next batch", K(ret));
+  } else if (OB_FAIL(child_brs_holder_.save(1))) {
+    LOG_WARN("fail to save child batch", K(ret));
+  } else {
+    LOG_TRACE("child output batch", KPC(child_brs));
+  }
+  return ret;
+}
+
 int ObTableInsertUpOp::do_insert_up()
 {
   int ret = OB_SUCCESS;
@@ -901,23 +925,32 @@ int ObTableInsertUpOp::load_batch_insert_up_rows(bool &is_iter_end, int64_t &ins
     default_row_batch_cnt = 1;
   }
   LOG_DEBUG("simulate lookup row batch count", K(simulate_batch_row_cnt), K(default_row_batch_cnt));
-  while (OB_SUCC(ret) && ++row_cnt <= default_row_batch_cnt) {
-    if (OB_FAIL(get_next_row_from_child())) {
-      if (OB_ITER_END != ret) {
-        LOG_WARN("fail to load next row from child", K(ret));
+  // degenerated single row execution loads row by row, so that no row of child batch is left
+  if (child_->is_vectorized() && default_row_batch_cnt > 1) {
+    if (OB_FAIL(load_insert_up_rows_from_child_batch(default_row_batch_cnt,
+                                                     is_iter_end,
+                                                     insert_rows))) {
+      LOG_WARN("fail to load insert_up rows from child batch", K(ret));
+    }
+  } else {
+    while (OB_SUCC(ret) && ++row_cnt <= default_row_batch_cnt) {
+      if (OB_FAIL(get_next_row_from_child())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("fail to load next row from child", K(ret));
+        } else {
+          iter_end_ = true;
+        }
+      } else if (OB_FAIL(try_insert_row())) {
+        LOG_WARN("try insert row to das", K(ret));
+      } else if (OB_FAIL(insert_up_row_store_.add_row(MY_SPEC.all_saved_exprs_, &eval_ctx_))) {
+        LOG_WARN("add insert_up row to row store failed", K(ret));
       } else {
-        iter_end_ = true;
-      }
-    } else if (OB_FAIL(try_insert_row())) {
-      LOG_WARN("try insert row to das", K(ret));
-    } else if (OB_FAIL(insert_up_row_store_.add_row(MY_SPEC.all_saved_exprs_, &eval_ctx_))) {
-      LOG_WARN("add insert_up row to row store failed", K(ret));
-    } else {
-      plan_ctx->record_last_insert_id_cur_stmt();
-      insert_rows++;
-      if (insert_up_row_store_.get_mem_used() >= OB_DEFAULT_INSERT_UP_MEMORY_LIMIT) {
-        LOG_INFO("insert up rows used memory over limit", K(ret), K(row_cnt), K(insert_rows));
-        break;
+        plan_ctx->record_last_insert_id_cur_stmt();
+        insert_rows++;
+        if (insert_up_row_store_.get_mem_used() >= OB_DEFAULT_INSERT_UP_MEMORY_LIMIT) {
+          LOG_INFO("insert up rows used memory over limit", K(ret), K(row_cnt), K(insert_rows));
+          break;
+        }
       }
     }
   }
@@ -929,6 +962,60 @@ int ObTableInsertUpOp::load_batch_insert_up_rows(bool &is_iter_end, int64_t &ins
   return ret;
 }
 
+// The rows of a child batch are processed in place, by pointing the batch index of eval ctx
+// to each of them. The whole batch is loaded before checking the row count and memory limit,
+// the rowkeys of all loaded rows are looked up together by the conflict checker later.
+int ObTableInsertUpOp::load_insert_up_rows_from_child_batch(const int64_t max_row_cnt,
+                                                            bool &is_iter_end,
+                                                            int64_t &insert_rows)
+{
+  int ret = OB_SUCCESS;
+  int64_t row_cnt = 0;
+  bool reach_limit = false;
+  ObPhysicalPlanCtx *plan_ctx = ctx_.get_physical_plan_ctx();
+  const int64_t max_batch_size = child_->get_spec().max_batch_size_;
+  while (OB_SUCC(ret) && !is_iter_end && !reach_limit) {
+    const ObBatchRows *child_brs = nullptr;
+    if (OB_FAIL(get_next_batch_from_child(MIN(max_batch_size, max_row_cnt - row_cnt),
+                                          child_brs))) {
+      LOG_WARN("fail to load next batch from child", K(ret));
+    } else {
+      ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+      batch_info_guard.set_batch_size(child_brs->size_);
+      for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
+        if (child_brs->skip_->at(i)) {
+          continue;
+        }
+        batch_info_guard.set_batch_idx(i);
+        // expressions of insert_up are evaluated row by row as the non vectorized path
+        clear_evaluated_flag();
+        found_rows_++;
+        if (OB_FAIL(try_insert_row())) {
+          LOG_WARN("try insert row to das", K(ret));
+        } else if (OB_FAIL(insert_up_row_store_.add_row(MY_SPEC.all_saved_exprs_, &eval_ctx_))) {
+          LOG_WARN("add insert_up row to row store failed", K(ret));
+        } else {
+          plan_ctx->record_last_insert_id_cur_stmt();
+          insert_rows++;
+        }
+      }
+      if (OB_SUCC(ret)) {
+        row_cnt += child_brs->size_;
+        if (child_brs->end_) {
+          is_iter_end = true;
+          iter_end_ = true;
+        } else if (row_cnt >= max_row_cnt) {
+          reach_limit = true;
+        } else if (insert_up_row_store_.get_mem_used() >= OB_DEFAULT_INSERT_UP_MEMORY_LIMIT) {
+          LOG_INFO("insert up rows used memory over limit", K(ret), K(row_cnt), K(insert_rows));
+          reach_limit = true;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTableInsertUpOp::post_all_dml_das_task(ObDMLRtCtx &dml_rtctx, bool del_task_ahead)
 {
   int ret = OB_SUCCESS;
@@ -117,8 +117,13 @@ protected:
 
   // 物化所有要被replace into的行到replace_row_store_
   int load_batch_insert_up_rows(bool &is_iter_end, int64_t &insert_rows);
+  // 向量化的child按batch物化，省去batch到行的转换
+  int load_insert_up_rows_from_child_batch(const int64_t max_row_cnt,
+                                           bool &is_iter_end,
+                                           int64_t &insert_rows);
 
   int get_next_row_from_child();
+  int get_next_batch_from_child(const int64_t max_row_cnt, const ObBatchRows *&child_brs);
 
   int do_insert_up();
 
@@ -236,6 +241,8 @@ protected:
   common::ObArrayWrap<ObInsertUpRtDef> insert_up_rtdefs_;
   ObChunkDatumStore insert_up_row_store_; //所有的insert_up的行的集合
   bool is_ignore_; // 暂时记录一下是否是ignore的insert_up SQL语句
+  // 冲突处理时StoredRow::to_expr会覆盖child batch的第0行, 取下一个batch前需要恢复
+  ObBatchResultHolder child_brs_holder_;
 };
 } // end namespace sql
 } // end namespace oceanbase
@@ -1138,6 +1138,48 @@ int ObTableModifyOp::get_next_row_from_child()
   return ret;
 }
 
+// The rows of a vectorized child batch are written in place, by pointing the batch index of
+// eval ctx to each of them, instead of being copied to the first datum of batch one by one.
+int ObTableModifyOp::write_child_batches_to_das_buffer(int64_t &row_count)
+{
+  int ret = OB_SUCCESS;
+  const int64_t max_batch_size = child_->get_spec().max_batch_size_;
+  while (OB_SUCC(ret) && !iter_end_) {
+    const ObBatchRows *child_brs = nullptr;
+    clear_evaluated_flag();
+    if (OB_FAIL(try_check_status())) {
+      LOG_WARN("check status failed", K(ret));
+    } else if (OB_FAIL(child_->get_next_batch(max_batch_size, child_brs))) {
+      LOG_WARN("fail to get next batch", K(ret));
+    } else {
+      ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+      batch_info_guard.set_batch_size(child_brs->size_);
+      for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
+        if (child_brs->skip_->at(i)) {
+          continue;
+        }
+        batch_info_guard.set_batch_idx(i);
+        clear_evaluated_flag();
+        if (OB_FAIL(write_row_to_das_buffer())) {
+          LOG_WARN("write row to das failed", K(ret));
+        } else if (OB_FAIL(discharge_das_write_buffer())) {
+          LOG_WARN("discharge das write buffer failed", K(ret));
+        } else if (is_error_logging_ && err_log_rt_def_.first_err_ret_ != OB_SUCCESS) {
+          clear_evaluated_flag();
+          err_log_rt_def_.curr_err_log_record_num_++;
+          err_log_rt_def_.reset();
+        } else {
+          row_count++;
+        }
+      }
+      if (OB_SUCC(ret)) {
+        iter_end_ = child_brs->end_;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTableModifyOp::inner_get_next_row()
 {
   int ret = OB_SUCCESS;
@@ -1146,7 +1188,13 @@ int ObTableModifyOp::inner_get_next_row()
     ret = OB_ITER_END;
   } else {
     int64_t row_count = 0;
-    while (OB_SUCC(ret)) {
+    // returning and single row execution (for triggers) get rows of child one by one
+    if (child_->is_vectorized() && !MY_SPEC.is_returning_ && !execute_single_row_) {
+      if (OB_FAIL(write_child_batches_to_das_buffer(row_count))) {
+        LOG_WARN("write child batches to das failed", K(ret));
+      }
+    }
+    while (OB_SUCC(ret) && !iter_end_) {
       if (OB_FAIL(try_check_status())) {
         LOG_WARN("check status failed", K(ret));
       } else if (OB_FAIL(get_next_row_from_child())) {
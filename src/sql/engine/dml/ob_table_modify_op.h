@@ -234,6 +234,7 @@ protected:
   virtual int inner_get_next_row() override;
   virtual int check_need_exec_single_row();
   int get_next_row_from_child();
+  int write_child_batches_to_das_buffer(int64_t &row_count);
   //Override this interface to complete the write semantics of the DML operator,
   //and write a row to the DAS Write Buffer according to the specific DML behavior
   virtual int write_row_to_das_buffer() { return common::OB_NOT_IMPLEMENT; }
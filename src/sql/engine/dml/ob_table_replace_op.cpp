@@ -147,6 +147,10 @@ int ObTableReplaceOp::inner_open()
     LOG_WARN("fail to init replace row store", K(ret));
   } else if (OB_FAIL(inner_open_with_das())) {
     LOG_WARN("inner open with das failed", K(ret));
+  } else if (child_->is_vectorized()
+             && OB_FAIL(child_brs_holder_.init(child_->get_spec().output_,
+                                               child_->get_eval_ctx()))) {
+    LOG_WARN("init child brs holder failed", K(ret));
   } else {
     conflict_checker_.set_local_tablet_loc(MY_INPUT.get_tablet_loc());
   }
@@ -202,6 +206,7 @@ int ObTableReplaceOp::inner_rescan()
   } else {
     conflict_checker_.set_local_tablet_loc(MY_INPUT.get_tablet_loc());
     replace_rtdefs_.release_array();
+    child_brs_holder_.reset();
     if (OB_UNLIKELY(iter_end_)) {
       //do nothing
     } else if (OB_FAIL(init_replace_rtdef())) {
@@ -272,6 +277,25 @@ OB_INLINE int ObTableReplaceOp::get_next_row_from_child()
   return ret;
 }
 
+OB_INLINE int ObTableReplaceOp::get_next_batch_from_child(const int64_t max_row_cnt,
+                                                          const ObBatchRows *&child_brs)
+{
+  int ret = OB_SUCCESS;
+  clear_evaluated_flag();
+  // the first row of last batch may be overwritten by conflict rows, restore it before child
+  // reuses its output
+  if (OB_FAIL(child_brs_holder_.restore())) {
+    LOG_WARN("fail to restore child batch", K(ret));
+  } else if (OB_FAIL(child_->get_next_batch(max_row_cnt, child_brs))) {
+    LOG_WARN("fail to get next batch", K(ret));
+  } else if (OB_FAIL(child_brs_holder_.save(1))) {
+    LOG_WARN("fail to save child batch", K(ret));
+  } else {
+    LOG_TRACE("child output batch", KPC(child_brs));
+  }
+  return ret;
+}
+
 OB_INLINE int ObTableReplaceOp::load_all_replace_row(bool &is_iter_end)
 {
   int ret = OB_SUCCESS;
@@ -286,19 +310,26 @@ OB_INLINE int ObTableReplaceOp::load_all_replace_row(bool &is_iter_end)
   if (execute_single_row_) {
     default_row_batch_cnt = 1;
   }
-  while (OB_SUCC(ret) &&  ++row_cnt <= default_row_batch_cnt) {
-    // todo @kaizhan.dkz @wangbo.wb 增加行前trigger逻辑在这里
-    // 新行的外键检查也在这里做
-    if (OB_FAIL(get_next_row_from_child())) {
-      if (OB_ITER_END != ret) {
-        LOG_WARN("fail to load next row from child", K(ret));
+  // degenerated single row execution loads row by row, so that no row of child batch is left
+  if (child_->is_vectorized() && default_row_batch_cnt > 1) {
+    if (OB_FAIL(load_replace_rows_from_child_batch(default_row_batch_cnt, is_iter_end))) {
+      LOG_WARN("fail to load replace rows from child batch", K(ret));
+    }
+  } else {
+    while (OB_SUCC(ret) &&  ++row_cnt <= default_row_batch_cnt) {
+      // todo @kaizhan.dkz @wangbo.wb 增加行前trigger逻辑在这里
+      // 新行的外键检查也在这里做
+      if (OB_FAIL(get_next_row_from_child())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("fail to load next row from child", K(ret));
+        }
+      } else if (OB_FAIL(insert_row_to_das(true))) {
+        LOG_WARN("insert row to das", K(ret));
+      } else if (OB_FAIL(replace_row_store_.add_row(get_primary_table_new_row(), &eval_ctx_))) {
+        LOG_WARN("add replace row to row store failed", K(ret));
+      } else {
+        plan_ctx->record_last_insert_id_cur_stmt();
       }
-    } else if (OB_FAIL(insert_row_to_das(true))) {
-      LOG_WARN("insert row to das", K(ret));
-    } else if (OB_FAIL(replace_row_store_.add_row(get_primary_table_new_row(), &eval_ctx_))) {
-      LOG_WARN("add replace row to row store failed", K(ret));
-    } else {
-      plan_ctx->record_last_insert_id_cur_stmt();
     }
   }
   if (OB_ITER_END == ret) {
@@ -308,6 +339,49 @@ OB_INLINE int ObTableReplaceOp::load_all_replace_row(bool &is_iter_end)
   return ret;
 }
 
+// The rows of a child batch are processed in place, by pointing the batch index of eval ctx
+// to each of them, and the batch size is limited so that row count of one replace batch is
+// the same as loading row by row.
+int ObTableReplaceOp::load_replace_rows_from_child_batch(const int64_t max_row_cnt,
+                                                         bool &is_iter_end)
+{
+  int ret = OB_SUCCESS;
+  int64_t row_cnt = 0;
+  ObPhysicalPlanCtx *plan_ctx = GET_PHY_PLAN_CTX(ctx_);
+  const int64_t max_batch_size = child_->get_spec().max_batch_size_;
+  while (OB_SUCC(ret) && !is_iter_end && row_cnt < max_row_cnt) {
+    const ObBatchRows *child_brs = nullptr;
+    if (OB_FAIL(get_next_batch_from_child(MIN(max_batch_size, max_row_cnt - row_cnt),
+                                          child_brs))) {
+      LOG_WARN("fail to load next batch from child", K(ret));
+    } else {
+      ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+      batch_info_guard.set_batch_size(child_brs->size_);
+      for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
+        if (child_brs->skip_->at(i)) {
+          continue;
+        }
+        batch_info_guard.set_batch_idx(i);
+        // expressions of replace are evaluated row by row as the non vectorized path
+        clear_evaluated_flag();
+        insert_rows_++;
+        if (OB_FAIL(insert_row_to_das(true))) {
+          LOG_WARN("insert row to das", K(ret));
+        } else if (OB_FAIL(replace_row_store_.add_row(get_primary_table_new_row(), &eval_ctx_))) {
+          LOG_WARN("add replace row to row store failed", K(ret));
+        } else {
+          plan_ctx->record_last_insert_id_cur_stmt();
+        }
+      }
+      if (OB_SUCC(ret)) {
+        row_cnt += child_brs->size_;
+        is_iter_end = child_brs->end_;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTableReplaceOp::insert_row_to_das(bool need_do_trigger)
 {
   int ret = OB_SUCCESS;
@@ -78,7 +78,10 @@ public:
 
   // 物化所有要被replace into的行到replace_row_store_
   int load_all_replace_row(bool &is_iter_end);
+  // 向量化的child按batch物化，省去batch到行的转换
+  int load_replace_rows_from_child_batch(const int64_t max_row_cnt, bool &is_iter_end);
   int get_next_row_from_child();
+  int get_next_batch_from_child(const int64_t max_row_cnt, const ObBatchRows *&child_brs);
 
   // 执行所有尝试插入的 das task， fetch冲突行的主表主键
   int fetch_conflict_rowkey();
@@ -155,6 +158,8 @@ protected:
   ObConflictChecker conflict_checker_;
   common::ObArrayWrap<ObReplaceRtDef> replace_rtdefs_;
   ObChunkDatumStore replace_row_store_; //所有的replace的行的集合
+  // 冲突处理时StoredRow::to_expr会覆盖child batch的第0行, 取下一个batch前需要恢复
+  ObBatchResultHolder child_brs_holder_;
 };
 
 class ObTableReplaceOpInput : public ObTableModifyOpInput
@@ -118,10 +118,11 @@ public:
   static void collect_sample_info(
     ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx,
     bool is_match);
-private:
+  // also used by storage pushdown filter to get the runtime filter msg
   static int check_rf_ready(
     ObExecContext &exec_ctx,
     ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx);
+private:
 
   static void check_need_dynamic_diable_bf(
       ObExprJoinFilter::ObExprJoinFilterContext *join_filter_ctx);
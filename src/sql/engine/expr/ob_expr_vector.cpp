@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/expr/ob_expr_vector.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+bool ObExprVectorUtil::is_payload_hash_type(const ObObjType type)
+{
+  const ObObjTypeClass tc = ob_obj_type_class(type);
+  return ObIntTC == tc || ObUIntTC == tc || ObDateTimeTC == tc
+      || ObDateTC == tc || ObTimeTC == tc;
+}
+
+template <typename ValueType, bool IS_BATCH_SEED>
+void ObExprVectorUtil::hash_fixed_vector(const ObFixedLengthVector<ValueType> &vec,
+                                         uint64_t *hash_values,
+                                         const ObBitVector &skip,
+                                         const int64_t size,
+                                         const uint64_t *seeds)
+{
+  const ValueType *data = vec.get_data();
+  if (!vec.has_null()) {
+    ObBitVector::flip_foreach(skip, size,
+      [&](int64_t i) __attribute__((always_inline)) {
+        hash_values[i] = ObMurmurHash::hash(data + i, sizeof(ValueType),
+                                            seeds[IS_BATCH_SEED ? i : 0]);
+        return OB_SUCCESS;
+      }
+    );
+  } else {
+    // null datum has zero length payload
+    ObBitVector::flip_foreach(skip, size,
+      [&](int64_t i) __attribute__((always_inline)) {
+        hash_values[i] = ObMurmurHash::hash(data + i,
+                                            vec.is_null(i) ? 0 : sizeof(ValueType),
+                                            seeds[IS_BATCH_SEED ? i : 0]);
+        return OB_SUCCESS;
+      }
+    );
+  }
+}
+
+template <typename ValueType>
+void ObExprVectorUtil::hash_fixed_vector(const ObIVector &vec,
+                                         uint64_t *hash_values,
+                                         const ObBitVector &skip,
+                                         const int64_t size,
+                                         const uint64_t *seeds,
+                                         const bool is_batch_seed)
+{
+  const ObFixedLengthVector<ValueType> &fixed_vec =
+      static_cast<const ObFixedLengthVector<ValueType> &>(vec);
+  if (is_batch_seed) {
+    hash_fixed_vector<ValueType, true>(fixed_vec, hash_values, skip, size, seeds);
+  } else {
+    hash_fixed_vector<ValueType, false>(fixed_vec, hash_values, skip, size, seeds);
+  }
+}
+
+int ObExprVectorUtil::murmur_hash_v2_batch(const ObIVector &vec,
+                                           const ObExpr &expr,
+                                           uint64_t *hash_values,
+                                           const ObBitVector &skip,
+                                           const int64_t size,
+                                           const uint64_t *seeds,
+                                           const bool is_batch_seed)
+{
+  int ret = OB_SUCCESS;
+  const VectorFormat format = vec.get_format();
+  const int64_t fixed_len = get_fixed_length(expr.obj_datum_map_);
+  if (VEC_FIXED == format && is_payload_hash_type(expr.datum_meta_.type_)
+      && sizeof(int64_t) == fixed_len) {
+    hash_fixed_vector<int64_t>(vec, hash_values, skip, size, seeds, is_batch_seed);
+  } else if (VEC_FIXED == format && is_payload_hash_type(expr.datum_meta_.type_)
+             && sizeof(int32_t) == fixed_len) {
+    hash_fixed_vector<int32_t>(vec, hash_values, skip, size, seeds, is_batch_seed);
+  } else if (VEC_UNIFORM == format) {
+    const ObUniformBatchVector &uniform_vec = static_cast<const ObUniformBatchVector &>(vec);
+    expr.basic_funcs_->murmur_hash_v2_batch_(hash_values,
+                                             const_cast<ObDatum *>(uniform_vec.get_datums()),
+                                             true, skip, size, seeds, is_batch_seed);
+  } else if (VEC_UNIFORM_CONST == format) {
+    const ObUniformConstVector &const_vec = static_cast<const ObUniformConstVector &>(vec);
+    expr.basic_funcs_->murmur_hash_v2_batch_(hash_values,
+                                             const_cast<ObDatum *>(const_vec.get_datums()),
+                                             false, skip, size, seeds, is_batch_seed);
+  } else {
+    ObDatum datum;
+    const char *payload = NULL;
+    ObLength length = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < size; i++) {
+      if (skip.at(i)) {
+      } else {
+        if (vec.is_null(i)) {
+          datum.set_null();
+        } else {
+          vec.get_payload(i, payload, length);
+          datum.ptr_ = payload;
+          datum.pack_ = static_cast<uint32_t>(length);
+        }
+        if (OB_FAIL(expr.basic_funcs_->murmur_hash_v2_(
+                    datum, seeds[is_batch_seed ? i : 0], hash_values[i]))) {
+          LOG_WARN("calc hash value failed", K(ret), K(datum));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObExprVectorUtil::murmur_hash_v2_batch(const ObExpr &expr,
+                                           ObEvalCtx &ctx,
+                                           uint64_t *hash_values,
+                                           const ObBitVector &skip,
+                                           const int64_t size,
+                                           const uint64_t *seeds,
+                                           const bool is_batch_seed)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(NULL == hash_values || NULL == seeds || size < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(hash_values), KP(seeds), K(size));
+  } else {
+    expr.basic_funcs_->murmur_hash_v2_batch_(hash_values, expr.locate_batch_datums(ctx),
+                                             expr.is_batch_result(), skip, size,
+                                             seeds, is_batch_seed);
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_VECTOR_H_
+#define OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_VECTOR_H_
+
+#include "share/vector/ob_vector_holder.h"
+#include "sql/engine/expr/ob_expr.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Format aware kernels on vectors of one column of batch rows.
+//
+// The batch result of expression is an ObDatum array, the datums are not guaranteed to point
+// to the reserved buffer one by one (e.g.: coalesce points them to the result of child), so
+// it's hashed by the datum kernel directly instead of being viewed as fixed length vector.
+// The fixed length kernels are for producers which build the vector themselves.
+class ObExprVectorUtil
+{
+public:
+  // Hash the batch result of %expr, same as ObExprBasicFuncs::murmur_hash_v2_batch_.
+  static int murmur_hash_v2_batch(const ObExpr &expr,
+                                  ObEvalCtx &ctx,
+                                  uint64_t *hash_values,
+                                  const ObBitVector &skip,
+                                  const int64_t size,
+                                  const uint64_t *seeds,
+                                  const bool is_batch_seed);
+  // Same result as ObExprBasicFuncs::murmur_hash_v2_batch_ of %expr, the fixed length vector
+  // of integer and temporal types is hashed in tight loop over the values.
+  static int murmur_hash_v2_batch(const common::ObIVector &vec,
+                                  const ObExpr &expr,
+                                  uint64_t *hash_values,
+                                  const ObBitVector &skip,
+                                  const int64_t size,
+                                  const uint64_t *seeds,
+                                  const bool is_batch_seed);
+
+  // murmur_hash_v2 of these types is the hash of datum payload
+  static bool is_payload_hash_type(const common::ObObjType type);
+
+private:
+  template <typename ValueType, bool IS_BATCH_SEED>
+  static void hash_fixed_vector(const common::ObFixedLengthVector<ValueType> &vec,
+                                uint64_t *hash_values,
+                                const ObBitVector &skip,
+                                const int64_t size,
+                                const uint64_t *seeds);
+  template <typename ValueType>
+  static void hash_fixed_vector(const common::ObIVector &vec,
+                                uint64_t *hash_values,
+                                const ObBitVector &skip,
+                                const int64_t size,
+                                const uint64_t *seeds,
+                                const bool is_batch_seed);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_VECTOR_H_
@@ -20,6 +20,7 @@
 #include "observer/omt/ob_tenant_config_mgr.h"
 #include "sql/engine/px/ob_px_util.h"
 #include "share/diagnosis/ob_sql_monitor_statname.h"
+#include "sql/engine/expr/ob_expr_vector.h"
 
 namespace oceanbase
 {
@@ -4463,13 +4464,13 @@ int ObHashJoinOp::calc_hash_value_batch(const ObIArray<ObExpr*> &join_keys,
       if (OB_FAIL(expr->eval_batch(eval_ctx_, *brs->skip_, brs->size_))) {
         LOG_WARN("eval failed", K(ret));
       } else {
-        ObBatchDatumHashFunc hash_func = expr->basic_funcs_->murmur_hash_v2_batch_;
         const bool is_batch_seed = (idx > 0);
-        hash_func(hash_vals,
-                  expr->locate_batch_datums(eval_ctx_), expr->is_batch_result(),
-                  *brs->skip_, brs->size_,
-                  is_batch_seed ? hash_vals : &seed,
-                  is_batch_seed);
+        if (OB_FAIL(ObExprVectorUtil::murmur_hash_v2_batch(*expr, eval_ctx_, hash_vals,
+                                                           *brs->skip_, brs->size_,
+                                                           is_batch_seed ? hash_vals : &seed,
+                                                           is_batch_seed))) {
+          LOG_WARN("failed to calc hash value of join key", K(ret));
+        }
       }
     }
     if (OB_SUCC(ret)) {
@@ -322,7 +322,8 @@ REGISTER_OPERATOR(ObLogicalOperator, PHY_TABLE_ROW_STORE, ObTableRowStoreSpec,
 class ObLogExprValues;
 class ObExprValuesSpec;
 class ObExprValuesOp;
-REGISTER_OPERATOR(ObLogExprValues, PHY_EXPR_VALUES, ObExprValuesSpec, ObExprValuesOp, NOINPUT);
+REGISTER_OPERATOR(ObLogExprValues, PHY_EXPR_VALUES, ObExprValuesSpec, ObExprValuesOp, NOINPUT,
+                  VECTORIZED_OP);
 
 class ObLogDelete;
 class ObTableDeleteSpec;
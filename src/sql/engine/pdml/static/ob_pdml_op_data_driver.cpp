@@ -90,6 +90,10 @@ int ObPDMLOpDataDriver::destroy()
   is_heap_table_insert_ = false;
   with_barrier_ = false;
   dfo_id_ = OB_INVALID_ID;
+  child_brs_ = nullptr;
+  child_brs_idx_ = 0;
+  batch_info_guard_ = nullptr;
+  child_brs_holder_.reset();
   return ret;
 }
 
@@ -176,6 +180,9 @@ int ObPDMLOpDataDriver::fill_cache_unitl_cache_full_or_child_iter_end(ObExecCont
   } else if (OB_FAIL(try_write_last_pending_row())) {
     LOG_WARN("fail write last pending row into cache", K(ret));
   } else {
+    // 向量化的 child 读入的行位于 batch 中，reader 会修改 eval ctx 的 batch idx，这里负责恢复
+    ObEvalCtx::BatchInfoScopeGuard batch_info_guard(*eval_ctx_);
+    batch_info_guard_ = &batch_info_guard;
     do {
       const ObExprPtrIArray *row = nullptr;
       ObTabletID tablet_id;
@@ -211,6 +218,7 @@ int ObPDMLOpDataDriver::fill_cache_unitl_cache_full_or_child_iter_end(ObExecCont
       }
     } while (OB_SUCCESS == ret);
 
+    batch_info_guard_ = nullptr;
     // reader已经读取完毕的错误，可以处理
     if (OB_ITER_END == ret) {
       ret = OB_SUCCESS;
@@ -220,6 +228,46 @@ int ObPDMLOpDataDriver::fill_cache_unitl_cache_full_or_child_iter_end(ObExecCont
 }
 
 
+int ObPDMLOpDataDriver::get_next_child_row(ObOperator &child)
+{
+  int ret = OB_SUCCESS;
+  if (!child.is_vectorized()) {
+    ret = child.get_next_row();
+  } else if (OB_ISNULL(batch_info_guard_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("read child row out of filling cache", K(ret));
+  } else {
+    bool got_row = false;
+    while (OB_SUCC(ret) && !got_row) {
+      if (nullptr != child_brs_) {
+        while (child_brs_idx_ < child_brs_->size_ && child_brs_->skip_->at(child_brs_idx_)) {
+          ++child_brs_idx_;
+        }
+      }
+      if (nullptr != child_brs_ && child_brs_idx_ < child_brs_->size_) {
+        batch_info_guard_->set_batch_size(child_brs_->size_);
+        batch_info_guard_->set_batch_idx(child_brs_idx_);
+        ++child_brs_idx_;
+        got_row = true;
+      } else if (nullptr != child_brs_ && child_brs_->end_) {
+        ret = OB_ITER_END;
+      } else if (OB_FAIL(child_brs_holder_.init(child.get_spec().output_,
+                                                child.get_eval_ctx()))) {
+        LOG_WARN("fail init child brs holder", K(ret));
+      } else if (OB_FAIL(child_brs_holder_.restore())) {
+        LOG_WARN("fail restore child batch", K(ret));
+      } else if (OB_FAIL(child.get_next_batch(child.get_spec().max_batch_size_, child_brs_))) {
+        LOG_WARN("fail get next batch from child", K(ret));
+      } else if (OB_FAIL(child_brs_holder_.save(1))) {
+        LOG_WARN("fail save child batch", K(ret));
+      } else {
+        child_brs_idx_ = 0;
+      }
+    }
+  }
+  return ret;
+}
+
 // 将 cache 中缓存的所有 partition 数据都写入到存储层
 // 注意：数据写入完成后不能从 cache 中释放，因为这些数据还需要
 // return 到 DML 上面的算子继续使用
@@ -15,6 +15,7 @@
 
 #include "sql/engine/pdml/static/ob_pdml_op_batch_row_cache.h"
 #include "sql/engine/pdml/static/ob_px_multi_part_modify_op.h"
+#include "sql/engine/basic/ob_batch_result_holder.h"
 
 namespace oceanbase
 {
@@ -50,7 +51,11 @@ public:
       op_id_(common::OB_INVALID_ID),
       is_heap_table_insert_(false),
       with_barrier_(false),
-      dfo_id_(OB_INVALID_ID)
+      dfo_id_(OB_INVALID_ID),
+      child_brs_(nullptr),
+      child_brs_idx_(0),
+      batch_info_guard_(nullptr),
+      child_brs_holder_()
   {
   }
 
@@ -70,6 +75,12 @@ public:
   int set_dh_barrier_param(uint64_t op_id, const ObPxMultiPartModifyOpInput *modify_input);
 
   int get_next_row(ObExecContext &ctx, const ObExprPtrIArray &row);
+
+  // 供 reader 的 read_row 从 child 读入下一行。向量化的 child 按 batch 读入，
+  // 通过设置 eval ctx 的 batch idx 定位到 batch 中的行，不再把每一行拷贝到 batch 的第一行；
+  // eval ctx 的 batch 信息在每次填充 cache 结束后恢复。
+  // 只能在填充 cache 的过程中调用
+  int get_next_child_row(ObOperator &child);
 private:
   int fill_cache_unitl_cache_full_or_child_iter_end(ObExecContext &ctx);
   inline int try_write_last_pending_row();
@@ -156,6 +167,13 @@ private:
   bool with_barrier_; // 当前算子需要支持 barrier，即：没有写完之前不可以对外吐出数据
                       // 这是针对 row-movement 场景下避免 insert、delete 并发写同一行
   uint64_t dfo_id_;   // with_barrier_等于true的情况下需要知道barrier对应的DFO
+  const ObBatchRows *child_brs_; // 向量化的 child 当前正在读取的 batch
+  int64_t child_brs_idx_; // child_brs_ 中下一个要读取的行
+  // 填充 cache 期间有效，用于设置 eval ctx 的 batch idx，填充结束后由其析构恢复
+  ObEvalCtx::BatchInfoScopeGuard *batch_info_guard_;
+  // last row 恢复以及写存储层时 StoredRow::to_expr 会覆盖 child batch 的第 0 行，
+  // 从 child 读取下一个 batch 之前需要恢复
+  ObBatchResultHolder child_brs_holder_;
   DISALLOW_COPY_AND_ASSIGN(ObPDMLOpDataDriver);;
 };
 }
@@ -153,7 +153,7 @@ int ObPxMultiPartInsertOp::read_row(ObExecContext &ctx,
   if (OB_ISNULL(child_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("child op is null", K(ret));
-  } else if (OB_FAIL(child_->get_next_row())) {
+  } else if (OB_FAIL(data_driver_.get_next_child_row(*child_))) {
     if (OB_UNLIKELY(OB_ITER_END != ret)) {
       LOG_WARN("fail get next row from child", K(ret));
     }
@@ -330,34 +330,34 @@ int ObPxMultiPartSSTableInsertOp::get_all_rows_and_count()
     LOG_WARN("cache row store or row_cnt_map is not inited", K(ret));
   } else {
     int64_t curr_tablet_row_cnt = 0;
-    while (OB_SUCC(ret)) {
-      const ObExprPtrIArray *row = &child_->get_spec().output_;
-      ObTabletID row_tablet_id;
-      ObChunkDatumStore *tablet_store = nullptr;
-      clear_evaluated_flag();
-      if (OB_FAIL(child_->get_next_row())) {
-        if (OB_UNLIKELY(OB_ITER_END != ret)) {
-          LOG_WARN("fail get next row from child", K(ret));
-        }
-      } else if (OB_FAIL(get_tablet_id_from_row(*row,
-                                                get_spec().row_desc_.get_part_id_index(),
-                                                row_tablet_id))) {
-        LOG_WARN("failed to get tablet id", K(ret));
-      } else if (OB_FAIL(tablet_store_map_.get_refactored(row_tablet_id, tablet_store))) {
-        if (OB_HASH_NOT_EXIST == ret) {
-          if (OB_FAIL(create_tablet_store(row_tablet_id, tablet_store))) {
-            LOG_WARN("failed to create tablet store", K(ret), K(row_tablet_id));
+    if (child_->is_vectorized()) {
+      if (OB_FAIL(get_all_batches_to_tablet_store())) {
+        LOG_WARN("failed to add child batches to tablet store", K(ret));
+      }
+    } else {
+      while (OB_SUCC(ret)) {
+        const ObExprPtrIArray *row = &child_->get_spec().output_;
+        ObTabletID row_tablet_id;
+        ObChunkDatumStore *tablet_store = nullptr;
+        clear_evaluated_flag();
+        if (OB_FAIL(child_->get_next_row())) {
+          if (OB_UNLIKELY(OB_ITER_END != ret)) {
+            LOG_WARN("fail get next row from child", K(ret));
           }
-        } else {
-          LOG_WARN("failed to get tablet store from map", K(ret), K(row_tablet_id));
+        } else if (OB_FAIL(get_tablet_id_from_row(*row,
+                                                  get_spec().row_desc_.get_part_id_index(),
+                                                  row_tablet_id))) {
+          LOG_WARN("failed to get tablet id", K(ret));
+        } else if (OB_FAIL(get_tablet_store(row_tablet_id, tablet_store))) {
+          LOG_WARN("failed to get tablet store", K(ret), K(row_tablet_id));
+        }
+        if (OB_FAIL(ret)) {
+        } else if (OB_ISNULL(tablet_store)) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unepxected tablet store", K(ret));
+        } else if (OB_FAIL(tablet_store->add_row(*row, &eval_ctx_))) {
+          LOG_WARN("failed to add row to tablet store", K(ret));
         }
-      }
-      if (OB_FAIL(ret)) {
-      } else if (OB_ISNULL(tablet_store)) {
-        ret = OB_ERR_UNEXPECTED;
-        LOG_WARN("unepxected tablet store", K(ret));
-      } else if (OB_FAIL(tablet_store->add_row(*row, &eval_ctx_))) {
-        LOG_WARN("failed to add row to tablet store", K(ret));
       }
     }
     if (OB_ITER_END == ret) {
@@ -385,6 +385,93 @@ int ObPxMultiPartSSTableInsertOp::get_all_rows_and_count()
   return ret;
 }
 
+// Rows of a child batch are grouped by tablet, and added to the tablet store of each tablet
+// with the selector of its rows.
+int ObPxMultiPartSSTableInsertOp::get_all_batches_to_tablet_store()
+{
+  int ret = OB_SUCCESS;
+  const ObExprPtrIArray &row = child_->get_spec().output_;
+  const int64_t part_id_idx = get_spec().row_desc_.get_part_id_index();
+  const int64_t max_batch_size = child_->get_spec().max_batch_size_;
+  ObTabletID *tablet_ids = nullptr;
+  uint16_t *selector = nullptr;
+  ObBitVector *added = nullptr;
+  void *buf = nullptr;
+  if (OB_ISNULL(tablet_ids = static_cast<ObTabletID *>(
+      allocator_.alloc(sizeof(ObTabletID) * max_batch_size)))
+      || OB_ISNULL(selector = static_cast<uint16_t *>(
+      allocator_.alloc(sizeof(uint16_t) * max_batch_size)))
+      || OB_ISNULL(buf = allocator_.alloc(ObBitVector::memory_size(max_batch_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to allocate memory for batch tablet ids", K(ret), K(max_batch_size));
+  } else {
+    added = to_bit_vector(buf);
+    bool iter_end = false;
+    while (OB_SUCC(ret) && !iter_end) {
+      const ObBatchRows *child_brs = nullptr;
+      clear_evaluated_flag();
+      if (OB_FAIL(child_->get_next_batch(max_batch_size, child_brs))) {
+        LOG_WARN("fail get next batch from child", K(ret));
+      } else {
+        ObEvalCtx::BatchInfoScopeGuard batch_info_guard(eval_ctx_);
+        batch_info_guard.set_batch_size(child_brs->size_);
+        added->deep_copy(*child_brs->skip_, child_brs->size_);
+        for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
+          if (!added->at(i)) {
+            batch_info_guard.set_batch_idx(i);
+            if (OB_FAIL(get_tablet_id_from_row(row, part_id_idx, tablet_ids[i]))) {
+              LOG_WARN("failed to get tablet id", K(ret));
+            }
+          }
+        }
+        for (int64_t i = 0; OB_SUCC(ret) && i < child_brs->size_; ++i) {
+          ObChunkDatumStore *tablet_store = nullptr;
+          int64_t size = 0;
+          if (added->at(i)) {
+            continue;
+          }
+          for (int64_t j = i; j < child_brs->size_; ++j) {
+            if (!added->at(j) && tablet_ids[j] == tablet_ids[i]) {
+              selector[size++] = j;
+              added->set(j);
+            }
+          }
+          if (OB_FAIL(get_tablet_store(tablet_ids[i], tablet_store))) {
+            LOG_WARN("failed to get tablet store", K(ret), K(tablet_ids[i]));
+          } else if (OB_FAIL(tablet_store->add_batch(row, eval_ctx_, *child_brs->skip_,
+                                                     child_brs->size_, selector, size))) {
+            LOG_WARN("failed to add batch to tablet store", K(ret), K(size));
+          }
+        }
+        if (OB_SUCC(ret)) {
+          iter_end = child_brs->end_;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObPxMultiPartSSTableInsertOp::get_tablet_store(ObTabletID &tablet_id,
+                                                   ObChunkDatumStore *&tablet_store)
+{
+  int ret = OB_SUCCESS;
+  tablet_store = nullptr;
+  if (OB_FAIL(tablet_store_map_.get_refactored(tablet_id, tablet_store))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      if (OB_FAIL(create_tablet_store(tablet_id, tablet_store))) {
+        LOG_WARN("failed to create tablet store", K(ret), K(tablet_id));
+      }
+    } else {
+      LOG_WARN("failed to get tablet store from map", K(ret), K(tablet_id));
+    }
+  } else if (OB_ISNULL(tablet_store)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unepxected tablet store", K(ret));
+  }
+  return ret;
+}
+
 int ObPxMultiPartSSTableInsertOp::create_tablet_store(ObTabletID &tablet_id, ObChunkDatumStore *&tablet_store)
 {
   int ret = OB_SUCCESS;
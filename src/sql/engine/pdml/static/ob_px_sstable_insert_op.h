@@ -81,6 +81,8 @@ public:
                              common::ObTabletID &tablet_id);
 private:
   int get_all_rows_and_count();
+  int get_all_batches_to_tablet_store();
+  int get_tablet_store(common::ObTabletID &tablet_id, ObChunkDatumStore *&tablet_store);
   int create_tablet_store(common::ObTabletID &tablet_id, ObChunkDatumStore *&tablet_store);
   bool need_count_rows() const { return MY_SPEC.regenerate_heap_table_pk_ && !count_rows_finish_; }      
   int get_next_tablet_id(common::ObTabletID &tablet_id);
@@ -66,6 +66,13 @@ public:
       const int64_t batch_size,
       ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx)
       { return OB_SUCCESS; }
+  // convert the msg into params of the storage white filter on %col_expr,
+  // @is_applicable is false when the msg can not be expressed as a white filter
+  virtual int prepare_storage_white_filter_data(
+      const ObExpr &col_expr,
+      common::ObFixedArray<common::ObObj, common::ObIAllocator> &params,
+      bool &is_applicable)
+      { UNUSED(col_expr); UNUSED(params); is_applicable = false; return OB_SUCCESS; }
   virtual int insert_by_row(
     const common::ObIArray<ObExpr *> &expr_array,
     const common::ObHashFuncs &hash_funcs_,
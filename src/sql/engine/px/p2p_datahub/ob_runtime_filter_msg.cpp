@@ -1197,6 +1197,36 @@ int ObRFRangeFilterMsg::might_contain_batch(
   }
   return ret;
 }
+int ObRFRangeFilterMsg::prepare_storage_white_filter_data(
+    const ObExpr &col_expr,
+    ObFixedArray<ObObj, ObIAllocator> &params,
+    bool &is_applicable)
+{
+  int ret = OB_SUCCESS;
+  ObObj lower;
+  ObObj upper;
+  is_applicable = false;
+  if (1 != lower_bounds_.count() || 1 != upper_bounds_.count()) {
+    // only single join key can be expressed as white filter
+  } else if (need_null_cmp_flags_.count() > 0 && need_null_cmp_flags_.at(0)) {
+    // null safe equal, null can not be expressed by between
+  } else if (lower_bounds_.at(0).is_null() || upper_bounds_.at(0).is_null()) {
+  } else if (OB_FAIL(lower_bounds_.at(0).to_obj(lower, col_expr.obj_meta_, col_expr.obj_datum_map_))) {
+    LOG_WARN("fail to convert lower bound", K(ret));
+  } else if (OB_FAIL(upper_bounds_.at(0).to_obj(upper, col_expr.obj_meta_, col_expr.obj_datum_map_))) {
+    LOG_WARN("fail to convert upper bound", K(ret));
+  } else if (FALSE_IT(params.reset())) {
+  } else if (OB_FAIL(params.init(2))) {
+    LOG_WARN("fail to init params", K(ret));
+  } else if (OB_FAIL(params.push_back(lower))) {
+    LOG_WARN("fail to push back lower bound", K(ret));
+  } else if (OB_FAIL(params.push_back(upper))) {
+    LOG_WARN("fail to push back upper bound", K(ret));
+  } else {
+    is_applicable = true;
+  }
+  return ret;
+}
 // end ObRFRangeFilterMsg
 
 // ObRFInFilterMsg
@@ -1503,6 +1533,38 @@ int ObRFInFilterMsg::might_contain(const ObExpr &expr,
   return ret;
 }
 
+int ObRFInFilterMsg::prepare_storage_white_filter_data(
+    const ObExpr &col_expr,
+    ObFixedArray<ObObj, ObIAllocator> &params,
+    bool &is_applicable)
+{
+  int ret = OB_SUCCESS;
+  is_applicable = false;
+  if (1 != col_cnt_) {
+    // only single join key can be expressed as white filter
+  } else if (need_null_cmp_flags_.count() > 0 && need_null_cmp_flags_.at(0)) {
+    // null safe equal, null can not be expressed by in
+  } else if (FALSE_IT(params.reset())) {
+  } else if (OB_FAIL(params.init(serial_rows_.count()))) {
+    LOG_WARN("fail to init params", K(ret), K(serial_rows_.count()));
+  } else {
+    ObObj param;
+    for (int64_t i = 0; OB_SUCC(ret) && i < serial_rows_.count(); ++i) {
+      const ObDatum &datum = serial_rows_.at(i)->at(0);
+      if (datum.is_null()) {
+      } else if (OB_FAIL(datum.to_obj(param, col_expr.obj_meta_, col_expr.obj_datum_map_))) {
+        LOG_WARN("fail to convert datum", K(ret), K(i));
+      } else if (OB_FAIL(params.push_back(param))) {
+        LOG_WARN("fail to push back param", K(ret), K(i));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      is_applicable = params.count() > 0;
+    }
+  }
+  return ret;
+}
+
 int ObRFInFilterMsg::reuse()
 {
   int ret = OB_SUCCESS;
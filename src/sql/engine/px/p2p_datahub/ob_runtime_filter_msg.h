@@ -142,6 +142,10 @@ public:
       const ObBitVector &skip,
       const int64_t batch_size,
       ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx) override;
+  virtual int prepare_storage_white_filter_data(
+      const ObExpr &col_expr,
+      common::ObFixedArray<common::ObObj, common::ObIAllocator> &params,
+      bool &is_applicable) override;
   virtual int insert_by_row(
     const common::ObIArray<ObExpr *> &expr_array,
     const common::ObHashFuncs &hash_funcs,
@@ -208,6 +212,10 @@ public:
       const ObBitVector &skip,
       const int64_t batch_size,
       ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx) override;
+  virtual int prepare_storage_white_filter_data(
+      const ObExpr &col_expr,
+      common::ObFixedArray<common::ObObj, common::ObIAllocator> &params,
+      bool &is_applicable) override;
   virtual int insert_by_row(
     const common::ObIArray<ObExpr *> &expr_array,
     const common::ObHashFuncs &hash_funcs,
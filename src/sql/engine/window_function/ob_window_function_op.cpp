@@ -419,11 +419,82 @@ DEF_TO_STRING(ObWindowFunctionOp::AggrCell)
   J_COLON();
   pos += ObWindowFunctionOp::WinFuncCell::to_string(buf + pos, buf_len - pos);
   J_COMMA();
-  J_KV(K_(finish_prepared), K_(result));
+  J_KV(K_(finish_prepared), K_(result), K_(use_extremum_deque), K_(extremum_deque));
   J_OBJ_END();
   return pos;
 }
 
+int ObWindowFunctionOp::AggrCell::slide_extremum(const Frame &last_frame,
+                                                 const Frame &new_frame,
+                                                 ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  ParamGetter get_param(op_, *wf_info_.aggr_info_.param_exprs_.at(0));
+  const ObDatumCmpFuncType cmp_func = wf_info_.aggr_info_.expr_->basic_funcs_->null_first_cmp_;
+  const bool is_max = T_FUN_MAX == wf_info_.func_type_;
+  if (OB_FAIL(extremum_deque_.slide(last_frame, new_frame, get_param, cmp_func, is_max, val))) {
+    LOG_WARN("slide extremum deque failed", K(ret), K(last_frame), K(new_frame));
+  }
+  return ret;
+}
+
+int ObWindowFunctionOp::AggrCell::ParamGetter::operator()(const int64_t idx, ObDatum *&param)
+{
+  int ret = OB_SUCCESS;
+  const ObRADatumStore::StoredRow *cur_row = NULL;
+  if (OB_FAIL(op_.input_rows_.cur_->get_row(idx, cur_row))) {
+    LOG_WARN("get cur row failed", K(ret), K(idx));
+  } else if (FALSE_IT(op_.clear_evaluated_flag())) {
+  } else if (OB_FAIL(cur_row->to_expr(op_.get_all_expr(), op_.eval_ctx_))) {
+    LOG_WARN("Failed to to_expr", K(ret));
+  } else if (OB_FAIL(param_expr_.eval(op_.eval_ctx_, param))) {
+    LOG_WARN("eval param failed", K(ret));
+  }
+  return ret;
+}
+
+int ObWindowFunctionOp::ExtremumDeque::save_cur_val(const ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  if (val.len_ > buf_size_) {
+    const int64_t size = MAX(val.len_, 2 * buf_size_);
+    char *buf = static_cast<char *>(alloc_.alloc(size));
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret), K(size));
+    } else {
+      buf_ = buf;
+      buf_size_ = size;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(cur_val_.deep_copy(val, buf_, buf_size_, pos))) {
+    LOG_WARN("failed to deep copy datum", K(ret), K(val), K_(buf_size));
+  }
+  return ret;
+}
+
+int ObWindowFunctionOp::ExtremumDeque::pop_front_before(const int64_t head)
+{
+  int ret = OB_SUCCESS;
+  while (!empty() && idxs_.at(begin_) < head) {
+    ++begin_;
+  }
+  // move alive items to the beginning to release popped front items
+  if (begin_ > COMPACT_THRESHOLD && begin_ > idxs_.count() - begin_) {
+    const int64_t alive_cnt = idxs_.count() - begin_;
+    for (int64_t i = 0; i < alive_cnt; ++i) {
+      idxs_.at(i) = idxs_.at(begin_ + i);
+    }
+    while (idxs_.count() > alive_cnt) {
+      idxs_.pop_back();
+    }
+    begin_ = 0;
+  }
+  return ret;
+}
+
 template <typename OP>
 int ObWindowFunctionOp::foreach_stores(OP op)
 {
@@ -1223,6 +1294,15 @@ int ObWindowFunctionOp::init()
             } else {
               AggrCell *aggr_func = new (tmp_ptr) AggrCell(wf_info, *this, *aggr_infos, tenant_id);
               aggr_func->aggr_processor_.set_in_window_func();
+              // max/min over sliding frame is computed by monotonic deque, except for pushdown
+              // window function, whose input rows may be skipped. Frame with unbounded upper
+              // never slides out the extremum, aggr_processor_ is good enough for it.
+              aggr_func->use_extremum_deque_ =
+                  common::REMOVE_EXTRENUM == wf_info.remove_type_
+                  && !wf_info.upper_.is_unbounded_
+                  && !MY_SPEC.is_push_down()
+                  && 1 == wf_info.aggr_info_.param_exprs_.count()
+                  && !ob_is_user_defined_sql_type(wf_info.aggr_info_.expr_->datum_meta_.type_);
               if (OB_FAIL(aggr_func->aggr_processor_.init())) {
                 LOG_WARN("failed to initialize init_group_rows", K(ret));
               } else {
@@ -1679,7 +1759,13 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
       if (wf_cell.is_aggr()) {
         AggrCell *aggr_func = static_cast<AggrCell *>(&wf_cell);
         const ObRADatumStore::StoredRow *cur_row = NULL;
-        if (!Frame::same_frame(last_valid_frame, new_frame)) {
+        if (aggr_func->use_extremum_deque_) {
+          if (OB_FAIL(aggr_func->slide_extremum(last_valid_frame, new_frame, val))) {
+            LOG_WARN("slide extremum failed", K(ret), K(last_valid_frame), K(new_frame));
+          } else {
+            last_valid_frame = new_frame;
+          }
+        } else if (!Frame::same_frame(last_valid_frame, new_frame)) {
           if (!Frame::need_restart_aggr(aggr_func->can_inv(), last_valid_frame, new_frame,
                                         aggr_func->aggr_processor_.get_removal_info(),
                                         wf_cell.wf_info_.remove_type_)) {
@@ -1772,7 +1858,8 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
           LOG_DEBUG("use last value");
           // reuse last result, invoke final directly...
         }
-        if (OB_SUCC(ret)) {
+        if (OB_FAIL(ret) || aggr_func->use_extremum_deque_) {
+        } else {
           if (MY_SPEC.is_consolidator() && !aggr_func->finish_prepared_) { // all rows skipped
             val.set_null();
             last_valid_frame = new_frame;
@@ -554,6 +554,115 @@ public:
     Frame last_valid_frame_;
   };
 
+  // Monotonic deque of row indexes for max/min over sliding frame. Values of the rows are
+  // non-increasing (max) or non-decreasing (min) from front to back, so the front is the result
+  // of the frame, and the earliest of equal values as ObAggregateProcessor does. Each row is
+  // pushed and popped at most once while the frame slides forward, instead of re-aggregating
+  // the whole frame once the extremum slides out. Values are read from input rows by %get_val
+  // when compared, only the value being pushed is copied.
+  class ExtremumDeque
+  {
+  public:
+    explicit ExtremumDeque(const int64_t tenant_id)
+      : idxs_(), begin_(0), cur_val_(), buf_(NULL), buf_size_(0),
+        alloc_(ObMemAttr(tenant_id, common::ObModIds::OB_SQL_WINDOW_FUNC,
+                         common::ObCtxIds::WORK_AREA))
+    {
+      idxs_.set_attr(ObMemAttr(tenant_id, common::ObModIds::OB_SQL_WINDOW_FUNC,
+                               common::ObCtxIds::WORK_AREA));
+    }
+    void reuse()
+    {
+      idxs_.reuse();
+      begin_ = 0;
+    }
+    inline bool empty() const { return begin_ >= idxs_.count(); }
+    // pop back items less (max) or greater (min) than %val of row %idx, then push %idx to back.
+    template <typename GetValFunc>
+    int push(const int64_t idx, const common::ObDatum &val, GetValFunc &get_val,
+             const common::ObDatumCmpFuncType cmp_func, const bool is_max)
+    {
+      int ret = common::OB_SUCCESS;
+      int cmp_ret = 0;
+      bool need_pop = !empty();
+      common::ObDatum *back_val = NULL;
+      // %val is overwritten by %get_val of back items
+      if (need_pop && OB_FAIL(save_cur_val(val))) {
+        SQL_ENG_LOG(WARN, "save value failed", K(ret), K(idx));
+      }
+      while (OB_SUCC(ret) && need_pop && !empty()) {
+        if (OB_FAIL(get_val(idxs_.at(idxs_.count() - 1), back_val))) {
+          SQL_ENG_LOG(WARN, "get value failed", K(ret));
+        } else if (OB_FAIL(cmp_func(*back_val, cur_val_, cmp_ret))) {
+          SQL_ENG_LOG(WARN, "failed to compare", K(ret));
+        } else if ((is_max && cmp_ret < 0) || (!is_max && cmp_ret > 0)) {
+          idxs_.pop_back();
+        } else {
+          need_pop = false;
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(idxs_.push_back(idx))) {
+        SQL_ENG_LOG(WARN, "failed to push back", K(ret));
+      }
+      return ret;
+    }
+    // pop front items which slide out of frame starting from %head.
+    int pop_front_before(const int64_t head);
+    // Slide from %last_frame to %new_frame and set %val to the extremum of %new_frame, NULL if
+    // all values are NULL. %get_val(idx, datum) fetches value of row %idx, %val points to the
+    // datum fetched last. The deque is rebuilt if the frame moves backward or leaves %last_frame.
+    template <typename GetValFunc>
+    int slide(const Frame &last_frame, const Frame &new_frame, GetValFunc &get_val,
+              const common::ObDatumCmpFuncType cmp_func, const bool is_max, common::ObDatum &val)
+    {
+      int ret = common::OB_SUCCESS;
+      int64_t push_begin = last_frame.tail_ + 1;
+      if (-1 == last_frame.head_ || -1 == last_frame.tail_
+          || new_frame.head_ < last_frame.head_
+          || new_frame.tail_ < last_frame.tail_
+          || new_frame.head_ > last_frame.tail_) {
+        reuse();
+        push_begin = new_frame.head_;
+      }
+      common::ObDatum *param = NULL;
+      for (int64_t i = push_begin; OB_SUCC(ret) && i <= new_frame.tail_; ++i) {
+        if (OB_FAIL(get_val(i, param))) {
+          SQL_ENG_LOG(WARN, "get value failed", K(ret), K(i));
+        } else if (param->is_null()) {
+          // null is ignored by max and min
+        } else if (OB_FAIL(push(i, *param, get_val, cmp_func, is_max))) {
+          SQL_ENG_LOG(WARN, "push extremum failed", K(ret), K(i));
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(pop_front_before(new_frame.head_))) {
+        SQL_ENG_LOG(WARN, "pop extremum failed", K(ret), K(new_frame));
+      } else if (empty()) {
+        val.set_null();
+      } else if (OB_FAIL(get_val(idxs_.at(begin_), param))) {
+        SQL_ENG_LOG(WARN, "get value failed", K(ret), K(idxs_.at(begin_)));
+      } else {
+        val = *param;
+      }
+      return ret;
+    }
+    TO_STRING_KV(K_(begin), "count", idxs_.count(), K_(buf_size));
+  private:
+    // copy %val to cur_val_, buf_ is reused and grows to the max length of pushed values.
+    int save_cur_val(const common::ObDatum &val);
+  private:
+    static const int64_t COMPACT_THRESHOLD = 1024;
+    common::ObArray<int64_t> idxs_;
+    // count of popped front items
+    int64_t begin_;
+    common::ObDatum cur_val_;
+    char *buf_;
+    int64_t buf_size_;
+    common::ObArenaAllocator alloc_;
+    DISALLOW_COPY_AND_ASSIGN(ExtremumDeque);
+  };
+
   class AggrCell : public WinFuncCell
   {
   public:
@@ -563,7 +672,9 @@ public:
         aggr_processor_(op_.eval_ctx_, aggr_infos, "WindowAggProc", op.get_monitor_info(), tenant_id),
         result_(),
         got_result_(false),
-        remove_type_(wf_info.remove_type_)
+        remove_type_(wf_info.remove_type_),
+        use_extremum_deque_(false),
+        extremum_deque_(tenant_id)
     {}
     virtual ~AggrCell() { aggr_processor_.destroy(); }
     int trans(const ObRADatumStore::StoredRow &row)
@@ -589,8 +700,21 @@ public:
 
     virtual int final(common::ObDatum &val);
     virtual bool is_aggr() const { return true; }
+    // compute max/min of %new_frame by sliding extremum_deque_ from %last_frame.
+    int slide_extremum(const Frame &last_frame, const Frame &new_frame, common::ObDatum &val);
     DECLARE_VIRTUAL_TO_STRING;
   protected:
+    // evaluate aggregation param of input row for extremum_deque_
+    class ParamGetter
+    {
+    public:
+      ParamGetter(ObWindowFunctionOp &op, const ObExpr &param_expr)
+        : op_(op), param_expr_(param_expr) {}
+      int operator()(const int64_t idx, common::ObDatum *&param);
+    private:
+      ObWindowFunctionOp &op_;
+      const ObExpr &param_expr_;
+    };
     // whether aggregate function support single line translate and inverse translate.
     virtual int trans_self(const ObRADatumStore::StoredRow &row);
     virtual int inv_trans_self(const ObRADatumStore::StoredRow &row);
@@ -600,6 +724,7 @@ public:
       aggr_processor_.reuse();
       result_.reset();
       got_result_ = false;
+      extremum_deque_.reuse();
     }
   public:
     bool finish_prepared_;
@@ -607,6 +732,9 @@ public:
     ObDatum result_;
     bool got_result_;
     uint64_t remove_type_;
+    // max/min computed by extremum_deque_ instead of aggr_processor_
+    bool use_extremum_deque_;
+    ExtremumDeque extremum_deque_;
   };
 
   class NonAggrCell : public WinFuncCell
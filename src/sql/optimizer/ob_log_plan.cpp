@@ -6984,7 +6984,12 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
       LOG_WARN("get unexpected null", K(ret));
     } else if (T_FUN_COUNT != cur_aggr->get_expr_type()
                && T_FUN_MIN != cur_aggr->get_expr_type()
-               && T_FUN_MAX != cur_aggr->get_expr_type()) {
+               && T_FUN_MAX != cur_aggr->get_expr_type()
+               && T_FUN_SUM != cur_aggr->get_expr_type()) {
+      can_push = false;
+    } else if (T_FUN_SUM == cur_aggr->get_expr_type()
+               && GET_MIN_CLUSTER_VERSION() < CLUSTER_VERSION_4_2_0_0) {
+      /* observers of old version can not execute pushed down sum */
       can_push = false;
     } else if (cur_aggr->is_param_distinct() || 1 < cur_aggr->get_real_param_count()) {
       /* mysql mode, support count(distinct c1, c2). if this distinct can be eliminated,
@@ -6995,14 +7000,34 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
     } else if (OB_ISNULL(first_param = cur_aggr->get_param_expr(0))) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("get unexpected null", K(ret));
+    } else if (T_FUN_SUM == cur_aggr->get_expr_type() &&
+               FALSE_IT(first_param = ObRawExprUtils::skip_implicit_cast(first_param))) {
     } else if (!first_param->is_column_ref_expr() ||
                table_item->table_id_ != static_cast<ObColumnRefRawExpr*>(first_param)->get_table_id()) {
       can_push = false;
+    } else if (T_FUN_SUM == cur_aggr->get_expr_type() &&
+               !is_sum_aggr_pushdown_type(first_param->get_result_type().get_type_class(),
+                                          cur_aggr->get_result_type().get_type_class())) {
+      can_push = false;
     }
   }
   return ret;
 }
 
+// storage sums int/uint/number column into number and float/double column into double,
+// same as the type deduced by sum aggregation
+bool ObLogPlan::is_sum_aggr_pushdown_type(const ObObjTypeClass param_tc,
+                                          const ObObjTypeClass result_tc)
+{
+  bool bret = false;
+  if (ObIntTC == param_tc || ObUIntTC == param_tc || ObNumberTC == param_tc) {
+    bret = ObNumberTC == result_tc;
+  } else if (ObFloatTC == param_tc || ObDoubleTC == param_tc) {
+    bret = ObFloatTC == result_tc || ObDoubleTC == result_tc;
+  }
+  return bret;
+}
+
 int ObLogPlan::check_can_pullup_gi(ObLogicalOperator &top,
                                    bool is_partition_wise,
                                    bool need_sort,
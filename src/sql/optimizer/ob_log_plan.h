@@ -752,6 +752,8 @@ public:
 
   int check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &aggrs,
                                     bool &can_push);
+  static bool is_sum_aggr_pushdown_type(const ObObjTypeClass param_tc,
+                                        const ObObjTypeClass result_tc);
 
   int check_basic_groupby_pushdown(const ObIArray<ObAggFunRawExpr*> &aggr_items,
                                    const EqualSets &equal_sets,
@@ -492,6 +492,347 @@ int ObMinMaxAggCell::deep_copy_datum(const blocksstable::ObStorageDatum &src)
   return ret;
 }
 
+ObSumAggCell::ObSumAggCell(
+    const int32_t col_idx,
+    const share::schema::ObColumnParam *col_param,
+    sql::ObExpr *expr,
+    common::ObIAllocator &allocator)
+    : ObAggCell(col_idx, col_param, expr, allocator),
+      column_tc_(common::ObMaxTC),
+      result_tc_(common::ObMaxTC),
+      has_value_(false),
+      sum_int_(0),
+      sum_uint_(0),
+      sum_double_(0),
+      sum_num_(),
+      agg_datum_buf_(allocator),
+      cell_data_ptrs_(nullptr),
+      storage_datums_(nullptr),
+      batch_size_(0)
+{
+  sum_num_.set_zero();
+}
+
+void ObSumAggCell::reset()
+{
+  agg_datum_buf_.reset();
+  if (nullptr != cell_data_ptrs_) {
+    allocator_.free(cell_data_ptrs_);
+    cell_data_ptrs_ = nullptr;
+  }
+  if (nullptr != storage_datums_) {
+    allocator_.free(storage_datums_);
+    storage_datums_ = nullptr;
+  }
+  batch_size_ = 0;
+  column_tc_ = common::ObMaxTC;
+  result_tc_ = common::ObMaxTC;
+  reuse();
+  ObAggCell::reset();
+}
+
+void ObSumAggCell::reuse()
+{
+  ObAggCell::reuse();
+  has_value_ = false;
+  sum_int_ = 0;
+  sum_uint_ = 0;
+  sum_double_ = 0;
+  sum_num_.set_zero();
+}
+
+bool ObSumAggCell::is_type_supported(const common::ObObjTypeClass column_tc, const common::ObObjTypeClass result_tc)
+{
+  bool bret = false;
+  switch (column_tc) {
+    case common::ObIntTC:
+    case common::ObUIntTC:
+    case common::ObNumberTC: {
+      bret = common::ObNumberTC == result_tc;
+      break;
+    }
+    case common::ObFloatTC:
+    case common::ObDoubleTC: {
+      bret = common::ObFloatTC == result_tc || common::ObDoubleTC == result_tc;
+      break;
+    }
+    default: {
+      bret = false;
+    }
+  }
+  return bret;
+}
+
+int ObSumAggCell::init(const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_ISNULL(col_param_) || OB_ISNULL(expr_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null col param or expr", K(ret), KP_(col_param), KP_(expr));
+  } else if (FALSE_IT(column_tc_ = col_param_->get_meta_type().get_type_class())) {
+  } else if (FALSE_IT(result_tc_ = ob_obj_type_class(expr_->datum_meta_.type_))) {
+  } else if (OB_UNLIKELY(!is_type_supported(column_tc_, result_tc_))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Sum type is not supported", K(ret), K_(column_tc), K_(result_tc));
+  } else if (OB_FAIL(agg_datum_buf_.init(batch_size))) {
+    LOG_WARN("Failed to init agg datum buf", K(ret));
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(char*) * batch_size))) {
+    ret = common::OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc cell data ptrs", K(ret), K(batch_size));
+  } else if (FALSE_IT(cell_data_ptrs_ = static_cast<const char**>(buf))) {
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(blocksstable::ObStorageDatum) * batch_size))) {
+    ret = common::OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc storage datums", K(ret), K(batch_size));
+  } else {
+    storage_datums_ = new (buf) blocksstable::ObStorageDatum[batch_size];
+    batch_size_ = batch_size;
+  }
+  return ret;
+}
+
+int ObSumAggCell::process(blocksstable::ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObStorageDatum &storage_datum = row.storage_datums_[col_idx_];
+  if (OB_FAIL(fill_default_if_need(storage_datum))) {
+    LOG_WARN("Failed to fill default", K(ret), K(storage_datum), K(*this));
+  } else if (OB_FAIL(process(static_cast<const common::ObDatum &>(storage_datum)))) {
+    LOG_WARN("Failed to process datum", K(ret), K(storage_datum), KPC(this));
+  }
+  LOG_DEBUG("after process single row", K(storage_datum), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(
+    blocksstable::ObIMicroBlockReader *reader,
+    int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(row_ids) || OB_UNLIKELY(row_count > batch_size_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Uexpected, row_ids is null or too many rows", K(ret), K(row_count), K(*this));
+  } else if (blocksstable::ObIMicroBlockReader::Reader == reader->get_type()) {
+    blocksstable::ObMicroBlockReader *block_reader = static_cast<blocksstable::ObMicroBlockReader*>(reader);
+    if (OB_FAIL(block_reader->get_column_datums(col_idx_, row_ids, row_count, storage_datums_))) {
+      LOG_WARN("Failed to get column datums", K(ret), K(row_count), KPC(this));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+      if (OB_FAIL(fill_default_if_need(storage_datums_[i]))) {
+        LOG_WARN("Failed to fill default", K(ret), K(i), K(*this));
+      } else if (OB_FAIL(process(static_cast<const common::ObDatum &>(storage_datums_[i])))) {
+        LOG_WARN("Failed to process datum", K(ret), K(i), K(storage_datums_[i]), KPC(this));
+      }
+    }
+  } else {
+    blocksstable::ObMicroBlockDecoder *block_decoder = static_cast<blocksstable::ObMicroBlockDecoder*>(reader);
+    blocksstable::ObEncodingIntSum int_sum(common::ObUIntTC == column_tc_);
+    if (common::ObIntTC != column_tc_ && common::ObUIntTC != column_tc_) {
+      ret = OB_NOT_SUPPORTED;
+    } else if (OB_FAIL(block_decoder->get_int_sum(
+        col_idx_, row_ids, row_count, agg_datum_buf_.get_datums(), int_sum))) {
+      if (OB_NOT_SUPPORTED != ret) {
+        LOG_WARN("Failed to get int sum", K(ret), K(row_count), KPC(this));
+      }
+    } else if (int_sum.overflow_) {
+      ret = OB_NOT_SUPPORTED;
+    } else if (OB_FAIL(add_int_sum(int_sum))) {
+      LOG_WARN("Failed to add int sum", K(ret), K(int_sum), KPC(this));
+    }
+    if (OB_NOT_SUPPORTED == ret) {
+      // sum the decoded datums
+      ret = OB_SUCCESS;
+      agg_datum_buf_.reuse();
+      common::ObDatum *datums = agg_datum_buf_.get_datums();
+      if (OB_FAIL(block_decoder->get_column_datums(col_idx_, row_ids, cell_data_ptrs_, row_count, datums))) {
+        LOG_WARN("Failed to get column datums", K(ret), K(row_count), KPC(this));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+        if (datums[i].is_nop()) {
+          // column not compacted yet, use default value
+          blocksstable::ObStorageDatum &def_datum = storage_datums_[i];
+          def_datum.set_nop();
+          if (OB_FAIL(fill_default_if_need(def_datum))) {
+            LOG_WARN("Failed to fill default", K(ret), K(i), K(*this));
+          } else if (OB_FAIL(process(static_cast<const common::ObDatum &>(def_datum)))) {
+            LOG_WARN("Failed to process datum", K(ret), K(i), K(def_datum), KPC(this));
+          }
+        } else if (OB_FAIL(process(datums[i]))) {
+          LOG_WARN("Failed to process datum", K(ret), K(i), K(datums[i]), KPC(this));
+        }
+      }
+    }
+  }
+  LOG_DEBUG("after process batch rows", K(ret), K(row_count), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
+{
+  UNUSED(index_info);
+  int ret = OB_NOT_SUPPORTED;
+  return ret;
+}
+
+int ObSumAggCell::process(const common::ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (datum.is_null()) {
+  } else {
+    switch (column_tc_) {
+      case common::ObIntTC: {
+        ret = add_int(datum.get_int());
+        break;
+      }
+      case common::ObUIntTC: {
+        ret = add_uint(datum.get_uint());
+        break;
+      }
+      case common::ObNumberTC: {
+        ret = add_number(common::number::ObNumber(datum.get_number()));
+        break;
+      }
+      case common::ObFloatTC: {
+        sum_double_ += datum.get_float();
+        break;
+      }
+      case common::ObDoubleTC: {
+        sum_double_ += datum.get_double();
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected column type", K(ret), K_(column_tc));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      has_value_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_int(const int64_t value)
+{
+  int ret = OB_SUCCESS;
+  int64_t sum = 0;
+  if (OB_UNLIKELY(__builtin_add_overflow(sum_int_, value, &sum))) {
+    LOG_DEBUG("int64_t add overflow, will use number", K_(sum_int), K(value));
+    if (OB_FAIL(flush_int_sum())) {
+      LOG_WARN("Failed to flush int sum", K(ret), KPC(this));
+    } else {
+      sum_int_ = value;
+    }
+  } else {
+    sum_int_ = sum;
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_uint(const uint64_t value)
+{
+  int ret = OB_SUCCESS;
+  uint64_t sum = 0;
+  if (OB_UNLIKELY(__builtin_add_overflow(sum_uint_, value, &sum))) {
+    LOG_DEBUG("uint64_t add overflow, will use number", K_(sum_uint), K(value));
+    if (OB_FAIL(flush_int_sum())) {
+      LOG_WARN("Failed to flush int sum", K(ret), KPC(this));
+    } else {
+      sum_uint_ = value;
+    }
+  } else {
+    sum_uint_ = sum;
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_int_sum(const blocksstable::ObEncodingIntSum &int_sum)
+{
+  int ret = OB_SUCCESS;
+  if (0 == int_sum.get_count()) {
+  } else if (common::ObIntTC == column_tc_ && OB_FAIL(add_int(int_sum.get_int()))) {
+    LOG_WARN("Failed to add int", K(ret), K(int_sum));
+  } else if (common::ObUIntTC == column_tc_ && OB_FAIL(add_uint(int_sum.get_uint()))) {
+    LOG_WARN("Failed to add uint", K(ret), K(int_sum));
+  } else {
+    has_value_ = true;
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_number(const common::number::ObNumber &nmb)
+{
+  int ret = OB_SUCCESS;
+  char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+  common::ObDataBuffer local_alloc(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+  common::number::ObNumber result_nmb;
+  if (OB_FAIL(sum_num_.add(nmb, result_nmb, local_alloc))) {
+    LOG_WARN("Failed to add number", K(ret), K(nmb), K_(sum_num));
+  } else {
+    common::ObDataBuffer num_alloc(num_buf_, common::number::ObNumber::MAX_BYTE_LEN);
+    if (OB_FAIL(sum_num_.from(result_nmb, num_alloc))) {
+      LOG_WARN("Failed to copy number", K(ret), K(result_nmb));
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::flush_int_sum()
+{
+  int ret = OB_SUCCESS;
+  char buf_alloc[common::number::ObNumber::MAX_BYTE_LEN];
+  common::ObDataBuffer local_alloc(buf_alloc, common::number::ObNumber::MAX_BYTE_LEN);
+  common::number::ObNumber nmb;
+  if (common::ObIntTC == column_tc_ && 0 != sum_int_) {
+    if (OB_FAIL(nmb.from(sum_int_, local_alloc))) {
+      LOG_WARN("Failed to cons number from int", K(ret), K_(sum_int));
+    } else if (OB_FAIL(add_number(nmb))) {
+      LOG_WARN("Failed to add number", K(ret), K(nmb));
+    } else {
+      sum_int_ = 0;
+    }
+  } else if (common::ObUIntTC == column_tc_ && 0 != sum_uint_) {
+    if (OB_FAIL(nmb.from(sum_uint_, local_alloc))) {
+      LOG_WARN("Failed to cons number from uint", K(ret), K_(sum_uint));
+    } else if (OB_FAIL(add_number(nmb))) {
+      LOG_WARN("Failed to add number", K(ret), K(nmb));
+    } else {
+      sum_uint_ = 0;
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
+{
+  UNUSED(need_padding);
+  int ret = OB_SUCCESS;
+  common::ObDatum &result = expr_->locate_datum_for_write(ctx);
+  sql::ObEvalInfo &eval_info = expr_->get_eval_info(ctx);
+  if (!has_value_) {
+    result.set_null();
+  } else if (common::ObNumberTC == result_tc_) {
+    if (OB_FAIL(flush_int_sum())) {
+      LOG_WARN("Failed to flush int sum", K(ret), KPC(this));
+    } else {
+      result.set_number(sum_num_);
+    }
+  } else if (common::ObDoubleTC == result_tc_) {
+    result.set_double(sum_double_);
+  } else if (common::ObFloatTC == result_tc_) {
+    result.set_float(static_cast<float>(sum_double_));
+  } else {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected result type", K(ret), K_(result_tc));
+  }
+  if (OB_SUCC(ret)) {
+    eval_info.evaluated_ = true;
+  }
+  LOG_DEBUG("fill result", K(result), KPC(this));
+  return ret;
+}
+
 ObAggRow::ObAggRow(common::ObIAllocator &allocator) :
     agg_cells_(allocator),
     need_exclude_null_(false),
@@ -601,6 +942,18 @@ int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
           } else if (OB_FAIL(agg_cells_.push_back(cell))) {
             LOG_WARN("Failed to push back agg cell", K(ret), K(i));
           }
+        } else if (T_FUN_SUM == expr->type_) {
+          need_exclude_null_ = true;
+          const share::schema::ObColumnParam *col_param = out_cols_param->at(col_idx);
+          if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObSumAggCell))) ||
+              OB_ISNULL(cell = new(buf) ObSumAggCell(col_idx, col_param, expr, allocator_))) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+          } else if (OB_FAIL(static_cast<ObSumAggCell*>(cell)->init(batch_size))) {
+            LOG_WARN("Failed to init ObSumAggCell", K(ret), KPC(cell));
+          } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+            LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+          }
         } else {
           ret = OB_NOT_SUPPORTED;
           LOG_WARN("Agg is not supported", K(ret), K(expr->type_));
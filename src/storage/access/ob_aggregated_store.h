@@ -25,6 +25,7 @@ namespace blocksstable
 {
 class ObMicroBlockDecoder;
 struct ObMicroIndexInfo;
+struct ObEncodingIntSum;
 }
 namespace storage
 {
@@ -40,6 +41,7 @@ public:
     COUNT,
     MINMAX,
     FIRST_ROW,
+    SUM,
   };
   ObAggCell(
       const int32_t col_idx,
@@ -171,7 +173,55 @@ private:
   common::ObArenaAllocator datum_allocator_;
 };
 
-// TODO sum
+// Sum of int/uint/number/float/double column, AVG is expanded to SUM and COUNT.
+// Integer column is summed on encoded data by decoder if possible, and summed as
+// int64_t/uint64_t until overflow, then accumulated into number.
+class ObSumAggCell : public ObAggCell
+{
+public:
+  ObSumAggCell(
+      const int32_t col_idx,
+      const share::schema::ObColumnParam *col_param,
+      sql::ObExpr *expr,
+      common::ObIAllocator &allocator);
+  virtual ~ObSumAggCell() { reset(); };
+  virtual void reset() override;
+  virtual void reuse() override;
+  virtual ObAggCellType get_type() const override { return SUM; }
+  int init(const int64_t batch_size);
+  virtual int process(blocksstable::ObDatumRow &row) override;
+  virtual int process(
+      blocksstable::ObIMicroBlockReader *reader,
+      int64_t *row_ids,
+      const int64_t row_count) override;
+  virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
+  static bool is_type_supported(
+      const common::ObObjTypeClass column_tc,
+      const common::ObObjTypeClass result_tc);
+  INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(column_tc), K_(result_tc), K_(has_value),
+      K_(sum_int), K_(sum_uint), K_(sum_double), K_(sum_num));
+private:
+  int process(const common::ObDatum &datum);
+  int add_int(const int64_t value);
+  int add_uint(const uint64_t value);
+  int add_int_sum(const blocksstable::ObEncodingIntSum &int_sum);
+  int add_number(const common::number::ObNumber &nmb);
+  // move int64_t/uint64_t sum into number sum
+  int flush_int_sum();
+  common::ObObjTypeClass column_tc_;
+  common::ObObjTypeClass result_tc_;
+  bool has_value_;
+  int64_t sum_int_;
+  uint64_t sum_uint_;
+  double sum_double_;
+  common::number::ObNumber sum_num_;
+  char num_buf_[common::number::ObNumber::MAX_BYTE_LEN];
+  ObAggDatumBuf agg_datum_buf_;
+  const char **cell_data_ptrs_;
+  blocksstable::ObStorageDatum *storage_datums_;
+  int64_t batch_size_;
+};
 
 class ObAggRow
 {
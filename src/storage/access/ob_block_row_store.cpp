@@ -172,6 +172,13 @@ int ObBlockRowStore::filter_micro_block(
     LOG_WARN("Unexpected null filter bitmap", K(ret));
   } else if (nullptr != parent && OB_FAIL(parent->prepare_skip_filter())) {
     LOG_WARN("Failed to check parent blockscan", K(ret));
+  } else if (filter->is_filter_dynamic_node()
+             && OB_FAIL(static_cast<sql::ObDynamicFilterExecutor *>(filter)->prepare_data())) {
+    LOG_WARN("Failed to prepare runtime filter data", K(ret), KPC(filter));
+  } else if (filter->is_filter_dynamic_node()
+             && !static_cast<sql::ObDynamicFilterExecutor *>(filter)->is_data_prepared()) {
+    // runtime filter not ready or not applicable in storage
+    result->reuse(!static_cast<sql::ObDynamicFilterExecutor *>(filter)->is_filter_always_false());
   } else if (filter->is_filter_node()) {
     if (OB_FAIL(micro_scanner.filter_pushdown_filter(parent, filter, pd_filter_info_, *result))) {
       LOG_WARN("Failed to filter pushdown filter", K(ret), KPC(filter));
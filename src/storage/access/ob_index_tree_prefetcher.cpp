@@ -16,6 +16,7 @@
 #include "share/rc/ob_tenant_base.h"
 #include "ob_index_tree_prefetcher.h"
 #include "ob_aggregated_store.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
 #include "storage/blocksstable/ob_storage_cache_suite.h"
 
 namespace oceanbase
@@ -309,6 +310,65 @@ int ObIndexTreePrefetcher::check_bloom_filter(const ObMicroIndexInfo &index_info
   return ret;
 }
 
+int ObIndexTreePrefetcher::submit_block_io(
+    const uint64_t tenant_id,
+    ObMicroIndexInfo &index_block_info,
+    ObMicroBlockDataHandle &micro_handle,
+    const bool is_data)
+{
+  int ret = OB_SUCCESS;
+  const MacroBlockId &macro_id = index_block_info.get_macro_id();
+  ObMacroBlockHandle macro_handle;
+  if (is_data) {
+    if (OB_FAIL(data_block_cache_->prefetch(
+                tenant_id,
+                macro_id,
+                index_block_info,
+                access_ctx_->query_flag_,
+                macro_handle))) {
+      LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(macro_handle), K(micro_handle));
+    }
+  } else if (OB_FAIL(index_block_cache_->prefetch(
+              tenant_id,
+              macro_id,
+              index_block_info,
+              access_ctx_->query_flag_,
+              macro_handle))) {
+    LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(micro_handle));
+  }
+  if (OB_SUCC(ret) && OB_FAIL(set_block_io_handle(
+              tenant_id, index_block_info, macro_handle, is_data, micro_handle))) {
+    LOG_WARN("Fail to set block io handle", K(ret), K(index_block_info), K(micro_handle));
+  }
+  return ret;
+}
+
+int ObIndexTreePrefetcher::set_block_io_handle(
+    const uint64_t tenant_id,
+    ObMicroIndexInfo &index_block_info,
+    ObMacroBlockHandle &macro_handle,
+    const bool is_data,
+    ObMicroBlockDataHandle &micro_handle)
+{
+  int ret = OB_SUCCESS;
+  const MacroBlockId &macro_id = index_block_info.get_macro_id();
+  if (ObSSTableMicroBlockState::UNKNOWN_STATE == micro_handle.block_state_) {
+    micro_handle.tenant_id_ = tenant_id;
+    micro_handle.macro_block_id_ = macro_id;
+    micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
+    micro_handle.io_handle_ = macro_handle;
+
+    if (is_data && OB_FAIL(micro_block_handle_mgr_.put_micro_block_handle(
+                tenant_id,
+                macro_id,
+                *index_block_info.row_header_,
+                micro_handle))) {
+      STORAGE_LOG(WARN, "failed to put handle cache", K(ret), K(tenant_id), K(macro_id), K(index_block_info));
+    }
+  }
+  return ret;
+}
+
 int ObIndexTreePrefetcher::prefetch_block_data(
     blocksstable::ObMicroIndexInfo &index_block_info,
     ObMicroBlockDataHandle &micro_handle,
@@ -356,39 +416,8 @@ int ObIndexTreePrefetcher::prefetch_block_data(
   if (OB_SUCC(ret)) {
     micro_handle.micro_info_.offset_ = offset;
     micro_handle.micro_info_.size_ = index_block_info.get_block_size();
-    if (need_submit_io) {
-      ObMacroBlockHandle macro_handle;
-      if (is_data) {
-        if (OB_FAIL(data_block_cache_->prefetch(
-                    tenant_id,
-                    macro_id,
-                    index_block_info,
-                    access_ctx_->query_flag_,
-                    macro_handle))) {
-          LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(macro_handle), K(micro_handle));
-        }
-      } else if (OB_FAIL(index_block_cache_->prefetch(
-                  tenant_id,
-                  macro_id,
-                  index_block_info,
-                  access_ctx_->query_flag_,
-                  macro_handle))) {
-        LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(micro_handle));
-      }
-      if (OB_SUCC(ret) && ObSSTableMicroBlockState::UNKNOWN_STATE == micro_handle.block_state_) {
-        micro_handle.tenant_id_ = tenant_id;
-        micro_handle.macro_block_id_ = macro_id;
-        micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
-        micro_handle.io_handle_ = macro_handle;
-
-        if (is_data && OB_FAIL(micro_block_handle_mgr_.put_micro_block_handle(
-                    tenant_id,
-                    macro_id,
-                    *index_block_info.row_header_,
-                    micro_handle))) {
-          STORAGE_LOG(WARN, "failed to put handle cache", K(ret), K(tenant_id), K(macro_id), K(index_block_info));
-        }
-      }
+    if (need_submit_io && OB_FAIL(submit_block_io(tenant_id, index_block_info, micro_handle, is_data))) {
+      LOG_WARN("Fail to submit block io", K(ret), K(index_block_info), K(micro_handle));
     }
   }
   if (OB_SUCC(ret)) {
@@ -410,6 +439,7 @@ void ObIndexTreeMultiPrefetcher::reset()
   prefetched_rowkey_cnt_ = 0;
   rowkeys_ = nullptr;
   ext_read_handles_.reset();
+  reset_pending_block_io(false /* reset_handles */);
   ObIndexTreePrefetcher::reset();
 }
 
@@ -419,6 +449,7 @@ void ObIndexTreeMultiPrefetcher::reuse()
   prefetch_rowkey_idx_ = 0;
   prefetched_rowkey_cnt_ = 0;
   rowkeys_ = nullptr;
+  reset_pending_block_io(false /* reset_handles */);
   ObIndexTreePrefetcher::reuse();
 }
 
@@ -523,6 +554,11 @@ int ObIndexTreeMultiPrefetcher::multi_prefetch()
     LOG_WARN("ObIndexTreeMultiPrefetcher not init", K(ret));
   } else {
     const int64_t rowkey_cnt = rowkeys_->count();
+    const int64_t prefetch_end = MIN(rowkey_cnt, fetch_rowkey_idx_ + max_handle_prefetching_cnt_);
+    if (prefetch_rowkey_idx_ < prefetch_end
+        && OB_FAIL(batch_lookup_in_cache(prefetch_rowkey_idx_, prefetch_end))) {
+      LOG_WARN("Failed to batch lookup in cache", K(ret), K_(prefetch_rowkey_idx), K(prefetch_end));
+    }
     for (int64_t i = fetch_rowkey_idx_;
          OB_SUCC(ret) && prefetched_rowkey_cnt_ < rowkey_cnt && i < fetch_rowkey_idx_ + max_handle_prefetching_cnt_;
          ++i) {
@@ -530,15 +566,9 @@ int ObIndexTreeMultiPrefetcher::multi_prefetch()
       const bool is_empty_handle = i >= prefetch_rowkey_idx_;
       ObSSTableReadHandleExt &read_handle = ext_read_handles_[i % max_handle_prefetching_cnt_];
       if (is_empty_handle && prefetch_rowkey_idx_ < rowkey_cnt) {
-        read_handle.reuse();
-        read_handle.rowkey_ = &rowkeys_->at(prefetch_rowkey_idx_);
-        read_handle.range_idx_ = prefetch_rowkey_idx_;
-        read_handle.is_get_ = true;
+        // read handle is prepared and looked up in cache by batch_lookup_in_cache
         prefetch_rowkey_idx_++;
-
-        if (OB_FAIL(lookup_in_cache(read_handle))) {
-          LOG_WARN("Failed to lookup_in_cache", K(ret));
-        } else if (ObSSTableRowState::IN_BLOCK == read_handle.row_state_) {
+        if (ObSSTableRowState::IN_BLOCK == read_handle.row_state_) {
           if (OB_FAIL(sstable_->get_index_tree_root(index_block_))) {
             LOG_WARN("Fail to get index block root", K(ret));
           } else if (!index_scanner_.is_valid() && OB_FAIL(init_index_scanner(index_scanner_))) {
@@ -592,10 +622,165 @@ int ObIndexTreeMultiPrefetcher::multi_prefetch()
         }
       }
     }
+    if (OB_FAIL(ret)) {
+      reset_pending_block_io(true /* reset_handles */);
+    } else if (OB_FAIL(submit_pending_block_io())) {
+      LOG_WARN("Fail to submit pending block io", K(ret), KPC(this));
+    }
   }
   return ret;
 }
 
+int ObIndexTreeMultiPrefetcher::batch_lookup_in_cache(const int64_t begin, const int64_t end)
+{
+  int ret = OB_SUCCESS;
+  alignas(ObRowCacheKey) char key_buf[sizeof(ObRowCacheKey) * MAX_MULTIGET_MICRO_DATA_HANDLE_CNT];
+  const ObRowCacheKey *keys[MAX_MULTIGET_MICRO_DATA_HANDLE_CNT];
+  ObRowValueHandle *row_handles[MAX_MULTIGET_MICRO_DATA_HANDLE_CNT];
+  int64_t key_cnt = 0;
+  if (OB_UNLIKELY(begin < 0 || begin >= end || end - begin > max_handle_prefetching_cnt_
+      || end > rowkeys_->count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(begin), K(end), KPC(this));
+  } else {
+    const bool use_row_cache = !sstable_->is_empty() && access_ctx_->enable_get_row_cache();
+    for (int64_t i = begin; OB_SUCC(ret) && i < end; ++i) {
+      ObSSTableReadHandleExt &read_handle = ext_read_handles_[i % max_handle_prefetching_cnt_];
+      read_handle.reuse();
+      read_handle.rowkey_ = &rowkeys_->at(i);
+      read_handle.range_idx_ = i;
+      read_handle.is_get_ = true;
+      if (!use_row_cache) {
+        if (OB_FAIL(lookup_in_cache(read_handle))) {
+          LOG_WARN("Failed to lookup_in_cache", K(ret));
+        }
+      } else {
+        keys[key_cnt] = new (key_buf + key_cnt * sizeof(ObRowCacheKey)) ObRowCacheKey(
+            MTL_ID(), iter_param_->tablet_id_, *read_handle.rowkey_,
+            *datum_utils_, data_version_, sstable_->get_key().table_type_);
+        row_handles[key_cnt] = &read_handle.row_handle_;
+        ++key_cnt;
+      }
+    }
+    // probe row cache for all rowkeys at once, the cache buckets of rowkeys are prefetched
+    if (OB_FAIL(ret) || 0 == key_cnt) {
+    } else if (OB_FAIL(ObStorageCacheSuite::get_instance().get_row_cache().batch_get_row(
+        keys, key_cnt, row_handles))) {
+      LOG_WARN("Fail to batch get rows from row cache", K(ret), K(key_cnt));
+    } else {
+      const int64_t start_log_ts = sstable_->get_key().get_start_scn().get_val_for_tx();
+      for (int64_t i = begin; i < end; ++i) {
+        ObSSTableReadHandleExt &read_handle = ext_read_handles_[i % max_handle_prefetching_cnt_];
+        const ObRowCacheValue *row_value = read_handle.row_handle_.row_value_;
+        if (nullptr != row_value && row_value->get_start_log_ts() == start_log_ts) {
+          read_handle.row_state_ = ObSSTableRowState::IN_ROW_CACHE;
+          ++access_ctx_->table_store_stat_.row_cache_hit_cnt_;
+        } else {
+          read_handle.row_state_ = ObSSTableRowState::IN_BLOCK;
+          ++access_ctx_->table_store_stat_.row_cache_miss_cnt_;
+        }
+      }
+    }
+  }
+  for (int64_t i = 0; i < key_cnt; ++i) {
+    keys[i]->~ObRowCacheKey();
+  }
+  return ret;
+}
+
+int ObIndexTreeMultiPrefetcher::submit_block_io(
+    const uint64_t tenant_id,
+    ObMicroIndexInfo &index_block_info,
+    ObMicroBlockDataHandle &micro_handle,
+    const bool is_data)
+{
+  int ret = OB_SUCCESS;
+  // deferred handles are not in micro_block_handle_mgr_ yet, the micro block may be pending already
+  const int64_t pending_idx = is_data ? find_pending_block_io(index_block_info) : -1;
+  const int64_t pending_cnt = pending_io_infos_.count();
+  if (pending_idx < 0 && (!is_data || pending_cnt >= MAX_MULTIGET_MICRO_DATA_HANDLE_CNT)) {
+    if (OB_FAIL(ObIndexTreePrefetcher::submit_block_io(tenant_id, index_block_info, micro_handle, is_data))) {
+      LOG_WARN("Fail to submit block io", K(ret), K(index_block_info), K(micro_handle));
+    }
+  } else if (pending_idx < 0 && OB_FAIL(pending_io_infos_.push_back(index_block_info))) {
+    LOG_WARN("Fail to push back pending io info", K(ret), K(index_block_info));
+  } else if (OB_FAIL(pending_io_handles_.push_back(&micro_handle))) {
+    LOG_WARN("Fail to push back pending io handle", K(ret));
+  } else if (OB_FAIL(pending_io_info_idxs_.push_back(pending_idx < 0 ? pending_cnt : pending_idx))) {
+    LOG_WARN("Fail to push back pending io info idx", K(ret));
+    pending_io_handles_.pop_back();
+  } else {
+    if (pending_idx < 0) {
+      pending_io_headers_[pending_cnt] = *index_block_info.row_header_;
+      pending_io_infos_.at(pending_cnt).row_header_ = &pending_io_headers_[pending_cnt];
+    }
+    // io handle is set after submitted, state is set here to be checked during prefetch
+    micro_handle.tenant_id_ = tenant_id;
+    micro_handle.macro_block_id_ = index_block_info.get_macro_id();
+    micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
+  }
+  if (OB_FAIL(ret) && pending_idx < 0 && pending_io_infos_.count() > pending_cnt) {
+    pending_io_infos_.pop_back();
+  }
+  return ret;
+}
+
+int64_t ObIndexTreeMultiPrefetcher::find_pending_block_io(const ObMicroIndexInfo &index_block_info) const
+{
+  int64_t pending_idx = -1;
+  for (int64_t i = 0; pending_idx < 0 && i < pending_io_infos_.count(); ++i) {
+    const ObMicroIndexInfo &pending_info = pending_io_infos_.at(i);
+    if (pending_info.get_macro_id() == index_block_info.get_macro_id() &&
+        pending_info.get_block_offset() == index_block_info.get_block_offset()) {
+      pending_idx = i;
+    }
+  }
+  return pending_idx;
+}
+
+int ObIndexTreeMultiPrefetcher::submit_pending_block_io()
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObMacroBlockHandle, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT> macro_handles;
+  if (pending_io_infos_.empty()) {
+  } else if (OB_FAIL(data_block_cache_->prefetch(
+              MTL_ID(), pending_io_infos_, access_ctx_->query_flag_, macro_handles))) {
+    LOG_WARN("Fail to prefetch micro blocks in batch", K(ret), K(pending_io_infos_.count()));
+  } else {
+    bool is_put[MAX_MULTIGET_MICRO_DATA_HANDLE_CNT] = { false };
+    for (int64_t i = 0; OB_SUCC(ret) && i < pending_io_handles_.count(); ++i) {
+      ObMicroBlockDataHandle &micro_handle = *pending_io_handles_.at(i);
+      const int64_t info_idx = pending_io_info_idxs_.at(i);
+      micro_handle.io_handle_ = macro_handles.at(info_idx);
+      if (is_put[info_idx]) {
+      } else if (OB_FAIL(micro_block_handle_mgr_.put_micro_block_handle(
+                  micro_handle.tenant_id_,
+                  micro_handle.macro_block_id_,
+                  *pending_io_infos_.at(info_idx).row_header_,
+                  micro_handle))) {
+        LOG_WARN("failed to put handle cache", K(ret), K(i), K(micro_handle));
+      } else {
+        is_put[info_idx] = true;
+      }
+    }
+  }
+  reset_pending_block_io(OB_SUCCESS != ret);
+  return ret;
+}
+
+void ObIndexTreeMultiPrefetcher::reset_pending_block_io(const bool reset_handles)
+{
+  if (reset_handles) {
+    // no io is submitted for these handles, do not leave them in IN_BLOCK_IO
+    for (int64_t i = 0; i < pending_io_handles_.count(); ++i) {
+      pending_io_handles_.at(i)->reset();
+    }
+  }
+  pending_io_infos_.reuse();
+  pending_io_handles_.reuse();
+  pending_io_info_idxs_.reuse();
+}
+
 int ObIndexTreeMultiPrefetcher::drill_down(
     const MacroBlockId &macro_id,
     ObSSTableReadHandleExt &read_handle,
@@ -1053,6 +1238,9 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::p
               LOG_DEBUG("Success to agg index info", K(ret), KPC(agg_row_store_));
               continue;
             }
+          } else if (can_skip_by_skip_index(block_info)) {
+            LOG_DEBUG("Skip micro block by skip index", K(block_info));
+            continue;
           } else if (OB_FAIL(check_row_lock(block_info, is_row_lock_checked_))) {
             if (OB_UNLIKELY(OB_ITER_END != ret)) {
               LOG_WARN("Fail to check row lock", K(ret), K(block_info), KPC(this));
@@ -1440,6 +1628,34 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::c
   return ret;
 }
 
+template <int32_t DATA_PREFETCH_DEPTH, int32_t INDEX_PREFETCH_DEPTH>
+bool ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::can_skip_by_skip_index(
+    const blocksstable::ObMicroIndexInfo &index_info)
+{
+  int ret = OB_SUCCESS;
+  bool can_skip = false;
+  // only blocks before border rowkey are exclusive to this sstable
+  if (nullptr != iter_param_->pushdown_filter_
+      && iter_param_->enable_pd_filter()
+      && !index_info.is_get()
+      && index_info.skip_index_.is_valid()
+      && index_info.can_blockscan(iter_param_->has_lob_column_out())
+      && nullptr != iter_param_->get_read_info()) {
+    bool always_false = false;
+    if (OB_FAIL(blocksstable::ObSkipIndexFilter::check_always_false(
+                *iter_param_->pushdown_filter_,
+                *iter_param_->get_read_info(),
+                index_info.skip_index_,
+                index_info.get_row_count(),
+                always_false))) {
+      LOG_WARN("Fail to check skip index, ignore", K(ret), K(index_info));
+    } else {
+      can_skip = always_false;
+    }
+  }
+  return can_skip;
+}
+
 //////////////////////////////////////// ObIndexTreeLevelHandle //////////////////////////////////////////////
 template <int32_t DATA_PREFETCH_DEPTH, int32_t INDEX_PREFETCH_DEPTH>
 int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::ObIndexTreeLevelHandle::prefetch(
@@ -1485,6 +1701,8 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::O
         } else {
           LOG_DEBUG("Success to agg index info", K(ret), K(index_info));
         }
+      } else if (prefetcher.can_skip_by_skip_index(index_info)) {
+        LOG_DEBUG("Skip index block by skip index", K(index_info));
       } else if (OB_FAIL(prefetcher.check_row_lock(index_info, is_row_lock_checked_))) {
         if (OB_UNLIKELY(OB_ITER_END != ret)) {
           LOG_WARN("Fail to check row lock", K(ret), KPC(this));
@@ -156,6 +156,17 @@ protected:
       ObMicroIndexInfo &index_block_info,
       ObMicroBlockDataHandle &micro_handle,
       const bool is_data = true);
+  virtual int submit_block_io(
+      const uint64_t tenant_id,
+      ObMicroIndexInfo &index_block_info,
+      ObMicroBlockDataHandle &micro_handle,
+      const bool is_data);
+  int set_block_io_handle(
+      const uint64_t tenant_id,
+      ObMicroIndexInfo &index_block_info,
+      ObMacroBlockHandle &macro_handle,
+      const bool is_data,
+      ObMicroBlockDataHandle &micro_handle);
   int lookup_in_cache(ObSSTableReadHandle &read_handle);
 private:
   int lookup_in_index_tree(ObSSTableReadHandle &read_handle);
@@ -248,7 +259,10 @@ public:
       prefetched_rowkey_cnt_(0),
       max_handle_prefetching_cnt_(0),
       rowkeys_(nullptr),
-      ext_read_handles_()
+      ext_read_handles_(),
+      pending_io_infos_(),
+      pending_io_handles_(),
+      pending_io_info_idxs_()
   {}
   virtual ~ObIndexTreeMultiPrefetcher() { reset(); }
   virtual void reset() override;
@@ -289,6 +303,25 @@ public:
   int32_t max_handle_prefetching_cnt_;
   const common::ObIArray<blocksstable::ObDatumRowkey> *rowkeys_;
   ReadHandleExtArray ext_read_handles_;
+protected:
+  // data block ios of one multi_prefetch are submitted in batch, so that nearby micro blocks
+  // of different rowkeys are read by one io
+  virtual int submit_block_io(
+      const uint64_t tenant_id,
+      ObMicroIndexInfo &index_block_info,
+      ObMicroBlockDataHandle &micro_handle,
+      const bool is_data) override;
+  int submit_pending_block_io();
+  void reset_pending_block_io(const bool reset_handles);
+  int64_t find_pending_block_io(const ObMicroIndexInfo &index_block_info) const;
+  // prepare read handles of rowkeys [begin, end) and look up them in row cache in a batch
+  int batch_lookup_in_cache(const int64_t begin, const int64_t end);
+  common::ObSEArray<ObMicroIndexInfo, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT> pending_io_infos_;
+  common::ObSEArray<ObMicroBlockDataHandle *, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT> pending_io_handles_;
+  // idx in pending_io_infos_ of each pending handle, handles of the same micro block share one io
+  common::ObSEArray<int64_t, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT> pending_io_info_idxs_;
+  // row headers of pending_io_infos_, index block data may be released before submit
+  ObIndexBlockRowHeader pending_io_headers_[MAX_MULTIGET_MICRO_DATA_HANDLE_CNT];
 private:
   int drill_down(
       const MacroBlockId &macro_id,
@@ -354,6 +387,15 @@ public:
     return 0 == cur_level_ ? cur_range_prefetch_idx_ - 1 :
         tree_handles_[cur_level_].current_block_read_handle().index_info_.range_idx();
   }
+  // size of micro blocks prefetched but not fetched yet
+  OB_INLINE int64_t prefetching_micro_size() const
+  {
+    int64_t size = 0;
+    for (int64_t i = cur_micro_data_fetch_idx_ + 1; i < micro_data_prefetch_idx_; ++i) {
+      size += micro_data_handles_[i % max_micro_handle_cnt_].micro_info_.size_;
+    }
+    return size;
+  }
   OB_INLINE bool read_wait()
   {
     return !is_prefetch_end_ &&
@@ -367,6 +409,8 @@ public:
   int check_row_lock(
       const blocksstable::ObMicroIndexInfo &index_info,
       bool &is_prefetch_end);
+  // skip the block when no row in it could pass the pushdown filter
+  bool can_skip_by_skip_index(const blocksstable::ObMicroIndexInfo &index_info);
   INHERIT_TO_STRING_KV("ObIndexTreeMultiPassPrefetcher", ObIndexTreePrefetcher,
                        K_(is_prefetch_end), K_(cur_range_fetch_idx), K_(cur_range_prefetch_idx), K_(max_range_prefetching_cnt),
                        K_(cur_micro_data_fetch_idx), K_(micro_data_prefetch_idx), K_(max_micro_handle_cnt),
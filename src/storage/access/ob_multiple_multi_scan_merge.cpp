@@ -192,6 +192,9 @@ int ObMultipleMultiScanMerge::construct_iters()
         STORAGE_LOG(DEBUG, "add iter for consumer", KPC(table), KPC(access_param_));
       }
     }
+    if (OB_SUCC(ret)) {
+      init_read_ahead();
+    }
   }
 
   return ret;
@@ -16,6 +16,7 @@
 #include "ob_block_row_store.h"
 #include "storage/ob_row_fuse.h"
 #include "ob_aggregated_store.h"
+#include "observer/ob_server_struct.h"
 
 namespace oceanbase
 {
@@ -32,6 +33,10 @@ ObMultipleScanMerge::ObMultipleScanMerge()
     rows_merger_(nullptr),
     iter_del_row_(false),
     consumer_cnt_(0),
+    read_ahead_size_(0),
+    read_ahead_row_cnt_(0),
+    read_ahead_batch_cnt_(0),
+    read_ahead_start_idx_(0),
     range_(NULL),
     cow_range_()
 {
@@ -92,6 +97,8 @@ int ObMultipleScanMerge::inner_get_next_rows()
   } else if (OB_ISNULL(iter = iters_.at(consumers_[0]))) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(WARN, "Unexpected null iter", K(ret), K(consumers_[0]));
+  } else if (OB_FAIL(read_ahead(READ_AHEAD_BATCH_INTERVAL, read_ahead_batch_cnt_))) {
+    STORAGE_LOG(WARN, "Failed to read ahead", K(ret));
   } else if (OB_FAIL(iter->get_next_rows())) {
     if (OB_UNLIKELY(OB_ITER_END != ret && OB_PUSHDOWN_STATUS_CHANGED != ret)) {
       STORAGE_LOG(WARN, "Failed to get next row from iterator", K(ret));
@@ -194,6 +201,68 @@ int ObMultipleScanMerge::construct_iters()
         STORAGE_LOG(TRACE, "add iter for consumer", KPC(table), KPC(access_param_));
       }
     }
+    if (OB_SUCC(ret)) {
+      init_read_ahead();
+    }
+  }
+  return ret;
+}
+
+// Rows of sstables are merged in key order, an sstable whose next row is far from
+// the merge frontier is not consumed and its prefetcher stays idle, then the scan waits
+// for its io once the frontier arrives. Let all sstables prefetch while the size of
+// micro blocks in flight is within the io budget. Memtables need no io.
+void ObMultipleScanMerge::init_read_ahead()
+{
+  int64_t sstable_cnt = 0;
+  const int64_t read_ahead_size = GCONF._scan_merge_read_ahead_size;
+  for (int64_t i = 0; i < iters_.count(); ++i) {
+    if (nullptr != iters_.at(i) && iters_.at(i)->is_sstable_iter()) {
+      ++sstable_cnt;
+    }
+  }
+  read_ahead_row_cnt_ = 0;
+  read_ahead_batch_cnt_ = 0;
+  read_ahead_start_idx_ = 0;
+  if (sstable_cnt < 2 || read_ahead_size <= 0 || access_ctx_->query_flag_.is_daily_merge()) {
+    read_ahead_size_ = 0;
+  } else {
+    read_ahead_size_ = read_ahead_size;
+  }
+}
+
+// row path and batch path count their calls separately, read ahead every @interval calls
+int ObMultipleScanMerge::read_ahead(const int64_t interval, int64_t &call_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (0 == read_ahead_size_) {
+  } else if (0 != (call_cnt++ % interval)) {
+  } else {
+    const int64_t iter_cnt = iters_.count();
+    int64_t inflight_size = 0;
+    for (int64_t i = 0; i < iter_cnt; ++i) {
+      ObStoreRowIterator *iter = iters_.at(i);
+      if (nullptr != iter && iter->is_sstable_iter()) {
+        inflight_size += iter->get_prefetching_size();
+      }
+    }
+    // one round of prefetch of an sstable is bounded, check the budget before each of them
+    for (int64_t i = 0; OB_SUCC(ret) && i < iter_cnt && inflight_size < read_ahead_size_; ++i) {
+      const int64_t iter_idx = (read_ahead_start_idx_ + i) % iter_cnt;
+      ObStoreRowIterator *iter = iters_.at(iter_idx);
+      if (nullptr == iter || !iter->is_sstable_iter()) {
+      } else {
+        const int64_t prefetching_size = iter->get_prefetching_size();
+        if (OB_FAIL(iter->prefetch_ahead())) {
+          STORAGE_LOG(WARN, "Failed to read ahead", K(ret), K(iter_idx), K(inflight_size), K_(read_ahead_size));
+        } else {
+          inflight_size += iter->get_prefetching_size() - prefetching_size;
+        }
+      }
+    }
+    if (iter_cnt > 0) {
+      read_ahead_start_idx_ = (read_ahead_start_idx_ + 1) % iter_cnt;
+    }
   }
   return ret;
 }
@@ -216,6 +285,10 @@ void ObMultipleScanMerge::reset()
   tree_cmp_.reset();
   iter_del_row_ = false;
   consumer_cnt_ = 0;
+  read_ahead_size_ = 0;
+  read_ahead_row_cnt_ = 0;
+  read_ahead_batch_cnt_ = 0;
+  read_ahead_start_idx_ = 0;
   range_ = NULL;
   cow_range_.reset();
   ObMultipleMerge::reset();
@@ -226,6 +299,10 @@ void ObMultipleScanMerge::reuse()
   ObMultipleMerge::reuse();
   iter_del_row_ = false;
   consumer_cnt_ = 0;
+  read_ahead_size_ = 0;
+  read_ahead_row_cnt_ = 0;
+  read_ahead_batch_cnt_ = 0;
+  read_ahead_start_idx_ = 0;
 }
 
 int ObMultipleScanMerge::supply_consume()
@@ -294,6 +371,10 @@ int ObMultipleScanMerge::inner_get_next_row(ObDatumRow &row)
     while (OB_SUCC(ret)) {
       STORAGE_LOG(DEBUG, "[PUSHDOWN] check condition of blockscan",
                   K(access_param_->iter_param_.pd_storage_flag_), K(consumer_cnt_));
+      if (OB_FAIL(read_ahead(READ_AHEAD_ROW_INTERVAL, read_ahead_row_cnt_))) {
+        STORAGE_LOG(WARN, "Failed to read ahead", K(ret));
+        break;
+      }
 
       final_result = false;
       need_supply_consume = true;
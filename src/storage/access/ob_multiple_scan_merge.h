@@ -52,8 +52,15 @@ protected:
   virtual int supply_consume();
   virtual int inner_merge_row(blocksstable::ObDatumRow &row);
   int set_rows_merger(const int64_t table_cnt);
+  void init_read_ahead();
+  int read_ahead(const int64_t interval, int64_t &call_cnt);
 private:
   int prepare_blockscan(ObStoreRowIterator &iter);
+  // rows returned by row path between two rounds of read ahead
+  static const int64_t READ_AHEAD_ROW_INTERVAL = 64;
+  // batches returned by batch path between two rounds of read ahead, a batch is at most
+  // one micro block of the consumer
+  static const int64_t READ_AHEAD_BATCH_INTERVAL = 4;
 protected:
   ObScanMergeLoserTreeCmp tree_cmp_;
   ObScanSimpleMerger *simple_merge_;
@@ -62,6 +69,12 @@ protected:
   bool iter_del_row_;
   int64_t consumers_[common::MAX_TABLE_CNT_IN_STORAGE];
   int64_t consumer_cnt_;
+  // max size of micro blocks in flight of all sstables, 0 means read ahead is disabled
+  int64_t read_ahead_size_;
+  int64_t read_ahead_row_cnt_;
+  int64_t read_ahead_batch_cnt_;
+  // sstable iter to read ahead first, rotated so that the budget is not taken by the first ones
+  int64_t read_ahead_start_idx_;
 private:
   const blocksstable::ObDatumRange *range_;
   blocksstable::ObDatumRange cow_range_;
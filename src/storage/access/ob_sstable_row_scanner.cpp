@@ -324,6 +324,17 @@ int ObSSTableRowScanner<PrefetchType>::refresh_blockscan_checker(const blockssta
   return ret;
 }
 
+template<typename PrefetchType>
+int ObSSTableRowScanner<PrefetchType>::prefetch_ahead()
+{
+  int ret = OB_SUCCESS;
+  if (!is_opened_ || prefetcher_.is_prefetch_end_) {
+  } else if (OB_FAIL(prefetcher_.prefetch())) {
+    LOG_WARN("Fail to prefetch micro block ahead", K(ret), K_(prefetcher));
+  }
+  return ret;
+}
+
 template<typename PrefetchType>
 bool ObSSTableRowScanner<PrefetchType>::can_vectorize() const
 {
@@ -39,6 +39,9 @@ public:
   virtual ~ObSSTableRowScanner();
   virtual void reset();
   virtual void reuse();
+  virtual int prefetch_ahead() override;
+  virtual int64_t get_prefetching_size() const override
+  { return is_opened_ ? prefetcher_.prefetching_micro_size() : 0; }
   TO_STRING_KV(K_(is_opened), K_(cur_range_idx), K_(prefetcher));
 protected:
   int inner_open(
@@ -99,6 +99,10 @@ public:
     UNUSED(read_handle);
     return OB_NOT_IMPLEMENT;
   }
+  // issue async io of following micro blocks before rows are fetched
+  virtual int prefetch_ahead() { return OB_SUCCESS; }
+  // size of micro blocks prefetched but not fetched yet
+  virtual int64_t get_prefetching_size() const { return 0; }
 
   VIRTUAL_TO_STRING_KV(K_(type), K_(is_sstable_iter), KP_(block_row_store));
 
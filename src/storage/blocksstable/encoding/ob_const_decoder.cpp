@@ -271,6 +271,47 @@ int ObConstDecoder::get_null_count(
   return ret;
 }
 
+int ObConstDecoder::get_int_sum(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    ObEncodingIntSum &sum) const
+{
+  UNUSED(row_index);
+  int ret = OB_SUCCESS;
+  int64_t unused_null_cnt = 0;
+  const ObObjTypeStoreClass store_class =
+      get_store_class_map()[ob_obj_type_class(ctx.obj_meta_.get_type())];
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (ObIntSC != store_class && ObUIntSC != store_class) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (0 == meta_header_->count_) {
+    ObObj const_obj;
+    if (2 == meta_header_->const_ref_) {
+      // all nop, need to be filled with default value
+      ret = OB_NOT_SUPPORTED;
+    } else if (0 != meta_header_->const_ref_) {
+      // all null
+    } else if (OB_FAIL(decode_without_dict(ctx, const_obj))) {
+      LOG_WARN("Failed to decode const value", K(ret), K(ctx));
+    } else {
+      sum.add(const_obj.v_.uint64_, row_cap);
+    }
+  } else if (OB_FAIL(extract_ref_and_null_count(row_ids, row_cap, datums, unused_null_cnt))) {
+    LOG_WARN("Failed to extract refs", K(ret));
+  } else if (OB_FAIL(dict_decoder_.batch_sum_refs(
+      ctx, ctx.col_header_->length_ - meta_header_->offset_, row_cap, datums, sum))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("Failed to sum const refs from dict", K(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
 int ObConstDecoder::pushdown_operator(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
@@ -328,6 +369,14 @@ int ObConstDecoder::pushdown_operator(
         }
         break;
       }
+      case sql::WHITE_OP_LI: {
+        if (OB_FAIL(like_operator(col_ctx, filter, result_bitmap))) {
+          if (OB_UNLIKELY(OB_NOT_SUPPORTED != ret)) {
+            LOG_WARN("Failed on running LIKE pushed down operator", K(ret), K(col_ctx), K(filter));
+          }
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Pushed down filter operator type not supported", K(ret), K(filter));
@@ -433,6 +482,23 @@ int ObConstDecoder::const_only_operator(
             }
             break;
           }
+          case sql::WHITE_OP_LI: {
+            bool matched = false;
+            if (OB_UNLIKELY(filter.null_param_contained() || !filter.get_like_matcher().is_inited())) {
+              ret = OB_INVALID_ARGUMENT;
+              LOG_WARN("Invalid argument", K(ret), K(filter));
+            } else if (!is_like_supported(col_ctx)) {
+              ret = OB_NOT_SUPPORTED;
+            } else if (ref == 1) {
+            } else if (OB_FAIL(filter.get_like_matcher().match(const_obj.get_string(), matched))) {
+              LOG_WARN("Failed to match like pattern", K(ret), K(const_obj));
+            } else if (matched) {
+              if (OB_FAIL(result_bitmap.bit_not())) {
+                LOG_WARN("Failed to do bitwise not on result bitmap", K(ret));
+              }
+            }
+            break;
+          }
           default: {
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("Pushed down filter operator type not supported", K(ret));
@@ -736,6 +802,84 @@ int ObConstDecoder::in_operator(
   return ret;
 }
 
+int ObConstDecoder::like_operator(
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterLikeMatcher &matcher = filter.get_like_matcher();
+  if (OB_UNLIKELY(result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+                  || filter.get_op_type() != sql::WHITE_OP_LI
+                  || filter.null_param_contained()
+                  || !matcher.is_inited())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator", K(ret), K(result_bitmap.size()), K(filter));
+  } else if (!is_like_supported(col_ctx)) {
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    const int64_t dict_count = dict_decoder_.get_dict_header()->count_;
+    const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
+    const int64_t dict_meta_length = col_ctx.col_header_->length_ - meta_header_->offset_;
+    bool const_in_result_set = false;
+
+    if (meta_header_->const_ref_ == dict_count) {
+    } else {
+      ObDictDecoderIterator dict_iter = dict_decoder_.begin(&col_ctx, dict_meta_length);
+      ObObj& const_obj = *(dict_iter + meta_header_->const_ref_);
+      if (OB_FAIL(matcher.match(const_obj.get_string(), const_in_result_set))) {
+        LOG_WARN("Failed to match like pattern", K(ret), K(const_obj));
+      } else if (const_in_result_set && OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to flip all bits in result bitmap", K(ret));
+      }
+    }
+
+    if (OB_SUCC(ret)) {
+      // Match the pattern once per exception value
+      bool found = false;
+      bool matched = false;
+      ObDictDecoderIterator trav_it = dict_decoder_.begin(&col_ctx, dict_meta_length);
+      ObDictDecoderIterator end_it = dict_decoder_.end(&col_ctx, dict_meta_length);
+      const int64_t ref_bitset_size = dict_count + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      int64_t dict_ref = 0;
+      while (OB_SUCC(ret) && trav_it != end_it) {
+        if (OB_FAIL(matcher.match((*trav_it).get_string(), matched))) {
+          LOG_WARN("Failed to match like pattern", K(ret), K(*trav_it));
+        } else if (!const_in_result_set == matched) {
+          found = true;
+          ref_bitset->set(dict_ref);
+        }
+        ++dict_ref;
+        ++trav_it;
+      }
+
+      if (OB_FAIL(ret)) {
+      } else if (found && OB_FAIL(set_res_with_bitset(
+                  row_ids,
+                  ref_bitset,
+                  !const_in_result_set,
+                  result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret));
+      } else if (const_in_result_set) {
+        if (OB_FAIL(traverse_refs_and_set_res(row_ids, dict_count, false, result_bitmap))) {
+          LOG_WARN("Failed to clean bitmap for null rows", K(ret));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+// char column need padding before matching
+bool ObConstDecoder::is_like_supported(const ObColumnDecoderCtx &col_ctx) const
+{
+  return ObStringSC == get_store_class_map()[ob_obj_type_class(col_ctx.obj_meta_.get_type())]
+      && !col_ctx.obj_meta_.is_fixed_len_char_type();
+}
+
 int ObConstDecoder::traverse_refs_and_set_res(
     const ObIntArrayFuncTable &row_ids,
     const int64_t dict_ref,
@@ -64,6 +64,14 @@ public:
       const int64_t row_cap,
       int64_t &null_count) const override;
 
+  virtual int get_int_sum(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      ObEncodingIntSum &sum) const override;
+
   virtual int pushdown_operator(
       const sql::ObPushdownFilterExecutor *parent,
       const ObColumnDecoderCtx &col_ctx,
@@ -104,6 +112,13 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  int like_operator(
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
+  bool is_like_supported(const ObColumnDecoderCtx &col_ctx) const;
+
   int traverse_refs_and_set_res(
       const ObIntArrayFuncTable &row_ids,
       const int64_t dict_ref,
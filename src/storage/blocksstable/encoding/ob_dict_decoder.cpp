@@ -467,6 +467,88 @@ int ObDictDecoder::batch_decode(
   return ret;
 }
 
+int ObDictDecoder::get_int_sum(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    ObEncodingIntSum &sum) const
+{
+  UNUSED(row_index);
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (ObIntSC != store_class_ && ObUIntSC != store_class_) {
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    const unsigned char *col_data = reinterpret_cast<unsigned char *>(
+        const_cast<ObDictMetaHeader *>(meta_header_)) + ctx.col_header_->length_;
+    const uint8_t row_ref_size = meta_header_->row_ref_size_;
+    if (ctx.is_bit_packing()) {
+      if (OB_FAIL(batch_get_bitpacked_refs(row_ids, row_cap, col_data, datums))) {
+        LOG_WARN("Failed to batch unpack bitpacked value", K(ret));
+      }
+    } else {
+      for (int64_t i = 0; i < row_cap; ++i) {
+        datums[i].pack_ = 0;
+        MEMCPY(&datums[i].pack_, col_data + row_ids[i] * row_ref_size, row_ref_size);
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(batch_sum_refs(ctx, ctx.col_header_->length_, row_cap, datums, sum))) {
+      LOG_WARN("Failed to sum dict references", K(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+int ObDictDecoder::batch_sum_refs(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t meta_length,
+    const int64_t row_cap,
+    const common::ObDatum *datums,
+    ObEncodingIntSum &sum) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t count = meta_header_->count_;
+  int64_t *ref_cnts = nullptr;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (ObIntSC != store_class_ && ObUIntSC != store_class_) {
+    ret = OB_NOT_SUPPORTED;
+  } else if (0 == count) {
+    // all null
+  } else if (OB_ISNULL(ref_cnts = static_cast<int64_t *>(
+      ctx.allocator_->alloc(sizeof(int64_t) * count)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc memory for reference count", K(ret), K(count));
+  } else {
+    MEMSET(ref_cnts, 0, sizeof(int64_t) * count);
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      const uint32_t ref = datums[i].pack_;
+      if (ref < count) {
+        ++ref_cnts[ref];
+      } else if (ref > count) {
+        // nop value need to be filled with default value
+        ret = OB_NOT_SUPPORTED;
+      }
+    }
+    ObObj cell;
+    for (int64_t ref = 0; OB_SUCC(ret) && ref < count && !sum.overflow_; ++ref) {
+      if (0 == ref_cnts[ref]) {
+      } else if (OB_FAIL(decode(ctx.obj_meta_, cell, ref, meta_length))) {
+        LOG_WARN("Failed to decode dict value", K(ret), K(ref), K(meta_length));
+      } else {
+        sum.add(cell.v_.uint64_, ref_cnts[ref]);
+      }
+    }
+  }
+  return ret;
+}
+
 // Internal call, not check parameters for performance
 // datums[i].len_ should stand for the reference to dictionary as input parameter
 int ObDictDecoder::batch_decode_dict(
@@ -681,6 +763,14 @@ int ObDictDecoder::pushdown_operator(
       }
       break;
     }
+    case sql::WHITE_OP_LI: {
+      if (OB_FAIL(like_operator(parent, col_ctx, col_data, filter, result_bitmap))) {
+        if (OB_UNLIKELY(OB_NOT_SUPPORTED != ret)) {
+          LOG_WARN("Failed to run LIKE operator", K(ret), K(col_ctx));
+        }
+      }
+      break;
+    }
     default: {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("Unexpected filter pushdown operation type", K(ret), K(op_type));
@@ -1026,6 +1116,57 @@ int ObDictDecoder::in_operator(
   return ret;
 }
 
+// Match the pattern once per dictionary entry, then set result by references
+int ObDictDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterLikeMatcher &matcher = filter.get_like_matcher();
+  if (OB_UNLIKELY(result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+                  || filter.get_op_type() != sql::WHITE_OP_LI
+                  || filter.null_param_contained()
+                  || !matcher.is_inited())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator", K(ret),
+             K(col_data), K(result_bitmap.size()), K(filter));
+  } else if (ObStringSC != store_class_ || col_ctx.obj_meta_.is_fixed_len_char_type()) {
+    // char column need padding before matching
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    const int64_t count = meta_header_->count_;
+    if (count > 0) {
+      bool found = false;
+      ObDictDecoderIterator traverse_it = begin(&col_ctx, col_ctx.col_header_->length_);
+      ObDictDecoderIterator end_it = end(&col_ctx, col_ctx.col_header_->length_);
+      const int64_t ref_bitset_size = meta_header_->count_ + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      int64_t dict_ref = 0;
+      bool matched = false;
+      while (OB_SUCC(ret) && traverse_it != end_it) {
+        if (OB_FAIL(matcher.match((*traverse_it).get_string(), matched))) {
+          LOG_WARN("Failed to match like pattern", K(ret), K(*traverse_it));
+        } else if (matched) {
+          found = true;
+          ref_bitset->set(dict_ref);
+        }
+        ++traverse_it;
+        ++dict_ref;
+      }
+      if (OB_SUCC(ret) && found
+          && OB_FAIL(set_res_with_bitset(parent, col_ctx, col_data, ref_bitset, result_bitmap))) {
+        LOG_WARN("Failed to set result bitmap", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDictDecoder::load_data_to_obj_cell(
     const ObObjMeta cell_meta,
     const char *cell_data,
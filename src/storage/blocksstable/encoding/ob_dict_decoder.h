@@ -83,6 +83,14 @@ public:
       const int64_t row_cap,
       int64_t &null_count) const override;
 
+  virtual int get_int_sum(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      ObEncodingIntSum &sum) const override;
+
   virtual int update_pointer(const char *old_block, const char *cur_block) override;
 
   int decode(common::ObObjMeta cell_meta, common::ObObj &cell, const int64_t ref, const int64_t meta_legnth) const;
@@ -94,6 +102,15 @@ public:
       const int64_t meta_length,
       common::ObDatum *datums) const;
 
+  // Sum integer dictionary values by references stored in datums.pack_,
+  // every distinct value is decoded once and multiplied by its occurrence.
+  int batch_sum_refs(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t meta_length,
+      const int64_t row_cap,
+      const common::ObDatum *datums,
+      ObEncodingIntSum &sum) const;
+
   void reset() { this->~ObDictDecoder(); new (this) ObDictDecoder(); }
   OB_INLINE void reuse();
   virtual ObColumnHeader::Type get_type() const override { return type_; }
@@ -163,6 +180,13 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  int like_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* col_data,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   int load_data_to_obj_cell(const ObObjMeta cell_meta, const char *cell_data, int64_t cell_len, ObObj &load_obj) const;
 
   int cmp_ref_and_set_res(
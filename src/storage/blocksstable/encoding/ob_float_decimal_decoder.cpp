@@ -0,0 +1,358 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_float_decimal_decoder.h"
+
+#include "storage/blocksstable/ob_block_sstable_struct.h"
+#include "ob_encoding_query_util.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace common;
+
+static void float_decimal_restore_scalar(
+    const int64_t base, const double divisor, const int64_t count, uint64_t *values)
+{
+  for (int64_t i = 0; i < count; ++i) {
+    const double v = static_cast<double>(base + static_cast<int64_t>(values[i])) / divisor;
+    MEMCPY(&values[i], &v, sizeof(double));
+  }
+}
+
+float_decimal_restore_func float_decimal_restore = &float_decimal_restore_scalar;
+
+bool init_float_decimal_restore_simd_func();
+
+bool init_float_decimal_restore_func()
+{
+  bool res = true;
+  // Dispatch simd version restore
+#if defined ( __x86_64__ )
+  if (is_avx2_valid()) {
+    res = init_float_decimal_restore_simd_func();
+  }
+#endif
+  return res;
+}
+
+bool float_decimal_restore_func_inited = init_float_decimal_restore_func();
+
+const ObColumnHeader::Type ObFloatDecimalDecoder::type_;
+
+int ObFloatDecimalDecoder::restore_rows(
+    const ObColumnDecoderCtx &ctx,
+    const unsigned char *col_data,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    uint64_t *values) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t cell_len = header_->length_;
+  int64_t data_offset = 0;
+  if (ctx.has_extend_value()) {
+    data_offset = ctx.micro_block_header_->row_count_ * ctx.micro_block_header_->extend_value_bit_;
+  }
+  if (0 == cell_len) {
+    MEMSET(values, 0, sizeof(uint64_t) * row_cap);
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      if (OB_FAIL(ObBitStream::get(col_data, data_offset + row_ids[i] * cell_len,
+          cell_len, values[i]))) {
+        LOG_WARN("get bit packing value failed", K(ret), K_(header), K(row_ids[i]));
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    float_decimal_restore(header_->base_, ObFloatDecimalHeader::get_divisor(header_->exponent_),
+        row_cap, values);
+  }
+  return ret;
+}
+
+int ObFloatDecimalDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
+    const ObBitStream &bs, const char *data, const int64_t len) const
+{
+  UNUSED(bs);
+  int ret = OB_SUCCESS;
+  uint64_t val = STORED_NOT_EXT;
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_) + ctx.col_header_->length_;
+
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(NULL == data || len < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(data), K(len));
+  } else if (ctx.has_extend_value()) {
+    if (OB_FAIL(ObBitStream::get(col_data, row_id * ctx.micro_block_header_->extend_value_bit_,
+        ctx.micro_block_header_->extend_value_bit_, val))) {
+      LOG_WARN("get extend value failed", K(ret), K(bs), K(ctx));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (STORED_NOT_EXT != val) {
+    set_stored_ext_value(cell, static_cast<ObStoredExtValue>(val));
+  } else {
+    if (cell.get_meta() != ctx.obj_meta_) {
+      cell.set_meta_type(ctx.obj_meta_);
+    }
+    const int64_t exception_idx = find_exception(row_id);
+    uint64_t value = 0;
+    if (exception_idx >= 0) {
+      set_obj_value(header_->get_exception_values()[exception_idx], cell);
+    } else if (OB_FAIL(restore_rows(ctx, col_data, &row_id, 1, &value))) {
+      LOG_WARN("restore row failed", K(ret), K(row_id));
+    } else if (is_float_) {
+      double d = 0;
+      MEMCPY(&d, &value, sizeof(double));
+      cell.v_.float_ = static_cast<float>(d);
+    } else {
+      MEMCPY(&cell.v_.double_, &value, sizeof(double));
+    }
+  }
+  return ret;
+}
+
+int ObFloatDecimalDecoder::update_pointer(const char *old_block, const char *cur_block)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited()) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(old_block) || OB_ISNULL(cur_block)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(old_block), KP(cur_block));
+  } else {
+    ObIColumnDecoder::update_pointer(header_, old_block, cur_block);
+  }
+  return ret;
+}
+
+// Internal call, not check parameters for performance
+// Packed values are restored to double by RESTORE_BATCH_SIZE rows with simd, exceptions
+// are patched after.
+int ObFloatDecimalDecoder::batch_decode(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex* row_index,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    common::ObDatum *datums) const
+{
+  UNUSEDx(row_index, cell_datas);
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+                                    + ctx.col_header_->length_;
+    const uint32_t datum_len = is_float_ ? sizeof(float) : sizeof(double);
+    const uint64_t *exception_values = header_->get_exception_values();
+    uint64_t values[RESTORE_BATCH_SIZE];
+    if (ctx.has_extend_value()
+        && OB_FAIL(set_null_datums_from_fixed_column(ctx, row_ids, row_cap, col_data, datums))) {
+      LOG_WARN("Failed to set null datums from fixed data", K(ret), K(ctx));
+    }
+    for (int64_t start = 0; OB_SUCC(ret) && start < row_cap; start += RESTORE_BATCH_SIZE) {
+      const int64_t batch_cnt = MIN(RESTORE_BATCH_SIZE, row_cap - start);
+      if (OB_FAIL(restore_rows(ctx, col_data, row_ids + start, batch_cnt, values))) {
+        LOG_WARN("Failed to restore rows", K(ret), K(start), K(batch_cnt));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < batch_cnt; ++i) {
+        ObDatum &datum = datums[start + i];
+        if (ctx.has_extend_value() && datum.is_null()) {
+          // Skip
+        } else {
+          const int64_t exception_idx = find_exception(row_ids[start + i]);
+          if (exception_idx >= 0) {
+            MEMCPY(const_cast<char *>(datum.ptr_), &exception_values[exception_idx], datum_len);
+          } else if (is_float_) {
+            double d = 0;
+            MEMCPY(&d, &values[i], sizeof(double));
+            const float f = static_cast<float>(d);
+            MEMCPY(const_cast<char *>(datum.ptr_), &f, datum_len);
+          } else {
+            MEMCPY(const_cast<char *>(datum.ptr_), &values[i], datum_len);
+          }
+          datum.pack_ = datum_len;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatDecimalDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSEDx(meta_data, row_index);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_) +
+      col_ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Float decimal decoder not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX
+                         || col_ctx.micro_block_header_->row_count_ != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushed down white filter",
+             K(ret), K(op_type), K(result_bitmap.size()));
+  } else if (OB_FAIL(get_is_null_bitmap_from_fixed_column(col_ctx, col_data, result_bitmap))) {
+    LOG_WARN("Failed to get is null bitmap", K(ret), K(col_ctx));
+  } else {
+    switch (op_type) {
+    case sql::WHITE_OP_NU: {
+      break;
+    }
+    case sql::WHITE_OP_NN: {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to flip bits for result bitmap",
+            K(ret), K(result_bitmap.size()));
+      }
+      break;
+    }
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE:
+    case sql::WHITE_OP_GT:
+    case sql::WHITE_OP_GE:
+    case sql::WHITE_OP_LT:
+    case sql::WHITE_OP_LE:
+    case sql::WHITE_OP_BT:
+    case sql::WHITE_OP_IN: {
+      if (OB_FAIL(comparison_operator(parent, col_ctx, col_data, filter, result_bitmap))) {
+        LOG_WARN("Failed on comparison operator", K(ret), K(col_ctx), K(op_type));
+      }
+      break;
+    }
+    default: {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Unexpected operation type", K(ret), K(op_type));
+    }
+    }
+  }
+  return ret;
+}
+
+// Restore rows by batch and compare with the same object comparison of retro path,
+// so fixed double precision and NaN follow the same semantics.
+int ObFloatDecimalDecoder::comparison_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char *col_data,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const common::ObIArray<ObObj> &objs = filter.get_objs();
+  if (OB_UNLIKELY(objs.count() == 0
+      || (sql::WHITE_OP_BT == op_type && 2 != objs.count())
+      || (sql::WHITE_OP_IN != op_type && sql::WHITE_OP_BT != op_type && 1 != objs.count()))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Filter pushdown operator: Invalid argument", K(ret), K(filter));
+  } else {
+    const int64_t row_count = col_ctx.micro_block_header_->row_count_;
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    const bool exist_parent_filter = nullptr != parent;
+    const uint64_t *exception_values = header_->get_exception_values();
+    const ObCmpOp cmp_op = sql::ObPushdownWhiteFilterNode::WHITE_OP_TO_CMP_OP[op_type];
+    int64_t row_ids[RESTORE_BATCH_SIZE];
+    uint64_t values[RESTORE_BATCH_SIZE];
+    ObObj cur_obj;
+    cur_obj.set_meta_type(col_ctx.obj_meta_);
+    for (int64_t start = 0; OB_SUCC(ret) && start < row_count; start += RESTORE_BATCH_SIZE) {
+      const int64_t batch_cnt = MIN(RESTORE_BATCH_SIZE, row_count - start);
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        row_ids[i] = start + i;
+      }
+      if (OB_FAIL(restore_rows(col_ctx, col_data, row_ids, batch_cnt, values))) {
+        LOG_WARN("Failed to restore rows", K(ret), K(start), K(batch_cnt));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < batch_cnt; ++i) {
+        const int64_t row_id = start + i;
+        if (exist_parent_filter && parent->can_skip_filter(row_id)) {
+        } else if (null_value_contained && result_bitmap.test(row_id)) {
+          if (OB_FAIL(result_bitmap.set(row_id, false))) {
+            LOG_WARN("Failed to set row with null object to false", K(ret));
+          }
+        } else {
+          const int64_t exception_idx = find_exception(row_id);
+          if (exception_idx >= 0) {
+            set_obj_value(exception_values[exception_idx], cur_obj);
+          } else {
+            double d = 0;
+            MEMCPY(&d, &values[i], sizeof(double));
+            if (is_float_) {
+              cur_obj.v_.float_ = static_cast<float>(d);
+            } else {
+              cur_obj.v_.double_ = d;
+            }
+          }
+          bool result = false;
+          if (sql::WHITE_OP_IN == op_type) {
+            if (OB_FAIL(filter.exist_in_obj_set(cur_obj, result))) {
+              LOG_WARN("Failed to check object in hashset", K(ret), K(cur_obj));
+            }
+          } else if (sql::WHITE_OP_BT == op_type) {
+            result = cur_obj >= objs.at(0) && cur_obj <= objs.at(1);
+          } else {
+            result = ObObjCmpFuncs::compare_oper_nullsafe(
+                cur_obj, objs.at(0), cur_obj.get_collation_type(), cmp_op);
+          }
+          if (OB_SUCC(ret) && result && OB_FAIL(result_bitmap.set(row_id))) {
+            LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatDecimalDecoder::get_null_count(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t &null_count) const
+{
+  int ret = OB_SUCCESS;
+  const char *col_data = reinterpret_cast<const char *>(header_) + ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Float decimal decoder is not inited", K(ret));
+  } else if (OB_FAIL(ObIColumnDecoder::get_null_count_from_extend_value(
+      ctx,
+      row_index,
+      row_ids,
+      row_cap,
+      col_data,
+      null_count))) {
+    LOG_WARN("Failed to get null count", K(ctx), K(ret));
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
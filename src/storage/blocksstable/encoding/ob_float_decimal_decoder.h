@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_DECODER_H_
+#define OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_DECODER_H_
+
+#include <algorithm>
+#include "ob_icolumn_decoder.h"
+#include "ob_encoding_util.h"
+#include "ob_float_decimal_encoder.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+struct ObColumnHeader;
+struct ObFloatDecimalHeader;
+
+// Restore packed values in place: values[i] = bits of (double)(base + values[i]) / divisor
+typedef void (*float_decimal_restore_func)(
+    const int64_t base,
+    const double divisor,
+    const int64_t count,
+    uint64_t *values);
+
+extern float_decimal_restore_func float_decimal_restore;
+extern bool float_decimal_restore_func_inited;
+
+class ObFloatDecimalDecoder : public ObIColumnDecoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::FLOAT_DECIMAL;
+  // rows restored by one call of float_decimal_restore in batch
+  static const int64_t RESTORE_BATCH_SIZE = 256;
+  ObFloatDecimalDecoder() : header_(NULL), is_float_(false)
+  {}
+  virtual ~ObFloatDecimalDecoder() {}
+
+  OB_INLINE int init(
+      const ObMicroBlockHeader &micro_block_header,
+      const ObColumnHeader &column_header,
+      const char *meta);
+
+  virtual int decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
+      const ObBitStream &bs, const char *data, const int64_t len) const override;
+
+  virtual int update_pointer(const char *old_block, const char *cur_block) override;
+
+  void reset() { this->~ObFloatDecimalDecoder(); new (this) ObFloatDecimalDecoder(); }
+  OB_INLINE void reuse();
+  virtual ObColumnHeader::Type get_type() const override { return type_; }
+  bool is_inited() const { return NULL != header_; }
+
+  virtual int batch_decode(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex* row_index,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      common::ObDatum *datums) const override;
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+
+  virtual int get_null_count(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      int64_t &null_count) const override;
+private:
+  // Restore double values of @row_ids into @values, null rows get undefined value.
+  int restore_rows(
+      const ObColumnDecoderCtx &ctx,
+      const unsigned char *col_data,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      uint64_t *values) const;
+
+  // Index of @row_id in exceptions, -1 if not exception
+  OB_INLINE int64_t find_exception(const int64_t row_id) const;
+
+  OB_INLINE void set_obj_value(const uint64_t bits, common::ObObj &cell) const;
+
+  int comparison_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char *col_data,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+private:
+  const ObFloatDecimalHeader *header_;
+  bool is_float_;
+};
+
+OB_INLINE int ObFloatDecimalDecoder::init(
+    const ObMicroBlockHeader &micro_block_header,
+    const ObColumnHeader &column_header,
+    const char *meta)
+{
+  UNUSED(micro_block_header);
+  int ret = common::OB_SUCCESS;
+  // performance critical, don't check params
+  if (is_inited()) {
+    ret = common::OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "init twice", K(ret));
+  } else {
+    const common::ObObjTypeClass tc = ob_obj_type_class(column_header.get_store_obj_type());
+    if (common::ObFloatTC != tc && common::ObDoubleTC != tc) {
+      ret = common::OB_INNER_STAT_ERROR;
+      STORAGE_LOG(WARN, "not supported type class", K(ret), K(column_header), K(tc));
+    } else {
+      meta += column_header.offset_;
+      header_ = reinterpret_cast<const ObFloatDecimalHeader *>(meta);
+      is_float_ = common::ObFloatTC == tc;
+    }
+  }
+  return ret;
+}
+
+OB_INLINE void ObFloatDecimalDecoder::reuse()
+{
+  header_ = NULL;
+}
+
+OB_INLINE int64_t ObFloatDecimalDecoder::find_exception(const int64_t row_id) const
+{
+  int64_t idx = -1;
+  if (header_->exception_cnt_ > 0) {
+    const uint32_t *row_ids = header_->get_exception_row_ids();
+    const uint32_t *end = row_ids + header_->exception_cnt_;
+    const uint32_t *pos = std::lower_bound(row_ids, end, static_cast<uint32_t>(row_id));
+    if (pos != end && *pos == row_id) {
+      idx = pos - row_ids;
+    }
+  }
+  return idx;
+}
+
+OB_INLINE void ObFloatDecimalDecoder::set_obj_value(const uint64_t bits, common::ObObj &cell) const
+{
+  if (is_float_) {
+    const uint32_t float_bits = static_cast<uint32_t>(bits);
+    MEMCPY(&cell.v_.float_, &float_bits, sizeof(float));
+  } else {
+    MEMCPY(&cell.v_.double_, &bits, sizeof(double));
+  }
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_DECODER_H_
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_encoding_query_util.h"
+#include "ob_float_decimal_decoder.h"
+
+namespace oceanbase {
+namespace blocksstable {
+
+#if defined ( __AVX2__ )
+// AVX2 has no int64 to double conversion, scaled values are less than 2^51 in absolute,
+// so adding them to mantissa of magic number 1.5 * 2^52 and subtracting the magic number
+// in double gives exact conversion.
+static void float_decimal_restore_avx2(
+    const int64_t base, const double divisor, const int64_t count, uint64_t *values)
+{
+  const __m256i base_vec = _mm256_set1_epi64x(base);
+  const __m256i magic_bits = _mm256_set1_epi64x(0x4338000000000000L);
+  const __m256d magic = _mm256_castsi256_pd(magic_bits);
+  const __m256d divisor_vec = _mm256_set1_pd(divisor);
+  int64_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+    x = _mm256_add_epi64(_mm256_add_epi64(x, base_vec), magic_bits);
+    __m256d d = _mm256_sub_pd(_mm256_castsi256_pd(x), magic);
+    d = _mm256_div_pd(d, divisor_vec);
+    _mm256_storeu_pd(reinterpret_cast<double *>(values + i), d);
+  }
+  for (; i < count; ++i) {
+    const double v = static_cast<double>(base + static_cast<int64_t>(values[i])) / divisor;
+    MEMCPY(&values[i], &v, sizeof(double));
+  }
+}
+#endif
+
+bool init_float_decimal_restore_simd_func()
+{
+#if defined ( __AVX2__ )
+  float_decimal_restore = &float_decimal_restore_avx2;
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // end of namespace blocksstable
+} // end of namespace oceanbase
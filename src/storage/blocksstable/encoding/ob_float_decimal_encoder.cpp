@@ -0,0 +1,239 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_float_decimal_encoder.h"
+
+#include "storage/blocksstable/ob_data_buffer.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+const ObColumnHeader::Type ObFloatDecimalEncoder::type_;
+
+ObFloatDecimalEncoder::ObFloatDecimalEncoder()
+  : is_float_(false), max_exponent_(0), exponent_(0), base_(0), exception_cnt_(0), header_(NULL)
+{
+}
+
+int ObFloatDecimalEncoder::init(
+    const ObColumnEncodingCtx &ctx,
+    const int64_t column_index,
+    const ObConstDatumRowArray &rows)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnEncoder::init(ctx, column_index, rows))) {
+    LOG_WARN("init base column encoder failed",
+        K(ret), K(ctx), K(column_index), "row count", rows.count());
+  } else {
+    const ObObjTypeClass tc = ob_obj_type_class(column_type_.get_type());
+    if (ObFloatTC != tc && ObDoubleTC != tc) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("not supported type for float decimal", K(ret), K(tc), K_(column_index));
+    } else {
+      is_float_ = ObFloatTC == tc;
+      max_exponent_ = is_float_
+          ? ObFloatDecimalHeader::MAX_FLOAT_EXPONENT : ObFloatDecimalHeader::MAX_DOUBLE_EXPONENT;
+      column_header_.type_ = type_;
+    }
+  }
+  return ret;
+}
+
+void ObFloatDecimalEncoder::reuse()
+{
+  ObIColumnEncoder::reuse();
+  is_float_ = false;
+  max_exponent_ = 0;
+  exponent_ = 0;
+  base_ = 0;
+  exception_cnt_ = 0;
+  header_ = NULL;
+  is_inited_ = false;
+}
+
+// Estimate bits of each exponent by evenly sampled not null values, the smallest
+// exponent with least estimated bits is chosen.
+int ObFloatDecimalEncoder::choose_exponent()
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_cnt = ctx_->col_datums_->count();
+  const int64_t step = MAX(1, row_cnt / SAMPLE_CNT);
+  const int64_t exception_bits = (sizeof(uint32_t) + sizeof(uint64_t)) * CHAR_BIT;
+  int64_t min_bits = INT64_MAX;
+  exponent_ = 0;
+  for (int64_t exp = 0; exp <= max_exponent_; ++exp) {
+    int64_t min = INT64_MAX;
+    int64_t max = INT64_MIN;
+    int64_t exception_cnt = 0;
+    int64_t sample_cnt = 0;
+    for (int64_t i = 0; i < row_cnt; i += step) {
+      const ObDatum &datum = ctx_->col_datums_->at(i);
+      int64_t scaled = 0;
+      if (datum.is_null() || datum.is_nop()) {
+      } else if (scale(datum, exp, scaled)) {
+        min = MIN(min, scaled);
+        max = MAX(max, scaled);
+        ++sample_cnt;
+      } else {
+        ++exception_cnt;
+      }
+    }
+    int64_t bits = exception_cnt * exception_bits;
+    if (sample_cnt > 0) {
+      const uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+      bits += (0 == range ? 0 : sizeof(range) * CHAR_BIT - __builtin_clzl(range))
+          * (sample_cnt + exception_cnt);
+    }
+    if (bits < min_bits) {
+      min_bits = bits;
+      exponent_ = exp;
+    }
+    if (0 == exception_cnt && sample_cnt > 0) {
+      // larger exponent only gets larger range
+      break;
+    }
+  }
+  return ret;
+}
+
+int ObFloatDecimalEncoder::traverse(bool &suitable)
+{
+  int ret = OB_SUCCESS;
+  suitable = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (!ctx_->encoding_ctx_->encoder_opt_.enable_bit_packing_) {
+    // scaled values are always bit packed
+  } else if (OB_FAIL(choose_exponent())) {
+    LOG_WARN("choose exponent failed", K(ret));
+  } else {
+    const int64_t row_cnt = ctx_->col_datums_->count();
+    int64_t min = INT64_MAX;
+    int64_t max = INT64_MIN;
+    exception_cnt_ = 0;
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      const ObDatum &datum = ctx_->col_datums_->at(i);
+      int64_t scaled = 0;
+      if (datum.is_null() || datum.is_nop()) {
+      } else if (scale(datum, exponent_, scaled)) {
+        min = MIN(min, scaled);
+        max = MAX(max, scaled);
+      } else {
+        ++exception_cnt_;
+      }
+    }
+    if (min > max) {
+      // all null or exception
+    } else if (exception_cnt_ > row_cnt / 4) {
+      // raw or dict is better for random values
+    } else {
+      const uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+      base_ = min;
+      suitable = true;
+      desc_.bit_packing_length_ = 0 == range ? 0 : sizeof(range) * CHAR_BIT - __builtin_clzl(range);
+      desc_.need_data_store_ = true;
+      desc_.has_null_ = ctx_->null_cnt_ > 0;
+      desc_.has_nope_ = ctx_->nope_cnt_ > 0;
+      desc_.need_extend_value_bit_store_ = desc_.has_null_ || desc_.has_nope_;
+      if (desc_.need_extend_value_bit_store_) {
+        column_header_.set_has_extend_value_attr();
+      }
+      if (desc_.bit_packing_length_ > 0) {
+        column_header_.set_bit_packing_attr();
+      }
+      column_header_.set_fix_lenght_attr();
+      LOG_DEBUG("float decimal", K_(column_index), K_(exponent), K_(base),
+          K_(exception_cnt), K_(desc));
+    }
+  }
+  return ret;
+}
+
+int ObFloatDecimalEncoder::store_meta(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    header_ = reinterpret_cast<ObFloatDecimalHeader *>(buf_writer.current());
+    if (OB_FAIL(buf_writer.advance_zero(ObFloatDecimalHeader::get_meta_size(exception_cnt_)))) {
+      LOG_WARN("advance meta store size failed", K(ret), K_(exception_cnt));
+    } else {
+      header_->version_ = ObFloatDecimalHeader::OB_FLOAT_DECIMAL_HEADER_V1;
+      header_->exponent_ = static_cast<uint8_t>(exponent_);
+      header_->length_ = static_cast<uint8_t>(desc_.bit_packing_length_);
+      header_->exception_cnt_ = static_cast<uint32_t>(exception_cnt_);
+      header_->base_ = base_;
+      uint32_t *row_ids = reinterpret_cast<uint32_t *>(header_->payload_);
+      uint64_t *values = reinterpret_cast<uint64_t *>(
+          header_->payload_ + exception_cnt_ * sizeof(uint32_t));
+      int64_t idx = 0;
+      for (int64_t row_id = 0; row_id < ctx_->col_datums_->count(); ++row_id) {
+        const ObDatum &datum = ctx_->col_datums_->at(row_id);
+        int64_t scaled = 0;
+        if (datum.is_null() || datum.is_nop() || scale(datum, exponent_, scaled)) {
+        } else {
+          uint64_t v = 0;
+          MEMCPY(&v, datum.ptr_, is_float_ ? sizeof(float) : sizeof(double));
+          row_ids[idx] = static_cast<uint32_t>(row_id);
+          values[idx] = v;
+          ++idx;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObFloatDecimalEncoder::calc_size() const
+{
+  int64_t size = INT64_MAX;
+  if (is_inited_) {
+    size = (rows_->count() * desc_.bit_packing_length_ + CHAR_BIT - 1) / CHAR_BIT
+        + ObFloatDecimalHeader::get_meta_size(exception_cnt_);
+  }
+  return size;
+}
+
+int ObFloatDecimalEncoder::store_fix_data(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(!is_valid_fix_encoder())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K_(desc));
+  } else {
+    ScaledGetter getter(*this);
+    EmptySetter setter;
+    if (OB_FAIL(fill_column_store(buf_writer, *ctx_->col_datums_, getter, setter))) {
+      LOG_WARN("fill column store failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
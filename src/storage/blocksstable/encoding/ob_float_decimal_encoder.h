@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_ENCODER_H_
+#define OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_ENCODER_H_
+
+#include <math.h>
+#include "ob_icolumn_encoder.h"
+#include "ob_encoding_util.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Meta of float decimal encoding:
+//   header | exception row ids (uint32_t) | exception values (uint64_t)
+// Float/double values with few decimal digits are scaled to integers by 10^exponent_:
+//   value = (double)(base_ + packed) / 10^exponent_
+// Fix data stores bit packed (scaled - base_) of each row. Values can not be restored
+// exactly by the formula (NaN, Inf, -0.0, too many digits) are exceptions, which store zero
+// in fix data and keep raw bits in meta, sorted by row id.
+struct ObFloatDecimalHeader
+{
+  static constexpr uint8_t OB_FLOAT_DECIMAL_HEADER_V1 = 0;
+  static constexpr int64_t MAX_DOUBLE_EXPONENT = 18;
+  static constexpr int64_t MAX_FLOAT_EXPONENT = 10;
+  // scaled value should be converted to double by magic number exactly
+  static constexpr int64_t MAX_ABS_SCALED = 1L << 51;
+  uint8_t version_;
+  uint8_t exponent_;
+  uint8_t length_;
+  uint32_t exception_cnt_;
+  int64_t base_;
+  char payload_[0];
+
+  ObFloatDecimalHeader()
+    : version_(OB_FLOAT_DECIMAL_HEADER_V1), exponent_(0), length_(0), exception_cnt_(0), base_(0)
+  {
+  }
+
+  OB_INLINE const uint32_t *get_exception_row_ids() const
+  {
+    return reinterpret_cast<const uint32_t *>(payload_);
+  }
+  OB_INLINE const uint64_t *get_exception_values() const
+  {
+    return reinterpret_cast<const uint64_t *>(payload_ + exception_cnt_ * sizeof(uint32_t));
+  }
+  OB_INLINE static int64_t get_meta_size(const int64_t exception_cnt)
+  {
+    return sizeof(ObFloatDecimalHeader) + exception_cnt * (sizeof(uint32_t) + sizeof(uint64_t));
+  }
+  OB_INLINE static double get_divisor(const int64_t exponent)
+  {
+    static const double POW10[] = {
+      1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+      1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+    };
+    return POW10[exponent];
+  }
+  // Same formula with decoder, exact for |scaled| < MAX_ABS_SCALED
+  OB_INLINE static double restore(const int64_t scaled, const int64_t exponent)
+  {
+    return static_cast<double>(scaled) / get_divisor(exponent);
+  }
+
+  TO_STRING_KV(K_(version), K_(exponent), K_(length), K_(exception_cnt), K_(base));
+} __attribute__((packed));
+
+class ObFloatDecimalEncoder : public ObIColumnEncoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::FLOAT_DECIMAL;
+  // values sampled to choose exponent
+  static const int64_t SAMPLE_CNT = 32;
+
+  ObFloatDecimalEncoder();
+  virtual ~ObFloatDecimalEncoder() {}
+
+  virtual int init(
+      const ObColumnEncodingCtx &ctx,
+      const int64_t column_index,
+      const ObConstDatumRowArray &rows) override;
+
+  virtual void reuse() override;
+  virtual int store_meta(ObBufferWriter &buf_writer) override;
+  virtual int store_data(
+      const int64_t row_id, ObBitStream &bs, char *buf, const int64_t len) override
+  {
+    UNUSEDx(row_id, bs, buf, len);
+    return common::OB_NOT_SUPPORTED;
+  }
+
+  virtual int traverse(bool &suitable) override;
+  virtual int64_t calc_size() const override;
+  virtual ObColumnHeader::Type get_type() const { return type_; }
+  virtual int store_fix_data(ObBufferWriter &buf_writer) override;
+
+  struct ScaledGetter
+  {
+    explicit ScaledGetter(const ObFloatDecimalEncoder &encoder) : encoder_(encoder) {}
+    inline int operator()(const int64_t, const common::ObDatum &datum, uint64_t &v)
+    {
+      int64_t scaled = 0;
+      if (encoder_.scale(datum, encoder_.exponent_, scaled)) {
+        v = static_cast<uint64_t>(scaled - encoder_.base_);
+      } else {
+        v = 0;
+      }
+      return common::OB_SUCCESS;
+    }
+
+    const ObFloatDecimalEncoder &encoder_;
+  };
+
+  struct EmptySetter
+  {
+    inline int operator()(
+        const int64_t,
+        const common::ObDatum &,
+        char *,
+        const int64_t) const
+    {
+      return common::OB_NOT_SUPPORTED;
+    }
+  };
+
+private:
+  // Scale @datum by 10^@exponent, return false if it can not be restored exactly
+  OB_INLINE bool scale(const common::ObDatum &datum, const int64_t exponent, int64_t &scaled) const
+  {
+    bool exact = false;
+    const double v = is_float_ ? static_cast<double>(datum.get_float()) : datum.get_double();
+    const double s = v * ObFloatDecimalHeader::get_divisor(exponent);
+    if (isfinite(s) && fabs(s) < static_cast<double>(ObFloatDecimalHeader::MAX_ABS_SCALED)) {
+      scaled = llround(s);
+      const double restored = ObFloatDecimalHeader::restore(scaled, exponent);
+      if (is_float_) {
+        const float f = static_cast<float>(restored);
+        exact = 0 == MEMCMP(&f, datum.ptr_, sizeof(float));
+      } else {
+        exact = 0 == MEMCMP(&restored, datum.ptr_, sizeof(double));
+      }
+    }
+    return exact;
+  }
+  int choose_exponent();
+
+private:
+  bool is_float_;
+  int64_t max_exponent_;
+  int64_t exponent_;
+  int64_t base_;
+  int64_t exception_cnt_;
+  // is null before write meta
+  ObFloatDecimalHeader *header_;
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_FLOAT_DECIMAL_ENCODER_H_
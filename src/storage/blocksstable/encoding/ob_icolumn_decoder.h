@@ -86,6 +86,62 @@ public:
   bool cache_attributes_[ObColumnHeader::MAX_ATTRIBUTE];
 };
 
+// Sum of integer column calculated on encoded data. Values are summed as int64_t
+// for signed column and uint64_t for unsigned column, caller should sum the decoded
+// values instead once overflowed.
+struct ObEncodingIntSum
+{
+public:
+  explicit ObEncodingIntSum(const bool is_unsigned)
+    : is_unsigned_(is_unsigned), overflow_(false), sum_(0), count_(0) {}
+  OB_INLINE void reset() { overflow_ = false; sum_ = 0; count_ = 0; }
+  // add @value of the column type @cnt times
+  OB_INLINE void add(const uint64_t value, const int64_t cnt)
+  {
+    count_ += cnt;
+    add_value(value, cnt);
+  }
+  // add non-negative @delta of values already counted, used by encodings
+  // storing difference to a base value
+  OB_INLINE void add_delta(const uint64_t delta)
+  {
+    if (!is_unsigned_ && delta > static_cast<uint64_t>(INT64_MAX)) {
+      overflow_ = true;
+    } else {
+      add_value(delta, 1);
+    }
+  }
+  OB_INLINE int64_t get_int() const { return static_cast<int64_t>(sum_); }
+  OB_INLINE uint64_t get_uint() const { return sum_; }
+  OB_INLINE int64_t get_count() const { return count_; }
+  TO_STRING_KV(K_(is_unsigned), K_(overflow), K_(sum), K_(count));
+
+private:
+  OB_INLINE void add_value(const uint64_t value, const int64_t cnt)
+  {
+    if (is_unsigned_) {
+      uint64_t product = 0;
+      overflow_ = overflow_
+          || __builtin_mul_overflow(value, static_cast<uint64_t>(cnt), &product)
+          || __builtin_add_overflow(sum_, product, &sum_);
+    } else {
+      int64_t product = 0;
+      int64_t sum = static_cast<int64_t>(sum_);
+      overflow_ = overflow_
+          || __builtin_mul_overflow(static_cast<int64_t>(value), cnt, &product)
+          || __builtin_add_overflow(sum, product, &sum);
+      sum_ = static_cast<uint64_t>(sum);
+    }
+  }
+
+public:
+  bool is_unsigned_;
+  bool overflow_;
+  uint64_t sum_;
+  // count of not null values
+  int64_t count_;
+};
+
 class ObIColumnDecoder
 {
 public:
@@ -138,6 +194,20 @@ public:
     return common::OB_NOT_SUPPORTED;
   }
 
+  // Sum not null values of integer column in @row_ids without decoding each row,
+  // @datums is only used as buffer for dictionary references.
+  virtual int get_int_sum(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      ObEncodingIntSum &sum) const
+  {
+    UNUSEDx(ctx, row_index, row_ids, row_cap, datums, sum);
+    return common::OB_NOT_SUPPORTED;
+  }
+
   OB_INLINE virtual int locate_row_data(
       const ObColumnDecoderCtx &col_ctx,
       const ObIRowIndex* row_index,
@@ -601,5 +601,68 @@ int ObIntegerBaseDiffDecoder::get_null_count(
   return ret;
 }
 
+// sum = base * not_null_count + sum(delta), deltas are summed without adding base
+int ObIntegerBaseDiffDecoder::get_int_sum(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    ObEncodingIntSum &sum) const
+{
+  UNUSEDx(row_index, datums);
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+                                    + ctx.col_header_->length_;
+    const bool has_ext_val = ctx.has_extend_value();
+    const int64_t ext_bit = ctx.micro_block_header_->extend_value_bit_;
+    int64_t data_offset = has_ext_val ? ctx.micro_block_header_->row_count_ * ext_bit : 0;
+    if (!ctx.is_bit_packing()) {
+      data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
+    }
+    int64_t not_null_cnt = 0;
+    uint64_t delta_sum = 0;
+    bool delta_overflow = false;
+    int64_t row_id = 0;
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      row_id = row_ids[i];
+      uint64_t val = STORED_NOT_EXT;
+      uint64_t v = 0;
+      if (has_ext_val && OB_FAIL(ObBitStream::get(col_data, row_id * ext_bit, ext_bit, val))) {
+        LOG_WARN("Failed to get extend value", K(ret), K(ctx), K(row_id));
+      } else if (STORED_NOPE == val) {
+        // nop value need to be filled with default value
+        ret = OB_NOT_SUPPORTED;
+      } else if (STORED_NOT_EXT != val) {
+        // null
+      } else if (ctx.is_bit_packing()) {
+        if (OB_FAIL(ObBitStream::get(col_data, data_offset + row_id * header_->length_,
+            header_->length_, v))) {
+          LOG_WARN("Failed to get bit packing value", K(ret), K_(header), K(row_id));
+        }
+      } else {
+        MEMCPY(&v, col_data + data_offset + row_id * header_->length_, header_->length_);
+      }
+      if (OB_SUCC(ret) && STORED_NOT_EXT == val) {
+        ++not_null_cnt;
+        delta_overflow = delta_overflow || __builtin_add_overflow(delta_sum, v, &delta_sum);
+      }
+    }
+    if (OB_SUCC(ret)) {
+      if (delta_overflow) {
+        sum.overflow_ = true;
+      } else if (not_null_cnt > 0) {
+        sum.add(base_, not_null_cnt);
+        sum.add_delta(delta_sum);
+      }
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
@@ -72,6 +72,14 @@ public:
       const int64_t *row_ids,
       const int64_t row_cap,
       int64_t &null_count) const override;
+
+  virtual int get_int_sum(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      ObEncodingIntSum &sum) const override;
 private:
   int batch_get_bitpacked_values(
       const ObColumnDecoderCtx &ctx,
@@ -0,0 +1,543 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_integer_delta_decoder.h"
+
+#include <limits>
+#include "storage/blocksstable/ob_block_sstable_struct.h"
+#include "ob_encoding_query_util.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace common;
+
+static void delta_prefix_sum_scalar(const uint64_t base, const int64_t count, uint64_t *values)
+{
+  uint64_t sum = base;
+  for (int64_t i = 0; i < count; ++i) {
+    sum += values[i];
+    values[i] = sum;
+  }
+}
+
+delta_prefix_sum_func delta_prefix_sum = &delta_prefix_sum_scalar;
+
+bool init_delta_prefix_sum_simd_func();
+
+bool init_delta_prefix_sum_func()
+{
+  bool res = true;
+  // Dispatch simd version prefix sum
+#if defined ( __x86_64__ )
+  if (is_avx2_valid()) {
+    res = init_delta_prefix_sum_simd_func();
+  }
+#endif
+  return res;
+}
+
+bool delta_prefix_sum_func_inited = init_delta_prefix_sum_func();
+
+const ObColumnHeader::Type ObIntegerDeltaDecoder::type_;
+
+int ObIntegerDeltaDecoder::decode_interval(
+    const ObColumnDecoderCtx &ctx,
+    const unsigned char *col_data,
+    const int64_t interval_idx,
+    const int64_t end_row,
+    uint64_t *values) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_row = interval_idx * ObIntegerDeltaHeader::CHECKPOINT_INTERVAL;
+  const int64_t count = end_row - start_row;
+  const int64_t cell_len = header_->length_;
+  const uint64_t min_delta = header_->min_delta_;
+  int64_t data_offset = 0;
+  if (ctx.has_extend_value()) {
+    data_offset = ctx.micro_block_header_->row_count_ * ctx.micro_block_header_->extend_value_bit_;
+  }
+  // unpack deltas
+  if (0 == cell_len) {
+    for (int64_t i = 0; i < count; ++i) {
+      values[i] = min_delta;
+    }
+  } else {
+    uint64_t v = 0;
+    int64_t pos = data_offset + start_row * cell_len;
+    for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+      if (OB_FAIL(ObBitStream::get(col_data, pos, cell_len, v))) {
+        LOG_WARN("get bit packing value failed", K(ret), K_(header), K(i));
+      } else {
+        values[i] = v + min_delta;
+        pos += cell_len;
+      }
+    }
+  }
+  // null rows do not move running value
+  if (OB_SUCC(ret) && ctx.has_extend_value()) {
+    const int64_t ext_bit = ctx.micro_block_header_->extend_value_bit_;
+    uint64_t val = STORED_NOT_EXT;
+    for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+      if (OB_FAIL(ObBitStream::get(col_data, (start_row + i) * ext_bit, ext_bit, val))) {
+        LOG_WARN("get extend value failed", K(ret), K(ctx), K(i));
+      } else if (STORED_NOT_EXT != val) {
+        values[i] = 0;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    delta_prefix_sum(header_->checkpoints_[interval_idx], count, values);
+  }
+  return ret;
+}
+
+int ObIntegerDeltaDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
+    const ObBitStream &bs, const char *data, const int64_t len) const
+{
+  UNUSED(bs);
+  int ret = OB_SUCCESS;
+  uint64_t val = STORED_NOT_EXT;
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_) + ctx.col_header_->length_;
+
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(NULL == data || len < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(data), K(len));
+  } else if (ctx.has_extend_value()) {
+    if (OB_FAIL(ObBitStream::get(col_data, row_id * ctx.micro_block_header_->extend_value_bit_,
+        ctx.micro_block_header_->extend_value_bit_, val))) {
+      LOG_WARN("get extend value failed", K(ret), K(bs), K(ctx));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (STORED_NOT_EXT != val) {
+    set_stored_ext_value(cell, static_cast<ObStoredExtValue>(val));
+  } else {
+    if (cell.get_meta() != ctx.obj_meta_) {
+      cell.set_meta_type(ctx.obj_meta_);
+    }
+    uint64_t values[ObIntegerDeltaHeader::CHECKPOINT_INTERVAL];
+    const int64_t interval_idx = row_id / ObIntegerDeltaHeader::CHECKPOINT_INTERVAL;
+    if (OB_FAIL(decode_interval(ctx, col_data, interval_idx, row_id + 1, values))) {
+      LOG_WARN("decode checkpoint interval failed", K(ret), K(row_id));
+    } else {
+      cell.v_.uint64_ = values[row_id % ObIntegerDeltaHeader::CHECKPOINT_INTERVAL];
+    }
+  }
+  return ret;
+}
+
+int ObIntegerDeltaDecoder::update_pointer(const char *old_block, const char *cur_block)
+{
+  int ret = OB_SUCCESS;
+  if (!is_inited()) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(old_block) || OB_ISNULL(cur_block)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(old_block), KP(cur_block));
+  } else {
+    ObIColumnDecoder::update_pointer(header_, old_block, cur_block);
+  }
+  return ret;
+}
+
+// Internal call, not check parameters for performance
+// Rows are decoded by checkpoint interval, ascending @row_ids decode each interval only once.
+int ObIntegerDeltaDecoder::batch_decode(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex* row_index,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    common::ObDatum *datums) const
+{
+  UNUSEDx(row_index, cell_datas);
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+                                    + ctx.col_header_->length_;
+    const int64_t row_count = ctx.micro_block_header_->row_count_;
+    uint32_t datum_len = 0;
+    if (ctx.has_extend_value()
+        && OB_FAIL(set_null_datums_from_fixed_column(ctx, row_ids, row_cap, col_data, datums))) {
+      LOG_WARN("Failed to set null datums from fixed data", K(ret), K(ctx));
+    } else if (OB_FAIL(get_uint_data_datum_len(
+        ObDatum::get_obj_datum_map_type(ctx.obj_meta_.get_type()),
+        datum_len))) {
+      LOG_WARN("Failed to get datum length of int/uint data", K(ret));
+    } else {
+      uint64_t values[ObIntegerDeltaHeader::CHECKPOINT_INTERVAL];
+      int64_t cur_interval = -1;
+      for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+        if (ctx.has_extend_value() && datums[i].is_null()) {
+          // Skip
+        } else {
+          const int64_t row_id = row_ids[i];
+          const int64_t interval_idx = row_id / ObIntegerDeltaHeader::CHECKPOINT_INTERVAL;
+          if (interval_idx != cur_interval) {
+            const int64_t end_row = MIN(row_count,
+                (interval_idx + 1) * ObIntegerDeltaHeader::CHECKPOINT_INTERVAL);
+            if (OB_FAIL(decode_interval(ctx, col_data, interval_idx, end_row, values))) {
+              LOG_WARN("Failed to decode checkpoint interval", K(ret), K(interval_idx));
+            } else {
+              cur_interval = interval_idx;
+            }
+          }
+          if (OB_SUCC(ret)) {
+            MEMCPY(const_cast<char *>(datums[i].ptr_),
+                &values[row_id % ObIntegerDeltaHeader::CHECKPOINT_INTERVAL], datum_len);
+            datums[i].pack_ = datum_len;
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIntegerDeltaDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSEDx(meta_data, row_index);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_) +
+      col_ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Integer delta decoder not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX
+                         || col_ctx.micro_block_header_->row_count_ != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushed down white filter",
+             K(ret), K(op_type), K(result_bitmap.size()));
+  } else if (OB_FAIL(get_is_null_bitmap_from_fixed_column(col_ctx, col_data, result_bitmap))) {
+    LOG_WARN("Failed to get is null bitmap", K(ret), K(col_ctx));
+  } else {
+    switch (op_type) {
+    case sql::WHITE_OP_NU: {
+      break;
+    }
+    case sql::WHITE_OP_NN: {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to flip bits for result bitmap",
+            K(ret), K(result_bitmap.size()));
+      }
+      break;
+    }
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE:
+    case sql::WHITE_OP_GT:
+    case sql::WHITE_OP_GE:
+    case sql::WHITE_OP_LT:
+    case sql::WHITE_OP_LE:
+    case sql::WHITE_OP_BT: {
+      if (col_ctx.obj_meta_.get_type_class() == ObFloatTC
+          || col_ctx.obj_meta_.get_type_class() == ObDoubleTC) {
+        // Can't compare by integer directly
+        ret = OB_NOT_SUPPORTED;
+        LOG_DEBUG("Double/Float with INTEGER_DELTA encoding, back to retro path", K(col_ctx));
+      } else if (is_signed_) {
+        ret = range_operator<int64_t>(parent, col_ctx, col_data, filter, result_bitmap);
+      } else {
+        ret = range_operator<uint64_t>(parent, col_ctx, col_data, filter, result_bitmap);
+      }
+      if (OB_FAIL(ret) && OB_NOT_SUPPORTED != ret) {
+        LOG_WARN("Failed on range operator", K(ret), K(col_ctx), K(op_type));
+      }
+      break;
+    }
+    case sql::WHITE_OP_IN: {
+      if (OB_FAIL(in_operator(parent, col_ctx, col_data, filter, result_bitmap))) {
+        LOG_WARN("Failed on IN operator", K(ret), K(col_ctx));
+      }
+      break;
+    }
+    default: {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Unexpected operation type", K(ret), K(op_type));
+    }
+    }
+  }
+  return ret;
+}
+
+// Convert comparison to closed range [left, right] of column values
+template <typename T>
+int ObIntegerDeltaDecoder::range_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char *col_data,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const common::ObIArray<ObObj> &objs = filter.get_objs();
+  const int64_t param_cnt = sql::WHITE_OP_BT == op_type ? 2 : 1;
+  if (OB_UNLIKELY(param_cnt != objs.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Filter pushdown operator: Invalid argument", K(ret), K(filter));
+  } else if (OB_UNLIKELY(col_ctx.obj_meta_.get_type() != objs.at(0).get_type()
+             || col_ctx.obj_meta_.get_type() != objs.at(param_cnt - 1).get_type())) {
+    // Filter type not match with column type, back to retro path
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("Type not match, back to retrograde path", K(col_ctx), K(filter));
+  } else {
+    const T min = std::numeric_limits<T>::min();
+    const T max = std::numeric_limits<T>::max();
+    const T param = static_cast<T>(objs.at(0).v_.uint64_);
+    T left = min;
+    T right = max;
+    bool is_empty = false;
+    switch (op_type) {
+    case sql::WHITE_OP_EQ:
+    case sql::WHITE_OP_NE: {
+      left = param;
+      right = param;
+      break;
+    }
+    case sql::WHITE_OP_GT: {
+      is_empty = max == param;
+      left = is_empty ? param : param + 1;
+      break;
+    }
+    case sql::WHITE_OP_GE: {
+      left = param;
+      break;
+    }
+    case sql::WHITE_OP_LT: {
+      is_empty = min == param;
+      right = is_empty ? param : param - 1;
+      break;
+    }
+    case sql::WHITE_OP_LE: {
+      right = param;
+      break;
+    }
+    case sql::WHITE_OP_BT: {
+      left = param;
+      right = static_cast<T>(objs.at(1).v_.uint64_);
+      is_empty = left > right;
+      break;
+    }
+    default: {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected operation type", K(ret), K(op_type));
+    }
+    }
+    if (OB_SUCC(ret) && OB_FAIL(filter_range<T>(parent, col_ctx, col_data, left, right,
+        is_empty, sql::WHITE_OP_NE == op_type, result_bitmap))) {
+      LOG_WARN("Failed to filter range", K(ret), K(left), K(right), K(is_empty));
+    }
+  }
+  return ret;
+}
+
+// For monotonic column, values of interval k are between checkpoints_[k] and checkpoints_[k + 1],
+// intervals fully inside or outside the range are decided without decoding.
+template <typename T>
+int ObIntegerDeltaDecoder::filter_range(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char *col_data,
+    const T left,
+    const T right,
+    const bool is_empty,
+    const bool is_negative,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_count = col_ctx.micro_block_header_->row_count_;
+  const int64_t interval_cnt = ObIntegerDeltaHeader::get_checkpoint_cnt(row_count) - 1;
+  const bool null_value_contained = result_bitmap.popcnt() > 0;
+  const bool exist_parent_filter = nullptr != parent;
+  uint64_t values[ObIntegerDeltaHeader::CHECKPOINT_INTERVAL];
+  for (int64_t interval_idx = 0; OB_SUCC(ret) && interval_idx < interval_cnt; ++interval_idx) {
+    const int64_t start_row = interval_idx * ObIntegerDeltaHeader::CHECKPOINT_INTERVAL;
+    const int64_t end_row = MIN(row_count, start_row + ObIntegerDeltaHeader::CHECKPOINT_INTERVAL);
+    // -1: need decode, 0: all false, 1: all true
+    int64_t decided = -1;
+    if (is_empty) {
+      decided = is_negative ? 1 : 0;
+    } else if (header_->is_monotonic()) {
+      const T lo = static_cast<T>(header_->checkpoints_[interval_idx]);
+      const T hi = static_cast<T>(header_->checkpoints_[interval_idx + 1]);
+      if (hi < left || lo > right) {
+        decided = 0;
+      } else if (lo >= left && hi <= right) {
+        decided = 1;
+      }
+      if (decided >= 0 && is_negative) {
+        decided = 1 - decided;
+      }
+    }
+    if (decided < 0 && OB_FAIL(decode_interval(col_ctx, col_data, interval_idx, end_row, values))) {
+      LOG_WARN("Failed to decode checkpoint interval", K(ret), K(interval_idx));
+    }
+    for (int64_t row_id = start_row; OB_SUCC(ret) && row_id < end_row; ++row_id) {
+      if (exist_parent_filter && parent->can_skip_filter(row_id)) {
+      } else if (null_value_contained && result_bitmap.test(row_id)) {
+        if (OB_FAIL(result_bitmap.set(row_id, false))) {
+          LOG_WARN("Failed to set row with null object to false", K(ret));
+        }
+      } else {
+        bool result = 1 == decided;
+        if (decided < 0) {
+          const T cur = static_cast<T>(values[row_id - start_row]);
+          result = (cur >= left && cur <= right) != is_negative;
+        }
+        if (result && OB_FAIL(result_bitmap.set(row_id))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIntegerDeltaDecoder::in_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char *col_data,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(filter.get_objs().count() == 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Pushdown in operator: Invalid arguments", K(ret), K(filter));
+  } else {
+    const int64_t row_count = col_ctx.micro_block_header_->row_count_;
+    const int64_t interval_cnt = ObIntegerDeltaHeader::get_checkpoint_cnt(row_count) - 1;
+    const bool null_value_contained = result_bitmap.popcnt() > 0;
+    const bool exist_parent_filter = nullptr != parent;
+    ObObj cur_obj(filter.get_objs().at(0));
+    uint64_t values[ObIntegerDeltaHeader::CHECKPOINT_INTERVAL];
+    for (int64_t interval_idx = 0; OB_SUCC(ret) && interval_idx < interval_cnt; ++interval_idx) {
+      const int64_t start_row = interval_idx * ObIntegerDeltaHeader::CHECKPOINT_INTERVAL;
+      const int64_t end_row = MIN(row_count, start_row + ObIntegerDeltaHeader::CHECKPOINT_INTERVAL);
+      if (OB_FAIL(decode_interval(col_ctx, col_data, interval_idx, end_row, values))) {
+        LOG_WARN("Failed to decode checkpoint interval", K(ret), K(interval_idx));
+      }
+      for (int64_t row_id = start_row; OB_SUCC(ret) && row_id < end_row; ++row_id) {
+        if (exist_parent_filter && parent->can_skip_filter(row_id)) {
+        } else if (null_value_contained && result_bitmap.test(row_id)) {
+          if (OB_FAIL(result_bitmap.set(row_id, false))) {
+            LOG_WARN("Failed to set row with null object to false", K(ret));
+          }
+        } else {
+          bool result = false;
+          cur_obj.v_.uint64_ = values[row_id - start_row];
+          if (OB_FAIL(filter.exist_in_obj_set(cur_obj, result))) {
+            LOG_WARN("Failed to check object in hashset", K(ret), K(cur_obj));
+          } else if (result && OB_FAIL(result_bitmap.set(row_id))) {
+            LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIntegerDeltaDecoder::get_null_count(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t &null_count) const
+{
+  int ret = OB_SUCCESS;
+  const char *col_data = reinterpret_cast<const char *>(header_) + ctx.col_header_->length_;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Integer delta decoder is not inited", K(ret));
+  } else if (OB_FAIL(ObIColumnDecoder::get_null_count_from_extend_value(
+      ctx,
+      row_index,
+      row_ids,
+      row_cap,
+      col_data,
+      null_count))) {
+    LOG_WARN("Failed to get null count", K(ctx), K(ret));
+  }
+  return ret;
+}
+
+int ObIntegerDeltaDecoder::get_int_sum(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    ObEncodingIntSum &sum) const
+{
+  UNUSEDx(row_index, datums);
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    const unsigned char *col_data = reinterpret_cast<const unsigned char *>(header_)
+                                    + ctx.col_header_->length_;
+    const int64_t row_count = ctx.micro_block_header_->row_count_;
+    const int64_t ext_bit = ctx.micro_block_header_->extend_value_bit_;
+    uint64_t values[ObIntegerDeltaHeader::CHECKPOINT_INTERVAL];
+    int64_t cur_interval = -1;
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      const int64_t row_id = row_ids[i];
+      const int64_t interval_idx = row_id / ObIntegerDeltaHeader::CHECKPOINT_INTERVAL;
+      uint64_t val = STORED_NOT_EXT;
+      if (ctx.has_extend_value()
+          && OB_FAIL(ObBitStream::get(col_data, row_id * ext_bit, ext_bit, val))) {
+        LOG_WARN("Failed to get extend value", K(ret), K(ctx), K(row_id));
+      } else if (STORED_NOPE == val) {
+        // nop value need to be filled with default value
+        ret = OB_NOT_SUPPORTED;
+      } else if (STORED_NOT_EXT != val) {
+        // null
+      } else if (interval_idx != cur_interval) {
+        const int64_t end_row = MIN(row_count,
+            (interval_idx + 1) * ObIntegerDeltaHeader::CHECKPOINT_INTERVAL);
+        if (OB_FAIL(decode_interval(ctx, col_data, interval_idx, end_row, values))) {
+          LOG_WARN("Failed to decode checkpoint interval", K(ret), K(interval_idx));
+        } else {
+          cur_interval = interval_idx;
+        }
+      }
+      if (OB_SUCC(ret) && STORED_NOT_EXT == val) {
+        sum.add(values[row_id % ObIntegerDeltaHeader::CHECKPOINT_INTERVAL], 1);
+      }
+    }
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_INTEGER_DELTA_DECODER_H_
+#define OCEANBASE_ENCODING_OB_INTEGER_DELTA_DECODER_H_
+
+#include "ob_icolumn_decoder.h"
+#include "ob_encoding_util.h"
+#include "ob_integer_delta_encoder.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+struct ObColumnHeader;
+struct ObIntegerDeltaHeader;
+
+// Inclusive prefix sum: values[i] = base + values[0] + ... + values[i]
+typedef void (*delta_prefix_sum_func)(
+    const uint64_t base,
+    const int64_t count,
+    uint64_t *values);
+
+extern delta_prefix_sum_func delta_prefix_sum;
+extern bool delta_prefix_sum_func_inited;
+
+class ObIntegerDeltaDecoder : public ObIColumnDecoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::INTEGER_DELTA;
+  ObIntegerDeltaDecoder() : header_(NULL), is_signed_(false)
+  {}
+  virtual ~ObIntegerDeltaDecoder() {}
+
+  OB_INLINE int init(
+      const ObMicroBlockHeader &micro_block_header,
+      const ObColumnHeader &column_header,
+      const char *meta);
+
+  virtual int decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
+      const ObBitStream &bs, const char *data, const int64_t len) const override;
+
+  virtual int update_pointer(const char *old_block, const char *cur_block) override;
+
+  void reset() { this->~ObIntegerDeltaDecoder(); new (this) ObIntegerDeltaDecoder(); }
+  OB_INLINE void reuse();
+  virtual ObColumnHeader::Type get_type() const override { return type_; }
+  bool is_inited() const { return NULL != header_; }
+
+  virtual int batch_decode(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex* row_index,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      common::ObDatum *datums) const override;
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+
+  virtual int get_null_count(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      int64_t &null_count) const override;
+
+  virtual int get_int_sum(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      ObEncodingIntSum &sum) const override;
+private:
+  // Decode rows of checkpoint interval @interval_idx before @end_row into @values,
+  // null rows get the value of previous not null row.
+  int decode_interval(
+      const ObColumnDecoderCtx &ctx,
+      const unsigned char *col_data,
+      const int64_t interval_idx,
+      const int64_t end_row,
+      uint64_t *values) const;
+
+  template <typename T>
+  int range_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char *col_data,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
+  template <typename T>
+  int filter_range(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char *col_data,
+      const T left,
+      const T right,
+      const bool is_empty,
+      const bool is_negative,
+      ObBitmap &result_bitmap) const;
+
+  int in_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char *col_data,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+private:
+  const ObIntegerDeltaHeader *header_;
+  bool is_signed_;
+};
+
+OB_INLINE int ObIntegerDeltaDecoder::init(
+    const ObMicroBlockHeader &micro_block_header,
+    const ObColumnHeader &column_header,
+    const char *meta)
+{
+  UNUSED(micro_block_header);
+  int ret = common::OB_SUCCESS;
+  // performance critical, don't check params
+  if (is_inited()) {
+    ret = common::OB_INIT_TWICE;
+    STORAGE_LOG(WARN, "init twice", K(ret));
+  } else {
+    ObObjTypeStoreClass sc = get_store_class_map()[ob_obj_type_class(column_header.get_store_obj_type())];
+    if (ObIntSC != sc && ObUIntSC != sc) {
+      ret = common::OB_INNER_STAT_ERROR;
+      STORAGE_LOG(WARN, "not supported store class", K(ret), K(column_header), K(sc));
+    } else {
+      meta += column_header.offset_;
+      header_ = reinterpret_cast<const ObIntegerDeltaHeader *>(meta);
+      is_signed_ = ObIntSC == sc;
+    }
+  }
+  return ret;
+}
+
+OB_INLINE void ObIntegerDeltaDecoder::reuse()
+{
+  header_ = NULL;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_INTEGER_DELTA_DECODER_H_
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_encoding_query_util.h"
+#include "ob_integer_delta_decoder.h"
+
+namespace oceanbase {
+namespace blocksstable {
+
+#if defined ( __AVX2__ )
+// Prefix sum of 4 uint64 lanes by two shift-and-add steps, carry of previous vector
+// is broadcasted and added to every lane.
+static void delta_prefix_sum_avx2(const uint64_t base, const int64_t count, uint64_t *values)
+{
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i carry = _mm256_set1_epi64x(static_cast<int64_t>(base));
+  int64_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+    // [0, x0, x1, x2]
+    __m256i t = _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x90), zero, 0x03);
+    x = _mm256_add_epi64(x, t);
+    // [0, 0, x0, x1]
+    t = _mm256_blend_epi32(_mm256_permute4x64_epi64(x, 0x40), zero, 0x0F);
+    x = _mm256_add_epi64(x, t);
+    x = _mm256_add_epi64(x, carry);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i), x);
+    carry = _mm256_permute4x64_epi64(x, 0xFF);
+  }
+  uint64_t sum = i > 0 ? values[i - 1] : base;
+  for (; i < count; ++i) {
+    sum += values[i];
+    values[i] = sum;
+  }
+}
+#endif
+
+bool init_delta_prefix_sum_simd_func()
+{
+#if defined ( __AVX2__ )
+  delta_prefix_sum = &delta_prefix_sum_avx2;
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // end of namespace blocksstable
+} // end of namespace oceanbase
@@ -0,0 +1,261 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_integer_delta_encoder.h"
+
+#include <limits>
+#include "storage/blocksstable/ob_data_buffer.h"
+#include "ob_integer_base_diff_encoder.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+const ObColumnHeader::Type ObIntegerDeltaEncoder::type_;
+
+ObIntegerDeltaEncoder::ObIntegerDeltaEncoder()
+  : type_store_size_(0), mask_(0), reverse_mask_(0), base_(0), min_delta_(0),
+    is_monotonic_(false), header_(NULL)
+{
+}
+
+int ObIntegerDeltaEncoder::init(
+    const ObColumnEncodingCtx &ctx,
+    const int64_t column_index,
+    const ObConstDatumRowArray &rows)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnEncoder::init(ctx, column_index, rows))) {
+    LOG_WARN("init base column encoder failed",
+        K(ret), K(ctx), K(column_index), "row count", rows.count());
+  } else {
+    const ObObjTypeStoreClass sc = get_store_class_map()[
+        ob_obj_type_class(column_type_.get_type())];
+    type_store_size_ = get_type_size_map()[column_type_.get_type()];
+    if ((ObIntSC != sc && ObUIntSC != sc) || type_store_size_ < 0) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("not supported type for integer delta",
+          K(ret), K(sc), K_(type_store_size), K_(column_index));
+    } else {
+      mask_ = INTEGER_MASK_TABLE[type_store_size_];
+      if (ObIntSC == sc) {
+        reverse_mask_ = ~mask_;
+      }
+      column_header_.type_ = type_;
+    }
+  }
+  return ret;
+}
+
+void ObIntegerDeltaEncoder::reuse()
+{
+  ObIColumnEncoder::reuse();
+  type_store_size_ = 0;
+  mask_ = 0;
+  reverse_mask_ = 0;
+  base_ = 0;
+  min_delta_ = 0;
+  is_monotonic_ = false;
+  header_ = NULL;
+  is_inited_ = false;
+}
+
+// Deltas are calculated by wrap around uint64_t subtraction and compared as int64_t,
+// so the packed (delta - min_delta) always restores the value by wrap around addition.
+template <typename T>
+int ObIntegerDeltaEncoder::traverse_cells(
+    uint64_t &value_range, uint64_t &delta_range, bool &has_delta)
+{
+  int ret = OB_SUCCESS;
+  T min_value = std::numeric_limits<T>::max();
+  T max_value = std::numeric_limits<T>::min();
+  int64_t min_delta = INT64_MAX;
+  int64_t max_delta = INT64_MIN;
+  uint64_t first = 0;
+  uint64_t prev = 0;
+  bool first_found = false;
+  is_monotonic_ = true;
+  has_delta = false;
+  for (int64_t i = 0; i < ctx_->col_datums_->count(); ++i) {
+    const ObDatum &datum = ctx_->col_datums_->at(i);
+    if (!datum.is_null() && !datum.is_nop()) {
+      const uint64_t v = cast_to_uint64(datum);
+      const T t = static_cast<T>(v);
+      if (first_found) {
+        const int64_t delta = static_cast<int64_t>(v - prev);
+        if (delta < min_delta) {
+          min_delta = delta;
+        }
+        if (delta > max_delta) {
+          max_delta = delta;
+        }
+        if (t < static_cast<T>(prev)) {
+          is_monotonic_ = false;
+        }
+        has_delta = true;
+      } else {
+        first = v;
+        first_found = true;
+      }
+      if (t < min_value) {
+        min_value = t;
+      }
+      if (t > max_value) {
+        max_value = t;
+      }
+      prev = v;
+    }
+  }
+  if (has_delta) {
+    min_delta_ = static_cast<uint64_t>(min_delta);
+    base_ = first - min_delta_;
+    // checkpoints are lower bounds of following values only if base does not wrap around
+    if (static_cast<T>(base_) > static_cast<T>(first)) {
+      is_monotonic_ = false;
+    }
+    value_range = static_cast<uint64_t>(max_value - min_value);
+    delta_range = static_cast<uint64_t>(max_delta) - min_delta_;
+  }
+  return ret;
+}
+
+int ObIntegerDeltaEncoder::traverse(bool &suitable)
+{
+  int ret = OB_SUCCESS;
+  suitable = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (!ctx_->encoding_ctx_->encoder_opt_.enable_bit_packing_) {
+    // rows of delta encoding can not be decoded individually, not suitable for
+    // selective row store which disables bit packing for random access.
+  } else {
+    uint64_t value_range = 0;
+    uint64_t delta_range = 0;
+    bool has_delta = false;
+    if (0 != reverse_mask_) {
+      ret = traverse_cells<int64_t>(value_range, delta_range, has_delta);
+    } else {
+      ret = traverse_cells<uint64_t>(value_range, delta_range, has_delta);
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("traverse integers failed", K(ret));
+    } else if (!has_delta || 0 == value_range) {
+      // not suitable for integer delta, use const encoding
+    } else {
+      const int64_t delta_size = 0 == delta_range
+          ? 0 : sizeof(delta_range) * CHAR_BIT - __builtin_clzl(delta_range);
+      // compare with integer base diff, which is always cheaper to decode
+      bool bit_packing = false;
+      int64_t base_diff_size = get_packing_size(bit_packing, value_range);
+      if (!bit_packing) {
+        base_diff_size *= CHAR_BIT;
+      }
+      const int64_t row_cnt = rows_->count();
+      const int64_t meta_size = ObIntegerDeltaHeader::get_meta_size(row_cnt);
+      const int64_t base_diff_meta_size = sizeof(ObIntegerBaseDiffHeader) + type_store_size_;
+      LOG_DEBUG("integer delta size", K_(column_index), K(delta_size), K(base_diff_size),
+          K_(min_delta), K_(is_monotonic));
+      if ((base_diff_size - delta_size) * row_cnt
+          > (meta_size - base_diff_meta_size) * CHAR_BIT) {
+        suitable = true;
+        desc_.bit_packing_length_ = delta_size;
+        desc_.need_data_store_ = true;
+        desc_.has_null_ = ctx_->null_cnt_ > 0;
+        desc_.has_nope_ = ctx_->nope_cnt_ > 0;
+        desc_.need_extend_value_bit_store_ = desc_.has_null_ || desc_.has_nope_;
+        if (desc_.need_extend_value_bit_store_) {
+          column_header_.set_has_extend_value_attr();
+        }
+        if (desc_.bit_packing_length_ > 0) {
+          column_header_.set_bit_packing_attr();
+        }
+        column_header_.set_fix_lenght_attr();
+      }
+    }
+  }
+  return ret;
+}
+
+int ObIntegerDeltaEncoder::store_meta(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    const int64_t row_cnt = ctx_->col_datums_->count();
+    header_ = reinterpret_cast<ObIntegerDeltaHeader *>(buf_writer.current());
+    if (OB_FAIL(buf_writer.advance_zero(ObIntegerDeltaHeader::get_meta_size(row_cnt)))) {
+      LOG_WARN("advance meta store size failed", K(ret), K(row_cnt));
+    } else {
+      header_->version_ = ObIntegerDeltaHeader::OB_INTEGER_DELTA_HEADER_V1;
+      header_->length_ = static_cast<uint8_t>(desc_.bit_packing_length_);
+      header_->attr_ = is_monotonic_ ? ObIntegerDeltaHeader::MONOTONIC : 0;
+      header_->min_delta_ = min_delta_;
+      uint64_t running = base_;
+      for (int64_t row_id = 0; row_id < row_cnt; ++row_id) {
+        if (0 == row_id % ObIntegerDeltaHeader::CHECKPOINT_INTERVAL) {
+          header_->checkpoints_[row_id / ObIntegerDeltaHeader::CHECKPOINT_INTERVAL] = running;
+        }
+        const ObDatum &datum = ctx_->col_datums_->at(row_id);
+        if (!datum.is_null() && !datum.is_nop()) {
+          running = cast_to_uint64(datum);
+        }
+      }
+      header_->checkpoints_[ObIntegerDeltaHeader::get_checkpoint_cnt(row_cnt) - 1] = running;
+      LOG_DEBUG("integer delta meta", KPC_(header), K_(base));
+    }
+  }
+  return ret;
+}
+
+int64_t ObIntegerDeltaEncoder::calc_size() const
+{
+  int64_t size = INT64_MAX;
+  if (is_inited_) {
+    size = (rows_->count() * desc_.bit_packing_length_ + CHAR_BIT - 1) / CHAR_BIT
+        + ObIntegerDeltaHeader::get_meta_size(rows_->count());
+  }
+  return size;
+}
+
+int ObIntegerDeltaEncoder::store_fix_data(ObBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(!is_valid_fix_encoder())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K_(desc));
+  } else {
+    DeltaGetter getter(*this);
+    EmptySetter setter;
+    if (OB_FAIL(fill_column_store(buf_writer, *ctx_->col_datums_, getter, setter))) {
+      LOG_WARN("fill column store failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
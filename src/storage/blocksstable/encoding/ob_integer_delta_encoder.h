@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_INTEGER_DELTA_ENCODER_H_
+#define OCEANBASE_ENCODING_OB_INTEGER_DELTA_ENCODER_H_
+
+#include "ob_icolumn_encoder.h"
+#include "ob_encoding_util.h"
+#include "ob_bit_stream.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Meta of integer delta encoding:
+//   header | checkpoints_[checkpoint count]
+// Fix data stores bit packed (value - previous not null value - min_delta_) of each row,
+// null/nop rows store zero. Running value before every CHECKPOINT_INTERVAL rows is kept in
+// checkpoints_ for random access, the last checkpoint is the last not null value of block.
+struct ObIntegerDeltaHeader
+{
+  static constexpr uint8_t OB_INTEGER_DELTA_HEADER_V1 = 0;
+  static constexpr int64_t CHECKPOINT_INTERVAL = 128;
+  // not null values are non-decreasing
+  static constexpr uint8_t MONOTONIC = 0x1;
+  uint8_t version_;
+  uint8_t length_;
+  uint8_t attr_;
+  uint64_t min_delta_;
+  uint64_t checkpoints_[0];
+
+  ObIntegerDeltaHeader()
+    : version_(OB_INTEGER_DELTA_HEADER_V1), length_(0), attr_(0), min_delta_(0)
+  {
+  }
+
+  OB_INLINE bool is_monotonic() const { return attr_ & MONOTONIC; }
+  OB_INLINE static int64_t get_checkpoint_cnt(const int64_t row_cnt)
+  {
+    return (row_cnt + CHECKPOINT_INTERVAL - 1) / CHECKPOINT_INTERVAL + 1;
+  }
+  OB_INLINE static int64_t get_meta_size(const int64_t row_cnt)
+  {
+    return sizeof(ObIntegerDeltaHeader) + get_checkpoint_cnt(row_cnt) * sizeof(uint64_t);
+  }
+
+  TO_STRING_KV(K_(version), K_(length), K_(attr), K_(min_delta));
+} __attribute__((packed));
+
+class ObIntegerDeltaEncoder : public ObIColumnEncoder
+{
+public:
+  static const ObColumnHeader::Type type_ = ObColumnHeader::INTEGER_DELTA;
+
+  ObIntegerDeltaEncoder();
+  virtual ~ObIntegerDeltaEncoder() {}
+
+  virtual int init(
+      const ObColumnEncodingCtx &ctx,
+      const int64_t column_index,
+      const ObConstDatumRowArray &rows) override;
+
+  virtual void reuse() override;
+  virtual int store_meta(ObBufferWriter &buf_writer) override;
+  virtual int store_data(
+      const int64_t row_id, ObBitStream &bs, char *buf, const int64_t len) override
+  {
+    UNUSEDx(row_id, bs, buf, len);
+    return common::OB_NOT_SUPPORTED;
+  }
+
+  virtual int traverse(bool &suitable) override;
+  virtual int64_t calc_size() const override;
+  virtual ObColumnHeader::Type get_type() const { return type_; }
+  virtual int store_fix_data(ObBufferWriter &buf_writer) override;
+
+  // rows are visited in order, null/nop rows are skipped by store_fix_bits()
+  struct DeltaGetter
+  {
+    explicit DeltaGetter(const ObIntegerDeltaEncoder &encoder)
+      : encoder_(encoder), prev_(encoder.base_) {}
+    inline int operator()(const int64_t, const common::ObDatum &datum, uint64_t &v)
+    {
+      const uint64_t cur = encoder_.cast_to_uint64(datum);
+      v = cur - prev_ - encoder_.min_delta_;
+      prev_ = cur;
+      return common::OB_SUCCESS;
+    }
+
+    const ObIntegerDeltaEncoder &encoder_;
+    uint64_t prev_;
+  };
+
+  struct EmptySetter
+  {
+    inline int operator()(
+        const int64_t,
+        const common::ObDatum &,
+        char *,
+        const int64_t) const
+    {
+      return common::OB_NOT_SUPPORTED;
+    }
+  };
+
+private:
+  template <typename T>
+  int traverse_cells(uint64_t &value_range, uint64_t &delta_range, bool &has_delta);
+  OB_INLINE uint64_t cast_to_uint64(const common::ObDatum &datum) const
+  {
+    uint64_t v = datum.get_uint64() & mask_;
+    if (0 != reverse_mask_ && (v & (reverse_mask_ >> 1))) {
+      v |= reverse_mask_;
+    }
+    return v;
+  }
+
+private:
+  int64_t type_store_size_;
+  uint64_t mask_;
+  uint64_t reverse_mask_;
+  // running value before the first row, first not null value minus min_delta_
+  uint64_t base_;
+  uint64_t min_delta_;
+  bool is_monotonic_;
+  // is null before write meta
+  ObIntegerDeltaHeader *header_;
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif // OCEANBASE_ENCODING_OB_INTEGER_DELTA_ENCODER_H_
@@ -256,6 +256,22 @@ int ObColumnDecoder::get_row_count(
   return ret;
 }
 
+int ObColumnDecoder::get_int_sum(
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    ObEncodingIntSum &sum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(decoder_->get_int_sum(*ctx_, row_index, row_ids, row_cap, datums, sum))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("Failed to get int sum from column decoder", K(ret), K(*ctx_));
+    }
+  }
+  return ret;
+}
+
 // performance critical, do not check parameters
 int ObColumnDecoder::quick_compare(const ObStorageDatum &left, const ObStorageDatumCmpFunc &cmp_func, const int64_t row_id,
     const ObBitStream &bs, const char *data, const int64_t len, int32_t &cmp_ret)
@@ -289,7 +305,9 @@ ObIEncodeBlockReader::decode_acquire_func ObIEncodeBlockReader::acquire_funcs_[O
     acquire_decoder<ObHexStringDecoder>,
     acquire_decoder<ObStringPrefixDecoder>,
     acquire_decoder<ObColumnEqualDecoder>,
-    acquire_decoder<ObInterColSubStrDecoder>
+    acquire_decoder<ObInterColSubStrDecoder>,
+    acquire_decoder<ObIntegerDeltaDecoder>,
+    acquire_decoder<ObFloatDecimalDecoder>
 };
 
 ObIEncodeBlockReader::ObIEncodeBlockReader()
@@ -1049,6 +1067,28 @@ int ObMicroBlockDecoder::acquire(
         }
         break;
       }
+      case ObColumnHeader::INTEGER_DELTA: {
+        ObIntegerDeltaDecoder *d = NULL;
+        if (OB_FAIL(allocator.alloc(d))) {
+          LOG_WARN("alloc failed", K(ret));
+        } else if (OB_FAIL(d->init(header, col_header, meta_data))) {
+          LOG_WARN("init integer delta decoder failed", K(ret));
+        } else {
+          decoder = d;
+        }
+        break;
+      }
+      case ObColumnHeader::FLOAT_DECIMAL: {
+        ObFloatDecimalDecoder *d = NULL;
+        if (OB_FAIL(allocator.alloc(d))) {
+          LOG_WARN("alloc failed", K(ret));
+        } else if (OB_FAIL(d->init(header, col_header, meta_data))) {
+          LOG_WARN("init float decimal decoder failed", K(ret));
+        } else {
+          decoder = d;
+        }
+        break;
+      }
       default:
         ret = OB_INNER_STAT_ERROR;
         LOG_WARN("unsupported encoding type", K(ret), "type", col_header.type_);
@@ -1737,15 +1777,35 @@ int ObMicroBlockDecoder::compare_rowkey(const ObDatumRange &range,
   return ret;
 }
 
+int64_t ObMicroBlockDecoder::get_max_decoder_cache_size(
+    const int64_t column_count,
+    const int64_t max_size)
+{
+  static int64_t max_decoder_size = 0;
+  if (0 == ATOMIC_LOAD(&max_decoder_size)) {
+    int64_t size = 0;
+    for (int64_t i = 0; i < ObColumnHeader::MAX_TYPE; ++i) {
+      size = MAX(size, decoder_sizes[i]);
+    }
+    ATOMIC_STORE(&max_decoder_size, size);
+  }
+  const int64_t limit = MIN(max_size, MAX_CACHED_DECODER_BUF_SIZE_LIMIT);
+  const int64_t size = sizeof(ObBlockCachedDecoderHeader)
+      + MAX(column_count, 0) * (sizeof(ObBlockCachedDecoderHeader::Col) + max_decoder_size);
+  return MIN(size, limit);
+}
+
 int ObMicroBlockDecoder::get_decoder_cache_size(
     const char *block,
     const int64_t block_size,
+    const int64_t max_size,
     int64_t &size)
 {
   int ret = OB_SUCCESS;
-  if (OB_UNLIKELY(nullptr == block || block_size <= 0)) {
+  if (OB_UNLIKELY(nullptr == block || block_size <= 0
+      || max_size <= 0 || max_size > MAX_CACHED_DECODER_BUF_SIZE_LIMIT)) {
     ret = OB_INVALID_ARGUMENT;
-    LOG_WARN("invalid argument", K(ret), KP(block), K(block_size));
+    LOG_WARN("invalid argument", K(ret), KP(block), K(block_size), K(max_size));
   } else {
     size = sizeof(ObBlockCachedDecoderHeader);
     const ObMicroBlockHeader *header = nullptr;
@@ -1755,9 +1815,8 @@ int ObMicroBlockDecoder::get_decoder_cache_size(
       LOG_WARN("get micro block meta failed", K(ret), KP(block), K(block_size));
     } else {
       const int64_t offset_size = sizeof(ObBlockCachedDecoderHeader::Col);
-      for (int64_t i = 0; size < MAX_CACHED_DECODER_BUF_SIZE && i < header->column_count_; i++) {
-        if (size + offset_size + decoder_sizes[col_header[i].type_]
-            > MAX_CACHED_DECODER_BUF_SIZE) {
+      for (int64_t i = 0; size < max_size && i < header->column_count_; i++) {
+        if (size + offset_size + decoder_sizes[col_header[i].type_] > max_size) {
           break;
         }
         size += offset_size + decoder_sizes[col_header[i].type_];
@@ -2161,6 +2220,48 @@ int ObMicroBlockDecoder::get_min_or_max(
   return ret;
 }
 
+int ObMicroBlockDecoder::get_int_sum(
+    int32_t col_id,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    ObDatum *datum_buf,
+    ObEncodingIntSum &sum)
+{
+  int ret = OB_SUCCESS;
+  decoder_allocator_.reuse();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(col_id >= header_->column_count_ || nullptr == row_ids
+                         || nullptr == datum_buf || 0 >= row_cap)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(col_id), KP(row_ids), KP(datum_buf), K(row_cap));
+  } else if (OB_FAIL(decoders_[col_id].get_int_sum(row_index_, row_ids, row_cap, datum_buf, sum))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("Failed to get int sum", K(ret), K(col_id), K(row_cap));
+    }
+  }
+  return ret;
+}
+
+int ObMicroBlockDecoder::get_column_datums(
+    int32_t col_id,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    ObDatum *datum_buf)
+{
+  int ret = OB_SUCCESS;
+  decoder_allocator_.reuse();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(get_col_datums(col_id, row_ids, cell_datas, row_cap, datum_buf))) {
+    LOG_WARN("Failed to get col datums", K(ret), K(col_id), K(row_cap));
+  }
+  return ret;
+}
+
 int ObMicroBlockDecoder::get_col_datums(
     int32_t col_id,
     const int64_t *row_ids,
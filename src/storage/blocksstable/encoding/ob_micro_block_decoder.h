@@ -67,6 +67,13 @@ public:
       const bool contains_null,
       int64_t &count);
 
+  int get_int_sum(
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      ObEncodingIntSum &sum);
+
 public:
   const ObIColumnDecoder *decoder_;
   ObColumnDecoderCtx *ctx_;
@@ -187,6 +194,8 @@ public:
   static const int64_t ROW_CACHE_BUF_SIZE = 64 * 1024;
   static const int64_t CPU_CACHE_LINE_SIZE = 64;
   static const int64_t MAX_CACHED_DECODER_BUF_SIZE = 1L << 10;
+  // offset of cached decoder is uint16_t
+  static const int64_t MAX_CACHED_DECODER_BUF_SIZE_LIMIT = 64L << 10;
 
   ObMicroBlockDecoder();
   virtual ~ObMicroBlockDecoder();
@@ -220,9 +229,12 @@ public:
       const int64_t index,
       int32_t &start_key_compare_result,
       int32_t &end_key_compare_result);
+  // Upper bound of buffer size to cache decoders of all columns, no more than @max_size.
+  static int64_t get_max_decoder_cache_size(const int64_t column_count, const int64_t max_size);
   static int get_decoder_cache_size(
       const char *block,
       const int64_t block_size,
+      const int64_t max_size,
       int64_t &size);
   static int cache_decoders(
       char *buf,
@@ -270,6 +282,20 @@ public:
       const int64_t row_cap,
       ObDatum *datum_buf,
       ObMicroBlockAggInfo<ObDatum> &agg_info);
+  // sum integer column on encoded data, OB_NOT_SUPPORTED if the encoding can not do it
+  int get_int_sum(
+      int32_t col_id,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      ObDatum *datum_buf,
+      ObEncodingIntSum &sum);
+  // decode datums of one column for aggregation
+  int get_column_datums(
+      int32_t col_id,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      ObDatum *datum_buf);
   virtual int64_t get_column_count() const override
   {
     OB_ASSERT(nullptr != header_);
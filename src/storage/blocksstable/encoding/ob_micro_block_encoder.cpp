@@ -23,6 +23,8 @@
 #include "ob_raw_encoder.h"
 #include "ob_dict_encoder.h"
 #include "ob_integer_base_diff_encoder.h"
+#include "ob_integer_delta_encoder.h"
+#include "ob_float_decimal_encoder.h"
 #include "ob_string_diff_encoder.h"
 #include "ob_hex_string_encoder.h"
 #include "ob_rle_encoder.h"
@@ -1319,6 +1321,14 @@ int ObMicroBlockEncoder::try_encoder(ObIColumnEncoder *&e, const int64_t column_
               : try_span_column_encoder<ObInterColSubStrEncoder>(e, column_index);
         break;
       }
+      case ObColumnHeader::INTEGER_DELTA: {
+        ret = try_encoder<ObIntegerDeltaEncoder>(e, column_index);
+        break;
+      }
+      case ObColumnHeader::FLOAT_DECIMAL: {
+        ret = try_encoder<ObFloatDecimalEncoder>(e, column_index);
+        break;
+      }
       default:
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unknown encoding type", K(ret), K(type));
@@ -1626,6 +1636,48 @@ int ObMicroBlockEncoder::choose_encoder(const int64_t column_idx,
       }
     }
 
+    // INTEGER_DELTA can not be decoded by observers of old version
+    if (OB_SUCC(ret) && try_more && ctx_.major_working_cluster_version_ >= DATA_VERSION_4_2_0_0) {
+      // sorted or nearly sorted integers, e.g. auto increment keys and timestamps
+      if ((ObIntSC == sc || ObUIntSC == sc) && ObFloatTC != tc && ObDoubleTC != tc) {
+        if (cc.detected_encoders_[ObIntegerDeltaEncoder::type_]) {
+        } else if (OB_FAIL(try_encoder<ObIntegerDeltaEncoder>(e, column_idx))) {
+          LOG_WARN("try integer delta encoder failed", K(ret), K(column_idx));
+        } else if (NULL != e) {
+          int64_t size = e->calc_size();
+          if (size < choose->calc_size()) {
+            free_encoder(choose);
+            choose = e;
+            try_more = size <= acceptable_size;
+          } else {
+            free_encoder(e);
+            e = NULL;
+          }
+        }
+      }
+    }
+
+    // FLOAT_DECIMAL can not be decoded by observers of old version
+    if (OB_SUCC(ret) && try_more && ctx_.major_working_cluster_version_ >= DATA_VERSION_4_2_0_0) {
+      // decimal values stored as float/double, e.g. metrics and sensor data
+      if (ObFloatTC == tc || ObDoubleTC == tc) {
+        if (cc.detected_encoders_[ObFloatDecimalEncoder::type_]) {
+        } else if (OB_FAIL(try_encoder<ObFloatDecimalEncoder>(e, column_idx))) {
+          LOG_WARN("try float decimal encoder failed", K(ret), K(column_idx));
+        } else if (NULL != e) {
+          int64_t size = e->calc_size();
+          if (size < choose->calc_size()) {
+            free_encoder(choose);
+            choose = e;
+            try_more = size <= acceptable_size;
+          } else {
+            free_encoder(e);
+            e = NULL;
+          }
+        }
+      }
+    }
+
     bool string_diff_suitable = false;
     if (OB_SUCC(ret) && try_more) {
       if (is_string_encoding_valid(sc) && cc.fix_data_size_ > 0) {
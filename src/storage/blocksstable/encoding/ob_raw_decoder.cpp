@@ -585,6 +585,15 @@ int ObRawDecoder::pushdown_operator(
       }
       break;
     }
+    case sql::WHITE_OP_LI: {
+      if (OB_FAIL(like_operator(parent, col_ctx, col_data, row_index,
+                  filter, result_bitmap))) {
+        if (OB_UNLIKELY(OB_NOT_SUPPORTED != ret)) {
+          LOG_WARN("Failed on Like Operator", K(ret), K(col_ctx));
+        }
+      }
+      break;
+    }
     default: {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("Not supported operation type", K(ret), K(op_type));
@@ -859,6 +868,42 @@ int ObRawDecoder::in_operator(
   return ret;
 }
 
+// Stored strings are matched in place, substring pattern uses SIMD search of the matcher
+int ObRawDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+                  || NULL == col_data
+                  || NULL == row_index
+                  || filter.null_param_contained()
+                  || !filter.get_like_matcher().is_inited())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Pushdown like operator: Invalid arguments", K(ret), K(result_bitmap.size()), K(filter));
+  } else if (ObStringSC != store_class_ || col_ctx.obj_meta_.is_fixed_len_char_type()) {
+    // char column need padding before matching
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_FAIL(traverse_all_data(parent, col_ctx, row_index, col_data,
+                    filter, result_bitmap,
+                    [](const ObObj &cur_obj,
+                      const sql::ObWhiteFilterExecutor &filter,
+                      bool &result) -> int {
+                      int ret = OB_SUCCESS;
+                      if (OB_FAIL(filter.get_like_matcher().match(cur_obj.get_string(), result))) {
+                        LOG_WARN("Failed to match like pattern", K(ret), K(cur_obj));
+                      }
+                      return ret;
+                    }))) {
+    LOG_WARN("Failed to traverse all data in micro block", K(ret));
+  }
+  return ret;
+}
+
 /**
  *  Function to traverse all row data with raw encoding, regardless of column is fixed length
  *  or var lengthand run lambda function for every row element.
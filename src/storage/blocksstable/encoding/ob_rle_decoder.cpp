@@ -120,6 +120,31 @@ int ObRLEDecoder::get_null_count(
   return ret;
 }
 
+int ObRLEDecoder::get_int_sum(
+    const ObColumnDecoderCtx &ctx,
+    const ObIRowIndex *row_index,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    common::ObDatum *datums,
+    ObEncodingIntSum &sum) const
+{
+  UNUSED(row_index);
+  int ret = OB_SUCCESS;
+  int64_t unused_null_cnt = 0;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (OB_FAIL(extract_ref_and_null_count(row_ids, row_cap, datums, unused_null_cnt))) {
+    LOG_WARN("Failed to extract refs", K(ret));
+  } else if (OB_FAIL(dict_decoder_.batch_sum_refs(
+      ctx, ctx.col_header_->length_ - meta_header_->offset_, row_cap, datums, sum))) {
+    if (OB_NOT_SUPPORTED != ret) {
+      LOG_WARN("Failed to sum RLE refs from dict", K(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
 int ObRLEDecoder::pushdown_operator(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
@@ -174,6 +199,14 @@ int ObRLEDecoder::pushdown_operator(
         }
         break;
       }
+      case sql::WHITE_OP_LI: {
+        if (OB_FAIL(like_operator(parent, col_ctx, filter, result_bitmap))) {
+          if (OB_UNLIKELY(OB_NOT_SUPPORTED != ret)) {
+            LOG_WARN("Failed to run LIKE operator", K(ret), K(filter));
+          }
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Pushed down filter operator type not supported", K(ret), K(filter));
@@ -427,6 +460,57 @@ int ObRLEDecoder::cmp_ref_and_set_res(
   return ret;
 }
 
+// Match the pattern once per dictionary entry, then set result by references
+int ObRLEDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterLikeMatcher &matcher = filter.get_like_matcher();
+  if (OB_UNLIKELY(result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+                  || filter.get_op_type() != sql::WHITE_OP_LI
+                  || filter.null_param_contained()
+                  || !matcher.is_inited())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator", K(ret), K(result_bitmap.size()), K(filter));
+  } else if (ObStringSC != get_store_class_map()[ob_obj_type_class(col_ctx.obj_meta_.get_type())]
+             || col_ctx.obj_meta_.is_fixed_len_char_type()) {
+    // char column need padding before matching
+    ret = OB_NOT_SUPPORTED;
+  } else {
+    const int64_t dict_count = dict_decoder_.get_dict_header()->count_;
+    if (dict_count > 0) {
+      bool found = false;
+      bool matched = false;
+      const int64_t dict_meta_length = col_ctx.col_header_->length_ - meta_header_->offset_;
+      ObDictDecoderIterator end_it = dict_decoder_.end(&col_ctx, dict_meta_length);
+      ObDictDecoderIterator traverse_it = dict_decoder_.begin(&col_ctx, dict_meta_length);
+      const int64_t ref_bitset_size = dict_count + 1;
+      char ref_bitset_buf[sql::ObBitVector::memory_size(ref_bitset_size)];
+      sql::ObBitVector *ref_bitset = sql::to_bit_vector(ref_bitset_buf);
+      ref_bitset->init(ref_bitset_size);
+      int64_t dict_ref = 0;
+      while (OB_SUCC(ret) && traverse_it != end_it) {
+        if (OB_FAIL(matcher.match((*traverse_it).get_string(), matched))) {
+          LOG_WARN("Failed to match like pattern", K(ret), K(*traverse_it));
+        } else if (matched) {
+          found = true;
+          ref_bitset->set(dict_ref);
+        }
+        ++traverse_it;
+        ++dict_ref;
+      }
+      if (OB_SUCC(ret) && found
+          && OB_FAIL(set_res_with_bitset(parent, col_ctx, ref_bitset, result_bitmap))) {
+        LOG_WARN("Failed to set result_bitmap", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObRLEDecoder::set_res_with_bitset(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
@@ -61,6 +61,14 @@ public:
       const int64_t row_cap,
       int64_t &null_count) const override;
 
+  virtual int get_int_sum(
+      const ObColumnDecoderCtx &ctx,
+      const ObIRowIndex *row_index,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      common::ObDatum *datums,
+      ObEncodingIntSum &sum) const override;
+
   virtual int update_pointer(const char *old_block, const char *cur_block) override;
 
   void reset() { this->~ObRLEDecoder(); new (this) ObRLEDecoder(); }
@@ -108,6 +116,12 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  int like_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
+
   int cmp_ref_and_set_res(
       const sql::ObPushdownFilterExecutor *parent,
       const ObColumnDecoderCtx &col_ctx,
@@ -247,5 +247,138 @@ int ObStringPrefixDecoder::get_null_count(
   return ret;
 }
 
+int ObStringPrefixDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(meta_data);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterLikeMatcher &matcher = filter.get_like_matcher();
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("StringPrefix decoder is not inited", K(ret), K(filter));
+  } else if (OB_UNLIKELY(NULL == row_index
+                         || result_bitmap.size() != col_ctx.micro_block_header_->row_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushdown operator", K(ret), KP(row_index), K(result_bitmap.size()));
+  } else if (sql::WHITE_OP_LI != filter.get_op_type()
+             || filter.null_param_contained()
+             || !matcher.is_inited()
+             || sql::ObWhiteFilterLikeMatcher::PREFIX != matcher.get_mode()
+             || col_ctx.obj_meta_.is_fixed_len_char_type()
+             || meta_header_->count_ > MAX_PREFIX_CNT) {
+    // other filters are evaluated on decoded rows
+    ret = OB_NOT_SUPPORTED;
+  } else if (OB_FAIL(like_prefix_operator(parent, col_ctx, row_index,
+                                          matcher.get_literal(), result_bitmap))) {
+    LOG_WARN("Failed on like prefix operator", K(ret), K(col_ctx));
+  }
+  return ret;
+}
+
+int ObStringPrefixDecoder::like_prefix_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const ObString &literal,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  ObIntegerArrayGenerator meta_gen;
+  if (OB_FAIL(meta_gen.init(meta_data_, meta_header_->prefix_index_byte_))) {
+    LOG_WARN("Failed to init integer array generator", K(ret), KP_(meta_data),
+        "Prefix index byte", meta_header_->prefix_index_byte_);
+  } else {
+    const char *lit = literal.ptr();
+    const int64_t lit_len = literal.length();
+    const char *var_data = meta_data_
+        + (meta_header_->count_ - 1) * meta_header_->prefix_index_byte_;
+    // bytes of prefix known to be equal with literal, and first different position
+    int64_t equal_len[MAX_PREFIX_CNT];
+    int64_t diff_pos[MAX_PREFIX_CNT];
+    for (int64_t i = 0; i < MAX_PREFIX_CNT; ++i) {
+      equal_len[i] = 0;
+      diff_pos[i] = INT64_MAX;
+    }
+    const char *row_data = nullptr;
+    int64_t row_len = 0;
+    const char *cell_data = nullptr;
+    int64_t cell_len = 0;
+    uint64_t ext_val = STORED_NOT_EXT;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      bool matched = false;
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+        LOG_WARN("Failed to locate row data", K(ret), K(row_id));
+      } else if (col_ctx.has_extend_value() && OB_FAIL(ObBitStream::get(
+          reinterpret_cast<const unsigned char *>(row_data),
+          col_ctx.col_header_->extend_value_index_,
+          col_ctx.micro_block_header_->extend_value_bit_,
+          ext_val))) {
+        LOG_WARN("Get extend value from row data failed", K(ret), K(col_ctx));
+      } else if (STORED_NOT_EXT != ext_val) {
+        // null never matches
+      } else if (OB_FAIL(ObRawDecoder::locate_cell_data(cell_data, cell_len, row_data, row_len,
+          *col_ctx.micro_block_header_, *col_ctx.col_header_, *meta_header_))) {
+        LOG_WARN("Failed to locate cell data", K(ret), K(row_id), K(col_ctx));
+      } else {
+        const ObStringPrefixCellHeader *cell_header =
+            reinterpret_cast<const ObStringPrefixCellHeader *>(cell_data);
+        const int64_t ref = cell_header->get_ref();
+        const int64_t cmp_len = std::min(static_cast<int64_t>(cell_header->len_), lit_len);
+        if (diff_pos[ref] < cmp_len) {
+          // differs from literal inside the common part
+        } else {
+          if (equal_len[ref] < cmp_len) {
+            const char *prefix_str = var_data
+                + (0 == ref ? 0 : meta_gen.get_array().at(ref - 1));
+            int64_t pos = equal_len[ref];
+            while (pos < cmp_len && prefix_str[pos] == lit[pos]) {
+              ++pos;
+            }
+            equal_len[ref] = pos;
+            if (pos < cmp_len) {
+              diff_pos[ref] = pos;
+            }
+          }
+          if (equal_len[ref] >= cmp_len) {
+            const int64_t remain_len = lit_len - cmp_len;
+            cell_data += sizeof(ObStringPrefixCellHeader);
+            cell_len -= sizeof(ObStringPrefixCellHeader);
+            if (0 == remain_len) {
+              matched = true;
+            } else if (meta_header_->is_hex_packing()) {
+              if (cell_len * 2 - cell_header->get_odd() >= remain_len) {
+                ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
+                    reinterpret_cast<const unsigned char *>(cell_data));
+                matched = true;
+                for (int64_t i = 0; matched && i < remain_len; ++i) {
+                  matched = static_cast<char>(unpacker.unpack()) == lit[cmp_len + i];
+                }
+              }
+            } else {
+              matched = cell_len >= remain_len
+                  && 0 == MEMCMP(cell_data, lit + cmp_len, remain_len);
+            }
+          }
+        }
+      }
+      if (OB_SUCC(ret) && matched) {
+        if (OB_FAIL(result_bitmap.set(row_id))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
@@ -62,7 +62,24 @@ public:
       const int64_t *row_ids,
       const int64_t row_cap,
       int64_t &null_count) const override;
+  // only like 'abc%' is evaluated on encoded data, compared with each prefix at most once
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+private:
+  int like_prefix_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const common::ObString &literal,
+      ObBitmap &result_bitmap) const;
 private:
+  // ref of cell header only has 4 bits
+  static const int64_t MAX_PREFIX_CNT = 16;
   const ObStringPrefixMetaHeader *meta_header_;
   const char *meta_data_;
 };
@@ -0,0 +1,443 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "storage/blocksstable/ob_block_cache_snapshot.h"
+#include <algorithm>
+#include "lib/checksum/ob_crc64.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/file/ob_file.h"
+#include "share/config/ob_server_config.h"
+#include "storage/blocksstable/ob_block_manager.h"
+#include "storage/blocksstable/ob_macro_block_bare_iterator.h"
+#include "storage/blocksstable/ob_macro_block_handle.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+ObBlockCacheSnapshot::ObBlockCacheSnapshot()
+  : is_inited_(false),
+    data_block_cache_(nullptr),
+    index_block_cache_(nullptr),
+    last_dump_ts_(0)
+{
+  MEMSET(file_path_, 0, sizeof(file_path_));
+}
+
+ObBlockCacheSnapshot::~ObBlockCacheSnapshot()
+{
+  destroy();
+}
+
+int ObBlockCacheSnapshot::init(
+    const char *file_path,
+    ObDataMicroBlockCache &data_block_cache,
+    ObIndexMicroBlockCache &index_block_cache)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_ISNULL(file_path) || OB_UNLIKELY(0 == STRLEN(file_path)
+      || STRLEN(file_path) >= sizeof(file_path_))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(file_path));
+  } else {
+    STRNCPY(file_path_, file_path, sizeof(file_path_) - 1);
+    data_block_cache_ = &data_block_cache;
+    index_block_cache_ = &index_block_cache;
+    last_dump_ts_ = ObTimeUtility::current_time();
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObBlockCacheSnapshot::destroy()
+{
+  lib::ThreadPool::stop();
+  lib::ThreadPool::wait();
+  lib::ThreadPool::destroy();
+  MEMSET(file_path_, 0, sizeof(file_path_));
+  data_block_cache_ = nullptr;
+  index_block_cache_ = nullptr;
+  last_dump_ts_ = 0;
+  is_inited_ = false;
+}
+
+int ObBlockCacheSnapshot::start()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(lib::ThreadPool::start())) {
+    LOG_WARN("fail to start block cache snapshot thread", K(ret));
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::warm_up()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    int tmp_ret = OB_SUCCESS;
+    BlockRecordArray records;
+    const int64_t start_ts = ObTimeUtility::current_time();
+    const int64_t io_rate = GCONF._block_cache_warm_up_io_rate;
+    int64_t read_size = 0;
+    int64_t begin = 0;
+    if (OB_TMP_FAIL(read_file(records))) {
+      if (OB_ENTRY_NOT_EXIST != tmp_ret) {
+        LOG_WARN("fail to read block cache snapshot", K(tmp_ret), K_(file_path));
+      }
+    } else if (records.count() > 0) {
+      std::sort(&records.at(0), &records.at(0) + records.count(),
+          [](const BlockRecord &left, const BlockRecord &right) {
+            return left.macro_first_id_ != right.macro_first_id_
+                ? left.macro_first_id_ < right.macro_first_id_
+                : (left.macro_second_id_ != right.macro_second_id_
+                    ? left.macro_second_id_ < right.macro_second_id_
+                    : (left.macro_third_id_ != right.macro_third_id_
+                        ? left.macro_third_id_ < right.macro_third_id_
+                        : left.offset_ < right.offset_));
+          });
+    }
+    while (begin < records.count()
+        && !has_set_stop()
+        && ObTimeUtility::current_time() - start_ts < WARM_UP_TIMEOUT_US) {
+      const MacroBlockId macro_id = records.at(begin).get_macro_id();
+      int64_t end = begin + 1;
+      int64_t macro_read_size = 0;
+      while (end < records.count() && records.at(end).get_macro_id() == macro_id) {
+        ++end;
+      }
+      if (OB_TMP_FAIL(load_macro_block(records, begin, end, macro_read_size))) {
+        LOG_WARN("fail to load macro block, skip it", K(tmp_ret), K(macro_id));
+      }
+      read_size += macro_read_size;
+      // throttle by io rate, and wake up in time when stopped
+      const int64_t wake_ts = start_ts + MIN(read_size * 1000L * 1000L / io_rate, WARM_UP_TIMEOUT_US);
+      int64_t cur_ts = ObTimeUtility::current_time();
+      while (cur_ts < wake_ts && !has_set_stop()) {
+        ob_usleep(static_cast<useconds_t>(MIN(wake_ts - cur_ts, CHECK_STOP_INTERVAL_US)));
+        cur_ts = ObTimeUtility::current_time();
+      }
+      begin = end;
+    }
+    LOG_INFO("finish warming up block cache", K_(file_path), "block_cnt", records.count(),
+        "loaded_block_cnt", begin, K(read_size), "cost_us", ObTimeUtility::current_time() - start_ts);
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::dump()
+{
+  int ret = OB_SUCCESS;
+  BlockRecordArray records;
+  const int64_t start_ts = ObTimeUtility::current_time();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(collect(INDEX_BLOCK_CACHE, *index_block_cache_, records))) {
+    LOG_WARN("fail to collect index block cache", K(ret));
+  } else if (OB_FAIL(collect(DATA_BLOCK_CACHE, *data_block_cache_, records))) {
+    LOG_WARN("fail to collect data block cache", K(ret));
+  } else if (OB_FAIL(write_file(records))) {
+    LOG_WARN("fail to write block cache snapshot", K(ret), K_(file_path));
+  } else {
+    LOG_INFO("dump block cache snapshot", K_(file_path), "block_cnt", records.count(),
+        "cost_us", ObTimeUtility::current_time() - start_ts);
+  }
+  return ret;
+}
+
+void ObBlockCacheSnapshot::run1()
+{
+  int ret = OB_SUCCESS;
+  lib::set_thread_name("BlkCacheSnap");
+  if (OB_FAIL(warm_up())) {
+    LOG_WARN("fail to warm up block cache", K(ret));
+  }
+  // blocks loaded by warm up are not hot yet, count dump interval from now
+  last_dump_ts_ = ObTimeUtility::current_time();
+  while (!has_set_stop()) {
+    if (ObTimeUtility::current_time() - last_dump_ts_ >= DUMP_INTERVAL_US) {
+      if (OB_FAIL(dump())) {
+        LOG_WARN("fail to dump block cache snapshot", K(ret));
+      }
+      last_dump_ts_ = ObTimeUtility::current_time();
+    }
+    ob_usleep(1000L * 1000L);
+  }
+}
+
+int ObBlockCacheSnapshot::collect(
+    const CacheType cache_type,
+    ObDataMicroBlockCache &cache,
+    BlockRecordArray &records)
+{
+  int ret = OB_SUCCESS;
+  // min heap of get count, keeps the most frequently got micro blocks
+  struct GetCntCmp
+  {
+    bool operator()(const BlockRecord &left, const BlockRecord &right) const
+    {
+      return left.get_cnt_ > right.get_cnt_;
+    }
+  } cmp;
+  BlockRecordArray heap;
+  ObKVCacheIterator iter;
+  if (OB_FAIL(cache.get_iterator(iter))) {
+    LOG_WARN("fail to get cache iterator", K(ret));
+  }
+  while (OB_SUCC(ret)) {
+    const ObMicroBlockCacheKey *key = nullptr;
+    const ObMicroBlockCacheValue *value = nullptr;
+    ObKVCacheHandle handle;
+    int64_t get_cnt = 0;
+    if (OB_FAIL(iter.get_next_kvpair(key, value, handle, get_cnt))) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("fail to get next kvpair", K(ret));
+      }
+    } else if (get_cnt <= 1) {
+      // never got since put into cache
+    } else if (heap.count() >= MAX_BLOCK_CNT_PER_CACHE && get_cnt <= heap.at(0).get_cnt_) {
+    } else {
+      BlockRecord record;
+      const ObMicroBlockId &block_id = key->get_micro_block_id();
+      record.tenant_id_ = key->get_tenant_id();
+      record.macro_first_id_ = block_id.macro_id_.first_id();
+      record.macro_second_id_ = block_id.macro_id_.second_id();
+      record.macro_third_id_ = block_id.macro_id_.third_id();
+      record.offset_ = block_id.offset_;
+      record.size_ = block_id.size_;
+      record.cache_type_ = cache_type;
+      record.get_cnt_ = get_cnt;
+      if (heap.count() >= MAX_BLOCK_CNT_PER_CACHE) {
+        std::pop_heap(&heap.at(0), &heap.at(0) + heap.count(), cmp);
+        heap.at(heap.count() - 1) = record;
+      } else if (OB_FAIL(heap.push_back(record))) {
+        LOG_WARN("fail to push back record", K(ret), K(record));
+      }
+      if (OB_SUCC(ret)) {
+        std::push_heap(&heap.at(0), &heap.at(0) + heap.count(), cmp);
+      }
+    }
+  }
+  if (OB_ITER_END == ret) {
+    ret = OB_SUCCESS;
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < heap.count(); ++i) {
+    if (OB_FAIL(records.push_back(heap.at(i)))) {
+      LOG_WARN("fail to push back record", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::write_file(const BlockRecordArray &records)
+{
+  int ret = OB_SUCCESS;
+  char tmp_path[OB_MAX_FILE_NAME_LENGTH + 8] = {0};
+  FileHeader header;
+  const int64_t records_size = records.count() * static_cast<int64_t>(sizeof(BlockRecord));
+  const char *records_buf = records.count() > 0 ? reinterpret_cast<const char *>(&records.at(0)) : nullptr;
+  int fd = -1;
+  header.magic_ = FileHeader::SNAPSHOT_MAGIC;
+  header.version_ = FileHeader::SNAPSHOT_VERSION;
+  header.block_cnt_ = records.count();
+  header.checksum_ = records_size > 0 ? static_cast<int64_t>(ob_crc64(records_buf, records_size)) : 0;
+  header.dump_ts_ = ObTimeUtility::current_time();
+  snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", file_path_);
+  if ((fd = ::open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to create snapshot file", K(ret), K(tmp_path), KERRMSG);
+  } else if (static_cast<int64_t>(sizeof(header)) != unintr_write(fd, &header, sizeof(header))) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to write snapshot header", K(ret), K(tmp_path), KERRMSG);
+  } else if (records_size > 0 && records_size != unintr_write(fd, records_buf, records_size)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to write snapshot records", K(ret), K(tmp_path), K(records_size), KERRMSG);
+  } else if (0 != ::fsync(fd)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to fsync snapshot file", K(ret), K(tmp_path), KERRMSG);
+  }
+  if (fd >= 0 && 0 != ::close(fd)) {
+    ret = OB_SUCC(ret) ? OB_IO_ERROR : ret;
+    LOG_WARN("fail to close snapshot file", K(ret), K(tmp_path), KERRMSG);
+  }
+  if (OB_SUCC(ret) && 0 != ::rename(tmp_path, file_path_)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to rename snapshot file", K(ret), K(tmp_path), K_(file_path), KERRMSG);
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::read_file(BlockRecordArray &records)
+{
+  int ret = OB_SUCCESS;
+  bool is_exist = false;
+  int64_t file_size = 0;
+  FileHeader header;
+  int fd = -1;
+  records.reset();
+  if (OB_FAIL(FileDirectoryUtils::is_exists(file_path_, is_exist))) {
+    LOG_WARN("fail to check snapshot file", K(ret), K_(file_path));
+  } else if (!is_exist) {
+    ret = OB_ENTRY_NOT_EXIST;
+    LOG_INFO("block cache snapshot not exist", K_(file_path));
+  } else if (OB_FAIL(FileDirectoryUtils::get_file_size(file_path_, file_size))) {
+    LOG_WARN("fail to get snapshot file size", K(ret), K_(file_path));
+  } else if ((fd = ::open(file_path_, O_RDONLY)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to open snapshot file", K(ret), K_(file_path), KERRMSG);
+  } else if (static_cast<int64_t>(sizeof(header)) != unintr_pread(fd, &header, sizeof(header), 0)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to read snapshot header", K(ret), K_(file_path), KERRMSG);
+  } else if (OB_UNLIKELY(!header.is_valid()
+      || file_size != static_cast<int64_t>(sizeof(header) + header.block_cnt_ * sizeof(BlockRecord)))) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid snapshot file", K(ret), K_(file_path), K(header), K(file_size));
+  } else if (0 == header.block_cnt_) {
+  } else if (OB_FAIL(records.prepare_allocate(header.block_cnt_))) {
+    LOG_WARN("fail to allocate records", K(ret), K(header));
+  } else {
+    const int64_t records_size = header.block_cnt_ * static_cast<int64_t>(sizeof(BlockRecord));
+    char *records_buf = reinterpret_cast<char *>(&records.at(0));
+    if (records_size != unintr_pread(fd, records_buf, records_size, sizeof(header))) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("fail to read snapshot records", K(ret), K_(file_path), KERRMSG);
+    } else if (header.checksum_ != static_cast<int64_t>(ob_crc64(records_buf, records_size))) {
+      ret = OB_CHECKSUM_ERROR;
+      LOG_WARN("snapshot file checksum error", K(ret), K_(file_path), K(header));
+    }
+  }
+  if (fd >= 0 && 0 != ::close(fd)) {
+    LOG_WARN("fail to close snapshot file", K_(file_path), KERRMSG);
+  }
+  if (OB_FAIL(ret)) {
+    records.reset();
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::load_macro_block(
+    const BlockRecordArray &records,
+    const int64_t begin,
+    const int64_t end,
+    int64_t &read_size)
+{
+  int ret = OB_SUCCESS;
+  const MacroBlockId macro_id = records.at(begin).get_macro_id();
+  bool is_free = false;
+  read_size = 0;
+  if (OB_FAIL(OB_SERVER_BLOCK_MGR.check_macro_block_free(macro_id, is_free))) {
+    LOG_WARN("fail to check macro block free", K(ret), K(macro_id));
+  } else if (is_free) {
+    // freed since the snapshot
+  } else {
+    // keeps encrypt key of des meta
+    ObSSTableMacroBlockHeader macro_header;
+    ObMicroBlockDesMeta des_meta;
+    // macro block header is read with the micro blocks near it
+    int64_t io_begin = 0;
+    int64_t io_end = MAX_READ_GAP_SIZE;
+    int64_t first = begin;
+    do {
+      int64_t last = first;
+      while (last < end && records.at(last).offset_ <= io_end + MAX_READ_GAP_SIZE) {
+        io_end = MAX(io_end, records.at(last).offset_ + records.at(last).size_);
+        ++last;
+      }
+      ObMacroBlockHandle macro_handle;
+      ObMacroBlockReadInfo read_info;
+      read_info.macro_block_id_ = macro_id;
+      read_info.offset_ = io_begin;
+      read_info.size_ = io_end - io_begin;
+      read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+      read_info.io_desc_.set_group_id(ObIOModule::MICRO_BLOCK_CACHE_IO);
+      if (OB_FAIL(ObBlockManager::read_block(read_info, macro_handle))) {
+        LOG_WARN("fail to read macro block", K(ret), K(read_info));
+      } else if (FALSE_IT(read_size += read_info.size_)) {
+      } else if (0 == io_begin) {
+        ObMicroBlockBareIterator micro_iter;
+        if (OB_FAIL(micro_iter.open(macro_handle.get_buffer(), macro_handle.get_data_size(),
+            false /* need_check_data_integrity */, false /* need_deserialize */))) {
+          LOG_WARN("fail to open macro block", K(ret), K(macro_id));
+        } else if (OB_FAIL(micro_iter.get_macro_block_header(macro_header))) {
+          LOG_WARN("fail to get macro block header", K(ret), K(macro_id));
+        } else {
+          des_meta.compressor_type_ = macro_header.fixed_header_.compressor_type_;
+          des_meta.encrypt_id_ = macro_header.fixed_header_.encrypt_id_;
+          des_meta.master_key_id_ = macro_header.fixed_header_.master_key_id_;
+          des_meta.encrypt_key_ = macro_header.fixed_header_.encrypt_key_;
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(load_blocks(records, first, last, des_meta,
+          macro_handle.get_buffer(), io_begin))) {
+        LOG_WARN("fail to load micro blocks", K(ret), K(macro_id));
+      } else if (last < end) {
+        io_begin = records.at(last).offset_;
+        io_end = io_begin + records.at(last).size_;
+      }
+      first = last;
+    } while (OB_SUCC(ret) && first < end);
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::load_blocks(
+    const BlockRecordArray &records,
+    const int64_t begin,
+    const int64_t end,
+    const ObMicroBlockDesMeta &des_meta,
+    const char *buf,
+    const int64_t buf_offset)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = begin; OB_SUCC(ret) && i < end; ++i) {
+    const BlockRecord &record = records.at(i);
+    ObIMicroBlockCache *cache = get_cache(record.cache_type_);
+    int tmp_ret = OB_SUCCESS;
+    if (OB_ISNULL(cache)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid cache type", K(ret), K(record));
+    } else if (OB_TMP_FAIL(cache->put_block(record.tenant_id_, record.get_macro_id(), des_meta,
+        buf + record.offset_ - buf_offset, record.offset_, record.size_))) {
+      // tenant may be dropped, go on with other micro blocks
+      LOG_WARN("fail to put micro block", K(tmp_ret), K(record));
+    }
+  }
+  return ret;
+}
+
+ObIMicroBlockCache *ObBlockCacheSnapshot::get_cache(const int32_t cache_type)
+{
+  ObIMicroBlockCache *cache = nullptr;
+  if (DATA_BLOCK_CACHE == cache_type) {
+    cache = data_block_cache_;
+  } else if (INDEX_BLOCK_CACHE == cache_type) {
+    cache = index_block_cache_;
+  }
+  return cache;
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
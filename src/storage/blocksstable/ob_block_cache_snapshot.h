@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_BLOCK_CACHE_SNAPSHOT_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_BLOCK_CACHE_SNAPSHOT_H_
+
+#include "lib/container/ob_array.h"
+#include "lib/thread/thread_pool.h"
+#include "ob_micro_block_cache.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Snapshot of hot micro blocks in data and index block cache, used to warm up the caches
+// after restart.
+//
+// A background thread first reads the recorded micro blocks back into caches with limited
+// io bandwidth, then records the most frequently got micro blocks of each cache to a local
+// file periodically. Warming up does not block server startup and stops with the thread.
+// Micro blocks are read by macro block, so the des meta is parsed from macro block header
+// and nearby micro blocks share one io. Macro blocks freed since the snapshot are skipped.
+class ObBlockCacheSnapshot : public lib::ThreadPool
+{
+public:
+  ObBlockCacheSnapshot();
+  virtual ~ObBlockCacheSnapshot();
+  int init(
+      const char *file_path,
+      ObDataMicroBlockCache &data_block_cache,
+      ObIndexMicroBlockCache &index_block_cache);
+  void destroy();
+  bool is_inited() const { return is_inited_; }
+  // Start the background thread, which warms up caches then dumps snapshot periodically.
+  virtual int start() override;
+  // Load the snapshot into caches, returns early once the thread is stopped.
+  int warm_up();
+  int dump();
+  virtual void run1() override;
+  TO_STRING_KV(K_(is_inited), K_(file_path), K_(last_dump_ts));
+
+private:
+  enum CacheType
+  {
+    DATA_BLOCK_CACHE = 0,
+    INDEX_BLOCK_CACHE = 1,
+    MAX_CACHE_TYPE
+  };
+  struct FileHeader
+  {
+    static const int32_t SNAPSHOT_MAGIC = 0x42435353; // "BCSS"
+    static const int32_t SNAPSHOT_VERSION = 1;
+    FileHeader() { MEMSET(this, 0, sizeof(*this)); }
+    bool is_valid() const
+    {
+      return SNAPSHOT_MAGIC == magic_ && SNAPSHOT_VERSION == version_ && block_cnt_ >= 0;
+    }
+    TO_STRING_KV(K_(magic), K_(version), K_(block_cnt), K_(checksum), K_(dump_ts));
+    int32_t magic_;
+    int32_t version_;
+    int64_t block_cnt_;
+    int64_t checksum_;
+    int64_t dump_ts_;
+  };
+  struct BlockRecord
+  {
+    BlockRecord() { MEMSET(this, 0, sizeof(*this)); }
+    MacroBlockId get_macro_id() const
+    {
+      return MacroBlockId(macro_first_id_, macro_second_id_, macro_third_id_);
+    }
+    TO_STRING_KV(K_(tenant_id), K_(macro_first_id), K_(macro_second_id), K_(macro_third_id),
+        K_(offset), K_(size), K_(cache_type), K_(get_cnt));
+    uint64_t tenant_id_;
+    int64_t macro_first_id_;
+    int64_t macro_second_id_;
+    int64_t macro_third_id_;
+    int32_t offset_;
+    int32_t size_;
+    int32_t cache_type_;
+    int32_t reserved_;
+    int64_t get_cnt_;
+  };
+  typedef common::ObArray<BlockRecord> BlockRecordArray;
+
+  static const int64_t DUMP_INTERVAL_US = 10L * 60L * 1000L * 1000L; // 10min
+  static const int64_t WARM_UP_TIMEOUT_US = 10L * 60L * 1000L * 1000L; // 10min
+  static const int64_t CHECK_STOP_INTERVAL_US = 100L * 1000L; // 100ms
+  static const int64_t MAX_BLOCK_CNT_PER_CACHE = 256L * 1024L;
+  // micro blocks in one macro block farther than this are read by different io
+  static const int64_t MAX_READ_GAP_SIZE = 64L * 1024L;
+
+  int collect(
+      const CacheType cache_type,
+      ObDataMicroBlockCache &cache,
+      BlockRecordArray &records);
+  int write_file(const BlockRecordArray &records);
+  int read_file(BlockRecordArray &records);
+  // Load records[begin, end) of the same macro block, which are sorted by offset.
+  int load_macro_block(
+      const BlockRecordArray &records,
+      const int64_t begin,
+      const int64_t end,
+      int64_t &read_size);
+  int load_blocks(
+      const BlockRecordArray &records,
+      const int64_t begin,
+      const int64_t end,
+      const ObMicroBlockDesMeta &des_meta,
+      const char *buf,
+      const int64_t buf_offset);
+  ObIMicroBlockCache *get_cache(const int32_t cache_type);
+
+private:
+  bool is_inited_;
+  char file_path_[common::OB_MAX_FILE_NAME_LENGTH];
+  ObDataMicroBlockCache *data_block_cache_;
+  ObIndexMicroBlockCache *index_block_cache_;
+  int64_t last_dump_ts_;
+  DISALLOW_COPY_AND_ASSIGN(ObBlockCacheSnapshot);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_BLOCK_CACHE_SNAPSHOT_H_
@@ -294,6 +294,8 @@ struct ObColumnHeader
     STRING_PREFIX,
     COLUMN_EQUAL,
     COLUMN_SUBSTR,
+    INTEGER_DELTA,
+    FLOAT_DECIMAL,
     MAX_TYPE
   };
 
@@ -195,6 +195,17 @@ int ObIMicroBlockReader::filter_white_filter(
         }
         break;
       }
+      case sql::WHITE_OP_LI: {
+        bool matched = false;
+        if (filter.null_param_contained() || obj.is_null()) {
+          // Result of like with null is null
+        } else if (OB_FAIL(filter.get_like_matcher().match(obj.get_string(), matched))) {
+          LOG_WARN("Failed to match like pattern", K(ret), K(obj));
+        } else if (matched) {
+          filtered = false;
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Unexpected filter pushdown operation type", K(ret), K(op_type));
@@ -49,6 +49,7 @@ void ObMicroBlockDesc::reset()
   has_lob_out_row_ = false;
   original_size_ = 0;
   is_last_row_last_flag_ = false;
+  skip_index_.reset();
 }
 
  /**
@@ -22,6 +22,7 @@
 #include "ob_macro_block_id.h"
 #include "ob_micro_block_hash_index.h"
 #include "ob_micro_block_header.h"
+#include "ob_index_block_aggregator.h"
 
 namespace oceanbase
 {
@@ -48,6 +49,7 @@ struct ObMicroBlockDesc
   bool has_string_out_row_;
   bool has_lob_out_row_;
   bool is_last_row_last_flag_;
+  ObSkipIndexData skip_index_; // aggregated data of rows in micro block, points to writer memory
 
   ObMicroBlockDesc() { reset(); }
   bool is_valid() const;
@@ -72,6 +74,7 @@ struct ObMicroBlockDesc
       K_(has_string_out_row),
       K_(has_lob_out_row),
       K_(is_last_row_last_flag),
+      K_(skip_index),
       K_(original_size));
 };
 enum MICRO_BLOCK_MERGE_VERIFY_LEVEL
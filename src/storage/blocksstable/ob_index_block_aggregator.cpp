@@ -0,0 +1,696 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_index_block_aggregator.h"
+#include "ob_macro_block.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
+#include "storage/access/ob_table_read_info.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+namespace blocksstable
+{
+
+enum ObSkipIndexValueClass
+{
+  SKIP_INDEX_INT = 0,
+  SKIP_INDEX_UINT = 1,
+  SKIP_INDEX_DOUBLE = 2,
+  SKIP_INDEX_INVALID = 3,
+};
+
+static OB_INLINE ObSkipIndexValueClass get_value_class(const ObObjType type)
+{
+  ObSkipIndexValueClass value_class = SKIP_INDEX_INVALID;
+  switch (ob_obj_type_class(type)) {
+    case ObIntTC:
+    case ObDateTimeTC:
+    case ObDateTC:
+    case ObTimeTC: {
+      value_class = SKIP_INDEX_INT;
+      break;
+    }
+    case ObUIntTC: {
+      value_class = SKIP_INDEX_UINT;
+      break;
+    }
+    case ObFloatTC:
+    case ObDoubleTC: {
+      value_class = SKIP_INDEX_DOUBLE;
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+  return value_class;
+}
+
+static int value_to_obj(const ObObjType type, const ObSkipIndexColMeta::Value &value, ObObj &obj)
+{
+  int ret = OB_SUCCESS;
+  switch (ob_obj_type_class(type)) {
+    case ObIntTC: {
+      obj.set_int(type, value.int_);
+      break;
+    }
+    case ObUIntTC: {
+      obj.set_uint(type, value.uint_);
+      break;
+    }
+    case ObFloatTC: {
+      obj.set_float(type, static_cast<float>(value.double_));
+      break;
+    }
+    case ObDoubleTC: {
+      obj.set_double(type, value.double_);
+      break;
+    }
+    case ObDateTimeTC: {
+      obj.set_datetime(type, value.int_);
+      break;
+    }
+    case ObDateTC: {
+      obj.set_date(static_cast<int32_t>(value.int_));
+      break;
+    }
+    case ObTimeTC: {
+      obj.set_time(value.int_);
+      break;
+    }
+    default: {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("Unsupported skip index column type", K(ret), K(type));
+    }
+  }
+  return ret;
+}
+
+/**
+ * -------------------------------------------------------------------ObSkipIndexColMeta-------------------------------------------------------------------
+ */
+int ObSkipIndexColMeta::get_min_obj(ObObj &obj) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!has_min_max())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Skip index column has no min/max", K(ret), KPC(this));
+  } else if (OB_FAIL(value_to_obj(get_obj_type(), min_, obj))) {
+    LOG_WARN("Fail to get min obj", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+int ObSkipIndexColMeta::get_max_obj(ObObj &obj) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!has_min_max())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Skip index column has no min/max", K(ret), KPC(this));
+  } else if (OB_FAIL(value_to_obj(get_obj_type(), max_, obj))) {
+    LOG_WARN("Fail to get max obj", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+DEFINE_SERIALIZE(ObSkipIndexColMeta)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_len <= 0 || pos < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i16(buf, buf_len, pos, col_idx_))) {
+    LOG_WARN("fail to encode col idx", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i8(buf, buf_len, pos, obj_type_))) {
+    LOG_WARN("fail to encode obj type", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i8(buf, buf_len, pos, flag_))) {
+    LOG_WARN("fail to encode flag", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, null_count_))) {
+    LOG_WARN("fail to encode null count", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, min_.int_))) {
+    LOG_WARN("fail to encode min", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, max_.int_))) {
+    LOG_WARN("fail to encode max", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_i64(buf, buf_len, pos, sum_.int_))) {
+    LOG_WARN("fail to encode sum", K(ret), K(buf_len), K(pos));
+  }
+  return ret;
+}
+
+DEFINE_DESERIALIZE(ObSkipIndexColMeta)
+{
+  int ret = OB_SUCCESS;
+  int16_t col_idx = 0;
+  int8_t obj_type = 0;
+  int8_t flag = 0;
+  reset();
+  if (OB_ISNULL(buf) || OB_UNLIKELY(data_len <= 0 || pos < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i16(buf, data_len, pos, &col_idx))) {
+    LOG_WARN("fail to decode col idx", K(ret), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i8(buf, data_len, pos, &obj_type))) {
+    LOG_WARN("fail to decode obj type", K(ret), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i8(buf, data_len, pos, &flag))) {
+    LOG_WARN("fail to decode flag", K(ret), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &null_count_))) {
+    LOG_WARN("fail to decode null count", K(ret), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &min_.int_))) {
+    LOG_WARN("fail to decode min", K(ret), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &max_.int_))) {
+    LOG_WARN("fail to decode max", K(ret), K(data_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_i64(buf, data_len, pos, &sum_.int_))) {
+    LOG_WARN("fail to decode sum", K(ret), K(data_len), K(pos));
+  } else {
+    col_idx_ = static_cast<uint16_t>(col_idx);
+    obj_type_ = static_cast<uint8_t>(obj_type);
+    flag_ = static_cast<uint8_t>(flag);
+  }
+  return ret;
+}
+
+DEFINE_GET_SERIALIZE_SIZE(ObSkipIndexColMeta)
+{
+  int64_t len = 0;
+  len += serialization::encoded_length_i16(col_idx_);
+  len += serialization::encoded_length_i8(obj_type_);
+  len += serialization::encoded_length_i8(flag_);
+  len += serialization::encoded_length_i64(null_count_);
+  len += serialization::encoded_length_i64(min_.int_);
+  len += serialization::encoded_length_i64(max_.int_);
+  len += serialization::encoded_length_i64(sum_.int_);
+  return len;
+}
+
+/**
+ * -------------------------------------------------------------------ObSkipIndexData-------------------------------------------------------------------
+ */
+bool ObSkipIndexData::find(const int64_t col_idx, ObSkipIndexColMeta &col_meta) const
+{
+  bool found = false;
+  uint16_t meta_col_idx = 0;
+  for (int64_t i = 0; !found && i < col_cnt_; ++i) {
+    const char *meta_buf = col_metas_buf_ + i * sizeof(ObSkipIndexColMeta);
+    MEMCPY(&meta_col_idx, meta_buf + offsetof(ObSkipIndexColMeta, col_idx_), sizeof(meta_col_idx));
+    if (col_idx == meta_col_idx) {
+      get_col_meta(i, col_meta);
+      found = true;
+    }
+  }
+  return found;
+}
+
+/**
+ * -------------------------------------------------------------------ObSkipIndexAggregator-------------------------------------------------------------------
+ */
+ObSkipIndexAggregator::ObSkipIndexAggregator()
+  : col_cnt_(0),
+    eval_cnt_(0),
+    from_data_row_(false),
+    is_aggregated_(true),
+    is_inited_(false)
+{
+}
+
+void ObSkipIndexAggregator::reset()
+{
+  col_cnt_ = 0;
+  eval_cnt_ = 0;
+  from_data_row_ = false;
+  is_aggregated_ = true;
+  is_inited_ = false;
+}
+
+void ObSkipIndexAggregator::reuse()
+{
+  for (int64_t i = 0; i < col_cnt_; ++i) {
+    const uint16_t col_idx = col_metas_[i].col_idx_;
+    const uint8_t obj_type = col_metas_[i].obj_type_;
+    col_metas_[i].reset();
+    col_metas_[i].col_idx_ = col_idx;
+    col_metas_[i].obj_type_ = obj_type;
+    col_valid_[i] = true;
+  }
+  if (!from_data_row_) {
+    // columns of index levels are adopted from children again
+    col_cnt_ = 0;
+  }
+  eval_cnt_ = 0;
+  is_aggregated_ = true;
+}
+
+bool ObSkipIndexAggregator::is_type_supported(const ObObjType type)
+{
+  return SKIP_INDEX_INVALID != get_value_class(type);
+}
+
+int ObSkipIndexAggregator::init(const ObDataStoreDesc &data_desc)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObSkipIndexAggregator init twice", K(ret));
+  } else if (OB_UNLIKELY(!data_desc.is_valid() || !data_desc.is_major_merge()
+      || data_desc.skip_index_max_col_cnt_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid data store desc to build skip index", K(ret), K(data_desc));
+  } else {
+    const ObIArray<share::schema::ObColDesc> &col_descs = data_desc.get_full_stored_col_descs();
+    const int64_t trans_col_idx = data_desc.schema_rowkey_col_cnt_;
+    const int64_t sql_seq_col_idx = data_desc.schema_rowkey_col_cnt_ + 1;
+    const int64_t max_col_cnt = MIN(data_desc.skip_index_max_col_cnt_, MAX_SKIP_INDEX_COL_CNT);
+    col_cnt_ = 0;
+    for (int64_t i = 0; i < col_descs.count() && col_cnt_ < max_col_cnt; ++i) {
+      const ObObjType type = col_descs.at(i).col_type_.get_type();
+      if (trans_col_idx == i || sql_seq_col_idx == i || !is_type_supported(type)) {
+        // skip multi-version columns and unsupported types
+      } else {
+        col_metas_[col_cnt_].reset();
+        col_metas_[col_cnt_].col_idx_ = static_cast<uint16_t>(i);
+        col_metas_[col_cnt_].obj_type_ = static_cast<uint8_t>(type);
+        col_valid_[col_cnt_] = true;
+        ++col_cnt_;
+      }
+    }
+    eval_cnt_ = 0;
+    from_data_row_ = true;
+    is_aggregated_ = true;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::init()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("ObSkipIndexAggregator init twice", K(ret));
+  } else {
+    col_cnt_ = 0;
+    eval_cnt_ = 0;
+    from_data_row_ = false;
+    is_aggregated_ = true;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::eval(const ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObSkipIndexAggregator not inited", K(ret));
+  } else if (OB_UNLIKELY(!from_data_row_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Index level aggregator can not eval data row", K(ret), KPC(this));
+  } else if (!is_aggregated_ || row.row_flag_.is_delete()) {
+    // deleted rows are not visible, no need to aggregate
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      const int64_t col_idx = col_metas_[i].col_idx_;
+      if (!col_valid_[i]) {
+      } else if (OB_UNLIKELY(col_idx >= row.get_column_count())) {
+        col_valid_[i] = false;
+      } else if (OB_FAIL(eval_datum(row.storage_datums_[col_idx], i))) {
+        LOG_WARN("Fail to eval datum", K(ret), K(i), K(col_idx), K(row));
+      }
+    }
+    ++eval_cnt_;
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::eval_datum(const ObStorageDatum &datum, const int64_t idx)
+{
+  int ret = OB_SUCCESS;
+  ObSkipIndexColMeta &col_meta = col_metas_[idx];
+  if (datum.is_nop()) {
+    // real value is the column default which we do not know here
+    col_valid_[idx] = false;
+  } else if (datum.is_null()) {
+    ++col_meta.null_count_;
+  } else {
+    const ObObjType type = col_meta.get_obj_type();
+    const bool is_first = !col_meta.has_min_max();
+    switch (get_value_class(type)) {
+      case SKIP_INDEX_INT: {
+        const int64_t v = ObDateTC == ob_obj_type_class(type) ? datum.get_date() : datum.get_int();
+        col_meta.min_.int_ = (is_first || v < col_meta.min_.int_) ? v : col_meta.min_.int_;
+        col_meta.max_.int_ = (is_first || v > col_meta.max_.int_) ? v : col_meta.max_.int_;
+        if (ObIntTC != ob_obj_type_class(type)) {
+        } else if (is_first) {
+          col_meta.sum_.int_ = v;
+          col_meta.flag_ |= ObSkipIndexColMeta::HAS_SUM;
+        } else if (col_meta.has_sum() && __builtin_add_overflow(col_meta.sum_.int_, v, &col_meta.sum_.int_)) {
+          col_meta.flag_ &= ~ObSkipIndexColMeta::HAS_SUM;
+        }
+        break;
+      }
+      case SKIP_INDEX_UINT: {
+        const uint64_t v = datum.get_uint64();
+        col_meta.min_.uint_ = (is_first || v < col_meta.min_.uint_) ? v : col_meta.min_.uint_;
+        col_meta.max_.uint_ = (is_first || v > col_meta.max_.uint_) ? v : col_meta.max_.uint_;
+        if (is_first) {
+          col_meta.sum_.uint_ = v;
+          col_meta.flag_ |= ObSkipIndexColMeta::HAS_SUM;
+        } else if (col_meta.has_sum() && __builtin_add_overflow(col_meta.sum_.uint_, v, &col_meta.sum_.uint_)) {
+          col_meta.flag_ &= ~ObSkipIndexColMeta::HAS_SUM;
+        }
+        break;
+      }
+      case SKIP_INDEX_DOUBLE: {
+        const double v = ObFloatTC == ob_obj_type_class(type) ? datum.get_float() : datum.get_double();
+        if (OB_UNLIKELY(std::isnan(v))) {
+          col_valid_[idx] = false;
+        } else {
+          col_meta.min_.double_ = (is_first || v < col_meta.min_.double_) ? v : col_meta.min_.double_;
+          col_meta.max_.double_ = (is_first || v > col_meta.max_.double_) ? v : col_meta.max_.double_;
+          col_meta.sum_.double_ = is_first ? v : col_meta.sum_.double_ + v;
+          col_meta.flag_ |= ObSkipIndexColMeta::HAS_SUM;
+        }
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected skip index column type", K(ret), K(col_meta));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      col_meta.flag_ |= ObSkipIndexColMeta::HAS_MIN_MAX;
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::eval(const ObSkipIndexData &child_data)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObSkipIndexAggregator not inited", K(ret));
+  } else if (OB_UNLIKELY(from_data_row_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Data row aggregator can not eval index data", K(ret), KPC(this));
+  } else if (!is_aggregated_) {
+  } else if (!child_data.is_valid()) {
+    is_aggregated_ = false;
+  } else if (0 == eval_cnt_) {
+    col_cnt_ = MIN(child_data.col_cnt_, MAX_SKIP_INDEX_COL_CNT);
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      child_data.get_col_meta(i, col_metas_[i]);
+      col_valid_[i] = true;
+    }
+    ++eval_cnt_;
+  } else {
+    ObSkipIndexColMeta child;
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      if (!col_valid_[i]) {
+      } else if (!child_data.find(col_metas_[i].col_idx_, child)
+          || child.obj_type_ != col_metas_[i].obj_type_) {
+        col_valid_[i] = false;
+      } else {
+        merge_col_meta(child, i);
+      }
+    }
+    ++eval_cnt_;
+  }
+  return ret;
+}
+
+void ObSkipIndexAggregator::merge_col_meta(const ObSkipIndexColMeta &child, const int64_t idx)
+{
+  ObSkipIndexColMeta &col_meta = col_metas_[idx];
+  col_meta.null_count_ += child.null_count_;
+  if (!child.has_min_max()) {
+    // all null in child
+  } else if (!col_meta.has_min_max()) {
+    col_meta.min_ = child.min_;
+    col_meta.max_ = child.max_;
+    col_meta.sum_ = child.sum_;
+    col_meta.flag_ = child.flag_;
+  } else {
+    const bool has_sum = col_meta.has_sum() && child.has_sum();
+    switch (get_value_class(col_meta.get_obj_type())) {
+      case SKIP_INDEX_INT: {
+        col_meta.min_.int_ = MIN(col_meta.min_.int_, child.min_.int_);
+        col_meta.max_.int_ = MAX(col_meta.max_.int_, child.max_.int_);
+        if (has_sum && !__builtin_add_overflow(col_meta.sum_.int_, child.sum_.int_, &col_meta.sum_.int_)) {
+        } else {
+          col_meta.flag_ &= ~ObSkipIndexColMeta::HAS_SUM;
+        }
+        break;
+      }
+      case SKIP_INDEX_UINT: {
+        col_meta.min_.uint_ = MIN(col_meta.min_.uint_, child.min_.uint_);
+        col_meta.max_.uint_ = MAX(col_meta.max_.uint_, child.max_.uint_);
+        if (has_sum && !__builtin_add_overflow(col_meta.sum_.uint_, child.sum_.uint_, &col_meta.sum_.uint_)) {
+        } else {
+          col_meta.flag_ &= ~ObSkipIndexColMeta::HAS_SUM;
+        }
+        break;
+      }
+      case SKIP_INDEX_DOUBLE: {
+        col_meta.min_.double_ = MIN(col_meta.min_.double_, child.min_.double_);
+        col_meta.max_.double_ = MAX(col_meta.max_.double_, child.max_.double_);
+        if (has_sum) {
+          col_meta.sum_.double_ += child.sum_.double_;
+        } else {
+          col_meta.flag_ &= ~ObSkipIndexColMeta::HAS_SUM;
+        }
+        break;
+      }
+      default: {
+        col_valid_[idx] = false;
+      }
+    }
+  }
+}
+
+int ObSkipIndexAggregator::get_aggregated_data(ObSkipIndexData &agg_data)
+{
+  int ret = OB_SUCCESS;
+  agg_data.reset();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObSkipIndexAggregator not inited", K(ret));
+  } else if (!is_aggregated_ || 0 == eval_cnt_) {
+    // no aggregated data
+  } else {
+    int64_t output_cnt = 0;
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      if (col_valid_[i]) {
+        output_[output_cnt++] = col_metas_[i];
+      }
+    }
+    if (output_cnt > 0) {
+      agg_data = ObSkipIndexData(output_, output_cnt);
+    }
+  }
+  return ret;
+}
+
+/**
+ * -------------------------------------------------------------------ObSkipIndexFilter-------------------------------------------------------------------
+ */
+int ObSkipIndexFilter::check_always_false(
+    sql::ObPushdownFilterExecutor &filter,
+    const ObITableReadInfo &read_info,
+    const ObSkipIndexData &skip_index,
+    const int64_t row_count,
+    bool &always_false)
+{
+  int ret = OB_SUCCESS;
+  always_false = false;
+  if (OB_UNLIKELY(!skip_index.is_valid() || row_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(skip_index), K(row_count));
+  } else if (filter.is_filter_dynamic_node()) {
+    sql::ObDynamicFilterExecutor &dynamic_filter = static_cast<sql::ObDynamicFilterExecutor &>(filter);
+    if (OB_FAIL(dynamic_filter.prepare_data())) {
+      LOG_WARN("Fail to prepare runtime filter data", K(ret));
+    } else if (dynamic_filter.is_filter_always_false()) {
+      always_false = true;
+    } else if (!dynamic_filter.is_data_prepared()) {
+    } else if (OB_FAIL(check_white_filter(dynamic_filter, read_info, skip_index, row_count, always_false))) {
+      LOG_WARN("Fail to check runtime filter", K(ret));
+    }
+  } else if (filter.is_filter_white_node()) {
+    if (OB_FAIL(check_white_filter(static_cast<const sql::ObWhiteFilterExecutor &>(filter),
+                                   read_info, skip_index, row_count, always_false))) {
+      LOG_WARN("Fail to check white filter", K(ret));
+    }
+  } else if (filter.is_logic_op_node()) {
+    sql::ObPushdownFilterExecutor **children = filter.get_childs();
+    const bool is_and = filter.is_logic_and_node();
+    // AND is false when any child is false, OR is false when all children are false
+    always_false = !is_and;
+    for (uint32_t i = 0; OB_SUCC(ret) && i < filter.get_child_count(); ++i) {
+      bool child_false = false;
+      if (OB_ISNULL(children[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected null child filter", K(ret), K(i));
+      } else if (OB_FAIL(check_always_false(*children[i], read_info, skip_index, row_count, child_false))) {
+        LOG_WARN("Fail to check child filter", K(ret), K(i));
+      } else if (is_and && child_false) {
+        always_false = true;
+        break;
+      } else if (!is_and && !child_false) {
+        always_false = false;
+        break;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexFilter::compare_param(
+    const ObObj &param,
+    const ObObj &value,
+    bool &comparable,
+    int &cmp)
+{
+  int ret = OB_SUCCESS;
+  comparable = false;
+  cmp = 0;
+  if (param.is_null() || ob_obj_type_class(param.get_type()) != ob_obj_type_class(value.get_type())) {
+    // only compare with param of the same type class
+  } else if (OB_FAIL(value.compare(param, cmp))) {
+    LOG_WARN("Fail to compare skip index value", K(ret), K(value), K(param));
+  } else {
+    comparable = true;
+  }
+  return ret;
+}
+
+int ObSkipIndexFilter::check_white_filter(
+    const sql::ObWhiteFilterExecutor &filter,
+    const ObITableReadInfo &read_info,
+    const ObSkipIndexData &skip_index,
+    const int64_t row_count,
+    bool &always_false)
+{
+  int ret = OB_SUCCESS;
+  always_false = false;
+  const ObIArray<int32_t> &col_offsets = filter.get_col_offsets();
+  const ObIArray<ObObj> &params = filter.get_objs();
+  const ObColumnIndexArray &cols_index = read_info.get_columns_index();
+  const ObIArray<share::schema::ObColDesc> &cols_desc = read_info.get_columns_desc();
+  ObSkipIndexColMeta col_meta;
+  int64_t col_idx = -1;
+  if (1 != col_offsets.count()) {
+    // filter params not inited, skip
+  } else if (col_offsets.at(0) < 0 || col_offsets.at(0) >= cols_index.count()
+      || col_offsets.at(0) >= cols_desc.count()) {
+  } else if (FALSE_IT(col_idx = cols_index.at(col_offsets.at(0)))) {
+  } else if (col_idx < 0 || !skip_index.find(col_idx, col_meta)) {
+  } else if (col_meta.get_obj_type() != cols_desc.at(col_offsets.at(0)).col_type_.get_type()) {
+    // column type changed since the skip index was built
+  } else {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    const bool all_null = col_meta.null_count_ >= row_count;
+    if (sql::WHITE_OP_NU == op_type) {
+      always_false = 0 == col_meta.null_count_;
+    } else if (sql::WHITE_OP_NN == op_type) {
+      always_false = all_null;
+    } else if (filter.null_param_contained() || params.count() <= 0) {
+    } else if (all_null) {
+      always_false = true;
+    } else if (!col_meta.has_min_max() || sql::WHITE_OP_LI == op_type) {
+    } else {
+      ObObj min_obj;
+      ObObj max_obj;
+      bool comparable = false;
+      int cmp_min = 0;
+      int cmp_max = 0;
+      if (OB_FAIL(col_meta.get_min_obj(min_obj))) {
+        LOG_WARN("Fail to get min obj", K(ret), K(col_meta));
+      } else if (OB_FAIL(col_meta.get_max_obj(max_obj))) {
+        LOG_WARN("Fail to get max obj", K(ret), K(col_meta));
+      } else if (sql::WHITE_OP_IN == op_type) {
+        // false when every param is out of [min, max]
+        always_false = true;
+        for (int64_t i = 0; OB_SUCC(ret) && always_false && i < params.count(); ++i) {
+          if (OB_FAIL(compare_param(params.at(i), min_obj, comparable, cmp_min))) {
+            LOG_WARN("Fail to compare min", K(ret));
+          } else if (!comparable) {
+            always_false = false;
+          } else if (OB_FAIL(compare_param(params.at(i), max_obj, comparable, cmp_max))) {
+            LOG_WARN("Fail to compare max", K(ret));
+          } else if (!comparable) {
+            always_false = false;
+          } else {
+            always_false = cmp_min > 0 || cmp_max < 0;
+          }
+        }
+      } else if (sql::WHITE_OP_BT == op_type) {
+        if (params.count() < 2) {
+        } else if (OB_FAIL(compare_param(params.at(0), max_obj, comparable, cmp_max))) {
+          LOG_WARN("Fail to compare max", K(ret));
+        } else if (!comparable) {
+        } else if (cmp_max < 0) {
+          always_false = true;
+        } else if (OB_FAIL(compare_param(params.at(1), min_obj, comparable, cmp_min))) {
+          LOG_WARN("Fail to compare min", K(ret));
+        } else if (comparable) {
+          always_false = cmp_min > 0;
+        }
+      } else if (OB_FAIL(compare_param(params.at(0), min_obj, comparable, cmp_min))) {
+        LOG_WARN("Fail to compare min", K(ret));
+      } else if (!comparable) {
+      } else if (OB_FAIL(compare_param(params.at(0), max_obj, comparable, cmp_max))) {
+        LOG_WARN("Fail to compare max", K(ret));
+      } else if (!comparable) {
+      } else {
+        // cmp_min = cmp(min, param), cmp_max = cmp(max, param)
+        switch (op_type) {
+          case sql::WHITE_OP_EQ: {
+            always_false = cmp_min > 0 || cmp_max < 0;
+            break;
+          }
+          case sql::WHITE_OP_NE: {
+            always_false = 0 == cmp_min && 0 == cmp_max;
+            break;
+          }
+          case sql::WHITE_OP_LT: {
+            always_false = cmp_min >= 0;
+            break;
+          }
+          case sql::WHITE_OP_LE: {
+            always_false = cmp_min > 0;
+            break;
+          }
+          case sql::WHITE_OP_GT: {
+            always_false = cmp_max <= 0;
+            break;
+          }
+          case sql::WHITE_OP_GE: {
+            always_false = cmp_max < 0;
+            break;
+          }
+          default: {
+            break;
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
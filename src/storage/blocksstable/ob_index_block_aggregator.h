@@ -0,0 +1,189 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+
+#include "common/object/ob_object.h"
+#include "lib/utility/ob_print_utils.h"
+#include "ob_datum_row.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+class ObPushdownFilterExecutor;
+class ObWhiteFilterExecutor;
+}
+namespace storage
+{
+class ObITableReadInfo;
+}
+namespace blocksstable
+{
+struct ObDataStoreDesc;
+
+// Per-column skip index entry attached to index block rows of major sstable.
+// Fixed size POD, stored right after ObIndexBlockRowHeader in index rows and
+// kept in ObDataBlockMetaVal for macro block level.
+struct ObSkipIndexColMeta
+{
+  static const uint8_t HAS_MIN_MAX = 0x1;
+  static const uint8_t HAS_SUM = 0x2;
+
+  void reset() { MEMSET(this, 0, sizeof(*this)); }
+  OB_INLINE bool has_min_max() const { return 0 != (flag_ & HAS_MIN_MAX); }
+  OB_INLINE bool has_sum() const { return 0 != (flag_ & HAS_SUM); }
+  OB_INLINE common::ObObjType get_obj_type() const { return static_cast<common::ObObjType>(obj_type_); }
+  // construct obj of the column type from the stored min/max
+  int get_min_obj(common::ObObj &obj) const;
+  int get_max_obj(common::ObObj &obj) const;
+
+  NEED_SERIALIZE_AND_DESERIALIZE;
+  TO_STRING_KV(K_(col_idx), K_(obj_type), K_(flag), K_(null_count),
+      K_(min_.int_), K_(max_.int_), K_(sum_.int_));
+
+  union Value
+  {
+    int64_t int_;
+    uint64_t uint_;
+    double double_;
+  };
+  uint16_t col_idx_;        // Store column index in data row
+  uint8_t obj_type_;        // ObObjType of the column
+  uint8_t flag_;
+  uint32_t reserved_;
+  int64_t null_count_;
+  Value min_;
+  Value max_;
+  Value sum_;
+};
+
+// Layout of aggregated data inside an index block row
+struct ObSkipIndexHeader
+{
+  static const uint16_t SKIP_INDEX_HEADER_V1 = 1;
+  OB_INLINE bool is_valid() const { return SKIP_INDEX_HEADER_V1 == version_ && col_cnt_ > 0; }
+  OB_INLINE int64_t get_data_size() const
+  {
+    return sizeof(ObSkipIndexHeader) + col_cnt_ * sizeof(ObSkipIndexColMeta);
+  }
+  // col metas follow the header in index row data, which has no alignment guarantee
+  OB_INLINE const char *get_col_metas_buf() const
+  {
+    return reinterpret_cast<const char *>(this + 1);
+  }
+  TO_STRING_KV(K_(version), K_(col_cnt));
+
+  uint16_t version_;
+  uint16_t col_cnt_;
+  uint32_t reserved_;
+};
+
+// Read-only view of skip index of one index row / macro meta.
+// The buffer may be unaligned when parsed from index row, col metas are always copied out.
+struct ObSkipIndexData
+{
+  ObSkipIndexData() : col_metas_buf_(nullptr), col_cnt_(0) {}
+  ObSkipIndexData(const ObSkipIndexColMeta *col_metas, const int64_t col_cnt)
+    : col_metas_buf_(reinterpret_cast<const char *>(col_metas)), col_cnt_(col_cnt) {}
+  ObSkipIndexData(const char *col_metas_buf, const int64_t col_cnt)
+    : col_metas_buf_(col_metas_buf), col_cnt_(col_cnt) {}
+  OB_INLINE void reset() { col_metas_buf_ = nullptr; col_cnt_ = 0; }
+  OB_INLINE bool is_valid() const { return nullptr != col_metas_buf_ && col_cnt_ > 0; }
+  OB_INLINE int64_t get_data_size() const
+  {
+    return is_valid() ? sizeof(ObSkipIndexHeader) + col_cnt_ * sizeof(ObSkipIndexColMeta) : 0;
+  }
+  OB_INLINE int64_t get_col_metas_size() const { return col_cnt_ * sizeof(ObSkipIndexColMeta); }
+  OB_INLINE void get_col_meta(const int64_t idx, ObSkipIndexColMeta &col_meta) const
+  {
+    MEMCPY(&col_meta, col_metas_buf_ + idx * sizeof(ObSkipIndexColMeta), sizeof(ObSkipIndexColMeta));
+  }
+  bool find(const int64_t col_idx, ObSkipIndexColMeta &col_meta) const;
+  TO_STRING_KV(KP_(col_metas_buf), K_(col_cnt));
+
+  const char *col_metas_buf_;
+  int64_t col_cnt_;
+};
+
+// Accumulates min/max/null count/sum of the chosen columns, from data rows
+// for leaf index rows, or from skip index of children for upper levels.
+class ObSkipIndexAggregator
+{
+public:
+  static const int64_t MAX_SKIP_INDEX_COL_CNT = 64;
+public:
+  ObSkipIndexAggregator();
+  ~ObSkipIndexAggregator() { reset(); }
+  void reset();
+  void reuse();
+  // choose columns from data store desc, used to aggregate data rows
+  int init(const ObDataStoreDesc &data_desc);
+  // columns are adopted from the first child skip index, used by index levels
+  int init();
+  int eval(const ObDatumRow &row);
+  int eval(const ObSkipIndexData &child_data);
+  // child without skip index makes the whole aggregated result unusable
+  void set_not_aggregated() { is_aggregated_ = false; }
+  int get_aggregated_data(ObSkipIndexData &agg_data);
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  OB_INLINE int64_t get_col_cnt() const { return col_cnt_; }
+  static bool is_type_supported(const common::ObObjType type);
+  TO_STRING_KV(K_(is_inited), K_(from_data_row), K_(is_aggregated), K_(eval_cnt), K_(col_cnt));
+
+private:
+  int eval_datum(const ObStorageDatum &datum, const int64_t idx);
+  void merge_col_meta(const ObSkipIndexColMeta &child, const int64_t idx);
+
+private:
+  ObSkipIndexColMeta col_metas_[MAX_SKIP_INDEX_COL_CNT];
+  // invalid columns are skipped when getting aggregated data
+  bool col_valid_[MAX_SKIP_INDEX_COL_CNT];
+  ObSkipIndexColMeta output_[MAX_SKIP_INDEX_COL_CNT];
+  int64_t col_cnt_;
+  int64_t eval_cnt_;
+  bool from_data_row_;
+  bool is_aggregated_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObSkipIndexAggregator);
+};
+
+// Check pushdown filter against skip index to prune blocks
+class ObSkipIndexFilter
+{
+public:
+  // @always_false: no row in the block could pass the filter
+  static int check_always_false(
+      sql::ObPushdownFilterExecutor &filter,
+      const storage::ObITableReadInfo &read_info,
+      const ObSkipIndexData &skip_index,
+      const int64_t row_count,
+      bool &always_false);
+private:
+  static int check_white_filter(
+      const sql::ObWhiteFilterExecutor &filter,
+      const storage::ObITableReadInfo &read_info,
+      const ObSkipIndexData &skip_index,
+      const int64_t row_count,
+      bool &always_false);
+  static int compare_param(
+      const common::ObObj &param,
+      const common::ObObj &value,
+      bool &comparable,
+      int &cmp);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
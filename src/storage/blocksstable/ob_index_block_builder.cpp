@@ -1027,6 +1027,7 @@ ObBaseIndexBlockBuilder::ObBaseIndexBlockBuilder()
    has_string_out_row_(false),
    has_lob_out_row_(false),
    is_last_row_last_flag_(false),
+   skip_index_aggregator_(),
    next_level_builder_(nullptr),
    level_(0)
 {
@@ -1061,6 +1062,7 @@ void ObBaseIndexBlockBuilder::reset()
   allocator_ = nullptr;
   level_ = 0;
   reset_accumulative_info();
+  skip_index_aggregator_.reset();
   is_inited_ = false;
 }
 
@@ -1088,6 +1090,8 @@ int ObBaseIndexBlockBuilder::init(ObDataStoreDesc &index_store_desc,
       STORAGE_LOG(WARN, "fail to init ObBaseIndexBlockBuilder", K(ret));
     } else if (OB_FAIL(ObMacroBlockWriter::build_micro_writer(index_store_desc_, allocator, micro_writer_))) {
       STORAGE_LOG(WARN, "fail to build micro writer", K(ret));
+    } else if (index_store_desc_->is_major_merge() && OB_FAIL(skip_index_aggregator_.init())) {
+      STORAGE_LOG(WARN, "fail to init skip index aggregator", K(ret));
     } else {
       if (index_store_desc_->need_pre_warm_) {
         index_block_pre_warmer_.init();
@@ -1152,6 +1156,12 @@ int ObBaseIndexBlockBuilder::append_row(const ObIndexBlockRowDesc &row_desc)
     macro_block_count_ += row_desc.macro_block_count_;
     // use the flag of the last row in last micro block
     is_last_row_last_flag_ = row_desc.is_last_row_last_flag_;
+    if (!skip_index_aggregator_.is_inited()) {
+    } else if (!row_desc.skip_index_.is_valid()) {
+      skip_index_aggregator_.set_not_aggregated();
+    } else if (OB_FAIL(skip_index_aggregator_.eval(row_desc.skip_index_))) {
+      STORAGE_LOG(WARN, "fail to aggregate skip index", K(ret), K(row_desc));
+    }
   }
   return ret;
 }
@@ -1329,6 +1339,11 @@ void ObBaseIndexBlockBuilder::update_accumulative_info(ObIndexBlockRowDesc &next
   next_row_desc.macro_block_count_ = macro_block_count_;
   next_row_desc.micro_block_count_ = micro_block_count_;
   next_row_desc.is_last_row_last_flag_ = is_last_row_last_flag_;
+  next_row_desc.skip_index_.reset();
+  if (skip_index_aggregator_.is_inited()) {
+    // the aggregated data is only valid until skip_index_aggregator_ is reused
+    (void) skip_index_aggregator_.get_aggregated_data(next_row_desc.skip_index_);
+  }
 }
 
 int ObBaseIndexBlockBuilder::close_index_tree(ObBaseIndexBlockBuilder *&root_builder)
@@ -1371,6 +1386,7 @@ void ObBaseIndexBlockBuilder::block_to_row_desc(
   row_desc.has_string_out_row_ = micro_block_desc.has_string_out_row_;
   row_desc.has_lob_out_row_ = micro_block_desc.has_lob_out_row_;
   row_desc.is_last_row_last_flag_ = micro_block_desc.is_last_row_last_flag_;
+  row_desc.skip_index_ = micro_block_desc.skip_index_;
 }
 
 int ObBaseIndexBlockBuilder::meta_to_row_desc(
@@ -1410,14 +1426,20 @@ int ObBaseIndexBlockBuilder::meta_to_row_desc(
     row_desc.macro_block_count_ = 1;
     row_desc.has_string_out_row_ = macro_meta.val_.has_string_out_row_;
     row_desc.has_lob_out_row_ = !macro_meta.val_.all_lob_in_row_;
+    row_desc.skip_index_.reset();
+    if (!macro_meta.val_.skip_index_col_metas_.empty()) {
+      row_desc.skip_index_ = ObSkipIndexData(&macro_meta.val_.skip_index_col_metas_.at(0),
+          macro_meta.val_.skip_index_col_metas_.count());
+    }
   }
   return ret;
 }
 
-void ObBaseIndexBlockBuilder::row_desc_to_meta(
+int ObBaseIndexBlockBuilder::row_desc_to_meta(
     const ObIndexBlockRowDesc &macro_row_desc,
     ObDataMacroBlockMeta &macro_meta)
 {
+  int ret = OB_SUCCESS;
   macro_meta.end_key_ = macro_row_desc.row_key_;
   macro_meta.val_.macro_id_ = macro_row_desc.macro_id_; // DEFAULT_IDX_ROW_MACRO_ID
   macro_meta.val_.block_offset_ = macro_row_desc.block_offset_;
@@ -1430,6 +1452,15 @@ void ObBaseIndexBlockBuilder::row_desc_to_meta(
   macro_meta.val_.has_string_out_row_ = macro_row_desc.has_string_out_row_;
   macro_meta.val_.all_lob_in_row_ = !macro_row_desc.has_lob_out_row_;
   macro_meta.val_.is_last_row_last_flag_ = macro_row_desc.is_last_row_last_flag_;
+  macro_meta.val_.skip_index_col_metas_.reuse();
+  ObSkipIndexColMeta col_meta;
+  for (int64_t i = 0; OB_SUCC(ret) && i < macro_row_desc.skip_index_.col_cnt_; ++i) {
+    macro_row_desc.skip_index_.get_col_meta(i, col_meta);
+    if (OB_FAIL(macro_meta.val_.skip_index_col_metas_.push_back(col_meta))) {
+      STORAGE_LOG(WARN, "fail to push back skip index", K(ret), K(i));
+    }
+  }
+  return ret;
 }
 
 
@@ -1446,6 +1477,7 @@ void ObBaseIndexBlockBuilder::reset_accumulative_info()
   is_last_row_last_flag_ = false;
   macro_block_count_ = 0;
   micro_block_count_ = 0;
+  skip_index_aggregator_.reuse();
 }
 
 int ObBaseIndexBlockBuilder::new_next_builder(ObBaseIndexBlockBuilder *&next_builder)
@@ -1625,7 +1657,9 @@ int ObDataIndexBlockBuilder::insert_and_update_index_tree(const ObDatumRow *inde
 }
 
 int ObDataIndexBlockBuilder::cal_macro_meta_block_size(
-    const ObDatumRowkey &rowkey, int64_t &estimate_meta_block_size)
+    const ObDatumRowkey &rowkey,
+    const int64_t skip_index_col_cnt,
+    int64_t &estimate_meta_block_size)
 {
   int ret = OB_SUCCESS;
   ObDataMacroBlockMeta macro_meta;
@@ -1646,6 +1680,13 @@ int ObDataIndexBlockBuilder::cal_macro_meta_block_size(
     macro_meta.val_.macro_id_ = ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID;
     meta_row_.reuse();
     row_allocator_.reuse();
+    ObSkipIndexColMeta empty_col_meta;
+    empty_col_meta.reset();
+    for (int64_t i = 0; OB_SUCC(ret) && i < skip_index_col_cnt; ++i) {
+      if (OB_FAIL(macro_meta.val_.skip_index_col_metas_.push_back(empty_col_meta))) {
+        STORAGE_LOG(WARN, "fail to push back skip index", K(ret), K(i));
+      }
+    }
     if (OB_FAIL(ret)) {
     } else if (OB_FAIL(macro_meta.build_estimate_row(meta_row_, row_allocator_))) {
       STORAGE_LOG(WARN, "fail to build meta row", K(ret), K(macro_meta));
@@ -1692,7 +1733,9 @@ int ObDataIndexBlockBuilder::append_row(const ObMicroBlockDesc &micro_block_desc
     if (remain_size <= 0) {
       ret = OB_BUF_NOT_ENOUGH;
     } else if (OB_FAIL(cal_macro_meta_block_size(
-        micro_block_desc.last_rowkey_, estimate_meta_block_size))) {
+        micro_block_desc.last_rowkey_,
+        MAX(skip_index_aggregator_.get_col_cnt(), micro_block_desc.skip_index_.col_cnt_),
+        estimate_meta_block_size))) {
       STORAGE_LOG(WARN, "fail to cal macro meta block size", K(ret), K(micro_block_desc));
     } else if ((remain_size = remain_size - estimate_meta_block_size) <= 0) {
       ret = OB_BUF_NOT_ENOUGH;
@@ -1777,7 +1820,8 @@ int ObDataIndexBlockBuilder::write_meta_block(
       != macro_row_desc.micro_block_count_)) {
     ret = OB_ERR_UNEXPECTED;
     STORAGE_LOG(WARN, "check micro block count failed", K(ret), K_(macro_meta), K(macro_row_desc));
-  } else if (FALSE_IT(row_desc_to_meta(macro_row_desc, macro_meta_))) {
+  } else if (OB_FAIL(row_desc_to_meta(macro_row_desc, macro_meta_))) {
+    STORAGE_LOG(WARN, "fail to build macro meta from row desc", K(ret), K(macro_row_desc));
   } else if (OB_FAIL(macro_meta_.build_row(meta_row_, row_allocator_))) {
     STORAGE_LOG(WARN, "fail to build row", K(ret), K_(macro_meta));
   } else if (OB_FAIL(meta_block_writer_->append_row(meta_row_))) {
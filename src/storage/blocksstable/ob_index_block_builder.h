@@ -246,7 +246,7 @@ protected:
   int meta_to_row_desc(
       const ObDataMacroBlockMeta &macro_meta,
       ObIndexBlockRowDesc &row_desc);
-  void row_desc_to_meta(
+  int row_desc_to_meta(
       const ObIndexBlockRowDesc &macro_row_desc,
       ObDataMacroBlockMeta &macro_meta);
   int64_t get_row_count() { return micro_writer_->get_row_count(); }
@@ -281,6 +281,7 @@ protected:
   bool has_string_out_row_;
   bool has_lob_out_row_;
   bool is_last_row_last_flag_;
+  ObSkipIndexAggregator skip_index_aggregator_;
 private:
   ObBaseIndexBlockBuilder *next_level_builder_;
   int64_t level_; // default 0
@@ -311,7 +312,10 @@ private:
       const MacroBlockId &block_id,
       const ObIndexBlockRowDesc &macro_row_desc);
   int insert_and_update_index_tree(const ObDatumRow *index_row) override;
-  int cal_macro_meta_block_size(const ObDatumRowkey &rowkey, int64_t &estimate_block_size);
+  int cal_macro_meta_block_size(
+      const ObDatumRowkey &rowkey,
+      const int64_t skip_index_col_cnt,
+      int64_t &estimate_block_size);
   int append_next_row(const ObMicroBlockDesc &micro_block_desc, ObIndexBlockRowDesc &macro_row_desc);
 private:
   ObDataStoreDesc *data_store_desc_;
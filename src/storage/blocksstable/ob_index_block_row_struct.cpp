@@ -29,7 +29,7 @@ ObIndexBlockRowDesc::ObIndexBlockRowDesc()
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
     is_secondary_meta_(false), is_macro_node_(false), has_string_out_row_(false), has_lob_out_row_(false),
-    is_last_row_last_flag_(false) {}
+    is_last_row_last_flag_(false), skip_index_() {}
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc(ObDataStoreDesc &data_store_desc)
   : data_store_desc_(&data_store_desc), row_key_(), macro_id_(), block_offset_(0),
@@ -37,7 +37,7 @@ ObIndexBlockRowDesc::ObIndexBlockRowDesc(ObDataStoreDesc &data_store_desc)
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
     is_secondary_meta_(false), is_macro_node_(false), has_string_out_row_(false), has_lob_out_row_(false),
-    is_last_row_last_flag_(false) {}
+    is_last_row_last_flag_(false), skip_index_() {}
 
 MacroBlockId ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID(0, DEFAULT_IDX_ROW_MACRO_IDX, 0);
 
@@ -247,11 +247,7 @@ int ObIndexBlockRowBuilder::calc_data_size(const ObIndexBlockRowDesc &desc, int6
   } else if (desc.is_secondary_meta_) {
     size = sizeof(ObIndexBlockRowHeader);
   } else if (desc.data_store_desc_->is_major_merge()) {
-    size = sizeof(ObIndexBlockRowHeader);
-    // if (desc.is_pre_aggregated_) {
-      // TODO: @saitong.zst Calculate aggregate size here
-      // size += aggregate_size;
-    // }
+    size = sizeof(ObIndexBlockRowHeader) + desc.skip_index_.get_data_size();
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
@@ -271,6 +267,16 @@ int ObIndexBlockRowBuilder::calc_data_size(
     size = sizeof(ObIndexBlockRowHeader);
   } else if (idx_row_header.is_major_node()) {
     size = sizeof(ObIndexBlockRowHeader);
+    if (idx_row_header.is_pre_aggregated()) {
+      const ObSkipIndexHeader *skip_index_header = reinterpret_cast<const ObSkipIndexHeader *>(
+          reinterpret_cast<const char *>(&idx_row_header) + sizeof(ObIndexBlockRowHeader));
+      if (OB_UNLIKELY(!skip_index_header->is_valid())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Invalid skip index header", K(ret), KPC(skip_index_header), K(idx_row_header));
+      } else {
+        size += skip_index_header->get_data_size();
+      }
+    }
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
@@ -296,7 +302,8 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
     header_->is_major_node_ = desc.data_store_desc_->is_major_merge();
     header_->has_string_out_row_ = desc.has_string_out_row_;
     header_->all_lob_in_row_ = !desc.has_lob_out_row_;
-    // header_->is_pre_aggregated_ =
+    header_->is_pre_aggregated_ = header_->is_major_node_ && is_data_mid_micro_block
+        && desc.skip_index_.is_valid();
     header_->is_deleted_ = desc.is_deleted_;
     header_->macro_id_ =(desc.is_data_block_ && is_data_mid_micro_block)
         ? ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID : desc.macro_id_;
@@ -330,20 +337,30 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
 int ObIndexBlockRowBuilder::append_aggregate_data(const ObIndexBlockRowDesc &desc)
 {
   int ret = OB_SUCCESS;
-  UNUSED(desc);
   if (OB_ISNULL(header_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Fail to append aggregation data to buffer", K(ret), KP_(header));
   } else if (!header_->is_pre_aggregated()) {
+  } else if (OB_UNLIKELY(!desc.skip_index_.is_valid()
+      || desc.skip_index_.col_cnt_ > ObSkipIndexAggregator::MAX_SKIP_INDEX_COL_CNT)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid skip index to append", K(ret), K(desc.skip_index_));
   } else {
-    // TODO: @saitong.zst Write aggregate data here
+    ObSkipIndexHeader *skip_index_header = reinterpret_cast<ObSkipIndexHeader *>(data_buf_ + write_pos_);
+    skip_index_header->version_ = ObSkipIndexHeader::SKIP_INDEX_HEADER_V1;
+    skip_index_header->col_cnt_ = static_cast<uint16_t>(desc.skip_index_.col_cnt_);
+    skip_index_header->reserved_ = 0;
+    write_pos_ += sizeof(ObSkipIndexHeader);
+    const int64_t col_metas_size = desc.skip_index_.get_col_metas_size();
+    MEMCPY(data_buf_ + write_pos_, desc.skip_index_.col_metas_buf_, col_metas_size);
+    write_pos_ += col_metas_size;
   }
   return ret;
 }
 
 
 ObIndexBlockRowParser::ObIndexBlockRowParser()
-  : header_(nullptr), minor_meta_info_(nullptr), is_inited_(false) {}
+  : header_(nullptr), minor_meta_info_(nullptr), skip_index_header_(nullptr), is_inited_(false) {}
 
 int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatumRow &row)
 {
@@ -369,6 +386,8 @@ int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatum
 int ObIndexBlockRowParser::init(const char *data_buf)
 {
   int ret = OB_SUCCESS;
+  minor_meta_info_ = nullptr;
+  skip_index_header_ = nullptr;
   if (OB_ISNULL(data_buf)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Unexpected null data buffer for index block row data", K(ret));
@@ -385,7 +404,16 @@ int ObIndexBlockRowParser::init(const char *data_buf)
       data_buf + minor_meta_offset);
   }
 
-  // TODO: @saitong.zst locate aggregated data logic here
+  if (OB_SUCC(ret) && header_->is_pre_aggregated()) {
+    skip_index_header_ = reinterpret_cast<const ObSkipIndexHeader *>(
+        data_buf + sizeof(ObIndexBlockRowHeader));
+    if (OB_UNLIKELY(!skip_index_header_->is_valid()
+        || skip_index_header_->col_cnt_ > ObSkipIndexAggregator::MAX_SKIP_INDEX_COL_CNT)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("Invalid skip index header parsed from data", K(ret), KPC(skip_index_header_));
+      skip_index_header_ = nullptr;
+    }
+  }
 
   if (OB_SUCC(ret)) {
     is_inited_ = true;
@@ -432,6 +460,20 @@ int ObIndexBlockRowParser::is_macro_node(bool &is_macro_node) const
   return ret;
 }
 
+int ObIndexBlockRowParser::get_skip_index(ObSkipIndexData &skip_index) const
+{
+  int ret = OB_SUCCESS;
+  skip_index.reset();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else if (nullptr != skip_index_header_) {
+    skip_index.col_metas_buf_ = skip_index_header_->get_col_metas_buf();
+    skip_index.col_cnt_ = skip_index_header_->col_cnt_;
+  }
+  return ret;
+}
+
 int64_t ObIndexBlockRowParser::get_snapshot_version() const
 {
   OB_ASSERT(is_inited_);
@@ -18,6 +18,7 @@
 #include "ob_data_buffer.h"
 #include "ob_macro_block.h"
 #include "ob_datum_row.h"
+#include "ob_index_block_aggregator.h"
 
 namespace oceanbase
 {
@@ -68,6 +69,7 @@ struct ObIndexBlockRowDesc
   bool has_string_out_row_;
   bool has_lob_out_row_;
   bool is_last_row_last_flag_;
+  ObSkipIndexData skip_index_;
 
   TO_STRING_KV(KP_(data_store_desc), K_(row_key), K_(macro_id),
       K_(block_offset), K_(row_count), K_(row_count_delta),
@@ -75,7 +77,7 @@ struct ObIndexBlockRowDesc
       K_(macro_block_count), K_(micro_block_count),
       K_(is_deleted), K_(contain_uncommitted_row), K_(is_data_block),
       K_(is_secondary_meta), K_(is_macro_node), K_(has_string_out_row), K_(has_lob_out_row),
-      K_(is_last_row_last_flag));
+      K_(is_last_row_last_flag), K_(skip_index));
 };
 
 struct ObIndexBlockRowHeader
@@ -201,6 +203,7 @@ public:
     : row_header_(nullptr),
       minor_meta_info_(nullptr),
       endkey_(nullptr),
+      skip_index_(),
       query_range_(nullptr),
       flag_(0),
       range_idx_(-1),
@@ -213,6 +216,7 @@ public:
     row_header_ = nullptr;
     minor_meta_info_ = nullptr;
     endkey_ = nullptr;
+    skip_index_.reset();
     query_range_ = nullptr;
     flag_ = 0;
     range_idx_ = -1;
@@ -248,7 +252,7 @@ public:
     OB_ASSERT(nullptr != row_header_);
     return row_header_->is_data_block();
   }
-  OB_INLINE const MacroBlockId &get_macro_id()
+  OB_INLINE const MacroBlockId &get_macro_id() const
   {
     OB_ASSERT(nullptr != row_header_);
     return row_header_->is_data_block() ? parent_macro_id_ : row_header_->get_macro_id();
@@ -358,13 +362,13 @@ public:
   }
 
   TO_STRING_KV(KP_(query_range), KPC_(row_header), KPC_(minor_meta_info), KPC_(endkey),
-      K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
+      K_(skip_index), K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
 
 public:
   const ObIndexBlockRowHeader *row_header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
   const ObDatumRowkey *endkey_;
-  // ObPreAggDataStore *pre_agg_data_;
+  ObSkipIndexData skip_index_;
   union {
     const ObDatumRowkey *rowkey_;
     const ObDatumRange *range_;
@@ -437,12 +441,14 @@ public:
   int64_t get_snapshot_version() const;
   int64_t get_max_merged_trans_version() const;
   int64_t get_row_count_delta() const;
-  TO_STRING_KV(K_(is_inited), KPC(header_));
+  int get_skip_index(ObSkipIndexData &skip_index) const;
+  TO_STRING_KV(K_(is_inited), KPC(header_), KPC(skip_index_header_));
 
 private:
   const ObIndexBlockRowHeader *header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
   // Aggregate data read struct
+  const ObSkipIndexHeader *skip_index_header_;
   bool is_inited_;
 };
 
@@ -17,6 +17,7 @@
 #include "ob_macro_block.h"
 #include "ob_micro_block_hash_index.h"
 #include "observer/ob_server_struct.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "share/ob_encryption_util.h"
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
@@ -181,6 +182,14 @@ int ObDataStoreDesc::init(
         STORAGE_LOG(WARN, "fail to get rowkey column ids", K(ret));
       }
     }
+    // skip index and the v2 data block meta carrying it can not be parsed by observers of old version
+    if (OB_SUCC(ret) && storage::is_major_merge_type(merge_type)
+        && major_working_cluster_version_ >= DATA_VERSION_4_2_0_0) {
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+      if (tenant_config.is_valid()) {
+        skip_index_max_col_cnt_ = tenant_config->_skip_index_max_column_count;
+      }
+    }
     if (OB_FAIL(ret)) {
     } else if (FALSE_IT(fresh_col_meta())) {
     } else if (OB_FAIL(datum_utils_.init(col_desc_array_, schema_rowkey_col_cnt_, lib::is_oracle_mode(), allocator_))) {
@@ -445,6 +454,7 @@ void ObDataStoreDesc::reset()
   need_pre_warm_ = false;
   is_force_flat_store_type_ = false;
   default_col_checksum_array_valid_ = false;
+  skip_index_max_col_cnt_ = 0;
   col_desc_array_.reset();
   col_default_checksum_array_.reset();
   datum_utils_.reset();
@@ -483,6 +493,7 @@ int ObDataStoreDesc::assign(const ObDataStoreDesc &desc)
   need_pre_warm_ = desc.need_pre_warm_;
   is_force_flat_store_type_ = desc.is_force_flat_store_type_;
   default_col_checksum_array_valid_ = desc.default_col_checksum_array_valid_;
+  skip_index_max_col_cnt_ = desc.skip_index_max_col_cnt_;
   col_desc_array_.reset();
   col_default_checksum_array_.reset();
   datum_utils_.reset();
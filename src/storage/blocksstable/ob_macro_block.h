@@ -82,6 +82,7 @@ struct ObDataStoreDesc
   bool need_pre_warm_;
   bool is_force_flat_store_type_;
   bool default_col_checksum_array_valid_;
+  int64_t skip_index_max_col_cnt_; // max column count of skip index, 0 means no skip index
   common::ObArenaAllocator allocator_;
   common::ObFixedArray<int64_t, common::ObIAllocator> col_default_checksum_array_;
   blocksstable::ObStorageDatumUtils datum_utils_;
@@ -167,6 +168,7 @@ struct ObDataStoreDesc
       K_(is_ddl),
       K_(col_desc_array),
       K_(default_col_checksum_array_valid),
+      K_(skip_index_max_col_cnt),
       K_(col_default_checksum_array));
 
 private:
@@ -112,6 +112,20 @@ int ObMacroBlockHandle::report_bad_block() const
   return ret;
 }
 
+void ObMacroBlockHandle::fill_read_io_info(const ObMacroBlockReadInfo &read_info, ObIOInfo &io_info)
+{
+  io_info.tenant_id_ = get_tenant_id();
+  io_info.offset_ = read_info.offset_;
+  io_info.size_ = static_cast<int32_t>(read_info.size_);
+  io_info.flag_ = read_info.io_desc_;
+  io_info.callback_ = read_info.io_callback_;
+  io_info.fd_.first_id_ = read_info.macro_block_id_.first_id();
+  io_info.fd_.second_id_ = read_info.macro_block_id_.second_id();
+  // resource manager level is higher than default
+  io_info.flag_.set_group_id(read_info.io_desc_.get_io_module());
+  io_info.flag_.set_read();
+}
+
 uint64_t ObMacroBlockHandle::get_tenant_id()
 {
   uint64_t tenant_id = MTL_ID();
@@ -130,17 +144,7 @@ int ObMacroBlockHandle::async_read(const ObMacroBlockReadInfo &read_info)
   } else {
     reuse();
     ObIOInfo io_info;
-    io_info.tenant_id_ = get_tenant_id();
-    io_info.offset_ = read_info.offset_;
-    io_info.size_ = static_cast<int32_t>(read_info.size_);
-    io_info.flag_ = read_info.io_desc_;
-    io_info.callback_ = read_info.io_callback_;
-    io_info.fd_.first_id_ = read_info.macro_block_id_.first_id();
-    io_info.fd_.second_id_ = read_info.macro_block_id_.second_id();
-    // resource manager level is higher than default
-    io_info.flag_.set_group_id(read_info.io_desc_.get_io_module());
-
-    io_info.flag_.set_read();
+    fill_read_io_info(read_info, io_info);
     if (OB_FAIL(ObIOManager::get_instance().aio_read(io_info, io_handle_))) {
       LOG_WARN("Fail to aio_read", K(read_info), K(ret));
     } else if (OB_FAIL(set_macro_block_id(read_info.macro_block_id_))) {
@@ -150,6 +154,45 @@ int ObMacroBlockHandle::async_read(const ObMacroBlockReadInfo &read_info)
   return ret;
 }
 
+int ObMacroBlockHandle::async_read_batch(
+    const ObIArray<ObMacroBlockReadInfo> &read_infos,
+    ObIArray<ObMacroBlockHandle> &macro_handles)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObIOInfo, 16> io_infos;
+  ObSEArray<ObIOHandle, 16> io_handles;
+  macro_handles.reset();
+  for (int64_t i = 0; OB_SUCC(ret) && i < read_infos.count(); ++i) {
+    const ObMacroBlockReadInfo &read_info = read_infos.at(i);
+    ObIOInfo io_info;
+    if (OB_UNLIKELY(!read_info.is_valid())) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("invalid argument", K(ret), K(i), K(read_info));
+    } else if (FALSE_IT(fill_read_io_info(read_info, io_info))) {
+    } else if (OB_FAIL(io_infos.push_back(io_info))) {
+      LOG_WARN("failed to push back io info", K(ret), K(io_info));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(ObIOManager::get_instance().aio_read_batch(io_infos, io_handles))) {
+    LOG_WARN("Fail to aio_read_batch", K(ret), K(io_infos.count()));
+  } else if (OB_FAIL(macro_handles.prepare_allocate(read_infos.count()))) {
+    LOG_WARN("failed to prepare allocate macro handles", K(ret), K(read_infos.count()));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < read_infos.count(); ++i) {
+      ObMacroBlockHandle &macro_handle = macro_handles.at(i);
+      macro_handle.io_handle_ = io_handles.at(i);
+      if (OB_FAIL(macro_handle.set_macro_block_id(read_infos.at(i).macro_block_id_))) {
+        LOG_WARN("failed to set macro block id", K(ret), K(i));
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    macro_handles.reset();
+  }
+  return ret;
+}
+
 int ObMacroBlockHandle::async_write(const ObMacroBlockWriteInfo &write_info)
 {
   int ret = OB_SUCCESS;
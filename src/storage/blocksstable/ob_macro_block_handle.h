@@ -43,12 +43,18 @@ public:
   int64_t get_data_size() const { return io_handle_.get_data_size(); }
   int async_read(const ObMacroBlockReadInfo &read_info);
   int async_write(const ObMacroBlockWriteInfo &write_info);
+  // Nearby reads in the same macro block are merged into one io, @macro_handles[i] is the
+  // handle of @read_infos[i].
+  static int async_read_batch(
+      const common::ObIArray<ObMacroBlockReadInfo> &read_infos,
+      common::ObIArray<ObMacroBlockHandle> &macro_handles);
   int set_macro_block_id(const MacroBlockId &macro_block_id);
   int wait(const int64_t timeout_ms);
   TO_STRING_KV(K_(macro_id), K_(io_handle));
 private:
   int report_bad_block() const;
   static uint64_t get_tenant_id();
+  static void fill_read_io_info(const ObMacroBlockReadInfo &read_info, common::ObIOInfo &io_info);
 private:
   MacroBlockId macro_id_;
   common::ObIOHandle io_handle_;
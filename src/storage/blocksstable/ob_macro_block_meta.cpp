@@ -50,7 +50,8 @@ ObDataBlockMetaVal::ObDataBlockMetaVal()
     macro_id_(),
     column_checksums_(sizeof(int64_t), ModulePageAllocator("MacroMetaChksum", MTL_ID())),
     has_string_out_row_(false),
-    all_lob_in_row_(false)
+    all_lob_in_row_(false),
+    skip_index_col_metas_(sizeof(ObSkipIndexColMeta), ModulePageAllocator("MacroMetaSkipIdx", MTL_ID()))
 {
   MEMSET(encrypt_key_, 0, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
 }
@@ -86,7 +87,8 @@ ObDataBlockMetaVal::ObDataBlockMetaVal(ObIAllocator &allocator)
     macro_id_(),
     column_checksums_(sizeof(int64_t), ModulePageAllocator(allocator, "MacroMetaChksum")),
     has_string_out_row_(false),
-    all_lob_in_row_(false)
+    all_lob_in_row_(false),
+    skip_index_col_metas_(sizeof(ObSkipIndexColMeta), ModulePageAllocator(allocator, "MacroMetaSkipIdx"))
 {
   MEMSET(encrypt_key_, 0, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
 }
@@ -128,11 +130,12 @@ void ObDataBlockMetaVal::reset()
   column_checksums_.reset();
   has_string_out_row_ = false;
   all_lob_in_row_ = false;
+  skip_index_col_metas_.reset();
 }
 
 bool ObDataBlockMetaVal::is_valid() const
 {
-return DATA_BLOCK_META_VAL_VERSION == version_
+return (DATA_BLOCK_META_VAL_VERSION == version_ || DATA_BLOCK_META_VAL_VERSION_V2 == version_)
     && rowkey_count_ > 0
     && column_count_ > 0
     && micro_block_count_ >= 0
@@ -160,6 +163,8 @@ int ObDataBlockMetaVal::assign(const ObDataBlockMetaVal &val)
     LOG_WARN("invalid argument", K(ret), K(val));
   } else if (OB_FAIL(column_checksums_.assign(val.column_checksums_))) {
     LOG_WARN("fail to assign column checksums", K(ret), K(val.column_checksums_));
+  } else if (OB_FAIL(skip_index_col_metas_.assign(val.skip_index_col_metas_))) {
+    LOG_WARN("fail to assign skip index", K(ret), K(val.skip_index_col_metas_));
   } else {
     version_ = val.version_;
     length_ = val.length_;
@@ -229,6 +234,7 @@ DEFINE_SERIALIZE(ObDataBlockMetaVal)
     LOG_WARN("data block meta value is invalid", K(ret), KPC(this));
   } else {
     int64_t start_pos = pos;
+    const_cast<ObDataBlockMetaVal *>(this)->version_ = get_serialize_version();
     const_cast<ObDataBlockMetaVal *>(this)->length_ = get_serialize_size();
     if (OB_FAIL(serialization::encode_i32(buf, buf_len, pos, version_))) {
       LOG_WARN("fail to encode version", K(ret), K(buf_len), K(pos));
@@ -270,6 +276,10 @@ DEFINE_SERIALIZE(ObDataBlockMetaVal)
                   has_string_out_row_,
                   all_lob_in_row_,
                   is_last_row_last_flag_);
+      // skip index is only serialized in V2, meta without it is kept in V1 format
+      if (OB_SUCC(ret) && DATA_BLOCK_META_VAL_VERSION_V2 == version_) {
+        OB_UNIS_ENCODE(skip_index_col_metas_);
+      }
       if (OB_FAIL(ret)) {
       } else if (OB_UNLIKELY(length_ != pos - start_pos)) {
         ret = OB_ERR_UNEXPECTED;
@@ -290,7 +300,8 @@ DEFINE_DESERIALIZE(ObDataBlockMetaVal)
     int64_t start_pos = pos;
     if (OB_FAIL(serialization::decode_i32(buf, data_len, pos, &version_))) {
       LOG_WARN("fail to decode version", K(ret), K(data_len), K(pos));
-    } else if (OB_UNLIKELY(version_ != DATA_BLOCK_META_VAL_VERSION)) {
+    } else if (OB_UNLIKELY(version_ != DATA_BLOCK_META_VAL_VERSION
+        && version_ != DATA_BLOCK_META_VAL_VERSION_V2)) {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("object version mismatch", K(ret), K(version_));
     } else if (OB_FAIL(serialization::decode_i32(buf, data_len, pos, &length_))) {
@@ -332,6 +343,12 @@ DEFINE_DESERIALIZE(ObDataBlockMetaVal)
                   all_lob_in_row_,
                   is_last_row_last_flag_);
       if (OB_FAIL(ret)) {
+      } else if (DATA_BLOCK_META_VAL_VERSION_V2 == version_) {
+        OB_UNIS_DECODE(skip_index_col_metas_);
+      } else {
+        skip_index_col_metas_.reuse();
+      }
+      if (OB_FAIL(ret)) {
       } else if (OB_UNLIKELY(length_ != pos - start_pos)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("unexpected error, deserialize may has bug", K(ret), K(pos), K(start_pos), KPC(this));
@@ -346,12 +363,15 @@ int64_t ObDataBlockMetaVal::get_max_serialize_size() const
   len -= sizeof(column_checksums_);
   len += sizeof(int64_t); // serialize column count
   len += sizeof(int64_t) * column_count_; // serialize each checksum
+  len -= sizeof(skip_index_col_metas_);
+  len += sizeof(int64_t); // serialize skip index column count
+  len += sizeof(ObSkipIndexColMeta) * skip_index_col_metas_.count();
   return len;
 }
 DEFINE_GET_SERIALIZE_SIZE(ObDataBlockMetaVal)
 {
   int64_t len = 0;
-  len += serialization::encoded_length_i32(version_);
+  len += serialization::encoded_length_i32(get_serialize_version());
   len += serialization::encoded_length_i32(length_);
   len += sizeof(encrypt_key_);
   LST_DO_CODE(OB_UNIS_ADD_LEN,
@@ -384,6 +404,9 @@ DEFINE_GET_SERIALIZE_SIZE(ObDataBlockMetaVal)
               has_string_out_row_,
               all_lob_in_row_,
               is_last_row_last_flag_);
+  if (DATA_BLOCK_META_VAL_VERSION_V2 == get_serialize_version()) {
+    OB_UNIS_ADD_LEN(skip_index_col_metas_);
+  }
   return len;
 }
 
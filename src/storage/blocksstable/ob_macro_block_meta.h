@@ -20,6 +20,7 @@
 #include "share/ob_encryption_util.h"
 #include "common/ob_store_format.h"
 #include "storage/blocksstable/ob_logic_macro_id.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
 
 
 namespace oceanbase
@@ -36,6 +37,8 @@ class ObDataBlockMetaVal final
 {
 private:
   static const int32_t DATA_BLOCK_META_VAL_VERSION = 1;
+  // V2 appends skip_index_col_metas_, meta without skip index is still written as V1
+  static const int32_t DATA_BLOCK_META_VAL_VERSION_V2 = 2;
 public:
   ObDataBlockMetaVal();
   explicit ObDataBlockMetaVal(ObIAllocator &allocator);
@@ -48,6 +51,10 @@ public:
   int deserialize(const char *buf, const int64_t data_len, int64_t& pos);
   int64_t get_serialize_size() const;
   int64_t get_max_serialize_size() const;
+  OB_INLINE int32_t get_serialize_version() const
+  {
+    return skip_index_col_metas_.empty() ? DATA_BLOCK_META_VAL_VERSION : DATA_BLOCK_META_VAL_VERSION_V2;
+  }
   TO_STRING_KV(K_(version), K_(length), K_(data_checksum), K_(rowkey_count),
         K_(rowkey_count), K_(column_count), K_(micro_block_count), K_(occupy_size), K_(data_size),
         K_(data_zsize), K_(original_size), K_(progressive_merge_round), K_(block_offset), K_(block_size), K_(row_count),
@@ -55,7 +62,8 @@ public:
         K_(is_deleted), K_(contain_uncommitted_row), K_(compressor_type),
         K_(master_key_id), K_(encrypt_id), K_(encrypt_key), K_(row_store_type),
         K_(schema_version), K_(snapshot_version), K_(is_last_row_last_flag),
-        K_(logic_id), K_(macro_id), K_(column_checksums), K_(has_string_out_row), K_(all_lob_in_row));
+        K_(logic_id), K_(macro_id), K_(column_checksums), K_(has_string_out_row), K_(all_lob_in_row),
+        K_(skip_index_col_metas));
 public:
   int32_t version_;
   int32_t length_;
@@ -89,6 +97,8 @@ public:
   common::ObSEArray<int64_t, 4> column_checksums_;
   bool has_string_out_row_;
   bool all_lob_in_row_;
+  // aggregated skip index of the whole macro block, only for major sstable
+  common::ObSEArray<ObSkipIndexColMeta, 1> skip_index_col_metas_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObDataBlockMetaVal);
@@ -367,7 +367,8 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    check_datum_row_(),
    callback_(nullptr),
    builder_(NULL),
-   data_block_pre_warmer_()
+   data_block_pre_warmer_(),
+   skip_index_aggregator_()
 {
   //macro_blocks_, macro_handles_
 }
@@ -412,6 +413,7 @@ void ObMacroBlockWriter::reset()
   allocator_.reset();
   rowkey_allocator_.reset();
   data_block_pre_warmer_.reset();
+  skip_index_aggregator_.reset();
 }
 
 
@@ -474,6 +476,9 @@ int ObMacroBlockWriter::open(
     } else if (OB_NOT_NULL(sstable_index_builder)) {
       if (OB_FAIL(sstable_index_builder->new_index_builder(builder_, data_store_desc, allocator_))) {
         STORAGE_LOG(WARN, "fail to alloc index builder", K(ret));
+      } else if (data_store_desc.is_major_merge() && data_store_desc.skip_index_max_col_cnt_ > 0
+          && OB_FAIL(skip_index_aggregator_.init(data_store_desc))) {
+        STORAGE_LOG(WARN, "fail to init skip index aggregator", K(ret), K(data_store_desc));
       } else if (data_store_desc.need_pre_warm_) {
         data_block_pre_warmer_.init();
       }
@@ -871,6 +876,10 @@ int ObMacroBlockWriter::append_row_and_hash_index(const ObDatumRow &row)
       }
     }
   }
+  if (OB_SUCC(ret) && skip_index_aggregator_.is_inited()
+      && OB_FAIL(skip_index_aggregator_.eval(row))) {
+    STORAGE_LOG(WARN, "Failed to aggregate skip index", K(ret), K(row));
+  }
   return ret;
 }
 
@@ -907,6 +916,9 @@ int ObMacroBlockWriter::build_micro_block()
     STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
   } else if (OB_FAIL(build_hash_index_block(micro_block_desc))) {
     STORAGE_LOG(WARN, "Failed to build hash index block", K(ret));
+  } else if (skip_index_aggregator_.is_inited()
+      && OB_FAIL(skip_index_aggregator_.get_aggregated_data(micro_block_desc.skip_index_))) {
+    STORAGE_LOG(WARN, "Failed to get aggregated skip index", K(ret));
   } else {
     micro_block_desc.last_rowkey_ = last_key_;
     block_size = micro_block_desc.buf_size_;
@@ -951,6 +963,9 @@ int ObMacroBlockWriter::build_micro_block()
 
   if (OB_SUCC(ret)) {
     micro_writer_->reuse();
+    if (skip_index_aggregator_.is_inited()) {
+      skip_index_aggregator_.reuse();
+    }
     if (data_store_desc_->need_build_hash_index_for_micro_block_) {
       hash_index_builder_.reuse();
     }
@@ -1038,6 +1053,8 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
     micro_block_desc.has_string_out_row_ = micro_block.micro_index_info_->has_string_out_row();
     micro_block_desc.has_lob_out_row_ = micro_block.micro_index_info_->has_lob_out_row();
     micro_block_desc.original_size_ = header.original_length_;
+    // schema is unchanged, skip index of the reused micro block is still valid
+    micro_block_desc.skip_index_ = micro_block.micro_index_info_->skip_index_;
   }
   STORAGE_LOG(DEBUG, "build micro block desc reuse", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
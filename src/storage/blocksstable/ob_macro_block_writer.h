@@ -227,6 +227,7 @@ private:
   ObDataIndexBlockBuilder *builder_;
   ObMicroBlockAdaptiveSplitter micro_block_adaptive_splitter_;
   ObDataBlockCachePreWarmer data_block_pre_warmer_;
+  ObSkipIndexAggregator skip_index_aggregator_;
 };
 
 }//end namespace blocksstable
@@ -13,6 +13,8 @@
 #define USING_LOG_PREFIX STORAGE
 
 #include "storage/blocksstable/ob_micro_block_cache.h"
+#include "storage/blocksstable/ob_micro_block_ssd_cache.h"
+#include "share/config/ob_server_config.h"
 #include "storage/blocksstable/ob_block_manager.h"
 #include "storage/blocksstable/ob_macro_block_handle.h"
 #include "storage/blocksstable/ob_shared_macro_block_manager.h"
@@ -551,6 +553,87 @@ const char *ObSingleMicroBlockIOCallback::get_data()
   return data;
 }
 
+/*-----------------------------------ObSSDMicroBlockIOCallback-----------------------------------*/
+ObSSDMicroBlockIOCallback::ObSSDMicroBlockIOCallback()
+  : ObIMicroBlockIOCallback(),
+    ssd_cache_(nullptr),
+    block_size_(0),
+    segment_idx_(-1),
+    segment_seq_(0),
+    micro_block_(nullptr),
+    cache_handle_()
+{
+  STATIC_ASSERT(sizeof(*this) <= CALLBACK_BUF_SIZE, "IOCallback buf size not enough");
+}
+
+ObSSDMicroBlockIOCallback::~ObSSDMicroBlockIOCallback()
+{
+}
+
+int64_t ObSSDMicroBlockIOCallback::size() const
+{
+  return sizeof(*this);
+}
+
+int ObSSDMicroBlockIOCallback::inner_process(const char *data_buffer, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  const char *block_buf = nullptr;
+  int64_t block_size = 0;
+  const ObMicroBlockCacheKey key(tenant_id_, block_id_, offset_, block_size_);
+  if (OB_ISNULL(cache_) || OB_ISNULL(ssd_cache_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid ssd micro block callback", K(ret), KP_(cache), KP_(ssd_cache));
+  } else if (OB_FAIL(ssd_cache_->check_record(key, segment_idx_, segment_seq_,
+      data_buffer, size, block_buf, block_size))) {
+    // the reader falls back to read data file
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("Fail to check ssd cache record", K(ret), K(key));
+    }
+  } else if (OB_FAIL(cache_->put_decompressed_block(key, block_buf, block_size, micro_block_, cache_handle_))) {
+    LOG_WARN("Fail to put micro block from ssd cache", K(ret), K(key));
+  }
+  return ret;
+}
+
+int ObSSDMicroBlockIOCallback::inner_deep_copy(
+    char *buf,
+    const int64_t buf_len,
+    ObIOCallback *&callback) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument, ", KP(buf), K(buf_len), K(ret));
+  } else if (OB_ISNULL(cache_) || OB_ISNULL(ssd_cache_)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("The ssd micro block io callback is not valid", K(ret), KP_(cache), KP_(ssd_cache));
+  } else {
+    ObSSDMicroBlockIOCallback *pcallback = new (buf) ObSSDMicroBlockIOCallback();
+    if (OB_FAIL(pcallback->assign(*this))) {
+      LOG_WARN("fail to assign callback", K(ret));
+    } else {
+      pcallback->ssd_cache_ = ssd_cache_;
+      pcallback->block_size_ = block_size_;
+      pcallback->segment_idx_ = segment_idx_;
+      pcallback->segment_seq_ = segment_seq_;
+      pcallback->micro_block_ = micro_block_;
+      pcallback->cache_handle_ = cache_handle_;
+      callback = pcallback;
+    }
+  }
+  return ret;
+}
+
+const char *ObSSDMicroBlockIOCallback::get_data()
+{
+  const char *data = nullptr;
+  if (OB_NOT_NULL(micro_block_)) {
+    data = reinterpret_cast<const char*> (&(micro_block_->get_block_data()));
+  }
+  return data;
+}
+
 /*-----------------------------------ObMultiDataBlockIOCallback-----------------------------------*/
 ObMultiDataBlockIOCallback::ObMultiDataBlockIOCallback()
   : ObIMicroBlockIOCallback(),
@@ -768,6 +851,159 @@ int ObIMicroBlockCache::get_cache_block(
   return ret;
 }
 
+int ObIMicroBlockCache::prefetch_from_ssd_cache(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObMicroIndexInfo& idx_row,
+    ObMacroBlockHandle &macro_handle)
+{
+  int ret = OB_SUCCESS;
+  ObIAllocator *allocator = nullptr;
+  const ObIndexBlockRowHeader *idx_row_header = idx_row.row_header_;
+  if (OB_ISNULL(ssd_cache_)) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_ISNULL(idx_row_header)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(idx_row));
+  } else if (OB_FAIL(get_allocator(allocator))) {
+    LOG_WARN("Fail to get allocator", K(ret));
+  } else {
+    ObSSDMicroBlockIOCallback callback;
+    callback.cache_ = this;
+    callback.allocator_ = allocator;
+    callback.put_size_stat_ = this;
+    callback.tenant_id_ = tenant_id;
+    callback.block_id_ = macro_id;
+    callback.offset_ = idx_row.get_block_offset();
+    callback.block_size_ = idx_row.get_block_size();
+    callback.row_store_type_ = idx_row.get_row_store_type();
+    const ObMicroBlockCacheKey key(tenant_id, macro_id, callback.offset_, callback.block_size_);
+    // macro id is not set to the handle, io error of ssd cache file is not a bad data block
+    if (OB_FAIL(ssd_cache_->aio_get(key, callback, macro_handle.get_io_handle()))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        LOG_WARN("Fail to read micro block from ssd cache", K(ret), K(key));
+      }
+      macro_handle.reset();
+    } else {
+      EVENT_INC(ObStatEventIds::IO_READ_PREFETCH_MICRO_COUNT);
+      EVENT_ADD(ObStatEventIds::IO_READ_PREFETCH_MICRO_BYTES, idx_row.get_block_size());
+    }
+  }
+  return ret;
+}
+
+int ObIMicroBlockCache::put_decompressed_block(
+    const ObMicroBlockCacheKey &key,
+    const char *block_buf,
+    const int64_t block_size,
+    const ObMicroBlockCacheValue *&micro_block,
+    ObKVCacheHandle &cache_handle)
+{
+  int ret = OB_SUCCESS;
+  BaseBlockCache *cache = nullptr;
+  ObMicroBlockHeader header;
+  int64_t pos = 0;
+  micro_block = nullptr;
+  if (OB_ISNULL(block_buf) || OB_UNLIKELY(block_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(block_buf), K(block_size));
+  } else if (OB_FAIL(get_cache(cache))) {
+    LOG_WARN("Fail to get kvcache", K(ret));
+  } else if (OB_FAIL(header.deserialize(block_buf, block_size, pos))) {
+    LOG_WARN("Fail to deserialize micro block header", K(ret), K(key), K(block_size));
+  } else if (OB_SUCCESS == cache->get(key, micro_block, cache_handle)) {
+    // entry exist, no need to put
+  } else {
+    ObKVCachePair *kvpair = nullptr;
+    ObKVCacheInstHandle inst_handle;
+    int64_t extra_size = 0;
+    bool need_decoder = false;
+    const int64_t value_size = calc_value_size(block_size,
+                                               static_cast<ObRowStoreType>(header.row_store_type_),
+                                               header.row_count_,
+                                               header.column_count_,
+                                               extra_size,
+                                               need_decoder);
+    if (OB_FAIL(cache->alloc(key.get_tenant_id(), sizeof(ObMicroBlockCacheKey), value_size,
+                             kvpair, cache_handle, inst_handle))) {
+      LOG_WARN("Fail to alloc cache buf", K(ret), K(key), K(value_size));
+    } else {
+      char *buf = reinterpret_cast<char *>(kvpair->value_) + sizeof(ObMicroBlockCacheValue);
+      kvpair->key_ = new (kvpair->key_) ObMicroBlockCacheKey(key);
+      ObMicroBlockCacheValue *cache_value = new (kvpair->value_) ObMicroBlockCacheValue(buf, block_size);
+      ObMicroBlockData &micro_data = cache_value->get_block_data();
+      micro_data.type_ = get_type();
+      MEMCPY(buf, block_buf, block_size);
+      if (need_decoder && OB_FAIL(write_extra_buf(buf, block_size, extra_size, buf + block_size, micro_data))) {
+        LOG_WARN("Fail to write extra buffer of block data", K(ret), K(header));
+      } else if (FALSE_IT(micro_block = cache_value)) {
+      } else if (OB_FAIL(cache->put_kvpair(inst_handle, kvpair, cache_handle, false /* overwrite */))) {
+        if (OB_ENTRY_EXIST != ret) {
+          LOG_WARN("Fail to put micro block cache", K(ret));
+        } else {
+          ret = OB_SUCCESS;
+        }
+      } else {
+        const int64_t put_size = ObKVStoreMemBlock::get_align_size(key, *cache_value);
+        if (OB_FAIL(add_put_size(put_size))) {
+          LOG_WARN("add_put_size failed", K(ret), K(put_size));
+        }
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    cache_handle.reset();
+    micro_block = nullptr;
+  }
+  return ret;
+}
+
+int ObIMicroBlockCache::put_block(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObMicroBlockDesMeta &des_meta,
+    const char *buf,
+    const int64_t offset,
+    const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  ObIAllocator *allocator = nullptr;
+  ObMicroBlockHeader header;
+  int64_t pos = 0;
+  if (OB_UNLIKELY(!macro_id.is_valid() || !des_meta.is_valid() || nullptr == buf
+      || offset < 0 || size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), K(macro_id), K(des_meta), KP(buf), K(offset), K(size));
+  } else if (OB_FAIL(get_allocator(allocator))) {
+    LOG_WARN("Fail to get allocator", K(ret));
+  } else if (OB_FAIL(header.deserialize(buf, size, pos))) {
+    LOG_WARN("Fail to deserialize micro block header", K(ret), K(macro_id), K(offset), K(size));
+  } else {
+    ObSingleMicroBlockIOCallback callback;
+    ObMacroBlockReader *reader = nullptr;
+    const ObMicroBlockCacheValue *micro_block = nullptr;
+    ObKVCacheHandle cache_handle;
+    callback.cache_ = this;
+    callback.allocator_ = allocator;
+    callback.put_size_stat_ = this;
+    callback.tenant_id_ = tenant_id;
+    callback.block_id_ = macro_id;
+    callback.offset_ = offset;
+    callback.row_store_type_ = static_cast<ObRowStoreType>(header.row_store_type_);
+    callback.block_des_meta_ = des_meta;
+    callback.use_block_cache_ = true;
+    callback.need_write_extra_buf_ = ObMicroBlockData::INDEX_BLOCK == get_type()
+        || ObStoreFormat::is_row_store_type_with_encoding(callback.row_store_type_);
+    if (OB_ISNULL(reader = GET_TSI_MULT(ObMacroBlockReader, 1))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Fail to allocate ObMacroBlockReader, ", K(ret));
+    } else if (OB_FAIL(callback.process_block(reader, buf, offset, size, micro_block, cache_handle))) {
+      LOG_WARN("Fail to put micro block into cache", K(ret), K(macro_id), K(offset), K(size));
+    }
+  }
+  return ret;
+}
+
 int ObIMicroBlockCache::reserve_kvpair(const ObMicroBlockDesc &micro_block_desc,
                                        ObKVCacheInstHandle &inst_handle,
                                        ObKVCacheHandle &cache_handle,
@@ -828,10 +1064,11 @@ int ObIMicroBlockCache::prefetch(
     LOG_WARN("Invalid data index block row header ", K(ret), K(idx_row));
   } else {
     ObSingleMicroBlockIOCallback callback;
-    callback.need_write_extra_buf_ = idx_header->is_data_index()
-                                     && (!idx_header->is_data_block()
-                                         || (ObStoreFormat::is_row_store_type_with_encoding(idx_header->get_row_store_type())));
-    if (OB_FAIL(prefetch(
+    callback.need_write_extra_buf_ = need_write_extra_buf(*idx_header);
+    if (nullptr != ssd_cache_ && flag.is_use_block_cache()
+        && OB_SUCCESS == prefetch_from_ssd_cache(tenant_id, macro_id, idx_row, macro_handle)) {
+      // read from ssd cache
+    } else if (OB_FAIL(prefetch(
         tenant_id, macro_id, idx_row, flag, macro_handle, callback))) {
       LOG_WARN("Fail to prefetch data micro block", K(ret));
     }
@@ -839,6 +1076,82 @@ int ObIMicroBlockCache::prefetch(
   return ret;
 }
 
+int ObIMicroBlockCache::prefetch(
+    const uint64_t tenant_id,
+    const ObIArray<ObMicroIndexInfo> &idx_rows,
+    const common::ObQueryFlag &flag,
+    ObIArray<ObMacroBlockHandle> &macro_handles)
+{
+  int ret = OB_SUCCESS;
+  const int64_t block_count = idx_rows.count();
+  ObSingleMicroBlockIOCallback callbacks[MAX_BATCH_PREFETCH_CNT];
+  ObSEArray<ObMacroBlockReadInfo, MAX_BATCH_PREFETCH_CNT> read_infos;
+  // blocks in ssd cache are read from it one by one, others are read from data file in batch
+  ObMacroBlockHandle ssd_handles[MAX_BATCH_PREFETCH_CNT];
+  bool in_ssd_cache[MAX_BATCH_PREFETCH_CNT];
+  int64_t ssd_block_count = 0;
+  int64_t total_size = 0;
+  if (OB_UNLIKELY(block_count <= 0 || block_count > MAX_BATCH_PREFETCH_CNT)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid block count", K(ret), K(block_count));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < block_count; ++i) {
+    const ObMicroIndexInfo &idx_row = idx_rows.at(i);
+    ObMacroBlockReadInfo read_info;
+    in_ssd_cache[i] = false;
+    if (OB_ISNULL(idx_row.row_header_)) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("Invalid null index block row header", K(ret), K(i), K(idx_row));
+    } else if (nullptr != ssd_cache_ && flag.is_use_block_cache()
+        && OB_SUCCESS == prefetch_from_ssd_cache(tenant_id, idx_row.get_macro_id(), idx_row, ssd_handles[i])) {
+      in_ssd_cache[i] = true;
+      ++ssd_block_count;
+    } else if (FALSE_IT(callbacks[i].need_write_extra_buf_ = need_write_extra_buf(*idx_row.row_header_))) {
+    } else if (OB_FAIL(fill_prefetch_info(
+        tenant_id, idx_row.get_macro_id(), idx_row, flag, callbacks[i], read_info))) {
+      LOG_WARN("Fail to fill prefetch info", K(ret), K(idx_row));
+    } else if (OB_FAIL(read_infos.push_back(read_info))) {
+      LOG_WARN("Fail to push back read info", K(ret), K(read_info));
+    } else {
+      total_size += read_info.size_;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (0 == ssd_block_count) {
+    if (OB_FAIL(ObMacroBlockHandle::async_read_batch(read_infos, macro_handles))) {
+      LOG_WARN("Fail to async read blocks in batch", K(ret), K(block_count));
+    }
+  } else {
+    ObSEArray<ObMacroBlockHandle, MAX_BATCH_PREFETCH_CNT> disk_handles;
+    int64_t disk_idx = 0;
+    if (read_infos.count() > 0 && OB_FAIL(ObMacroBlockHandle::async_read_batch(read_infos, disk_handles))) {
+      LOG_WARN("Fail to async read blocks in batch", K(ret), K(read_infos.count()));
+    } else if (FALSE_IT(macro_handles.reset())) {
+    } else if (OB_FAIL(macro_handles.prepare_allocate(block_count))) {
+      LOG_WARN("Fail to prepare allocate macro handles", K(ret), K(block_count));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < block_count; ++i) {
+      if (in_ssd_cache[i]) {
+        macro_handles.at(i) = ssd_handles[i];
+      } else {
+        macro_handles.at(i) = disk_handles.at(disk_idx++);
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    EVENT_ADD(ObStatEventIds::IO_READ_PREFETCH_MICRO_COUNT, read_infos.count());
+    EVENT_ADD(ObStatEventIds::IO_READ_PREFETCH_MICRO_BYTES, total_size);
+  }
+  return ret;
+}
+
+bool ObIMicroBlockCache::need_write_extra_buf(const ObIndexBlockRowHeader &idx_header)
+{
+  return idx_header.is_data_index()
+      && (!idx_header.is_data_block()
+          || (ObStoreFormat::is_row_store_type_with_encoding(idx_header.get_row_store_type())));
+}
+
 int ObIMicroBlockCache::prefetch(
     const uint64_t tenant_id,
     const MacroBlockId &macro_id,
@@ -846,6 +1159,27 @@ int ObIMicroBlockCache::prefetch(
     const common::ObQueryFlag &flag,
     ObMacroBlockHandle &macro_handle,
     ObIMicroBlockIOCallback &callback)
+{
+  int ret = OB_SUCCESS;
+  ObMacroBlockReadInfo read_info;
+  if (OB_FAIL(fill_prefetch_info(tenant_id, macro_id, idx_row, flag, callback, read_info))) {
+    LOG_WARN("Fail to fill prefetch info", K(ret), K(idx_row));
+  } else if (OB_FAIL(ObBlockManager::async_read_block(read_info, macro_handle))) {
+    STORAGE_LOG(WARN, "Fail to async read block, ", K(ret));
+  } else {
+    EVENT_INC(ObStatEventIds::IO_READ_PREFETCH_MICRO_COUNT);
+    EVENT_ADD(ObStatEventIds::IO_READ_PREFETCH_MICRO_BYTES, idx_row.get_block_size());
+  }
+  return ret;
+}
+
+int ObIMicroBlockCache::fill_prefetch_info(
+    const uint64_t tenant_id,
+    const MacroBlockId &macro_id,
+    const ObMicroIndexInfo& idx_row,
+    const common::ObQueryFlag &flag,
+    ObIMicroBlockIOCallback &callback,
+    ObMacroBlockReadInfo &read_info)
 {
   int ret = OB_SUCCESS;
   const ObIndexBlockRowHeader *idx_row_header = idx_row.row_header_;
@@ -870,19 +1204,12 @@ int ObIMicroBlockCache::prefetch(
     callback.block_des_meta_.encrypt_key_ = idx_row_header->get_encrypt_key();
     callback.use_block_cache_ = flag.is_use_block_cache();
     // fill read info
-    ObMacroBlockReadInfo read_info;
     read_info.macro_block_id_ = macro_id;
     read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
     read_info.io_desc_.set_group_id(ObIOModule::MICRO_BLOCK_CACHE_IO);
     read_info.io_callback_ = &callback;
     read_info.offset_ = idx_row.get_block_offset();
     read_info.size_ = idx_row.get_block_size();
-    if (OB_FAIL(ObBlockManager::async_read_block(read_info, macro_handle))) {
-      STORAGE_LOG(WARN, "Fail to async read block, ", K(ret));
-    } else {
-      EVENT_INC(ObStatEventIds::IO_READ_PREFETCH_MICRO_COUNT);
-      EVENT_ADD(ObStatEventIds::IO_READ_PREFETCH_MICRO_BYTES, idx_row.get_block_size());
-    }
   }
   return ret;
 }
@@ -986,10 +1313,31 @@ int ObDataMicroBlockCache::init(const char *cache_name, const int64_t priority)
 
 void ObDataMicroBlockCache::destroy()
 {
+  if (nullptr != ssd_cache_) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = set_evict_listener(nullptr))) {
+      LOG_WARN_RET(tmp_ret, "fail to unset evict listener", K(tmp_ret));
+    }
+    ssd_cache_ = nullptr;
+  }
   common::ObKVCache<ObMicroBlockCacheKey, ObMicroBlockCacheValue>::destroy();
   allocator_.destroy();
 }
 
+int ObDataMicroBlockCache::set_ssd_cache(ObMicroBlockSSDCache *ssd_cache)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(ssd_cache) || OB_UNLIKELY(!ssd_cache->is_inited())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid ssd cache", K(ret), KP(ssd_cache));
+  } else if (OB_FAIL(set_evict_listener(ssd_cache))) {
+    LOG_WARN("fail to set evict listener", K(ret));
+  } else {
+    ssd_cache_ = ssd_cache;
+  }
+  return ret;
+}
+
 int ObDataMicroBlockCache::prefetch(
     const uint64_t tenant_id,
     const MacroBlockId &macro_id,
@@ -1069,12 +1417,16 @@ int64_t ObDataMicroBlockCache::calc_value_size(const int64_t data_length,
                                                int64_t &extra_size,
                                                bool &need_decoder)
 {
-  UNUSEDx(row_count, request_count, extra_size);
+  UNUSED(row_count);
   need_decoder = false;
+  extra_size = 0;
   int64_t value_size = sizeof(ObMicroBlockCacheValue) + data_length;
   if (ObStoreFormat::is_row_store_type_with_encoding(type)) {
+    // request_count is the column count of micro block here
     need_decoder = true;
-    value_size += ObMicroBlockDecoder::MAX_CACHED_DECODER_BUF_SIZE;
+    extra_size = ObMicroBlockDecoder::get_max_decoder_cache_size(
+        request_count, GCONF._micro_block_decoder_cache_size);
+    value_size += extra_size;
   }
   return value_size;
 }
@@ -1085,11 +1437,10 @@ int ObDataMicroBlockCache::write_extra_buf(const char *block_buf,
                                            char *extra_buf,
                                            ObMicroBlockData &micro_data)
 {
-  UNUSEDx(extra_size);
   int ret = OB_SUCCESS;
 
   int64_t decoder_size = 0;
-  if (OB_FAIL(ObMicroBlockDecoder::get_decoder_cache_size(block_buf, block_size, decoder_size))) {
+  if (OB_FAIL(ObMicroBlockDecoder::get_decoder_cache_size(block_buf, block_size, extra_size, decoder_size))) {
     LOG_WARN("Fail to get decoder cache size", K(ret));
   } else if (OB_FAIL(ObMicroBlockDecoder::cache_decoders(extra_buf, decoder_size, block_buf, block_size))) {
     LOG_WARN("Fail to set cache decoder", K(ret));
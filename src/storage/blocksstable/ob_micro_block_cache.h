@@ -51,6 +51,7 @@ public:
            const MacroBlockId &block_id,
            const int64_t offset,
            const int64_t size);
+  const ObMicroBlockId &get_micro_block_id() const { return block_id_; }
   TO_STRING_KV(K_(tenant_id), K_(block_id));
 private:
   uint64_t tenant_id_;
@@ -79,6 +80,7 @@ private:
 };
 
 class ObIMicroBlockCache;
+class ObMicroBlockSSDCache;
 
 class ObMicroBlockBufferHandle
 {
@@ -206,6 +208,31 @@ private:
   common::ObKVCacheHandle cache_handle_;
 };
 
+// Reads a decompressed micro block from ssd cache and puts it back to memory cache.
+class ObSSDMicroBlockIOCallback : public ObIMicroBlockIOCallback
+{
+public:
+  ObSSDMicroBlockIOCallback();
+  virtual ~ObSSDMicroBlockIOCallback();
+  virtual int64_t size() const;
+  virtual int inner_process(const char *data_buffer, const int64_t size) override;
+  virtual int inner_deep_copy(
+      char *buf, const int64_t buf_len,
+      ObIOCallback *&callback) const override;
+  virtual const char *get_data() override;
+  TO_STRING_KV(KP_(micro_block), K_(cache_handle), K_(offset), K_(block_size),
+      K_(segment_idx), K_(segment_seq));
+private:
+  friend class ObIMicroBlockCache;
+  friend class ObMicroBlockSSDCache;
+  ObMicroBlockSSDCache *ssd_cache_;
+  int64_t block_size_; // size of micro block in data file, part of cache key
+  int64_t segment_idx_;
+  int64_t segment_seq_;
+  const ObMicroBlockCacheValue *micro_block_;
+  common::ObKVCacheHandle cache_handle_;
+};
+
 class ObMultiDataBlockIOCallback : public ObIMicroBlockIOCallback
 {
 public:
@@ -233,7 +260,7 @@ class ObIMicroBlockCache : public ObIPutSizeStat
 {
 public:
   typedef common::ObIKVCache<ObMicroBlockCacheKey, ObMicroBlockCacheValue> BaseBlockCache;
-  ObIMicroBlockCache() {}
+  ObIMicroBlockCache() : ssd_cache_(nullptr) {}
   virtual ~ObIMicroBlockCache() {}
   int get_cache_block(
       const uint64_t tenant_id,
@@ -253,6 +280,13 @@ public:
       const ObMicroIndexInfo& idx_row,
       const common::ObQueryFlag &flag,
       ObMacroBlockHandle &macro_handle);
+  // Prefetch micro blocks of @idx_rows in batch, nearby micro blocks in the same macro block
+  // are read by one io. @macro_handles[i] is the handle of @idx_rows[i].
+  int prefetch(
+      const uint64_t tenant_id,
+      const common::ObIArray<ObMicroIndexInfo> &idx_rows,
+      const common::ObQueryFlag &flag,
+      common::ObIArray<ObMacroBlockHandle> &macro_handles);
   virtual int load_block(
       const ObMicroBlockId &micro_block_id,
       const ObMicroBlockDesMeta &des_meta,
@@ -268,7 +302,25 @@ public:
                               const int64_t extra_size, char *extra_buf, ObMicroBlockData &micro_data) = 0;
   virtual ObMicroBlockData::Type get_type() = 0;
   virtual int add_put_size(const int64_t put_size) override;
+  // Decompress micro block in @buf, which is read from @offset of macro block @macro_id,
+  // and put it into cache. Used to warm up cache without index of the micro block.
+  int put_block(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroBlockDesMeta &des_meta,
+      const char *buf,
+      const int64_t offset,
+      const int64_t size);
+  static const int64_t MAX_BATCH_PREFETCH_CNT = 32;
 protected:
+  static bool need_write_extra_buf(const ObIndexBlockRowHeader &idx_header);
+  int fill_prefetch_info(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroIndexInfo& idx_row,
+      const common::ObQueryFlag &flag,
+      ObIMicroBlockIOCallback &callback,
+      ObMacroBlockReadInfo &read_info);
   int prefetch(
       const uint64_t tenant_id,
       const MacroBlockId &macro_id,
@@ -285,6 +337,22 @@ protected:
       ObIMicroBlockIOCallback &callback);
   int alloc_base_kvpair(const ObMicroBlockDesc &micro_block_desc, const int64_t key_size, const int64_t value_size,
                         ObKVCacheInstHandle &inst_handle, ObKVCacheHandle &cache_handle, ObKVCachePair *&kvpair);
+  // Read micro block of @idx_row from ssd cache asynchronously instead of data file.
+  // Return OB_ENTRY_NOT_EXIST if it is not in ssd cache.
+  int prefetch_from_ssd_cache(
+      const uint64_t tenant_id,
+      const MacroBlockId &macro_id,
+      const ObMicroIndexInfo& idx_row,
+      ObMacroBlockHandle &macro_handle);
+  // Put decompressed micro block read from ssd cache back to memory cache.
+  int put_decompressed_block(
+      const ObMicroBlockCacheKey &key,
+      const char *block_buf,
+      const int64_t block_size,
+      const ObMicroBlockCacheValue *&micro_block,
+      common::ObKVCacheHandle &cache_handle);
+protected:
+  ObMicroBlockSSDCache *ssd_cache_;
 };
 
 class ObDataMicroBlockCache
@@ -296,6 +364,9 @@ public:
   virtual ~ObDataMicroBlockCache() {}
   int init(const char *cache_name, const int64_t priority = 1);
   virtual void destroy() override;
+  // Micro blocks washed out of memory are admitted to @ssd_cache, which should be inited
+  // and outlive this cache.
+  int set_ssd_cache(ObMicroBlockSSDCache *ssd_cache);
   using ObIMicroBlockCache::prefetch;
   int prefetch(
       const uint64_t tenant_id,
@@ -800,6 +800,42 @@ int ObMicroBlockReader::get_min_or_max(
   return ret;
 }
 
+int ObMicroBlockReader::get_column_datums(
+    int32_t col,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    ObStorageDatum *datums)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == header_ ||
+                  nullptr == read_info_ ||
+                  nullptr == row_ids ||
+                  nullptr == datums ||
+                  row_cap > header_->row_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KPC(header_), KPC_(read_info), KP(row_ids), KP(datums),
+             K(row_cap), K(col));
+  } else {
+    int64_t row_idx = common::OB_INVALID_INDEX;
+    const ObColumnIndexArray &cols_index = read_info_->get_columns_index();
+    int64_t col_idx = cols_index.at(col);
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      row_idx = row_ids[i];
+      if (OB_UNLIKELY(row_idx < 0 || row_idx >= header_->row_count_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Uexpected row idx", K(ret), K(row_idx), KPC(header_));
+      } else if (OB_FAIL(flat_row_reader_.read_column(
+          data_begin_ + index_data_[row_idx],
+          index_data_[row_idx + 1] - index_data_[row_idx],
+          col_idx,
+          datums[i]))) {
+        LOG_WARN("fail to read column", K(ret), K(i), K(col_idx), K(row_idx));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObMicroBlockReader::get_aggregate_result(
     const int64_t *row_ids,
     const int64_t row_cap,
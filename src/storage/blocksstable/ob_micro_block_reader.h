@@ -118,6 +118,12 @@ public:
       const int64_t *row_ids,
       const int64_t row_cap,
       ObMicroBlockAggInfo<ObStorageDatum> &agg_info);
+  // read column @col of @row_ids, nop values are kept for caller to fill default
+  int get_column_datums(
+      int32_t col,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      ObStorageDatum *datums);
   int get_aggregate_result(
       const int64_t *row_ids,
       const int64_t row_cap,
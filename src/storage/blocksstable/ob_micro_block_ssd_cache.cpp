@@ -0,0 +1,543 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "storage/blocksstable/ob_micro_block_ssd_cache.h"
+#include "lib/checksum/ob_crc64.h"
+#include "share/config/ob_server_config.h"
+#include "share/io/ob_io_manager.h"
+#include "share/ob_io_device_helper.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+bool ObMicroBlockSSDCache::RecordHeader::is_key_equal(const ObMicroBlockCacheKey &key) const
+{
+  const ObMicroBlockId &block_id = key.get_micro_block_id();
+  return tenant_id_ == key.get_tenant_id()
+      && macro_first_id_ == block_id.macro_id_.first_id()
+      && macro_second_id_ == block_id.macro_id_.second_id()
+      && macro_third_id_ == block_id.macro_id_.third_id()
+      && block_offset_ == block_id.offset_
+      && block_size_ == block_id.size_;
+}
+
+void ObMicroBlockSSDCache::RecordHeader::set_key(const ObMicroBlockCacheKey &key)
+{
+  const ObMicroBlockId &block_id = key.get_micro_block_id();
+  tenant_id_ = key.get_tenant_id();
+  macro_first_id_ = block_id.macro_id_.first_id();
+  macro_second_id_ = block_id.macro_id_.second_id();
+  macro_third_id_ = block_id.macro_id_.third_id();
+  block_offset_ = block_id.offset_;
+  block_size_ = block_id.size_;
+}
+
+int ObMicroBlockSSDCache::RecordHeader::get_key(ObMicroBlockCacheKey &key) const
+{
+  int ret = OB_SUCCESS;
+  const MacroBlockId macro_id(macro_first_id_, macro_second_id_, macro_third_id_);
+  if (OB_UNLIKELY(!macro_id.is_valid())) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid macro id in record header", K(ret), K(macro_id));
+  } else {
+    key.set(tenant_id_, macro_id, block_offset_, block_size_);
+  }
+  return ret;
+}
+
+ObMicroBlockSSDCache::ObMicroBlockSSDCache()
+  : is_inited_(false),
+    fd_(),
+    segment_cnt_(0),
+    segment_seqs_(nullptr),
+    segment_keys_(),
+    next_segment_idx_(0),
+    index_(),
+    doorkeeper_(nullptr),
+    doorkeeper_bits_(0),
+    doorkeeper_set_cnt_(0),
+    cond_(),
+    cur_buffer_(nullptr),
+    free_buffer_cnt_(0),
+    full_buffer_cnt_(0),
+    admit_cnt_(0),
+    drop_cnt_(0),
+    hit_cnt_(0),
+    miss_cnt_(0)
+{
+}
+
+ObMicroBlockSSDCache::~ObMicroBlockSSDCache()
+{
+  destroy();
+}
+
+int ObMicroBlockSSDCache::init(const char *file_path, const int64_t file_size)
+{
+  int ret = OB_SUCCESS;
+  const ObMemAttr attr(OB_SERVER_TENANT_ID, "MicroSSDCache");
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_ISNULL(file_path) || OB_UNLIKELY(0 == STRLEN(file_path)
+      || file_size < MIN_SEGMENT_CNT * SEGMENT_SIZE)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(file_path), K(file_size));
+  } else {
+    segment_cnt_ = file_size / SEGMENT_SIZE;
+    next_segment_idx_ = 0;
+    const int64_t record_cnt = segment_cnt_ * (SEGMENT_SIZE / AVG_RECORD_SIZE);
+    doorkeeper_bits_ = upper_align(record_cnt * 4, 64);
+    if (OB_FAIL(THE_IO_DEVICE->open(file_path, O_CREAT | O_DIRECT | O_RDWR, S_IRUSR | S_IWUSR, fd_))) {
+      LOG_WARN("fail to open ssd cache file", K(ret), K(file_path));
+    } else if (OB_FAIL(THE_IO_DEVICE->fallocate(fd_, 0, 0, segment_cnt_ * SEGMENT_SIZE))) {
+      LOG_WARN("fail to fallocate ssd cache file", K(ret), K(file_path), K_(segment_cnt));
+    } else if (OB_ISNULL(segment_seqs_ = static_cast<int64_t *>(
+        ob_malloc(sizeof(int64_t) * segment_cnt_, attr)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc segment seqs", K(ret), K_(segment_cnt));
+    } else if (FALSE_IT(segment_keys_.set_attr(attr))) {
+    } else if (OB_FAIL(segment_keys_.prepare_allocate(segment_cnt_))) {
+      LOG_WARN("fail to alloc segment keys", K(ret), K_(segment_cnt));
+    } else if (OB_ISNULL(doorkeeper_ = static_cast<uint64_t *>(
+        ob_malloc(doorkeeper_bits_ / CHAR_BIT, attr)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc doorkeeper", K(ret), K_(doorkeeper_bits));
+    } else if (OB_FAIL(index_.create(record_cnt, attr))) {
+      LOG_WARN("fail to create index", K(ret), K(record_cnt));
+    } else if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+      LOG_WARN("fail to init cond", K(ret));
+    } else {
+      MEMSET(segment_seqs_, 0, sizeof(int64_t) * segment_cnt_);
+      for (int64_t i = 0; i < segment_cnt_; ++i) {
+        segment_keys_.at(i).set_attr(attr);
+      }
+      MEMSET(doorkeeper_, 0, doorkeeper_bits_ / CHAR_BIT);
+      doorkeeper_set_cnt_ = 0;
+      for (int64_t i = 0; OB_SUCC(ret) && i < WRITE_BUFFER_CNT; ++i) {
+        WriteBuffer &write_buffer = write_buffers_[i];
+        if (OB_ISNULL(write_buffer.buf_ = static_cast<char *>(
+            ob_malloc_align(DIO_ALIGN_SIZE, SEGMENT_SIZE, attr)))) {
+          ret = OB_ALLOCATE_MEMORY_FAILED;
+          LOG_WARN("fail to alloc write buffer", K(ret), K(i));
+        } else {
+          write_buffer.pos_ = 0;
+          free_buffers_[free_buffer_cnt_++] = &write_buffer;
+        }
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (FALSE_IT(is_inited_ = true)) {
+    } else if (OB_FAIL(lib::ThreadPool::start())) {
+      LOG_WARN("fail to start ssd cache writer", K(ret));
+    } else {
+      LOG_INFO("micro block ssd cache inited", K(file_path), K(file_size), K(*this));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  }
+  return ret;
+}
+
+void ObMicroBlockSSDCache::destroy()
+{
+  lib::ThreadPool::stop();
+  lib::ThreadPool::wait();
+  lib::ThreadPool::destroy();
+  if (is_inited_) {
+    ObThreadCondGuard guard(cond_);
+    is_inited_ = false;
+  }
+  free_write_buffers();
+  index_.destroy();
+  if (nullptr != segment_seqs_) {
+    ob_free(segment_seqs_);
+    segment_seqs_ = nullptr;
+  }
+  segment_keys_.destroy();
+  if (nullptr != doorkeeper_) {
+    ob_free(doorkeeper_);
+    doorkeeper_ = nullptr;
+  }
+  cond_.destroy();
+  if (fd_.is_valid()) {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_SUCCESS != (tmp_ret = THE_IO_DEVICE->close(fd_))) {
+      LOG_WARN_RET(tmp_ret, "fail to close ssd cache file", K(tmp_ret), K_(fd));
+    }
+    fd_.reset();
+  }
+  segment_cnt_ = 0;
+  next_segment_idx_ = 0;
+  doorkeeper_bits_ = 0;
+  doorkeeper_set_cnt_ = 0;
+}
+
+void ObMicroBlockSSDCache::free_write_buffers()
+{
+  for (int64_t i = 0; i < WRITE_BUFFER_CNT; ++i) {
+    if (nullptr != write_buffers_[i].buf_) {
+      ob_free_align(write_buffers_[i].buf_);
+      write_buffers_[i].buf_ = nullptr;
+    }
+    write_buffers_[i].pos_ = 0;
+  }
+  cur_buffer_ = nullptr;
+  free_buffer_cnt_ = 0;
+  full_buffer_cnt_ = 0;
+}
+
+void ObMicroBlockSSDCache::on_evict(const ObIKVCacheKey &key, const ObIKVCacheValue &value)
+{
+  if (is_inited_) {
+    const ObMicroBlockCacheKey &block_key = static_cast<const ObMicroBlockCacheKey &>(key);
+    const ObMicroBlockData &block_data =
+        static_cast<const ObMicroBlockCacheValue &>(value).get_block_data();
+    const int64_t record_size = upper_align(
+        static_cast<int64_t>(sizeof(RecordHeader)) + block_data.get_buf_size(), RECORD_ALIGN_SIZE);
+    if (OB_ISNULL(block_data.get_buf()) || block_data.get_buf_size() <= 0
+        || record_size > SEGMENT_SIZE) {
+      // not cacheable
+    } else if (admit(block_key)) {
+      append(block_key, block_data.get_buf(), block_data.get_buf_size());
+    }
+  }
+}
+
+bool ObMicroBlockSSDCache::admit(const ObMicroBlockCacheKey &key)
+{
+  bool bret = false;
+  Location location;
+  if (OB_SUCCESS == index_.get_refactored(key, location)
+      && location.segment_seq_ == ATOMIC_LOAD(&segment_seqs_[location.segment_idx_])) {
+    // still in cache
+  } else {
+    const uint64_t bit_idx = key.hash() % doorkeeper_bits_;
+    const uint64_t mask = 1ULL << (bit_idx % 64);
+    uint64_t *word = &doorkeeper_[bit_idx / 64];
+    uint64_t old_word = ATOMIC_LOAD(word);
+    while (0 == (old_word & mask) && !ATOMIC_BCAS(word, old_word, old_word | mask)) {
+      old_word = ATOMIC_LOAD(word);
+    }
+    if (0 != (old_word & mask)) {
+      bret = true;
+    } else if (ATOMIC_AAF(&doorkeeper_set_cnt_, 1) > doorkeeper_bits_ / 2) {
+      // start a new window before too many bits are set
+      MEMSET(doorkeeper_, 0, doorkeeper_bits_ / CHAR_BIT);
+      ATOMIC_STORE(&doorkeeper_set_cnt_, 0);
+    }
+  }
+  return bret;
+}
+
+void ObMicroBlockSSDCache::append(const ObMicroBlockCacheKey &key, const char *data, const int64_t data_size)
+{
+  const int64_t record_size = upper_align(
+      static_cast<int64_t>(sizeof(RecordHeader)) + data_size, RECORD_ALIGN_SIZE);
+  const int64_t data_checksum = static_cast<int64_t>(ob_crc64(data, data_size));
+  bool is_appended = false;
+  {
+    ObThreadCondGuard guard(cond_);
+    if (OB_UNLIKELY(!is_inited_)) {
+    } else {
+      if (nullptr != cur_buffer_ && cur_buffer_->pos_ + record_size > SEGMENT_SIZE) {
+        full_buffers_[full_buffer_cnt_++] = cur_buffer_;
+        cur_buffer_ = nullptr;
+        cond_.signal();
+      }
+      if (nullptr == cur_buffer_ && free_buffer_cnt_ > 0) {
+        cur_buffer_ = free_buffers_[--free_buffer_cnt_];
+        cur_buffer_->pos_ = 0;
+      }
+      if (nullptr != cur_buffer_) {
+        RecordHeader *header = new (cur_buffer_->buf_ + cur_buffer_->pos_) RecordHeader();
+        header->magic_ = RecordHeader::RECORD_MAGIC;
+        header->data_size_ = static_cast<int32_t>(data_size);
+        header->data_checksum_ = data_checksum;
+        header->set_key(key);
+        MEMCPY(cur_buffer_->buf_ + cur_buffer_->pos_ + sizeof(RecordHeader), data, data_size);
+        cur_buffer_->pos_ += record_size;
+        is_appended = true;
+      }
+    }
+  }
+  if (is_appended) {
+    ATOMIC_INC(&admit_cnt_);
+  } else {
+    ATOMIC_INC(&drop_cnt_);
+  }
+}
+
+int ObMicroBlockSSDCache::locate(const ObMicroBlockCacheKey &key, Location &location)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(index_.get_refactored(key, location))) {
+    if (OB_HASH_NOT_EXIST == ret) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      LOG_WARN("fail to get location", K(ret), K(key));
+    }
+  } else if (location.segment_seq_ != ATOMIC_LOAD(&segment_seqs_[location.segment_idx_])) {
+    ret = OB_ENTRY_NOT_EXIST;
+  }
+  if (OB_FAIL(ret)) {
+    ATOMIC_INC(&miss_cnt_);
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::check_record(
+    const ObMicroBlockCacheKey &key,
+    const int64_t segment_idx,
+    const int64_t segment_seq,
+    const char *buf,
+    const int64_t size,
+    const char *&block_buf,
+    int64_t &block_size)
+{
+  int ret = OB_SUCCESS;
+  block_buf = nullptr;
+  block_size = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(segment_idx < 0 || segment_idx >= segment_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid segment idx", K(ret), K(segment_idx), K_(segment_cnt));
+  } else if (segment_seq != ATOMIC_LOAD(&segment_seqs_[segment_idx])) {
+    // segment is overwritten while reading
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (OB_ISNULL(buf) || OB_UNLIKELY(size < static_cast<int64_t>(sizeof(RecordHeader)))) {
+    ret = OB_CHECKSUM_ERROR;
+    LOG_WARN("ssd cache record is truncated", K(ret), K(key), KP(buf), K(size));
+  } else {
+    RecordHeader header;
+    MEMCPY(&header, buf, sizeof(RecordHeader));
+    const char *data = buf + sizeof(RecordHeader);
+    if (OB_UNLIKELY(!header.is_valid() || !header.is_key_equal(key)
+        || static_cast<int64_t>(sizeof(RecordHeader)) + header.data_size_ > size
+        || header.data_checksum_ != static_cast<int64_t>(ob_crc64(data, header.data_size_)))) {
+      ret = OB_CHECKSUM_ERROR;
+      LOG_WARN("ssd cache record is corrupted", K(ret), K(key), K(segment_idx), K(size));
+    } else {
+      block_buf = data;
+      block_size = header.data_size_;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ATOMIC_INC(&hit_cnt_);
+  } else {
+    ATOMIC_INC(&miss_cnt_);
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::get(
+    const ObMicroBlockCacheKey &key,
+    ObIOHandle &io_handle,
+    const char *&block_buf,
+    int64_t &block_size)
+{
+  int ret = OB_SUCCESS;
+  Location location;
+  block_buf = nullptr;
+  block_size = 0;
+  if (OB_FAIL(locate(key, location))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("fail to locate", K(ret), K(key));
+    }
+  } else {
+    const int64_t io_timeout_ms = GCONF._data_storage_io_timeout / 1000L;
+    ObIOInfo io_info;
+    fill_io_info(location.segment_idx_ * SEGMENT_SIZE + location.offset_, location.size_, io_info);
+    io_info.flag_.set_read();
+    io_info.flag_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    if (OB_FAIL(ObIOManager::get_instance().read(io_info, io_handle, io_timeout_ms))) {
+      LOG_WARN("fail to read ssd cache", K(ret), K(key), K(location));
+    } else if (OB_FAIL(check_record(key, location.segment_idx_, location.segment_seq_,
+        io_handle.get_buffer(), io_handle.get_data_size(), block_buf, block_size))) {
+      if (OB_ENTRY_NOT_EXIST != ret) {
+        LOG_WARN("fail to check ssd cache record", K(ret), K(key), K(location));
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    io_handle.reset();
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::aio_get(
+    const ObMicroBlockCacheKey &key,
+    ObSSDMicroBlockIOCallback &callback,
+    ObIOHandle &io_handle)
+{
+  int ret = OB_SUCCESS;
+  Location location;
+  if (OB_FAIL(locate(key, location))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("fail to locate", K(ret), K(key));
+    }
+  } else {
+    callback.ssd_cache_ = this;
+    callback.segment_idx_ = location.segment_idx_;
+    callback.segment_seq_ = location.segment_seq_;
+    ObIOInfo io_info;
+    fill_io_info(location.segment_idx_ * SEGMENT_SIZE + location.offset_, location.size_, io_info);
+    io_info.flag_.set_read();
+    io_info.flag_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    io_info.callback_ = &callback;
+    if (OB_FAIL(ObIOManager::get_instance().aio_read(io_info, io_handle))) {
+      LOG_WARN("fail to aio read ssd cache", K(ret), K(key), K(location));
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockSSDCache::run1()
+{
+  int ret = OB_SUCCESS;
+  lib::set_thread_name("MicroSSDCache");
+  while (!has_set_stop()) {
+    WriteBuffer *write_buffer = nullptr;
+    {
+      ObThreadCondGuard guard(cond_);
+      if (0 == full_buffer_cnt_) {
+        cond_.wait(FLUSH_WAIT_INTERVAL_MS);
+      }
+      if (full_buffer_cnt_ > 0) {
+        write_buffer = full_buffers_[0];
+        for (int64_t i = 1; i < full_buffer_cnt_; ++i) {
+          full_buffers_[i - 1] = full_buffers_[i];
+        }
+        --full_buffer_cnt_;
+      }
+    }
+    if (nullptr != write_buffer) {
+      if (OB_FAIL(write_segment(*write_buffer))) {
+        LOG_WARN("fail to write segment", K(ret), K(*this));
+      }
+      ObThreadCondGuard guard(cond_);
+      write_buffer->pos_ = 0;
+      free_buffers_[free_buffer_cnt_++] = write_buffer;
+    }
+    if (REACH_TIME_INTERVAL(60 * 1000 * 1000L)) {
+      LOG_INFO("micro block ssd cache status", K(*this), "index_cnt", index_.size());
+    }
+  }
+}
+
+int ObMicroBlockSSDCache::write_segment(WriteBuffer &write_buffer)
+{
+  int ret = OB_SUCCESS;
+  const int64_t segment_idx = next_segment_idx_;
+  const int64_t segment_seq = ATOMIC_LOAD(&segment_seqs_[segment_idx]) + 1;
+  next_segment_idx_ = (next_segment_idx_ + 1) % segment_cnt_;
+  if (segment_seq > 1 && OB_FAIL(evict_segment(segment_idx, segment_seq - 1))) {
+    // records left in index are ignored by sequence check
+    LOG_WARN("fail to evict segment", K(ret), K(segment_idx), K(segment_seq));
+    ret = OB_SUCCESS;
+  }
+  // readers of the old records find the sequence changed after reading
+  ATOMIC_STORE(&segment_seqs_[segment_idx], segment_seq);
+  MEMSET(write_buffer.buf_ + write_buffer.pos_, 0, SEGMENT_SIZE - write_buffer.pos_);
+  const int64_t io_timeout_ms = GCONF._data_storage_io_timeout / 1000L;
+  ObIOInfo io_info;
+  fill_io_info(segment_idx * SEGMENT_SIZE, SEGMENT_SIZE, io_info);
+  io_info.tenant_id_ = OB_SERVER_TENANT_ID;
+  io_info.flag_.set_write();
+  io_info.flag_.set_wait_event(ObWaitEventIds::DB_FILE_COMPACT_WRITE);
+  io_info.buf_ = write_buffer.buf_;
+  if (OB_FAIL(ObIOManager::get_instance().write(io_info, io_timeout_ms))) {
+    LOG_WARN("fail to write segment", K(ret), K(segment_idx), K(io_info));
+  } else if (OB_FAIL(publish_segment(write_buffer, segment_idx, segment_seq))) {
+    LOG_WARN("fail to publish segment", K(ret), K(segment_idx), K(segment_seq));
+  }
+  return ret;
+}
+
+int ObMicroBlockSSDCache::evict_segment(const int64_t segment_idx, const int64_t segment_seq)
+{
+  int ret = OB_SUCCESS;
+  SegmentKeys &keys = segment_keys_.at(segment_idx);
+  for (int64_t i = 0; OB_SUCC(ret) && i < keys.count(); ++i) {
+    const ObMicroBlockCacheKey &key = keys.at(i);
+    Location location;
+    if (OB_SUCCESS == index_.get_refactored(key, location)
+        && location.segment_idx_ == segment_idx && location.segment_seq_ == segment_seq) {
+      if (OB_FAIL(index_.erase_refactored(key))) {
+        if (OB_HASH_NOT_EXIST == ret) {
+          ret = OB_SUCCESS;
+        } else {
+          LOG_WARN("fail to erase key", K(ret), K(key));
+        }
+      }
+    }
+  }
+  keys.reuse();
+  return ret;
+}
+
+int ObMicroBlockSSDCache::publish_segment(
+    const WriteBuffer &write_buffer,
+    const int64_t segment_idx,
+    const int64_t segment_seq)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  SegmentKeys &keys = segment_keys_.at(segment_idx);
+  keys.reuse();
+  while (OB_SUCC(ret) && pos < write_buffer.pos_) {
+    const RecordHeader *header = reinterpret_cast<const RecordHeader *>(write_buffer.buf_ + pos);
+    const int64_t record_size = upper_align(
+        static_cast<int64_t>(sizeof(RecordHeader)) + header->data_size_, RECORD_ALIGN_SIZE);
+    ObMicroBlockCacheKey key;
+    if (OB_FAIL(header->get_key(key))) {
+      LOG_WARN("fail to get key", K(ret), K(pos));
+    } else if (OB_FAIL(index_.set_refactored(
+        key, Location(segment_idx, segment_seq, pos, record_size), 1 /* overwrite */))) {
+      LOG_WARN("fail to set location", K(ret), K(key));
+    } else if (OB_FAIL(keys.push_back(key))) {
+      // the location is left in index, which is ignored by sequence check after overwritten
+      LOG_WARN("fail to push back key", K(ret), K(key));
+    } else {
+      pos += record_size;
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockSSDCache::fill_io_info(const int64_t offset, const int64_t size, ObIOInfo &io_info) const
+{
+  uint64_t tenant_id = MTL_ID();
+  if (is_virtual_tenant_id(tenant_id) || 0 == tenant_id) {
+    tenant_id = OB_SERVER_TENANT_ID;
+  }
+  io_info.tenant_id_ = tenant_id;
+  io_info.fd_ = fd_;
+  io_info.offset_ = offset;
+  io_info.size_ = static_cast<int32_t>(size);
+  io_info.flag_.set_group_id(ObIOModule::MICRO_BLOCK_CACHE_IO);
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_MICRO_BLOCK_SSD_CACHE_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_MICRO_BLOCK_SSD_CACHE_H_
+
+#include "lib/container/ob_array.h"
+#include "lib/hash/ob_hashmap.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/thread/thread_pool.h"
+#include "share/cache/ob_kvcache_struct.h"
+#include "share/io/ob_io_define.h"
+#include "ob_micro_block_cache.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Second tier of data micro block cache on a local file, which is usually on a device faster
+// than data files.
+//
+// Micro blocks washed out of memory are admitted in decompressed form. The file is split into
+// segments which are written in turn as a ring by a background thread, so the oldest segment
+// is evicted when the file is full. Records of a segment are published to the index after the
+// segment is written, and removed from the index before the segment is overwritten. Keys of
+// each segment are kept in memory, so that eviction does not read the segment back.
+//
+// Admission: a micro block is admitted when it is evicted for the second time in a window
+// of evictions, blocks only read once are filtered out. Blocks are dropped when all write
+// buffers are full, the memory eviction never waits for io.
+//
+// Lookup: the memory cache probe never reads this file. Blocks are read back asynchronously
+// by the prefetch io path instead of the data file, see ObSSDMicroBlockIOCallback.
+class ObMicroBlockSSDCache : public common::ObIKVCacheEvictListener, public lib::ThreadPool
+{
+public:
+  ObMicroBlockSSDCache();
+  virtual ~ObMicroBlockSSDCache();
+  int init(const char *file_path, const int64_t file_size);
+  void destroy();
+  bool is_inited() const { return is_inited_; }
+  virtual void on_evict(const common::ObIKVCacheKey &key, const common::ObIKVCacheValue &value) override;
+  // Read the decompressed micro block of @key, @block_buf is valid while @io_handle is held.
+  // Return OB_ENTRY_NOT_EXIST if the block is not in cache.
+  int get(
+      const ObMicroBlockCacheKey &key,
+      common::ObIOHandle &io_handle,
+      const char *&block_buf,
+      int64_t &block_size);
+  // Issue async read of the micro block of @key, @callback checks the record and puts the
+  // block back to memory cache. Return OB_ENTRY_NOT_EXIST if the block is not in cache.
+  int aio_get(
+      const ObMicroBlockCacheKey &key,
+      ObSSDMicroBlockIOCallback &callback,
+      common::ObIOHandle &io_handle);
+  // Check the record read from @segment_idx, which may be overwritten while reading.
+  int check_record(
+      const ObMicroBlockCacheKey &key,
+      const int64_t segment_idx,
+      const int64_t segment_seq,
+      const char *buf,
+      const int64_t size,
+      const char *&block_buf,
+      int64_t &block_size);
+  virtual void run1() override;
+  TO_STRING_KV(K_(is_inited), K_(fd), K_(segment_cnt), K_(next_segment_idx), K_(admit_cnt),
+      K_(drop_cnt), K_(hit_cnt), K_(miss_cnt));
+
+private:
+  struct RecordHeader
+  {
+    static const uint32_t RECORD_MAGIC = 0x53534443; // "SSDC"
+    RecordHeader() { MEMSET(this, 0, sizeof(*this)); }
+    bool is_valid() const { return RECORD_MAGIC == magic_ && data_size_ > 0; }
+    bool is_key_equal(const ObMicroBlockCacheKey &key) const;
+    void set_key(const ObMicroBlockCacheKey &key);
+    int get_key(ObMicroBlockCacheKey &key) const;
+    uint32_t magic_;
+    int32_t data_size_;
+    uint64_t tenant_id_;
+    int64_t macro_first_id_;
+    int64_t macro_second_id_;
+    int64_t macro_third_id_;
+    int32_t block_offset_;
+    int32_t block_size_;
+    int64_t data_checksum_;
+  };
+  struct Location
+  {
+    Location() : segment_idx_(0), segment_seq_(0), offset_(0), size_(0) {}
+    Location(const int64_t segment_idx, const int64_t segment_seq, const int64_t offset, const int64_t size)
+      : segment_idx_(segment_idx), segment_seq_(segment_seq), offset_(offset), size_(size) {}
+    TO_STRING_KV(K_(segment_idx), K_(segment_seq), K_(offset), K_(size));
+    int64_t segment_idx_;
+    int64_t segment_seq_;
+    int64_t offset_;
+    int64_t size_;
+  };
+  struct WriteBuffer
+  {
+    WriteBuffer() : buf_(nullptr), pos_(0) {}
+    char *buf_;
+    int64_t pos_;
+  };
+  typedef common::hash::ObHashMap<ObMicroBlockCacheKey, Location> IndexMap;
+  typedef common::ObArray<ObMicroBlockCacheKey> SegmentKeys;
+
+  static const int64_t SEGMENT_SIZE = 2L * 1024L * 1024L;
+  static const int64_t MIN_SEGMENT_CNT = 4;
+  static const int64_t WRITE_BUFFER_CNT = 4;
+  static const int64_t RECORD_ALIGN_SIZE = 8;
+  static const int64_t AVG_RECORD_SIZE = 16L * 1024L;
+  static const int64_t FLUSH_WAIT_INTERVAL_MS = 1000;
+
+  int locate(const ObMicroBlockCacheKey &key, Location &location);
+  bool admit(const ObMicroBlockCacheKey &key);
+  void append(const ObMicroBlockCacheKey &key, const char *data, const int64_t data_size);
+  int write_segment(WriteBuffer &write_buffer);
+  int evict_segment(const int64_t segment_idx, const int64_t segment_seq);
+  int publish_segment(const WriteBuffer &write_buffer, const int64_t segment_idx, const int64_t segment_seq);
+  void fill_io_info(const int64_t offset, const int64_t size, common::ObIOInfo &io_info) const;
+  void free_write_buffers();
+
+private:
+  bool is_inited_;
+  common::ObIOFd fd_;
+  int64_t segment_cnt_;
+  // sequence of each segment, increased before the segment is overwritten
+  int64_t *segment_seqs_;
+  // keys of records published in each segment, only accessed by the writer thread
+  common::ObArray<SegmentKeys> segment_keys_;
+  int64_t next_segment_idx_;
+  IndexMap index_;
+  // admission filter, a bit is set when a micro block hashed to it is evicted
+  uint64_t *doorkeeper_;
+  int64_t doorkeeper_bits_;
+  int64_t doorkeeper_set_cnt_;
+  common::ObThreadCond cond_;
+  WriteBuffer write_buffers_[WRITE_BUFFER_CNT];
+  WriteBuffer *cur_buffer_;
+  WriteBuffer *free_buffers_[WRITE_BUFFER_CNT];
+  int64_t free_buffer_cnt_;
+  WriteBuffer *full_buffers_[WRITE_BUFFER_CNT];
+  int64_t full_buffer_cnt_;
+  int64_t admit_cnt_;
+  int64_t drop_cnt_;
+  int64_t hit_cnt_;
+  int64_t miss_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockSSDCache);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_MICRO_BLOCK_SSD_CACHE_H_
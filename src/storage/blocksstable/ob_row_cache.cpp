@@ -255,6 +255,53 @@ int ObRowCache::get_row(const ObRowCacheKey &key, ObRowValueHandle &handle)
 }
 
 
+int ObRowCache::batch_get_row(
+    const ObRowCacheKey *const *keys,
+    const int64_t count,
+    ObRowValueHandle *const *handles)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == keys || count <= 0 || nullptr == handles)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), KP(keys), K(count), KP(handles));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+      if (OB_ISNULL(keys[i]) || OB_ISNULL(handles[i]) || OB_UNLIKELY(!keys[i]->is_valid())) {
+        ret = OB_INVALID_ARGUMENT;
+        STORAGE_LOG(WARN, "invalid row cache key or handle", K(ret), K(i), KPC(keys[i]), KP(handles[i]));
+      } else {
+        handles[i]->reset();
+      }
+    }
+  }
+  const ObRowCacheValue *values[BATCH_GET_ROW_CNT];
+  ObKVCacheHandle cache_handles[BATCH_GET_ROW_CNT];
+  for (int64_t begin = 0; OB_SUCC(ret) && begin < count; begin += BATCH_GET_ROW_CNT) {
+    const int64_t batch_cnt = MIN(count - begin, BATCH_GET_ROW_CNT);
+    if (OB_FAIL(batch_get(keys + begin, batch_cnt, values, cache_handles))) {
+      STORAGE_LOG(WARN, "Fail to batch get keys from row cache", K(ret), K(batch_cnt));
+    } else {
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        if (nullptr == values[i]) {
+          EVENT_INC(ObStatEventIds::ROW_CACHE_MISS);
+        } else {
+          EVENT_INC(ObStatEventIds::ROW_CACHE_HIT);
+          handles[begin + i]->row_value_ = const_cast<ObRowCacheValue *>(values[i]);
+          handles[begin + i]->handle_.move_from(cache_handles[i]);
+        }
+      }
+    }
+  }
+  if (OB_FAIL(ret) && nullptr != handles) {
+    for (int64_t i = 0; i < count; ++i) {
+      if (nullptr != handles[i]) {
+        handles[i]->reset();
+      }
+    }
+  }
+  return ret;
+}
+
 int ObRowCache::put_row(const ObRowCacheKey &key, const ObRowCacheValue &value)
 {
   int ret = OB_SUCCESS;
@@ -103,7 +103,11 @@ public:
   ObRowCache();
   virtual ~ObRowCache();
   int get_row(const ObRowCacheKey &key, ObRowValueHandle &handle);
+  // Get rows of @count keys in a batch, handles[i] is reset if keys[i] is not in cache.
+  int batch_get_row(const ObRowCacheKey *const *keys, const int64_t count, ObRowValueHandle *const *handles);
   int put_row(const ObRowCacheKey &key, const ObRowCacheValue &value);
+private:
+  static const int64_t BATCH_GET_ROW_CNT = 32;
   DISALLOW_COPY_AND_ASSIGN(ObRowCache);
 };
 
@@ -11,6 +11,7 @@
  */
 
 #include "ob_storage_cache_suite.h"
+#include "share/config/ob_server_config.h"
 
 using namespace oceanbase::common;
 
@@ -67,7 +68,32 @@ int ObStorageCacheSuite::init(
     STORAGE_LOG(ERROR, "fail to init fuse row cache", K(ret));
   } else if (OB_FAIL(storage_meta_cache_.init("storage_meta_cache", storage_meta_cache_priority))) {
     STORAGE_LOG(ERROR, "fail to init storage meta cache", K(ret), K(storage_meta_cache_priority));
+  } else if (GCONF._micro_block_ssd_cache_size <= 0
+      || 0 == STRLEN(GCONF._micro_block_ssd_cache_path.str())) {
+    // ssd cache is disabled
   } else {
+    // ssd cache is optional, the tier is left disabled if it can not be set up
+    int tmp_ret = OB_SUCCESS;
+    if (OB_TMP_FAIL(micro_block_ssd_cache_.init(GCONF._micro_block_ssd_cache_path.str(),
+                                                GCONF._micro_block_ssd_cache_size))) {
+      STORAGE_LOG(WARN, "fail to init micro block ssd cache, disable it", K(tmp_ret));
+    } else if (OB_TMP_FAIL(user_block_cache_.set_ssd_cache(&micro_block_ssd_cache_))) {
+      STORAGE_LOG(WARN, "fail to set ssd cache of user block cache, disable it", K(tmp_ret));
+      micro_block_ssd_cache_.destroy();
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (0 == STRLEN(GCONF._block_cache_snapshot_path.str())) {
+    // block cache snapshot is disabled
+  } else {
+    // block cache snapshot is optional, server starts without it
+    int tmp_ret = OB_SUCCESS;
+    if (OB_TMP_FAIL(block_cache_snapshot_.init(GCONF._block_cache_snapshot_path.str(),
+                                              user_block_cache_, index_block_cache_))) {
+      STORAGE_LOG(WARN, "fail to init block cache snapshot, disable it", K(tmp_ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
     is_inited_ = true;
   }
 
@@ -117,12 +143,14 @@ int ObStorageCacheSuite::set_bf_cache_miss_count_threshold(const int64_t bf_cach
 
 void ObStorageCacheSuite::destroy()
 {
+  block_cache_snapshot_.destroy();
   index_block_cache_.destroy();
   user_block_cache_.destroy();
   user_row_cache_.destroy();
   bf_cache_.destroy();
   fuse_row_cache_.destroy();
   storage_meta_cache_.destory();
+  micro_block_ssd_cache_.destroy();
   is_inited_ = false;
 }
 
@@ -16,6 +16,8 @@
 #include "storage/meta_mem/ob_storage_meta_cache.h"
 #include "share/schema/ob_table_schema.h"
 #include "ob_micro_block_cache.h"
+#include "ob_micro_block_ssd_cache.h"
+#include "ob_block_cache_snapshot.h"
 #include "ob_row_cache.h"
 #include "ob_fuse_row_cache.h"
 #include "ob_bloom_filter_cache.h"
@@ -53,6 +55,8 @@ public:
   ObBloomFilterCache &get_bf_cache() { return bf_cache_; }
   ObFuseRowCache &get_fuse_row_cache() { return fuse_row_cache_; }
   ObStorageMetaCache &get_storage_meta_cache() { return storage_meta_cache_; }
+  ObMicroBlockSSDCache &get_micro_block_ssd_cache() { return micro_block_ssd_cache_; }
+  ObBlockCacheSnapshot &get_block_cache_snapshot() { return block_cache_snapshot_; }
   void destroy();
   inline bool is_inited() const { return is_inited_; }
   TO_STRING_KV(K(is_inited_));
@@ -65,6 +69,8 @@ private:
   ObBloomFilterCache bf_cache_;
   ObFuseRowCache fuse_row_cache_;
   ObStorageMetaCache storage_meta_cache_;
+  ObMicroBlockSSDCache micro_block_ssd_cache_;
+  ObBlockCacheSnapshot block_cache_snapshot_;
   bool is_inited_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObStorageCacheSuite);
@@ -345,6 +345,40 @@ int ScanHandle<BtreeKey, BtreeVal>::get(BtreeKey &key, BtreeVal &val, bool is_ba
   return ret;
 }
 
+template<typename BtreeKey, typename BtreeVal>
+int ScanHandle<BtreeKey, BtreeVal>::get_leaf_run(const bool is_backward, BtreeKV *kvs,
+                                                 const int64_t capacity, int64_t &count)
+{
+  int ret = OB_SUCCESS;
+  BtreeNode *leaf = nullptr;
+  int pos = 0;
+  count = 0;
+  if (OB_FAIL(path_.top(leaf, pos))) {
+    ret = OB_ITER_END;
+  } else if (OB_UNLIKELY(!leaf->is_leaf())) {
+    // do nothing
+  } else {
+    // step as scan_forward/scan_backward without skip_inactive
+    const int64_t version = 0;
+    MultibitSet *index = &this->index_;
+    const int size = leaf->size(index);
+    while (count < capacity) {
+      const int next = is_backward ? leaf->get_prev_active_child(pos, version, nullptr, index)
+          : leaf->get_next_active_child(pos, version, nullptr, index);
+      if (next < 0 || next >= size) {
+        break;
+      } else {
+        kvs[count].key_ = leaf->get_key(pos, index);
+        kvs[count].val_ = leaf->get_val_with_tag(pos, version_, index);
+        ++count;
+        pos = next;
+      }
+    }
+    path_.set_top_pos(pos);
+  }
+  return ret;
+}
+
 template<typename BtreeKey, typename BtreeVal>
 int ScanHandle<BtreeKey, BtreeVal>::pop_level_node(const bool is_backward, const int64_t level, const double ratio,
     const int64_t gap_limit, int64_t &element_count, int64_t &phy_element_count,
@@ -987,6 +1021,47 @@ int Iterator<BtreeKey, BtreeVal>::get_next(BtreeKey &key, BtreeVal &value)
   return ret;
 }
 
+template<typename BtreeKey, typename BtreeVal>
+int Iterator<BtreeKey, BtreeVal>::get_next_batch(BtreeKV *kvs, const int64_t capacity, int64_t &count)
+{
+  int ret = OB_SUCCESS;
+  count = 0;
+  while (OB_SUCC(ret) && count < capacity) {
+    if (iter_count_ > 0 && !is_iter_end_) {
+      BtreeKey key;
+      BtreeVal value;
+      BtreeKey* jump_key = nullptr;
+      int cmp = 0;
+      int64_t run_count = 0;
+      if (OB_FAIL(scan_handle_.get(key, value, scan_backward_, jump_key))) {
+        // do nothing
+      } else if (OB_FAIL(comp(key, jump_key, cmp))) {
+        // do nothing
+      } else if (cmp > 0 && OB_FAIL(scan_handle_.get_leaf_run(scan_backward_, kvs + count,
+                                                             capacity - count, run_count))) {
+        // do nothing
+      } else {
+        // the rest of the leaf is within range when its last key is within range
+        count += run_count;
+        iter_count_ += run_count;
+      }
+    }
+    if (OB_SUCC(ret) && count < capacity) {
+      if (OB_SUCC(get_next(kvs[count].key_, kvs[count].val_))) {
+        ++count;
+      }
+    }
+  }
+  if (OB_ITER_END == ret && count > 0) {
+    ret = OB_SUCCESS;
+  } else if (OB_FAIL(ret)) {
+    // errors of the leaf run path do not go through get_next, release the leaf here
+    is_iter_end_ = true;
+    scan_handle_.release_ref();
+  }
+  return ret;
+}
+
 template<typename BtreeKey, typename BtreeVal>
 int Iterator<BtreeKey, BtreeVal>::next_on_level(const int64_t level, BtreeKey& key, BtreeVal& value)
 {
@@ -1313,19 +1388,17 @@ int BtreeIterator<BtreeKey, BtreeVal>::scan_batch()
                                           end_exclude_, version_))) {
     // do nothing
   } else {
-    BtreeKV item;
-    while (OB_SUCCESS == ret) {
-      if (OB_FAIL(iter_->get_next(item.key_, item.val_))) {
+    // queue is empty here, fill it by leaf runs directly
+    BtreeKV *kvs = kv_queue_.get_batch_buf();
+    int64_t count = 0;
+    if (OB_FAIL(iter_->get_next_batch(kvs, kv_queue_.get_batch_capacity(), count))) {
+      is_iter_end_ = true;
+    } else {
+      kv_queue_.set_batch_size(count);
+      start_key_ = kvs[count - 1].key_;
+      start_exclude_ = true;
+      if (iter_->is_iter_end()) {
         is_iter_end_ = true;
-        if (kv_queue_.size() > 0) {
-          ret = OB_SUCCESS;
-        }
-        break;
-      } else if (OB_SUCCESS != kv_queue_.push(item)) {
-        break;
-      } else {
-        start_key_ = item.key_;
-        start_exclude_ = true;
       }
     }
     iter_->reset();
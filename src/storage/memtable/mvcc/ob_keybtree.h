@@ -121,6 +121,10 @@ private:
       int push(const BtreeKV &data);
       int pop(BtreeKV &data);
       int64_t size() const { return push_ - pop_; }
+      // kvs are filled into the buffer directly by batch, only valid when the queue is empty
+      BtreeKV *get_batch_buf() { push_ = 0; pop_ = 0; return items_; }
+      int64_t get_batch_capacity() const { return capacity; }
+      void set_batch_size(const int64_t count) { push_ = count; }
     private:
       int64_t idx(const int64_t x) { return x % capacity; }
     private:
@@ -357,6 +357,12 @@ public:
     return ret;
   }
   int top(BtreeNode *&node, int &pos);
+  OB_INLINE void set_top_pos(const int pos)
+  {
+    if (OB_LIKELY(depth_ > 0)) {
+      path_[depth_ - 1].pos_ = pos;
+    }
+  }
   int top_k(int k, BtreeNode*& node, int& pos);
   int get_root_level() { return depth_; }
   bool is_empty() const { return 0 == depth_; }
@@ -427,6 +433,7 @@ private:
   typedef Path<BtreeKey, BtreeVal> Path;
   typedef BtreeNode<BtreeKey, BtreeVal> BtreeNode;
   typedef ObKeyBtree<BtreeKey, BtreeVal> ObKeyBtree;
+  typedef BtreeKV<BtreeKey, BtreeVal> BtreeKV;
 private:
   Path path_;
   int64_t version_;
@@ -441,6 +448,9 @@ public:
   int64_t get_root_level() { return path_.get_root_level(); }
   int get(BtreeKey &key, BtreeVal &val);
   int get(BtreeKey &key, BtreeVal &val, bool is_backward, BtreeKey*& last_key);
+  // copy kvs of current leaf from current position in scan order, stop before the last
+  // one of the leaf, which is left as current position for scan_forward/scan_backward.
+  int get_leaf_run(const bool is_backward, BtreeKV *kvs, const int64_t capacity, int64_t &count);
   // for estimate row count in range, leaf node is level 0
   int pop_level_node(const bool is_backward, const int64_t level, const double ratio,
       const int64_t gap_limit, int64_t &element_count, int64_t &phy_element_count,
@@ -556,6 +566,7 @@ private:
   typedef ObKeyBtree<BtreeKey, BtreeVal> ObKeyBtree;
   typedef CompHelper<BtreeKey, BtreeVal> CompHelper;
   typedef ScanHandle<BtreeKey, BtreeVal> ScanHandle;
+  typedef BtreeKV<BtreeKey, BtreeVal> BtreeKV;
 public:
   explicit Iterator(ObKeyBtree &btree): btree_(btree), scan_handle_(btree), jump_key_(nullptr),
                                         cmp_result_(0), comp_(scan_handle_.get_comp()),
@@ -568,6 +579,10 @@ public:
   int set_key_range(const BtreeKey min_key, const bool start_exclude,
                     const BtreeKey max_key, const bool end_exclude, int64_t version);
   int get_next(BtreeKey &key, BtreeVal &value);
+  // bulk mode of get_next, leafs entirely within range are copied without per key
+  // comparison and path walking
+  int get_next_batch(BtreeKV *kvs, const int64_t capacity, int64_t &count);
+  bool is_iter_end() const { return is_iter_end_; }
   int64_t get_root_level() { return scan_handle_.get_root_level(); }
   int next_on_level(const int64_t level, BtreeKey& key, BtreeVal& value);
   int estimate_one_level(const int64_t level, const int64_t start_batch_count, const int64_t end_batch_count,
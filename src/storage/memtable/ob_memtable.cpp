@@ -385,6 +385,47 @@ int ObMemtable::set(
   return ret;
 }
 
+int ObMemtable::multi_set(
+    const storage::ObTableIterParam &param,
+    storage::ObTableAccessContext &context,
+    const common::ObIArray<share::schema::ObColDesc> &columns,
+    const storage::ObStoreRow *rows,
+    const int64_t row_count,
+    const share::ObEncryptMeta *encrypt_meta)
+{
+  int ret = OB_SUCCESS;
+  ObMvccWriteGuard guard;
+  if (IS_NOT_INIT) {
+    TRANS_LOG(WARN, "not init", K(*this));
+    ret = OB_NOT_INIT;
+  } else if (!param.is_valid() || !context.is_valid() || OB_ISNULL(rows) || row_count <= 0) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument, ", K(ret), K(param), K(context), KP(rows), K(row_count));
+  } else if (NULL == context.store_ctx_->mvcc_acc_ctx_.get_mem_ctx()
+             || param.get_schema_rowkey_count() > columns.count()) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid param", K(ret), K(param), K(columns.count()));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+      if (OB_UNLIKELY(rows[i].row_val_.count_ < columns.count())) {
+        ret = OB_INVALID_ARGUMENT;
+        TRANS_LOG(WARN, "invalid row", K(ret), K(i), K(rows[i]), K(columns.count()));
+      }
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(guard.write_auth(*context.store_ctx_))) {
+    TRANS_LOG(WARN, "not allow to write", K(*context.store_ctx_));
+  } else {
+    lib::CompatModeGuard compat_guard(mode_);
+
+    ret = multi_set_(param, context, columns, rows, row_count);
+    guard.set_memtable(this);
+  }
+  return ret;
+}
+
 int ObMemtable::lock(
     const storage::ObTableIterParam &param,
     storage::ObTableAccessContext &context,
@@ -2425,16 +2466,8 @@ int ObMemtable::set_(
     const common::ObIArray<int64_t> *update_idx)
 {
   int ret = OB_SUCCESS;
-  blocksstable::ObRowWriter row_writer;
-  char *buf = nullptr;
-  int64_t len = 0;
-  ObRowData old_row_data;
   ObStoreRowkey tmp_key;
   ObMemtableKey mtk;
-  ObStoreCtx &ctx = *(context.store_ctx_);
-  auto *mem_ctx = ctx.mvcc_acc_ctx_.get_mem_ctx();
-
-  //set_begin(ctx.mvcc_acc_ctx_);
 
   if (OB_FAIL(tmp_key.assign(new_row.row_val_.cells_,
           param.get_schema_rowkey_count()))) {
@@ -2442,7 +2475,88 @@ int ObMemtable::set_(
         K(param.get_schema_rowkey_count()));
   } else if (OB_FAIL(mtk.encode(columns, &tmp_key))) {
     TRANS_LOG(WARN, "mtk encode fail", "ret", ret);
-  } else if (nullptr != old_row) {
+  } else {
+    ret = set_(param, context, columns, mtk, new_row, old_row, update_idx);
+  }
+  return ret;
+}
+
+// Rows of the batch are written in rowkey order. Each insert still descends the
+// btree from the root, sorting only makes neighbouring inserts land on the same
+// or adjacent leaf instead of random ones. Rowkeys are encoded and hashed before
+// any write, rows with equal rowkey keep their order in the batch.
+int ObMemtable::multi_set_(
+    const storage::ObTableIterParam &param,
+    storage::ObTableAccessContext &context,
+    const common::ObIArray<share::schema::ObColDesc> &columns,
+    const storage::ObStoreRow *rows,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  ObArenaAllocator allocator("MemtableMSet", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID());
+  ObStoreRowkey *rowkeys = nullptr;
+  ObMemtableKey *mtks = nullptr;
+  int64_t *order = nullptr;
+
+  if (OB_ISNULL(rowkeys = static_cast<ObStoreRowkey *>(allocator.alloc(sizeof(ObStoreRowkey) * row_count)))
+      || OB_ISNULL(mtks = static_cast<ObMemtableKey *>(allocator.alloc(sizeof(ObMemtableKey) * row_count)))
+      || OB_ISNULL(order = static_cast<int64_t *>(allocator.alloc(sizeof(int64_t) * row_count)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    TRANS_LOG(WARN, "failed to alloc multi set keys", K(ret), K(row_count));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+      new (rowkeys + i) ObStoreRowkey();
+      new (mtks + i) ObMemtableKey();
+      order[i] = i;
+      if (OB_FAIL(rowkeys[i].assign(rows[i].row_val_.cells_, param.get_schema_rowkey_count()))) {
+        TRANS_LOG(WARN, "Failed to assign tmp rowkey", K(ret), K(i), K(rows[i]),
+            K(param.get_schema_rowkey_count()));
+      } else if (OB_FAIL(mtks[i].encode(columns, rowkeys + i))) {
+        TRANS_LOG(WARN, "mtk encode fail", K(ret), K(i));
+      }
+    }
+  }
+
+  if (OB_SUCC(ret) && row_count > 1) {
+    MultiSetKeyCompare key_cmp(mtks, ret);
+    std::sort(order, order + row_count, key_cmp);
+    if (OB_FAIL(ret)) {
+      TRANS_LOG(WARN, "failed to sort multi set rows", K(ret), K(row_count));
+    }
+  }
+
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    const int64_t idx = order[i];
+    if (OB_FAIL(set_(param, context, columns, mtks[idx], rows[idx], NULL, NULL))) {
+      if (OB_TRY_LOCK_ROW_CONFLICT != ret &&
+          OB_TRANSACTION_SET_VIOLATION != ret) {
+        TRANS_LOG(WARN, "failed to set row", K(ret), K(idx), K(rows[idx]));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObMemtable::set_(
+    const storage::ObTableIterParam &param,
+    storage::ObTableAccessContext &context,
+    const common::ObIArray<share::schema::ObColDesc> &columns,
+    const ObMemtableKey &mtk,
+    const storage::ObStoreRow &new_row,
+    const storage::ObStoreRow *old_row,
+    const common::ObIArray<int64_t> *update_idx)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObRowWriter row_writer;
+  char *buf = nullptr;
+  int64_t len = 0;
+  ObRowData old_row_data;
+  ObStoreCtx &ctx = *(context.store_ctx_);
+  auto *mem_ctx = ctx.mvcc_acc_ctx_.get_mem_ctx();
+
+  //set_begin(ctx.mvcc_acc_ctx_);
+
+  if (nullptr != old_row) {
     char *new_buf = nullptr;
     if(OB_FAIL(row_writer.write(param.get_schema_rowkey_count(), *old_row, nullptr, buf, len))) {
       TRANS_LOG(WARN, "Failed to write old row", K(ret), KPC(old_row));
@@ -203,6 +203,15 @@ public:
       const storage::ObStoreRow &old_row,
       const storage::ObStoreRow &new_row,
       const share::ObEncryptMeta *encrypt_meta);
+  // insert a batch of rows of one statement, the per row overhead of write
+  // auth and rowkey hashing is amortized by the batch
+  virtual int multi_set(
+      const storage::ObTableIterParam &param,
+      storage::ObTableAccessContext &context,
+      const common::ObIArray<share::schema::ObColDesc> &columns,
+      const storage::ObStoreRow *rows,
+      const int64_t row_count,
+      const share::ObEncryptMeta *encrypt_meta);
 
   // lock is used to lock the row(s)
   // ctx is the locker tx's context, we need the tx_id, version and scn to do the concurrent control(mvcc_write)
@@ -523,6 +532,36 @@ private:
       const storage::ObStoreRow &new_row,
       const storage::ObStoreRow *old_row,
       const common::ObIArray<int64_t> *update_idx);
+  int set_(
+      const storage::ObTableIterParam &param,
+      storage::ObTableAccessContext &context,
+      const common::ObIArray<share::schema::ObColDesc> &columns,
+      const ObMemtableKey &mtk,
+      const storage::ObStoreRow &new_row,
+      const storage::ObStoreRow *old_row,
+      const common::ObIArray<int64_t> *update_idx);
+  // sort row indexes of multi set by rowkey, equal rowkeys keep batch order
+  struct MultiSetKeyCompare
+  {
+    MultiSetKeyCompare(const ObMemtableKey *keys, int &ret) : keys_(keys), ret_(ret) {}
+    bool operator()(const int64_t left, const int64_t right)
+    {
+      int cmp = 0;
+      if (common::OB_SUCCESS != ret_) {
+      } else if (common::OB_SUCCESS != (ret_ = keys_[left].compare(keys_[right], cmp))) {
+        TRANS_LOG_RET(WARN, ret_, "failed to compare rowkey", K(left), K(right));
+      }
+      return 0 == cmp ? left < right : cmp < 0;
+    }
+    const ObMemtableKey *keys_;
+    int &ret_;
+  };
+  int multi_set_(
+      const storage::ObTableIterParam &param,
+      storage::ObTableAccessContext &context,
+      const common::ObIArray<share::schema::ObColDesc> &columns,
+      const storage::ObStoreRow *rows,
+      const int64_t row_count);
   int lock_(
       const storage::ObTableIterParam &param,
       storage::ObTableAccessContext &context,
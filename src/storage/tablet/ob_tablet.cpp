@@ -2779,6 +2779,59 @@ int ObTablet::insert_row_without_rowkey_check(
   return ret;
 }
 
+int ObTablet::insert_rows_without_rowkey_check(
+    ObRelativeTable &relative_table,
+    ObStoreCtx &store_ctx,
+    const common::ObIArray<share::schema::ObColDesc> &col_descs,
+    const storage::ObStoreRow *rows,
+    const int64_t row_count,
+    const common::ObIArray<transaction::ObEncryptMetaCache> *encrypt_meta_arr)
+{
+  int ret = OB_SUCCESS;
+  {
+    ObStorageTableGuard guard(this, store_ctx, true);
+    ObMemtable *write_memtable = nullptr;
+    const transaction::ObSerializeEncryptMeta *encrypt_meta = NULL;
+
+    if (OB_UNLIKELY(!is_inited_)) {
+      ret = OB_NOT_INIT;
+      LOG_WARN("not inited", K(ret), K_(is_inited));
+    } else if (OB_UNLIKELY(!store_ctx.is_valid()
+        || col_descs.count() <= 0
+        || OB_ISNULL(rows)
+        || row_count <= 0
+        || !relative_table.is_valid())) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("invalid args", K(ret), K(store_ctx), K(relative_table),
+          K(col_descs), KP(rows), K(row_count));
+    } else if (OB_UNLIKELY(relative_table.get_tablet_id() != tablet_meta_.tablet_id_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("tablet id doesn't match", K(ret), K(relative_table.get_tablet_id()), K(tablet_meta_.tablet_id_));
+    } else if (OB_FAIL(try_update_storage_schema(relative_table.get_table_id(),
+        relative_table.get_schema_version(),
+        store_ctx.mvcc_acc_ctx_.get_mem_ctx()->get_query_allocator(),
+        store_ctx.timeout_))) {
+      LOG_WARN("fail to record table schema", K(ret));
+    } else if (OB_FAIL(guard.refresh_and_protect_table(relative_table))) {
+      LOG_WARN("fail to protect table", K(ret));
+    } else if (OB_FAIL(prepare_memtable(relative_table, store_ctx, write_memtable))) {
+      LOG_WARN("prepare write memtable fail", K(ret), K(relative_table));
+    } else {
+      ObArenaAllocator allocator(ObModIds::OB_STORE_ROW_EXISTER);
+      ObTableIterParam param;
+      ObTableAccessContext context;
+      if (OB_FAIL(prepare_param_ctx(allocator, relative_table, store_ctx, param, context))) {
+        LOG_WARN("prepare param ctx fail, ", K(ret));
+      } else if (OB_FAIL(write_memtable->multi_set(param, context, col_descs, rows, row_count, encrypt_meta))) {
+        if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+          LOG_WARN("fail to multi set memtable", K(ret), K(row_count));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTablet::do_rowkey_exists(
     ObTableIterParam &param,
     ObTableAccessContext &context,
@@ -256,6 +256,13 @@ public:
       const ObColDescIArray &col_descs,
       const storage::ObStoreRow &row,
       const common::ObIArray<transaction::ObEncryptMetaCache> *encrypt_meta_arr);
+  int insert_rows_without_rowkey_check(
+      ObRelativeTable &relative_table,
+      ObStoreCtx &store_ctx,
+      const ObColDescIArray &col_descs,
+      const storage::ObStoreRow *rows,
+      const int64_t row_count,
+      const common::ObIArray<transaction::ObEncryptMetaCache> *encrypt_meta_arr);
   int update_row(
       ObRelativeTable &relative_table,
       ObStoreCtx &store_ctx,
@@ -11,7 +11,9 @@
  */
 
 #include "ob_admin_io_executor.h"
+#include "ob_admin_io_mixed_bench.h"
 #include "share/io/ob_io_manager.h"
+#include "share/config/ob_config_helper.h"
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -24,7 +26,11 @@ namespace tools
 ObAdminIOExecutor::ObAdminIOExecutor()
   : conf_dir_(NULL),
     data_dir_(NULL),
-    file_size_(NULL)
+    file_size_(NULL),
+    mode_(NULL),
+    duration_(NULL),
+    min_bandwidth_(NULL),
+    max_bandwidth_(NULL)
 {
 }
 
@@ -38,7 +44,24 @@ int ObAdminIOExecutor::execute(int argc, char *argv[])
   reset();
   if (OB_FAIL(parse_cmd(argc - 1, argv + 1))) {
     COMMON_LOG(ERROR, "Fail to parse cmd, ", K(ret));
-  } else if (OB_UNLIKELY(NULL == conf_dir_ || NULL == data_dir_)) {
+  } else if (NULL != mode_ && 0 == STRCMP(mode_, "mixed")) {
+    if (OB_FAIL(run_mixed_bench())) {
+      COMMON_LOG(ERROR, "run mixed bench failed", K(ret));
+    }
+  } else if (OB_UNLIKELY(NULL != mode_ && 0 != STRCMP(mode_, "fio"))) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(ERROR, "invalid bench mode", K(ret), K(mode_));
+    print_usage();
+  } else if (OB_FAIL(run_fio_bench())) {
+    COMMON_LOG(ERROR, "run fio bench failed", K(ret));
+  }
+  return ret;
+}
+
+int ObAdminIOExecutor::run_fio_bench()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(NULL == conf_dir_ || NULL == data_dir_)) {
     ret = OB_INVALID_ARGUMENT;
     COMMON_LOG(ERROR, "invalid argument", K(ret), K(data_dir_), K(conf_dir_));
   } else {
@@ -79,16 +102,62 @@ int ObAdminIOExecutor::execute(int argc, char *argv[])
   return ret;
 }
 
+int ObAdminIOExecutor::run_mixed_bench()
+{
+  int ret = OB_SUCCESS;
+  int64_t file_size = 0;
+  int64_t duration_s = DEFAULT_MIXED_BENCH_DURATION_S;
+  int64_t min_bandwidth = 0;
+  int64_t max_bandwidth = 0;
+  if (OB_UNLIKELY(NULL == data_dir_)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(ERROR, "invalid argument", K(ret), K(data_dir_));
+  } else if (OB_FAIL(parse_capacity(file_size_, DEFAULT_MIXED_BENCH_FILE_SIZE, file_size))) {
+    COMMON_LOG(ERROR, "invalid file size", K(ret), K(file_size_));
+  } else if (OB_FAIL(parse_capacity(min_bandwidth_, 0, min_bandwidth))) {
+    COMMON_LOG(ERROR, "invalid min bandwidth", K(ret), K(min_bandwidth_));
+  } else if (OB_FAIL(parse_capacity(max_bandwidth_, 0, max_bandwidth))) {
+    COMMON_LOG(ERROR, "invalid max bandwidth", K(ret), K(max_bandwidth_));
+  } else if (NULL != duration_ && (duration_s = atol(duration_)) <= 0) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(ERROR, "invalid duration", K(ret), K(duration_));
+  } else {
+    ObAdminIOMixedBench bench;
+    if (OB_FAIL(bench.run(data_dir_, conf_dir_, file_size, duration_s, min_bandwidth, max_bandwidth))) {
+      COMMON_LOG(ERROR, "mixed bench failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObAdminIOExecutor::parse_capacity(const char *str, const int64_t default_value, int64_t &value)
+{
+  int ret = OB_SUCCESS;
+  bool valid = false;
+  if (NULL == str) {
+    value = default_value;
+  } else if (FALSE_IT(value = ObConfigCapacityParser::get(str, valid))) {
+  } else if (OB_UNLIKELY(!valid || value < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+  }
+  return ret;
+}
+
 int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
 {
   int ret = OB_SUCCESS;
   int opt = 0;
-  const char* opt_string = "hc:d:f:";
+  const char* opt_string = "hc:d:f:m:t:r:l:";
   struct option longopts[] =
     {{"help", 0, NULL, 'h' },
      {"conf_dir", 1, NULL, 'c'},
      {"data_dir", 1, NULL, 'd'},
-     {"file_size", 1, NULL, 'f'}};
+     {"file_size", 1, NULL, 'f'},
+     {"mode", 1, NULL, 'm'},
+     {"duration", 1, NULL, 't'},
+     {"min_bandwidth", 1, NULL, 'r'},
+     {"max_bandwidth", 1, NULL, 'l'},
+     {0, 0, 0, 0}};
 
   while ((opt = getopt_long(argc, argv, opt_string, longopts, NULL)) != -1) {
     switch (opt) {
@@ -108,6 +177,22 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
         file_size_ = optarg;
         break;
       }
+      case 'm': {
+        mode_ = optarg;
+        break;
+      }
+      case 't': {
+        duration_ = optarg;
+        break;
+      }
+      case 'r': {
+        min_bandwidth_ = optarg;
+        break;
+      }
+      case 'l': {
+        max_bandwidth_ = optarg;
+        break;
+      }
       default: {
         print_usage();
         ret = OB_INVALID_ARGUMENT;
@@ -119,7 +204,9 @@ int ObAdminIOExecutor::parse_cmd(int argc, char *argv[])
 
 void ObAdminIOExecutor::print_usage()
 {
-  fprintf(stderr, "\nUsage: ob_tool io_bench -c conf_dir -d data_dir\n");
+  fprintf(stderr, "\nUsage: ob_tool io_bench -c conf_dir -d data_dir [-f file_size]\n"
+                  "       ob_tool io_bench -m mixed -d data_dir [-c conf_dir] [-f file_size] [-t duration_s]"
+                  " [-r oltp_min_bandwidth] [-l batch_max_bandwidth]\n");
 }
 
 void ObAdminIOExecutor::reset()
@@ -127,6 +214,10 @@ void ObAdminIOExecutor::reset()
   conf_dir_ = NULL;
   data_dir_ = NULL;
   file_size_ = NULL;
+  mode_ = NULL;
+  duration_ = NULL;
+  min_bandwidth_ = NULL;
+  max_bandwidth_ = NULL;
 }
 
 }
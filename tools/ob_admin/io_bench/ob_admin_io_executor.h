@@ -28,11 +28,21 @@ public:
   void reset();
 private:
   static const int64_t DEFAULT_BENCH_FILE_SIZE = 1024L * 1024L * 1024L * 100L;
+  static const int64_t DEFAULT_MIXED_BENCH_FILE_SIZE = 1024L * 1024L * 1024L * 10L;
+  static const int64_t DEFAULT_MIXED_BENCH_DURATION_S = 60L;
   int parse_cmd(int argc, char *argv[]);
+  int run_fio_bench();
+  // run OLTP and batch tenants on one disk concurrently to check the io isolation
+  int run_mixed_bench();
+  int parse_capacity(const char *str, const int64_t default_value, int64_t &value);
   void print_usage();
   const char *conf_dir_;
   const char *data_dir_;
   const char *file_size_;
+  const char *mode_;
+  const char *duration_;
+  const char *min_bandwidth_;
+  const char *max_bandwidth_;
 };
 
 }
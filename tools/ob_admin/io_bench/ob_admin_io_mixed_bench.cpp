@@ -0,0 +1,383 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_admin_io_mixed_bench.h"
+#include <fcntl.h>
+#include "lib/alloc/ob_malloc_allocator.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/random/ob_random.h"
+#include "share/io/ob_io_manager.h"
+#include "share/io/ob_io_calibration.h"
+
+using namespace oceanbase::lib;
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+namespace oceanbase
+{
+namespace tools
+{
+
+/******************             IOMixedBenchRunner              **********************/
+
+ObIOMixedBenchRunner::ObIOMixedBenchRunner()
+  : is_inited_(false),
+    load_(),
+    fd_(),
+    file_size_(0),
+    write_buf_(nullptr),
+    next_offset_(0),
+    succ_count_(0),
+    fail_count_(0),
+    sum_rt_us_(0),
+    max_rt_us_(0)
+{
+}
+
+ObIOMixedBenchRunner::~ObIOMixedBenchRunner()
+{
+  destroy();
+}
+
+int ObIOMixedBenchRunner::init(const ObIOMixedBenchLoad &load, const ObIOFd &fd, const int64_t file_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    COMMON_LOG(WARN, "init twice", K(ret));
+  } else if (OB_UNLIKELY(!load.is_valid() || !fd.is_valid() || file_size < load.io_size_)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "invalid argument", K(ret), K(load), K(fd), K(file_size));
+  } else if (OB_FAIL(set_thread_count(load.thread_count_))) {
+    COMMON_LOG(WARN, "set thread count failed", K(ret), K(load));
+  } else {
+    if (ObIOMode::WRITE == load.mode_) {
+      write_buf_ = static_cast<char *>(ob_malloc_align(DIO_READ_ALIGN_SIZE, load.io_size_, "IOMixedBench"));
+      if (OB_ISNULL(write_buf_)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        COMMON_LOG(WARN, "alloc write buf failed", K(ret), K(load));
+      } else {
+        MEMSET(write_buf_, 'b', load.io_size_);
+      }
+    }
+    if (OB_SUCC(ret)) {
+      load_ = load;
+      fd_ = fd;
+      file_size_ = lower_align(file_size, load.io_size_);
+      is_inited_ = true;
+    }
+  }
+  return ret;
+}
+
+void ObIOMixedBenchRunner::destroy()
+{
+  if (nullptr != write_buf_) {
+    ob_free_align(write_buf_);
+    write_buf_ = nullptr;
+  }
+  fd_.reset();
+  file_size_ = 0;
+  next_offset_ = 0;
+  succ_count_ = 0;
+  fail_count_ = 0;
+  sum_rt_us_ = 0;
+  max_rt_us_ = 0;
+  is_inited_ = false;
+}
+
+void ObIOMixedBenchRunner::run1()
+{
+  int ret = OB_SUCCESS;
+  const int64_t block_cnt = file_size_ / load_.io_size_;
+  while (!has_set_stop()) {
+    int64_t offset = 0;
+    if (load_.is_sequence_) {
+      offset = (ATOMIC_FAA(&next_offset_, load_.io_size_)) % file_size_;
+    } else {
+      offset = ObRandom::rand(0, block_cnt - 1) * load_.io_size_;
+    }
+    const int64_t begin_ts = ObTimeUtility::current_time();
+    if (OB_FAIL(do_io(offset))) {
+      ATOMIC_INC(&fail_count_);
+    } else {
+      const int64_t rt_us = ObTimeUtility::current_time() - begin_ts;
+      ATOMIC_INC(&succ_count_);
+      ATOMIC_FAA(&sum_rt_us_, rt_us);
+      int64_t max_rt_us = ATOMIC_LOAD(&max_rt_us_);
+      while (rt_us > max_rt_us && !ATOMIC_BCAS(&max_rt_us_, max_rt_us, rt_us)) {
+        max_rt_us = ATOMIC_LOAD(&max_rt_us_);
+      }
+    }
+  }
+}
+
+int ObIOMixedBenchRunner::do_io(const int64_t offset)
+{
+  int ret = OB_SUCCESS;
+  ObIOHandle io_handle;
+  ObIOInfo io_info;
+  io_info.tenant_id_ = load_.tenant_id_;
+  io_info.fd_ = fd_;
+  io_info.offset_ = offset;
+  io_info.size_ = static_cast<int32_t>(load_.io_size_);
+  io_info.flag_.set_group_id(0);
+  io_info.flag_.set_mode(load_.mode_);
+  if (ObIOMode::READ == load_.mode_) {
+    io_info.flag_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+    if (OB_FAIL(ObIOManager::get_instance().aio_read(io_info, io_handle))) {
+      COMMON_LOG(WARN, "aio read failed", K(ret), K(io_info));
+    }
+  } else {
+    io_info.flag_.set_wait_event(ObWaitEventIds::DB_FILE_COMPACT_WRITE);
+    io_info.buf_ = write_buf_;
+    if (OB_FAIL(ObIOManager::get_instance().aio_write(io_info, io_handle))) {
+      COMMON_LOG(WARN, "aio write failed", K(ret), K(io_info));
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(io_handle.wait(DEFAULT_IO_WAIT_TIME_MS))) {
+    COMMON_LOG(WARN, "wait io failed", K(ret), K(io_info));
+  }
+  return ret;
+}
+
+void ObIOMixedBenchRunner::print_result(const int64_t duration_us) const
+{
+  const int64_t succ_count = ATOMIC_LOAD(&succ_count_);
+  const double duration_s = static_cast<double>(max(duration_us, 1L)) / 1000000.0;
+  const double iops = static_cast<double>(succ_count) / duration_s;
+  const double bandwidth_mb = iops * static_cast<double>(load_.io_size_) / 1024.0 / 1024.0;
+  const double avg_rt_us = 0 == succ_count ? 0 : static_cast<double>(ATOMIC_LOAD(&sum_rt_us_)) / succ_count;
+  fprintf(stdout, "%-8s tenant_id=%lu, mode=%s, io_size=%ld, threads=%ld, min_bandwidth=%ld, max_bandwidth=%ld\n"
+          "         iops=%.2f, bandwidth=%.2fMB/s, avg_rt=%.2fus, max_rt=%ldus, fail_count=%ld\n",
+          load_.name_, load_.tenant_id_, ObIOMode::READ == load_.mode_ ? "read" : "write",
+          load_.io_size_, load_.thread_count_, load_.min_bandwidth_, load_.max_bandwidth_,
+          iops, bandwidth_mb, avg_rt_us, ATOMIC_LOAD(&max_rt_us_), ATOMIC_LOAD(&fail_count_));
+}
+
+/******************             AdminIOMixedBench              **********************/
+
+ObAdminIOMixedBench::ObAdminIOMixedBench()
+  : device_(), fd_(-1)
+{
+  MEMSET(sstable_dir_, 0, sizeof(sstable_dir_));
+}
+
+ObAdminIOMixedBench::~ObAdminIOMixedBench()
+{
+}
+
+int ObAdminIOMixedBench::run(const char *data_dir,
+                             const char *conf_dir,
+                             const int64_t file_size,
+                             const int64_t duration_s,
+                             const int64_t oltp_min_bandwidth,
+                             const int64_t batch_max_bandwidth)
+{
+  int ret = OB_SUCCESS;
+  ObIOMixedBenchLoad oltp_load;
+  oltp_load.tenant_id_ = OLTP_TENANT_ID;
+  oltp_load.name_ = "oltp";
+  oltp_load.mode_ = ObIOMode::READ;
+  oltp_load.io_size_ = OLTP_IO_SIZE;
+  oltp_load.is_sequence_ = false;
+  oltp_load.thread_count_ = OLTP_THREAD_COUNT;
+  oltp_load.min_bandwidth_ = oltp_min_bandwidth;
+  ObIOMixedBenchLoad batch_load;
+  batch_load.tenant_id_ = BATCH_TENANT_ID;
+  batch_load.name_ = "batch";
+  batch_load.mode_ = ObIOMode::WRITE;
+  batch_load.io_size_ = BATCH_IO_SIZE;
+  batch_load.is_sequence_ = true;
+  batch_load.thread_count_ = BATCH_THREAD_COUNT;
+  batch_load.max_bandwidth_ = batch_max_bandwidth;
+  ObIOMixedBenchRunner oltp_runner;
+  ObIOMixedBenchRunner batch_runner;
+  ObIOFd fd;
+  if (OB_ISNULL(data_dir) || OB_UNLIKELY(file_size < BATCH_IO_SIZE || duration_s <= 0
+      || oltp_min_bandwidth < 0 || batch_max_bandwidth < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "invalid argument", K(ret), KP(data_dir), K(file_size), K(duration_s),
+        K(oltp_min_bandwidth), K(batch_max_bandwidth));
+  } else if (OB_FAIL(init_device(data_dir))) {
+    COMMON_LOG(WARN, "init device failed", K(ret), K(data_dir));
+  } else if (OB_FAIL(ObIOManager::get_instance().init())) {
+    COMMON_LOG(WARN, "init io manager failed", K(ret));
+  } else if (OB_FAIL(ObIOManager::get_instance().start())) {
+    COMMON_LOG(WARN, "start io manager failed", K(ret));
+  } else if (OB_FAIL(ObIOManager::get_instance().add_device_channel(&device_, 16, 2, 1024))) {
+    COMMON_LOG(WARN, "add device channel failed", K(ret));
+  } else if (OB_FAIL(load_io_ability(conf_dir))) {
+    COMMON_LOG(WARN, "load io ability failed", K(ret), K(conf_dir));
+  } else if (OB_FAIL(prepare_file(data_dir, file_size))) {
+    COMMON_LOG(WARN, "prepare bench file failed", K(ret), K(data_dir), K(file_size));
+  } else if (OB_FAIL(add_tenant(oltp_load))) {
+    COMMON_LOG(WARN, "add oltp tenant failed", K(ret), K(oltp_load));
+  } else if (OB_FAIL(add_tenant(batch_load))) {
+    COMMON_LOG(WARN, "add batch tenant failed", K(ret), K(batch_load));
+  } else {
+    fd.first_id_ = ObIOFd::NORMAL_FILE_ID;
+    fd.second_id_ = fd_;
+    fd.device_handle_ = &device_;
+    if (OB_FAIL(oltp_runner.init(oltp_load, fd, file_size))) {
+      COMMON_LOG(WARN, "init oltp runner failed", K(ret), K(oltp_load));
+    } else if (OB_FAIL(batch_runner.init(batch_load, fd, file_size))) {
+      COMMON_LOG(WARN, "init batch runner failed", K(ret), K(batch_load));
+    } else if (OB_FAIL(oltp_runner.start())) {
+      COMMON_LOG(WARN, "start oltp runner failed", K(ret));
+    } else if (OB_FAIL(batch_runner.start())) {
+      COMMON_LOG(WARN, "start batch runner failed", K(ret));
+      oltp_runner.stop();
+      oltp_runner.wait();
+    } else {
+      const int64_t begin_ts = ObTimeUtility::current_time();
+      fprintf(stdout, "mixed io bench is running, duration=%lds\n", duration_s);
+      ::sleep(static_cast<unsigned int>(duration_s));
+      oltp_runner.stop();
+      batch_runner.stop();
+      oltp_runner.wait();
+      batch_runner.wait();
+      const int64_t duration_us = ObTimeUtility::current_time() - begin_ts;
+      oltp_runner.print_result(duration_us);
+      batch_runner.print_result(duration_us);
+    }
+  }
+  destroy();
+  return ret;
+}
+
+int ObAdminIOMixedBench::init_device(const char *data_dir)
+{
+  int ret = OB_SUCCESS;
+  const int64_t IO_OPT_COUNT = 6;
+  const int64_t block_size = 2L * 1024L * 1024L; // 2MB
+  const int64_t data_disk_size = 64L * 1024L * 1024L; // the macro block file is not used
+  const int64_t data_disk_percentage = 0L;
+  int len = snprintf(sstable_dir_, sizeof(sstable_dir_), "%s/sstable", data_dir);
+  if (len < 0 || len >= static_cast<int>(sizeof(sstable_dir_))) {
+    ret = OB_SIZE_OVERFLOW;
+    COMMON_LOG(WARN, "data dir is too long", K(ret), K(data_dir));
+  } else if (OB_FAIL(FileDirectoryUtils::create_full_path(sstable_dir_))) {
+    COMMON_LOG(WARN, "create sstable dir failed", K(ret), K(sstable_dir_));
+  } else {
+    ObIODOpt io_opts[IO_OPT_COUNT];
+    io_opts[0].key_ = "data_dir";                   io_opts[0].value_.value_str = data_dir;
+    io_opts[1].key_ = "sstable_dir";                io_opts[1].value_.value_str = sstable_dir_;
+    io_opts[2].key_ = "block_size";                 io_opts[2].value_.value_int64 = block_size;
+    io_opts[3].key_ = "datafile_disk_percentage";   io_opts[3].value_.value_int64 = data_disk_percentage;
+    io_opts[4].key_ = "datafile_size";              io_opts[4].value_.value_int64 = data_disk_size;
+    io_opts[5].key_ = "media_id";                   io_opts[5].value_.value_int64 = 0;
+    ObIODOpts init_opts;
+    init_opts.opts_ = io_opts;
+    init_opts.opt_cnt_ = IO_OPT_COUNT;
+    int64_t reserved_size = 0;
+    ObIODOpts opts_start;
+    ObIODOpt opt_start;
+    opts_start.opts_ = &(opt_start);
+    opts_start.opt_cnt_ = 1;
+    opt_start.set("reserved size", reserved_size);
+    if (OB_FAIL(device_.init(init_opts))) {
+      COMMON_LOG(WARN, "init device failed", K(ret));
+    } else if (OB_FAIL(device_.start(opts_start))) {
+      COMMON_LOG(WARN, "start device failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+// Load io_resource.conf generated by bench_io.sh, the format of each line is:
+//   io_type io_size_byte io_ps io_rt_us
+int ObAdminIOMixedBench::load_io_ability(const char *conf_dir)
+{
+  int ret = OB_SUCCESS;
+  char file_path[OB_MAX_FILE_NAME_LENGTH] = { 0 };
+  FILE *fp = nullptr;
+  if (OB_FAIL(ObIOCalibration::get_instance().init())) {
+    COMMON_LOG(WARN, "init io calibration failed", K(ret));
+  } else if (nullptr == conf_dir) {
+    fprintf(stdout, "conf_dir is not specified, io cost is not normalized by io size\n");
+  } else if (OB_FAIL(databuff_printf(file_path, sizeof(file_path), "%s/io_resource.conf", conf_dir))) {
+    COMMON_LOG(WARN, "generate io resource file path failed", K(ret), K(conf_dir));
+  } else if (OB_ISNULL(fp = fopen(file_path, "r"))) {
+    fprintf(stdout, "%s not found, io cost is not normalized by io size\n", file_path);
+  } else {
+    ObIOAbility io_ability;
+    char line[OB_MAX_FILE_NAME_LENGTH] = { 0 };
+    bool is_header = true;
+    while (OB_SUCC(ret) && nullptr != fgets(line, sizeof(line), fp)) {
+      int mode = 0;
+      ObIOBenchResult item;
+      if (is_header) {
+        is_header = false;
+      } else if (4 != sscanf(line, "%d %ld %lf %lf", &mode, &item.size_, &item.iops_, &item.rt_us_)) {
+        // skip empty line
+      } else {
+        item.mode_ = static_cast<ObIOMode>(mode);
+        if (OB_FAIL(io_ability.add_measure_item(item))) {
+          COMMON_LOG(WARN, "add measure item failed", K(ret), K(item));
+        }
+      }
+    }
+    fclose(fp);
+    if (OB_SUCC(ret) && OB_FAIL(ObIOCalibration::get_instance().update_io_ability(io_ability))) {
+      COMMON_LOG(WARN, "update io ability failed", K(ret), K(io_ability));
+    }
+  }
+  return ret;
+}
+
+int ObAdminIOMixedBench::prepare_file(const char *data_dir, const int64_t file_size)
+{
+  int ret = OB_SUCCESS;
+  char file_path[OB_MAX_FILE_NAME_LENGTH] = { 0 };
+  if (OB_FAIL(databuff_printf(file_path, sizeof(file_path), "%s/ob_io_mixed_bench.data", data_dir))) {
+    COMMON_LOG(WARN, "generate bench file path failed", K(ret), K(data_dir));
+  } else if ((fd_ = ::open(file_path, O_CREAT | O_DIRECT | O_RDWR, S_IRUSR | S_IWUSR)) < 0) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "open bench file failed", K(ret), K(file_path), K(errno));
+  } else if (0 != ::fallocate(fd_, 0, 0, file_size)) {
+    ret = OB_IO_ERROR;
+    COMMON_LOG(WARN, "fallocate bench file failed", K(ret), K(file_path), K(file_size), K(errno));
+  } else {
+    ::unlink(file_path); // removed when closed
+  }
+  return ret;
+}
+
+int ObAdminIOMixedBench::add_tenant(const ObIOMixedBenchLoad &load)
+{
+  int ret = OB_SUCCESS;
+  ObTenantIOConfig io_config = ObTenantIOConfig::default_instance();
+  io_config.unit_config_.min_bandwidth_ = load.min_bandwidth_;
+  io_config.unit_config_.max_bandwidth_ = load.max_bandwidth_;
+  if (OB_FAIL(ObMallocAllocator::get_instance()->create_and_add_tenant_allocator(load.tenant_id_))) {
+    COMMON_LOG(WARN, "create tenant allocator failed", K(ret), K(load));
+  } else if (OB_FAIL(ObIOManager::get_instance().add_tenant_io_manager(load.tenant_id_, io_config))) {
+    COMMON_LOG(WARN, "add tenant io manager failed", K(ret), K(load), K(io_config));
+  }
+  return ret;
+}
+
+void ObAdminIOMixedBench::destroy()
+{
+  ObIOManager::get_instance().stop();
+  ObIOManager::get_instance().destroy();
+  ObIOCalibration::get_instance().destroy();
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  device_.destroy();
+}
+
+}
+}
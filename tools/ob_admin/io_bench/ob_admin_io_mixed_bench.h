@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_ADMIN_IO_MIXED_BENCH_H_
+#define OB_ADMIN_IO_MIXED_BENCH_H_
+
+#include "lib/thread/thread_pool.h"
+#include "share/io/ob_io_define.h"
+#include "share/ob_local_device.h"
+
+namespace oceanbase
+{
+namespace tools
+{
+
+struct ObIOMixedBenchLoad
+{
+  ObIOMixedBenchLoad()
+    : tenant_id_(0), name_(nullptr), mode_(common::ObIOMode::MAX_MODE), io_size_(0),
+      is_sequence_(false), thread_count_(0), min_bandwidth_(0), max_bandwidth_(0)
+  {}
+  bool is_valid() const
+  {
+    return tenant_id_ > 0 && nullptr != name_ && mode_ < common::ObIOMode::MAX_MODE
+        && io_size_ > 0 && thread_count_ > 0 && min_bandwidth_ >= 0 && max_bandwidth_ >= 0;
+  }
+  TO_STRING_KV(K_(tenant_id), K_(name), K_(mode), K_(io_size), K_(is_sequence), K_(thread_count),
+      K_(min_bandwidth), K_(max_bandwidth));
+  uint64_t tenant_id_;
+  const char *name_;
+  common::ObIOMode mode_;
+  int64_t io_size_;
+  bool is_sequence_;
+  int64_t thread_count_;
+  int64_t min_bandwidth_;
+  int64_t max_bandwidth_;
+};
+
+// Issue the io load of one tenant to the bench file through ObIOManager, each thread keeps
+// one io in flight.
+class ObIOMixedBenchRunner : public lib::ThreadPool
+{
+public:
+  ObIOMixedBenchRunner();
+  virtual ~ObIOMixedBenchRunner();
+  int init(const ObIOMixedBenchLoad &load, const common::ObIOFd &fd, const int64_t file_size);
+  void destroy();
+  virtual void run1() override;
+  void print_result(const int64_t duration_us) const;
+private:
+  int do_io(const int64_t offset);
+private:
+  bool is_inited_;
+  ObIOMixedBenchLoad load_;
+  common::ObIOFd fd_;
+  int64_t file_size_;
+  char *write_buf_;
+  int64_t next_offset_;
+  int64_t succ_count_;
+  int64_t fail_count_;
+  int64_t sum_rt_us_;
+  int64_t max_rt_us_;
+};
+
+// Benchmark of tenant io isolation on one disk. An OLTP tenant issues small random reads and
+// a batch tenant issues large sequential writes to the same file concurrently, and the iops,
+// bandwidth and latency of each tenant are reported. The io ability measured by bench_io.sh
+// is loaded from conf_dir if it exists, so that the io cost is normalized by io size.
+class ObAdminIOMixedBench
+{
+public:
+  ObAdminIOMixedBench();
+  ~ObAdminIOMixedBench();
+  int run(const char *data_dir,
+          const char *conf_dir,
+          const int64_t file_size,
+          const int64_t duration_s,
+          const int64_t oltp_min_bandwidth,
+          const int64_t batch_max_bandwidth);
+private:
+  static const int64_t OLTP_TENANT_ID = 1001;
+  static const int64_t BATCH_TENANT_ID = 1002;
+  static const int64_t OLTP_IO_SIZE = 4L * 1024L;
+  static const int64_t BATCH_IO_SIZE = 2L * 1024L * 1024L;
+  static const int64_t OLTP_THREAD_COUNT = 16;
+  static const int64_t BATCH_THREAD_COUNT = 8;
+  int init_device(const char *data_dir);
+  int load_io_ability(const char *conf_dir);
+  int prepare_file(const char *data_dir, const int64_t file_size);
+  int add_tenant(const ObIOMixedBenchLoad &load);
+  void destroy();
+private:
+  share::ObLocalDevice device_;
+  char sstable_dir_[common::OB_MAX_FILE_NAME_LENGTH];
+  int fd_;
+};
+
+}
+}
+
+#endif /* OB_ADMIN_IO_MIXED_BENCH_H_ */
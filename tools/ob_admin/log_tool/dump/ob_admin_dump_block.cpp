@@ -249,7 +249,7 @@ int ObAdminDumpBlock::parse_single_group_entry_(const LogGroupEntry &group_entry
       }
       str_arg_.log_stat_->log_entry_header_size_ += entry.get_header_size();
       str_arg_.log_stat_->total_log_entry_count_++;
-      curr_lsn = curr_lsn + entry.get_serialize_size();
+      curr_lsn = lsn + parser_ge.get_parsed_size();
       int tmp_ret = OB_SUCCESS;
       if (OB_SUCCESS != (tmp_ret = parse_single_log_entry_(entry, block_name, lsn))) {
         LOG_WARN("parse_single_log_entry_ failed", K(tmp_ret), K(entry));
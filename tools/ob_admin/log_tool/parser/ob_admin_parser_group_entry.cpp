@@ -15,6 +15,7 @@
 #include "ob_admin_parser_group_entry.h"
 #include "lib/ob_errno.h"
 #include "logservice/palf/log_entry.h"
+#include "logservice/palf/log_compression.h"
 namespace oceanbase
 {
 using namespace palf;
@@ -24,7 +25,8 @@ ObAdminParserGroupEntry::ObAdminParserGroupEntry(const char *buf, const int64_t
                                                  share::ObAdminMutatorStringArg &str_arg)
   : buf_(buf),
     curr_pos_(0),
-    end_pos_(buf_len)
+    end_pos_(buf_len),
+    decompress_buf_()
 {
   str_arg_ = str_arg;
 }
@@ -37,9 +39,10 @@ int ObAdminParserGroupEntry::get_next_log_entry(palf::LogEntry &log_entry)
     LOG_TRACE("parse one LogGroupEntry finished");
   } else if (OB_FAIL(do_parse_one_log_entry_(log_entry))) {
     LOG_WARN("parse one LogEntry failed", K(ret));
+  } else if (FALSE_IT(curr_pos_ += log_entry.get_serialize_size())) {
+  } else if (OB_FAIL(LogCompression::decompress(log_entry, decompress_buf_))) {
+    LOG_WARN("decompress LogEntry failed", K(ret), K(log_entry));
   } else {
-    curr_pos_ += log_entry.get_serialize_size();
-
     LOG_TRACE("parse one LogEntry success", K(log_entry));
   }
   return ret;
@@ -13,6 +13,7 @@
 #ifndef OB_ADMIN_PARSER_GROUP_ENTRY_H_
 #define OB_ADMIN_PARSER_GROUP_ENTRY_H_
 #include "logservice/palf/log_group_entry.h"
+#include "logservice/palf/log_compression.h"
 #include "share/ob_admin_dump_helper.h"
 namespace oceanbase
 {
@@ -27,7 +28,10 @@ class ObAdminParserGroupEntry
 public:
   ObAdminParserGroupEntry(const char *buf, const int64_t buf_len,
                           share::ObAdminMutatorStringArg &str_arg);
+  // the compressed LogEntry is decompressed, log_entry points to decompress_buf_ then
   int get_next_log_entry(palf::LogEntry &log_entry);
+  // the size of LogEntrys which have been parsed, as they are stored in LogGroupEntry
+  int64_t get_parsed_size() const { return curr_pos_; }
 private:
   int do_parse_one_log_entry_(palf::LogEntry &log_entry);
 private:
@@ -35,6 +39,7 @@ private:
   int64_t curr_pos_;
   int64_t end_pos_;
   share::ObAdminMutatorStringArg str_arg_;
+  palf::LogCompressionBuf decompress_buf_;
 };
 }
 }
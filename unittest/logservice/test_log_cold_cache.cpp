@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "logservice/palf/log_define.h"
+#include "logservice/palf/log_cache.h"
+#include <gtest/gtest.h>
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+
+namespace unittest
+{
+
+TEST(TestLogColdCache, test_cache_key)
+{
+  LogColdCacheKey invalid_key;
+  EXPECT_FALSE(invalid_key.is_valid());
+  LogColdCacheKey key1(1001, 1, 1, LogColdCache::CHUNK_SIZE);
+  LogColdCacheKey key2(1001, 1, 1, LogColdCache::CHUNK_SIZE);
+  // chunks of different version are different
+  LogColdCacheKey key3(1001, 1, 2, LogColdCache::CHUNK_SIZE);
+  LogColdCacheKey key4(1001, 2, 1, LogColdCache::CHUNK_SIZE);
+  EXPECT_TRUE(key1.is_valid());
+  EXPECT_TRUE(key1 == key2);
+  EXPECT_EQ(key1.hash(), key2.hash());
+  EXPECT_FALSE(key1 == key3);
+  EXPECT_FALSE(key1 == key4);
+
+  char buf[sizeof(LogColdCacheKey)];
+  ObIKVCacheKey *copied_key = NULL;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, key1.deep_copy(buf, sizeof(buf) - 1, copied_key));
+  EXPECT_EQ(OB_SUCCESS, key1.deep_copy(buf, sizeof(buf), copied_key));
+  EXPECT_TRUE(key1 == *copied_key);
+  EXPECT_EQ(1001, copied_key->get_tenant_id());
+}
+
+TEST(TestLogColdCache, test_cache_value)
+{
+  const int64_t data_len = 1024;
+  char data[data_len];
+  memset(data, 'c', data_len);
+  LogColdCacheValue invalid_value;
+  EXPECT_FALSE(invalid_value.is_valid());
+  LogColdCacheValue value(data, data_len);
+  EXPECT_TRUE(value.is_valid());
+  EXPECT_EQ(sizeof(LogColdCacheValue) + data_len, value.size());
+
+  char buf[sizeof(LogColdCacheValue) + data_len];
+  ObIKVCacheValue *copied = NULL;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, value.deep_copy(buf, sizeof(buf) - 1, copied));
+  EXPECT_EQ(OB_SUCCESS, value.deep_copy(buf, sizeof(buf), copied));
+  const LogColdCacheValue *copied_value = static_cast<const LogColdCacheValue *>(copied);
+  EXPECT_EQ(data_len, copied_value->get_buf_len());
+  EXPECT_NE(data, copied_value->get_buf());
+  EXPECT_EQ(0, memcmp(data, copied_value->get_buf(), data_len));
+}
+
+TEST(TestLogColdCache, test_alloc_version)
+{
+  const int64_t version1 = LogColdCache::alloc_version();
+  const int64_t version2 = LogColdCache::alloc_version();
+  EXPECT_LT(0, version1);
+  EXPECT_LT(version1, version2);
+  // not inited, LogStorage reads from disk
+  EXPECT_FALSE(OB_LOG_COLD_CACHE.is_inited());
+  const LogColdCacheValue *value = NULL;
+  ObKVCacheHandle handle;
+  EXPECT_EQ(OB_NOT_INIT, OB_LOG_COLD_CACHE.get_chunk(LogColdCacheKey(1001, 1, version1, 0), value, handle));
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_cold_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_cold_cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -23,6 +23,7 @@
 #include "logservice/palf/log_group_buffer.h"
 #include "logservice/palf/log_group_entry.h"
 #include "logservice/palf/log_writer_utils.h"
+#include "logservice/palf/log_compression.h"
 #include "share/rc/ob_tenant_base.h"
 #undef private
 
@@ -408,6 +409,81 @@ TEST(TestPaddingLogEntry, test_generate_padding_log_entry)
   out_buf = nullptr;
 }
 
+TEST(TestLogEntry, test_compressed_log_entry)
+{
+  const int64_t data_len = 64 * 1024;
+  const int64_t header_size = LogEntryHeader::HEADER_SER_SIZE;
+  const share::SCN scn = share::SCN::base_scn();
+  char *data = reinterpret_cast<char*>(ob_malloc(data_len, "unittest"));
+  char *entry_buf = reinterpret_cast<char*>(ob_malloc(header_size + data_len, "unittest"));
+  ASSERT_NE(nullptr, data);
+  ASSERT_NE(nullptr, entry_buf);
+  for (int64_t i = 0; i < data_len; i++) {
+    data[i] = 'a' + (i / 64) % 8;
+  }
+  LogCompressionBuf compression_buf;
+  LogCompressionBuf decompression_buf;
+  int64_t compressed_len = 0;
+  bool is_compressed = false;
+  // small log and none compressor are not compressed
+  EXPECT_EQ(OB_SUCCESS, LogCompression::compress(LZ4_COMPRESSOR, data, 100, compression_buf,
+      compressed_len, is_compressed));
+  EXPECT_FALSE(is_compressed);
+  EXPECT_EQ(OB_SUCCESS, LogCompression::compress(NONE_COMPRESSOR, data, data_len, compression_buf,
+      compressed_len, is_compressed));
+  EXPECT_FALSE(is_compressed);
+
+  EXPECT_EQ(OB_SUCCESS, LogCompression::compress(LZ4_COMPRESSOR, data, data_len, compression_buf,
+      compressed_len, is_compressed));
+  EXPECT_TRUE(is_compressed);
+  EXPECT_LT(compressed_len, data_len);
+  int64_t original_len = 0;
+  EXPECT_EQ(OB_SUCCESS, LogCompression::get_data_len(compression_buf.get_buf(), compressed_len, original_len));
+  EXPECT_EQ(data_len, original_len);
+
+  // compressed LogEntry on disk
+  LogEntryHeader header;
+  int64_t pos = 0;
+  EXPECT_EQ(OB_SUCCESS, header.generate_header(compression_buf.get_buf(), compressed_len, scn, true));
+  EXPECT_TRUE(header.is_compressed());
+  EXPECT_TRUE(header.check_header_integrity());
+  EXPECT_EQ(OB_SUCCESS, header.serialize(entry_buf, header_size, pos));
+  MEMCPY(entry_buf + header_size, compression_buf.get_buf(), compressed_len);
+  LogEntry entry;
+  pos = 0;
+  EXPECT_EQ(OB_SUCCESS, entry.deserialize(entry_buf, header_size + compressed_len, pos));
+  EXPECT_TRUE(entry.check_integrity());
+  EXPECT_TRUE(entry.get_header().is_compressed());
+
+  // decompressed LogEntry is a normal LogEntry
+  EXPECT_EQ(OB_SUCCESS, LogCompression::decompress(entry, decompression_buf));
+  EXPECT_FALSE(entry.get_header().is_compressed());
+  EXPECT_TRUE(entry.check_integrity());
+  EXPECT_EQ(data_len, entry.get_data_len());
+  EXPECT_EQ(scn, entry.get_scn());
+  EXPECT_EQ(0, MEMCMP(data, entry.get_data_buf(), data_len));
+  EXPECT_EQ(entry.get_data_buf() - header_size, decompression_buf.get_buf());
+  // decompressing a normal LogEntry does nothing
+  EXPECT_EQ(OB_SUCCESS, LogCompression::decompress(entry, decompression_buf));
+  EXPECT_EQ(data_len, entry.get_data_len());
+
+  // corrupted compressed data
+  entry_buf[header_size] = 0;
+  EXPECT_EQ(OB_INVALID_DATA, LogCompression::get_data_len(entry_buf + header_size, compressed_len, original_len));
+
+  // reused buf is kept unless it's too large
+  char *reused_buf = compression_buf.get_buf();
+  EXPECT_EQ(OB_SUCCESS, compression_buf.reserve(100));
+  EXPECT_EQ(reused_buf, compression_buf.get_buf());
+  compression_buf.shrink(compression_buf.get_buf_len());
+  EXPECT_EQ(reused_buf, compression_buf.get_buf());
+  compression_buf.shrink(100);
+  EXPECT_EQ(nullptr, compression_buf.get_buf());
+  EXPECT_EQ(0, compression_buf.get_buf_len());
+  ob_free(data);
+  ob_free(entry_buf);
+}
+
 } // namespace unittest
 } // namespace oceanbase
 
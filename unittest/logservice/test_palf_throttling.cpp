@@ -215,6 +215,7 @@ TEST_F(TestPalfThrottling, test_log_write_throttle)
   ASSERT_EQ(1, throttle.stat_.total_throttling_task_cnt_);
   ASSERT_EQ(0, throttle.stat_.total_skipped_task_cnt_);
   ASSERT_EQ(0, throttle.stat_.total_skipped_size_);
+  ASSERT_EQ(true, throttle.next_throttling_ts_ > 0);
   throttle.after_append_log(1024);
   ASSERT_EQ(1024, throttle.appended_log_size_cur_round_);
 
@@ -396,6 +397,7 @@ TEST_F(TestPalfThrottling, test_log_write_throttle)
   throttle.update_throttling_options(&palf_env_impl);
   throttle.throttling(1024, g_need_purging_throttling_func, &palf_env_impl);
   ASSERT_EQ(false, throttle.need_throttling_with_options_not_guarded_by_lock_());
+  ASSERT_EQ(OB_INVALID_TIMESTAMP, throttle.next_throttling_ts_);
 
 }
 
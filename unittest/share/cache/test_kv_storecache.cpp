@@ -401,6 +401,76 @@ TEST_F(TestKVCache, test_func)
   ASSERT_NE(OB_SUCCESS, ret);
 }
 
+TEST_F(TestKVCache, test_batch_get)
+{
+  static const int64_t K_SIZE = 16;
+  static const int64_t V_SIZE = 64;
+  static const int64_t KEY_CNT = 100;
+  typedef TestKVCacheKey<K_SIZE> TestKey;
+  typedef TestKVCacheValue<V_SIZE> TestValue;
+
+  int ret = OB_SUCCESS;
+  ObKVCache<TestKey, TestValue> cache;
+  TestKey keys[KEY_CNT];
+  const TestKey *pkeys[KEY_CNT];
+  const TestValue *pvalues[KEY_CNT];
+  ObKVCacheHandle handles[KEY_CNT];
+  TestValue value;
+
+  for (int64_t i = 0; i < KEY_CNT; ++i) {
+    keys[i].v_ = i;
+    keys[i].tenant_id_ = tenant_id_;
+    pkeys[i] = &keys[i];
+  }
+
+  //invalid invoke when not init
+  ret = cache.batch_get(pkeys, KEY_CNT, pvalues, handles);
+  ASSERT_NE(OB_SUCCESS, ret);
+
+  ret = cache.init("test_batch_get");
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  //invalid argument
+  ret = cache.batch_get(NULL, KEY_CNT, pvalues, handles);
+  ASSERT_NE(OB_SUCCESS, ret);
+  ret = cache.batch_get(pkeys, -1, pvalues, handles);
+  ASSERT_NE(OB_SUCCESS, ret);
+
+  //put even keys only
+  for (int64_t i = 0; i < KEY_CNT; i += 2) {
+    value.v_ = i * 10;
+    ret = cache.put(keys[i], value);
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+
+  //batch get hits even keys and misses odd keys
+  ret = cache.batch_get(pkeys, KEY_CNT, pvalues, handles);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  for (int64_t i = 0; i < KEY_CNT; ++i) {
+    if (0 == i % 2) {
+      ASSERT_TRUE(NULL != pvalues[i]);
+      ASSERT_TRUE(handles[i].is_valid());
+      ASSERT_EQ(i * 10, pvalues[i]->v_);
+    } else {
+      ASSERT_TRUE(NULL == pvalues[i]);
+      ASSERT_FALSE(handles[i].is_valid());
+    }
+  }
+
+  //batch get result is the same as get
+  const TestValue *pvalue = NULL;
+  ObKVCacheHandle handle;
+  ret = cache.get(keys[KEY_CNT - 2], pvalue, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(pvalue, pvalues[KEY_CNT - 2]);
+
+  for (int64_t i = 0; i < KEY_CNT; ++i) {
+    handles[i].reset();
+  }
+  handle.reset();
+  cache.destroy();
+}
+
 TEST_F(TestKVCache, test_large_kv)
 {
   static const int64_t K_SIZE = 16;
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+
+#include "share/datum/ob_datum_funcs.h"
+#include "share/vector/ob_vector_holder.h"
+#include "sql/engine/expr/ob_expr_vector.h"
+
+namespace oceanbase
+{
+namespace share
+{
+using namespace common;
+using namespace sql;
+
+static const int64_t ROW_CNT = 100;
+
+class TestVectorFormat : public ::testing::Test
+{
+public:
+  TestVectorFormat()
+  {
+    MEMSET(nulls_buf_, 0, sizeof(nulls_buf_));
+    MEMSET(skip_buf_, 0, sizeof(skip_buf_));
+  }
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+protected:
+  ObBitVector *nulls() { return to_bit_vector(nulls_buf_); }
+  ObBitVector *skip() { return to_bit_vector(skip_buf_); }
+  char nulls_buf_[ObBitVector::BYTES_PER_WORD * 2];
+  char skip_buf_[ObBitVector::BYTES_PER_WORD * 2];
+};
+
+TEST_F(TestVectorFormat, fixed_length)
+{
+  int64_t values[ROW_CNT];
+  ObFixedLengthVector<int64_t> vec(values, nulls());
+  vec.reset_nulls(ROW_CNT);
+  ASSERT_EQ(VEC_FIXED, vec.get_format());
+  for (int64_t i = 0; i < ROW_CNT; i++) {
+    vec.set_value(i, i * 10);
+  }
+  ASSERT_FALSE(vec.has_null());
+  vec.set_null(3);
+  ASSERT_TRUE(vec.has_null());
+  ASSERT_TRUE(vec.is_null(3));
+  ASSERT_FALSE(vec.is_null(4));
+
+  const char *payload = NULL;
+  ObLength length = 0;
+  vec.get_payload(5, payload, length);
+  ASSERT_EQ(sizeof(int64_t), length);
+  ASSERT_EQ(50, *reinterpret_cast<const int64_t *>(payload));
+  const int64_t v = 7;
+  vec.set_payload(3, &v, sizeof(v));
+  ASSERT_FALSE(vec.is_null(3));
+  ASSERT_EQ(7, vec.get_value(3));
+
+  vec.set_null(9);
+  ObDatum datums[ROW_CNT];
+  skip()->set(1);
+  vec.to_datums(datums, *skip(), ROW_CNT);
+  ASSERT_TRUE(datums[9].is_null());
+  ASSERT_EQ(0, datums[1].len_);
+  ASSERT_EQ(20, datums[2].get_int());
+  ASSERT_EQ(7, datums[3].get_int());
+}
+
+TEST_F(TestVectorFormat, uniform_and_holder)
+{
+  int64_t values[ROW_CNT];
+  ObDatum datums[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; i++) {
+    values[i] = i;
+    datums[i].ptr_ = reinterpret_cast<const char *>(&values[i]);
+    datums[i].pack_ = sizeof(int64_t);
+  }
+  datums[0].set_null();
+
+  ObVectorHolder holder;
+  ASSERT_FALSE(holder.is_valid());
+  ObUniformConstVector *const_vec = holder.make<ObUniformConstVector>(datums);
+  ASSERT_EQ(VEC_UNIFORM_CONST, holder.get()->get_format());
+  ASSERT_TRUE(const_vec->is_null(50));
+  ObUniformBatchVector *batch_vec = holder.make<ObUniformBatchVector>(datums);
+  ASSERT_EQ(VEC_UNIFORM, holder.get()->get_format());
+  ASSERT_TRUE(batch_vec->is_null(0));
+  ASSERT_FALSE(batch_vec->is_null(50));
+  ASSERT_EQ(50, batch_vec->get_datum(50).get_int());
+  ObFixedLengthVector<int64_t> *fixed_vec = holder.make<ObFixedLengthVector<int64_t>>(values, nulls());
+  ASSERT_EQ(VEC_FIXED, holder.get()->get_format());
+  ASSERT_EQ(99, fixed_vec->get_value(99));
+  holder.reset();
+  ASSERT_FALSE(holder.is_valid());
+}
+
+TEST_F(TestVectorFormat, hash_same_as_datum)
+{
+  int64_t values[ROW_CNT];
+  ObDatum datums[ROW_CNT];
+  ObFixedLengthVector<int64_t> fixed_vec(values, nulls());
+  fixed_vec.reset_nulls(ROW_CNT);
+  for (int64_t i = 0; i < ROW_CNT; i++) {
+    values[i] = i * 7919;
+    datums[i].ptr_ = reinterpret_cast<const char *>(&values[i]);
+    datums[i].pack_ = sizeof(int64_t);
+  }
+  datums[10].set_null();
+  fixed_vec.set_null(10);
+  ObUniformBatchVector uniform_vec(datums);
+
+  ObExpr expr;
+  expr.datum_meta_.type_ = ObIntType;
+  expr.obj_datum_map_ = OBJ_DATUM_8BYTE_DATA;
+  expr.basic_funcs_ = ObDatumFuncs::get_basic_func(ObIntType, CS_TYPE_BINARY);
+  ASSERT_TRUE(NULL != expr.basic_funcs_);
+
+  const uint64_t seed = 99194853094755497L;
+  uint64_t fixed_hash[ROW_CNT];
+  uint64_t uniform_hash[ROW_CNT];
+  uint64_t datum_hash[ROW_CNT];
+  skip()->reset(ROW_CNT);
+  ASSERT_EQ(OB_SUCCESS, ObExprVectorUtil::murmur_hash_v2_batch(
+      fixed_vec, expr, fixed_hash, *skip(), ROW_CNT, &seed, false));
+  ASSERT_EQ(OB_SUCCESS, ObExprVectorUtil::murmur_hash_v2_batch(
+      uniform_vec, expr, uniform_hash, *skip(), ROW_CNT, &seed, false));
+  expr.basic_funcs_->murmur_hash_v2_batch_(datum_hash, datums, true, *skip(), ROW_CNT,
+                                           &seed, false);
+  for (int64_t i = 0; i < ROW_CNT; i++) {
+    ASSERT_EQ(datum_hash[i], fixed_hash[i]);
+    ASSERT_EQ(datum_hash[i], uniform_hash[i]);
+  }
+
+  // batch seed
+  ASSERT_EQ(OB_SUCCESS, ObExprVectorUtil::murmur_hash_v2_batch(
+      fixed_vec, expr, fixed_hash, *skip(), ROW_CNT, fixed_hash, true));
+  expr.basic_funcs_->murmur_hash_v2_batch_(datum_hash, datums, true, *skip(), ROW_CNT,
+                                           datum_hash, true);
+  for (int64_t i = 0; i < ROW_CNT; i++) {
+    ASSERT_EQ(datum_hash[i], fixed_hash[i]);
+  }
+}
+
+} // end namespace share
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
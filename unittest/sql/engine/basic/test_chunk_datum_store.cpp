@@ -941,6 +941,42 @@ TEST_F(TestChunkDatumStore, test_only_disk_data1)
   rs.reset();
 }
 
+TEST_F(TestChunkDatumStore, test_compressed_disk_data)
+{
+  int64_t cnt = 10000;
+  LOG_INFO("starting write compressed disk test: append rows", K(cnt));
+  ObChunkDatumStore raw_rs;
+  ObChunkDatumStore rs;
+  ASSERT_EQ(OB_SUCCESS, raw_rs.alloc_dir_id());
+  ASSERT_EQ(OB_SUCCESS, rs.alloc_dir_id());
+  ObChunkDatumStore::Iterator it;
+  ASSERT_EQ(OB_SUCCESS, raw_rs.init(0, tenant_id_, ctx_id_, label_));
+  ASSERT_EQ(OB_SUCCESS, rs.init(0, tenant_id_, ctx_id_, label_));
+  ASSERT_EQ(OB_SUCCESS, rs.set_compressor_type(LZ4_COMPRESSOR));
+  ASSERT_TRUE(rs.is_dump_compressed());
+  raw_rs.set_mem_limit(1L << 30);
+  rs.set_mem_limit(1L << 30);
+  CALL(append_rows, raw_rs, cnt);
+  ASSERT_EQ(OB_SUCCESS, raw_rs.dump(false, true));
+  raw_rs.finish_add_row();
+  // disk data and memory data
+  CALL(append_rows, rs, cnt);
+  ASSERT_EQ(OB_SUCCESS, rs.dump(false, true));
+  ASSERT_EQ(OB_STATE_NOT_MATCH, rs.set_compressor_type(ZSTD_COMPRESSOR));
+  CALL(append_rows, rs, cnt);
+  rs.finish_add_row();
+  LOG_INFO("dumped file size", K(raw_rs.get_file_size()), K(rs.get_file_size()));
+  ASSERT_LT(rs.get_file_size(), raw_rs.get_file_size());
+
+  CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true, ObChunkDatumStore::BLOCK_SIZE);
+  it.reset();
+  CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true, 0);
+  it.reset();
+
+  raw_rs.reset();
+  rs.reset();
+}
+
 TEST_F(TestChunkDatumStore, test_append_block)
 {
   int ret = OB_SUCCESS;
@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "sql/engine/basic/ob_pushdown_filter.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
+#include "sql/engine/px/p2p_datahub/ob_runtime_filter_msg.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/resolver/expr/ob_raw_expr.h"
+#include "sql/code_generator/ob_static_engine_cg.h"
+#include "share/datum/ob_datum_funcs.h"
+#include "share/ob_cluster_version.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace sql;
+
+namespace unittest
+{
+typedef ObExprJoinFilter::ObExprJoinFilterContext JoinFilterCtx;
+
+class TestPushdownDynamicFilter : public ::testing::Test
+{
+public:
+  static const int64_t MAX_VAL_CNT = 16;
+  TestPushdownDynamicFilter()
+    : allocator_(), exec_ctx_(allocator_), eval_ctx_(exec_ctx_), expr_spec_(allocator_),
+      op_(eval_ctx_, expr_spec_), node_(allocator_), executor_(nullptr), join_filter_ctx_(nullptr),
+      col_arg_(&col_expr_), val_cnt_(0)
+  {}
+  void SetUp()
+  {
+    ObClusterVersion::get_instance().update_cluster_version(CLUSTER_CURRENT_VERSION);
+    // int column c1 and runtime filter expr on it
+    col_expr_.datum_meta_.type_ = ObIntType;
+    col_expr_.obj_meta_.set_int();
+    col_expr_.obj_datum_map_ = ObDatum::get_obj_datum_map_type(ObIntType);
+    col_expr_.basic_funcs_ = ObDatumFuncs::get_basic_func(ObIntType, CS_TYPE_BINARY);
+    rf_expr_.arg_cnt_ = 1;
+    rf_expr_.args_ = &col_arg_;
+    rf_expr_.expr_ctx_id_ = 0;
+    node_.expr_ = &rf_expr_;
+    node_.op_type_ = WHITE_OP_BT;
+    ASSERT_EQ(OB_SUCCESS, exec_ctx_.init_expr_op(1));
+    ASSERT_EQ(OB_SUCCESS, exec_ctx_.create_expr_op_ctx(rf_expr_.expr_ctx_id_, join_filter_ctx_));
+    ASSERT_TRUE(nullptr != join_filter_ctx_);
+    join_filter_ctx_->need_wait_rf_ = false;
+    join_filter_ctx_->cmp_funcs_.set_allocator(&allocator_);
+    ASSERT_EQ(OB_SUCCESS, join_filter_ctx_->cmp_funcs_.init(1));
+    ObCmpFunc cmp_func;
+    cmp_func.cmp_func_ = col_expr_.basic_funcs_->null_first_cmp_;
+    ASSERT_EQ(OB_SUCCESS, join_filter_ctx_->cmp_funcs_.push_back(cmp_func));
+    executor_ = new (allocator_.alloc(sizeof(ObDynamicFilterExecutor)))
+        ObDynamicFilterExecutor(allocator_, node_, op_);
+    ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  }
+  void TearDown()
+  {
+    // msgs are owned by the test cases
+    join_filter_ctx_->rf_msg_ = nullptr;
+    executor_->~ObDynamicFilterExecutor();
+    executor_ = nullptr;
+  }
+  ObDatum make_datum(const int64_t val, const bool is_null = false)
+  {
+    ObDatum datum;
+    if (is_null) {
+      datum.set_null();
+    } else {
+      vals_[val_cnt_] = val;
+      datum.ptr_ = reinterpret_cast<const char *>(&vals_[val_cnt_++]);
+      datum.pack_ = sizeof(int64_t);
+    }
+    return datum;
+  }
+  void set_ready(ObP2PDatahubMsgBase &msg, const bool is_empty)
+  {
+    msg.is_ready_ = true;
+    msg.is_empty_ = is_empty;
+    join_filter_ctx_->rf_msg_ = &msg;
+  }
+  void init_range_msg(ObRFRangeFilterMsg &msg, const int64_t lower, const int64_t upper)
+  {
+    ASSERT_EQ(OB_SUCCESS, msg.lower_bounds_.init(1));
+    ASSERT_EQ(OB_SUCCESS, msg.upper_bounds_.init(1));
+    ASSERT_EQ(OB_SUCCESS, msg.lower_bounds_.push_back(make_datum(lower)));
+    ASSERT_EQ(OB_SUCCESS, msg.upper_bounds_.push_back(make_datum(upper)));
+  }
+  // NULL_VAL in %vals is null
+  void init_in_msg(ObRFInFilterMsg &msg, const int64_t *vals, const int64_t cnt)
+  {
+    msg.col_cnt_ = 1;
+    for (int64_t i = 0; i < cnt; ++i) {
+      ObIAllocator &msg_alloc = msg.get_allocator();
+      ObFixedArray<ObDatum, ObIAllocator> *row = new (msg_alloc.alloc(sizeof(ObFixedArray<ObDatum, ObIAllocator>)))
+          ObFixedArray<ObDatum, ObIAllocator>(msg_alloc);
+      ASSERT_EQ(OB_SUCCESS, row->init(1));
+      ASSERT_EQ(OB_SUCCESS, row->push_back(make_datum(vals[i], NULL_VAL == vals[i])));
+      ASSERT_EQ(OB_SUCCESS, msg.serial_rows_.push_back(row));
+    }
+  }
+  void check_state(const ObDynamicFilterExecutor::DataState state)
+  {
+    ASSERT_EQ(OB_SUCCESS, executor_->prepare_data());
+    ASSERT_EQ(state, executor_->data_state_);
+  }
+
+protected:
+  static const int64_t NULL_VAL = INT64_MIN;
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObPushdownExprSpec expr_spec_;
+  ObPushdownOperator op_;
+  ObPushdownDynamicFilterNode node_;
+  ObDynamicFilterExecutor *executor_;
+  JoinFilterCtx *join_filter_ctx_;
+  ObExpr col_expr_;
+  ObExpr *col_arg_;
+  ObExpr rf_expr_;
+  int64_t vals_[MAX_VAL_CNT];
+  int64_t val_cnt_;
+};
+
+TEST_F(TestPushdownDynamicFilter, filter_type)
+{
+  ASSERT_EQ(PushdownFilterType::DYNAMIC_FILTER, node_.get_type());
+  ASSERT_TRUE(executor_->is_filter_node());
+  ASSERT_TRUE(executor_->is_filter_white_node());
+  ASSERT_TRUE(executor_->is_filter_dynamic_node());
+  // keep all rows before prepared
+  ASSERT_TRUE(executor_->is_filter_always_true());
+  ASSERT_FALSE(executor_->is_data_prepared());
+
+  // only single key range and in filter on column are pushed down as dynamic filter,
+  // bloom filter is kept as black filter
+  ObRawExprFactory expr_factory(allocator_);
+  ObStaticEngineCG static_cg(GET_MIN_CLUSTER_VERSION());
+  ObPushdownFilterConstructor constructor(&allocator_, static_cg);
+  ObColumnRefRawExpr *col_ref = nullptr;
+  ObConstRawExpr *const_expr = nullptr;
+  ASSERT_EQ(OB_SUCCESS, expr_factory.create_raw_expr(T_REF_COLUMN, col_ref));
+  col_ref->set_data_type(ObIntType);
+  ASSERT_EQ(OB_SUCCESS, expr_factory.create_raw_expr(T_INT, const_expr));
+  const RuntimeFilterType types[] = { RuntimeFilterType::BLOOM_FILTER, RuntimeFilterType::RANGE, RuntimeFilterType::IN };
+  for (int64_t i = 0; i < ARRAYSIZEOF(types); ++i) {
+    const bool expect_dynamic = RuntimeFilterType::BLOOM_FILTER != types[i];
+    bool is_dynamic = !expect_dynamic;
+    ObOpRawExpr *rf_expr = nullptr;
+    ASSERT_EQ(OB_SUCCESS, expr_factory.create_raw_expr(T_OP_RUNTIME_FILTER, rf_expr));
+    rf_expr->set_runtime_filter_type(types[i]);
+    ASSERT_EQ(OB_SUCCESS, rf_expr->add_param_expr(col_ref));
+    ASSERT_EQ(OB_SUCCESS, constructor.is_dynamic_filter_mode(rf_expr, is_dynamic));
+    ASSERT_EQ(expect_dynamic, is_dynamic);
+    // multiple join keys
+    ASSERT_EQ(OB_SUCCESS, rf_expr->add_param_expr(col_ref));
+    ASSERT_EQ(OB_SUCCESS, constructor.is_dynamic_filter_mode(rf_expr, is_dynamic));
+    ASSERT_FALSE(is_dynamic);
+
+    // join key is not a column
+    ObOpRawExpr *const_rf_expr = nullptr;
+    ASSERT_EQ(OB_SUCCESS, expr_factory.create_raw_expr(T_OP_RUNTIME_FILTER, const_rf_expr));
+    const_rf_expr->set_runtime_filter_type(types[i]);
+    ASSERT_EQ(OB_SUCCESS, const_rf_expr->add_param_expr(const_expr));
+    ASSERT_EQ(OB_SUCCESS, constructor.is_dynamic_filter_mode(const_rf_expr, is_dynamic));
+    ASSERT_FALSE(is_dynamic);
+  }
+
+  // kept as black filter until all observers can deserialize dynamic filter node
+  const uint64_t cluster_version = GET_MIN_CLUSTER_VERSION();
+  ObOpRawExpr *range_rf_expr = nullptr;
+  bool is_dynamic = false;
+  ASSERT_EQ(OB_SUCCESS, expr_factory.create_raw_expr(T_OP_RUNTIME_FILTER, range_rf_expr));
+  range_rf_expr->set_runtime_filter_type(RuntimeFilterType::RANGE);
+  ASSERT_EQ(OB_SUCCESS, range_rf_expr->add_param_expr(col_ref));
+  ObClusterVersion::get_instance().update_cluster_version(CLUSTER_VERSION_4_1_0_0);
+  ASSERT_EQ(OB_SUCCESS, constructor.is_dynamic_filter_mode(range_rf_expr, is_dynamic));
+  ASSERT_FALSE(is_dynamic);
+  ObClusterVersion::get_instance().update_cluster_version(cluster_version);
+}
+
+TEST_F(TestPushdownDynamicFilter, range_filter)
+{
+  ObRFRangeFilterMsg msg;
+  init_range_msg(msg, 10, 20);
+  set_ready(msg, false);
+  check_state(ObDynamicFilterExecutor::DATA_PREPARED);
+  ASSERT_TRUE(executor_->is_data_prepared());
+  ASSERT_FALSE(executor_->is_filter_always_true());
+  ASSERT_FALSE(executor_->is_filter_always_false());
+  ASSERT_FALSE(executor_->null_param_contained_);
+  ASSERT_EQ(WHITE_OP_BT, executor_->get_op_type());
+  ASSERT_EQ(2, executor_->params_.count());
+  ASSERT_EQ(10, executor_->params_.at(0).get_int());
+  ASSERT_EQ(20, executor_->params_.at(1).get_int());
+
+  // prepared only once until rescan
+  msg.set_is_active(false);
+  check_state(ObDynamicFilterExecutor::DATA_PREPARED);
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  ASSERT_EQ(0, executor_->params_.count());
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+}
+
+TEST_F(TestPushdownDynamicFilter, range_filter_not_applicable)
+{
+  // null safe equal join
+  ObRFRangeFilterMsg null_safe_msg;
+  init_range_msg(null_safe_msg, 10, 20);
+  ASSERT_EQ(OB_SUCCESS, null_safe_msg.need_null_cmp_flags_.init(1));
+  ASSERT_EQ(OB_SUCCESS, null_safe_msg.need_null_cmp_flags_.push_back(true));
+  set_ready(null_safe_msg, false);
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+  ASSERT_TRUE(executor_->is_filter_always_true());
+
+  // join key of other type
+  ObRFRangeFilterMsg msg;
+  init_range_msg(msg, 10, 20);
+  set_ready(msg, false);
+  join_filter_ctx_->cmp_funcs_.at(0).cmp_func_ = col_expr_.basic_funcs_->null_last_cmp_;
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+  join_filter_ctx_->cmp_funcs_.at(0).cmp_func_ = col_expr_.basic_funcs_->null_first_cmp_;
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  check_state(ObDynamicFilterExecutor::DATA_PREPARED);
+}
+
+TEST_F(TestPushdownDynamicFilter, in_filter)
+{
+  node_.op_type_ = WHITE_OP_IN;
+  ObRFInFilterMsg msg;
+  const int64_t vals[] = { 3, NULL_VAL, 7, 3 };
+  init_in_msg(msg, vals, ARRAYSIZEOF(vals));
+  set_ready(msg, false);
+  check_state(ObDynamicFilterExecutor::DATA_PREPARED);
+  // null never matches in list
+  ASSERT_FALSE(executor_->null_param_contained_);
+  ASSERT_EQ(3, executor_->params_.count());
+  ASSERT_TRUE(executor_->param_set_.created());
+  ASSERT_EQ(2, executor_->param_set_.size());
+  bool is_exist = false;
+  ObObj obj;
+  obj.set_int(7);
+  ASSERT_EQ(OB_SUCCESS, executor_->exist_in_obj_set(obj, is_exist));
+  ASSERT_TRUE(is_exist);
+  obj.set_int(5);
+  ASSERT_EQ(OB_SUCCESS, executor_->exist_in_obj_set(obj, is_exist));
+  ASSERT_FALSE(is_exist);
+
+  // in list of null only
+  ObRFInFilterMsg null_msg;
+  const int64_t null_vals[] = { NULL_VAL, NULL_VAL };
+  init_in_msg(null_msg, null_vals, ARRAYSIZEOF(null_vals));
+  set_ready(null_msg, false);
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+
+  // multiple join keys
+  msg.col_cnt_ = 2;
+  set_ready(msg, false);
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+}
+
+TEST_F(TestPushdownDynamicFilter, bloom_filter)
+{
+  // bloom filter can not be expressed as white filter, keep all rows
+  ObRFBloomFilterMsg msg;
+  set_ready(msg, false);
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+  ASSERT_TRUE(executor_->is_filter_always_true());
+  ASSERT_FALSE(executor_->is_filter_always_false());
+}
+
+TEST_F(TestPushdownDynamicFilter, empty_filter)
+{
+  ObRFRangeFilterMsg range_msg;
+  set_ready(range_msg, true);
+  check_state(ObDynamicFilterExecutor::ALWAYS_FALSE);
+  ASSERT_TRUE(executor_->is_filter_always_false());
+  ASSERT_FALSE(executor_->is_filter_always_true());
+  ASSERT_FALSE(executor_->is_data_prepared());
+
+  node_.op_type_ = WHITE_OP_IN;
+  ObRFInFilterMsg in_msg;
+  set_ready(in_msg, true);
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  check_state(ObDynamicFilterExecutor::ALWAYS_FALSE);
+
+  // inactive filter is never applied even if it is empty
+  in_msg.set_is_active(false);
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+}
+
+TEST_F(TestPushdownDynamicFilter, late_filter)
+{
+  ObRFRangeFilterMsg msg;
+  init_range_msg(msg, 10, 20);
+  msg.is_empty_ = false;
+  join_filter_ctx_->rf_msg_ = &msg;
+  // msg is not ready when the first micro blocks are filtered, checked again later
+  for (int64_t i = 0; i < 3; ++i) {
+    check_state(ObDynamicFilterExecutor::NOT_READY);
+    ASSERT_TRUE(executor_->is_filter_always_true());
+    ASSERT_FALSE(join_filter_ctx_->is_ready());
+  }
+  ASSERT_FALSE(join_filter_ctx_->is_first_);
+  msg.is_ready_ = true;
+  check_state(ObDynamicFilterExecutor::DATA_PREPARED);
+  ASSERT_TRUE(join_filter_ctx_->is_ready());
+  ASSERT_EQ(2, executor_->params_.count());
+
+  // no join filter ctx, e.g. executed in das
+  rf_expr_.expr_ctx_id_ = 1;
+  ASSERT_EQ(OB_SUCCESS, executor_->init_evaluated_datums());
+  check_state(ObDynamicFilterExecutor::ALWAYS_TRUE);
+  rf_expr_.expr_ctx_id_ = 0;
+}
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_pushdown_dynamic_filter.log*");
+  OB_LOGGER.set_file_name("test_pushdown_dynamic_filter.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
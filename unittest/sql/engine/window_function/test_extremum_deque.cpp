@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "sql/engine/window_function/ob_window_function_op.h"
+#include "lib/random/ob_random.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace sql;
+
+namespace unittest
+{
+typedef ObWindowFunctionOp::ExtremumDeque ExtremumDeque;
+typedef ObWindowFunctionOp::Frame Frame;
+
+static const int64_t NULL_VAL = INT64_MIN;
+
+static int cmp_int(const ObDatum &l, const ObDatum &r, int &cmp_ret)
+{
+  cmp_ret = l.get_int() < r.get_int() ? -1 : (l.get_int() > r.get_int() ? 1 : 0);
+  return OB_SUCCESS;
+}
+
+// values of input rows, NULL_VAL for null. Like evaluating the param expr, the fetched datum
+// is overwritten by the next fetch.
+class ValueGetter
+{
+public:
+  static const int64_t MAX_ROW_CNT = 8192;
+  ValueGetter() : row_cnt_(0), get_cnt_(0), cur_int_(0), cur_() {}
+  void set_values(const int64_t *values, const int64_t cnt)
+  {
+    row_cnt_ = cnt;
+    for (int64_t i = 0; i < cnt; ++i) {
+      ints_[i] = values[i];
+      datums_[i].ptr_ = reinterpret_cast<const char *>(&ints_[i]);
+      if (NULL_VAL == values[i]) {
+        datums_[i].set_null();
+      } else {
+        datums_[i].pack_ = sizeof(int64_t);
+      }
+    }
+  }
+  int operator()(const int64_t idx, ObDatum *&datum)
+  {
+    int ret = OB_SUCCESS;
+    if (idx < 0 || idx >= row_cnt_) {
+      ret = OB_INDEX_OUT_OF_RANGE;
+    } else {
+      cur_int_ = ints_[idx];
+      cur_ = datums_[idx];
+      cur_.ptr_ = reinterpret_cast<const char *>(&cur_int_);
+      datum = &cur_;
+      ++get_cnt_;
+    }
+    return ret;
+  }
+  int64_t row_cnt_;
+  int64_t get_cnt_;
+  int64_t ints_[MAX_ROW_CNT];
+  ObDatum datums_[MAX_ROW_CNT];
+  int64_t cur_int_;
+  ObDatum cur_;
+};
+
+class TestExtremumDeque : public ::testing::Test
+{
+public:
+  TestExtremumDeque() : deque_(OB_SERVER_TENANT_ID), last_frame_() {}
+  void TearDown()
+  {
+    deque_.reuse();
+    last_frame_ = Frame();
+  }
+  // extremum of frame by scanning all rows
+  int64_t scan_extremum(const Frame &frame, const bool is_max)
+  {
+    int64_t res = NULL_VAL;
+    for (int64_t i = frame.head_; i <= frame.tail_; ++i) {
+      const int64_t v = getter_.ints_[i];
+      if (NULL_VAL == v) {
+      } else if (NULL_VAL == res || (is_max ? v > res : v < res)) {
+        res = v;
+      }
+    }
+    return res;
+  }
+  int64_t slide(const int64_t head, const int64_t tail, const bool is_max)
+  {
+    ObDatum val;
+    Frame new_frame(head, tail);
+    EXPECT_EQ(OB_SUCCESS, deque_.slide(last_frame_, new_frame, getter_, cmp_int, is_max, val));
+    last_frame_ = new_frame;
+    return val.is_null() ? NULL_VAL : val.get_int();
+  }
+  void check_slide(const int64_t head, const int64_t tail, const bool is_max)
+  {
+    const int64_t res = slide(head, tail, is_max);
+    ASSERT_EQ(scan_extremum(Frame(head, tail), is_max), res) << "frame: [" << head << ", " << tail << "]";
+  }
+
+protected:
+  ExtremumDeque deque_;
+  ValueGetter getter_;
+  Frame last_frame_;
+};
+
+TEST_F(TestExtremumDeque, sliding_frame)
+{
+  const int64_t values[] = { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+  const int64_t cnt = ARRAYSIZEOF(values);
+  getter_.set_values(values, cnt);
+  // max(x) over (rows between 2 preceding and current row) on descending input
+  for (int64_t i = 0; i < cnt; ++i) {
+    check_slide(MAX(0, i - 2), i, true);
+    ASSERT_LE(deque_.idxs_.count() - deque_.begin_, 3);
+  }
+  // each row is read when pushed, compared with the next pushed row and as the front
+  ASSERT_EQ(3 * cnt - 1, getter_.get_cnt_);
+
+  // min(x) over (rows between 2 preceding and current row), every row is an extremum
+  TearDown();
+  for (int64_t i = 0; i < cnt; ++i) {
+    check_slide(MAX(0, i - 2), i, false);
+    ASSERT_EQ(1, deque_.idxs_.count() - deque_.begin_);
+  }
+}
+
+TEST_F(TestExtremumDeque, growing_and_shrinking_frame)
+{
+  const int64_t values[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8 };
+  const int64_t cnt = ARRAYSIZEOF(values);
+  getter_.set_values(values, cnt);
+  for (int64_t k = 0; k < 2; ++k) {
+    const bool is_max = 0 == k;
+    TearDown();
+    // grows by tail only
+    check_slide(0, 0, is_max);
+    check_slide(0, 3, is_max);
+    check_slide(0, 5, is_max);
+    // shrinks by head only
+    check_slide(2, 5, is_max);
+    check_slide(5, 5, is_max);
+    // grows and shrinks, e.g. range frame over duplicated order by keys
+    check_slide(5, 8, is_max);
+    check_slide(6, 8, is_max);
+    check_slide(6, 11, is_max);
+    check_slide(11, 11, is_max);
+    // moves backward or jumps out of the last frame, rebuilt
+    const int64_t get_cnt = getter_.get_cnt_;
+    check_slide(1, 4, is_max);
+    // 4 rows pushed, 4 back items compared and the front read
+    ASSERT_EQ(get_cnt + 9, getter_.get_cnt_);
+    check_slide(0, 2, is_max);
+    check_slide(7, 9, is_max);
+    check_slide(8, 10, is_max);
+    check_slide(10, 11, is_max);
+  }
+}
+
+TEST_F(TestExtremumDeque, null_values)
+{
+  const int64_t values[] = { NULL_VAL, NULL_VAL, 2, NULL_VAL, 1, NULL_VAL, NULL_VAL, NULL_VAL, 7 };
+  const int64_t cnt = ARRAYSIZEOF(values);
+  getter_.set_values(values, cnt);
+  for (int64_t k = 0; k < 2; ++k) {
+    const bool is_max = 0 == k;
+    TearDown();
+    // all values of frame are null
+    ASSERT_EQ(NULL_VAL, slide(0, 0, is_max));
+    ASSERT_EQ(NULL_VAL, slide(0, 1, is_max));
+    ASSERT_TRUE(deque_.empty());
+    ASSERT_EQ(2, slide(1, 2, is_max));
+    ASSERT_EQ(2, slide(2, 3, is_max));
+    ASSERT_EQ(is_max ? 2 : 1, slide(2, 4, is_max));
+    ASSERT_EQ(1, slide(3, 5, is_max));
+    // non-null values slide out
+    ASSERT_EQ(NULL_VAL, slide(5, 7, is_max));
+    ASSERT_TRUE(deque_.empty());
+    ASSERT_EQ(7, slide(6, 8, is_max));
+  }
+}
+
+TEST_F(TestExtremumDeque, duplicate_extremes)
+{
+  const int64_t values[] = { 5, 5, 3, 5, 5, 1, 1, 1, 2 };
+  const int64_t cnt = ARRAYSIZEOF(values);
+  getter_.set_values(values, cnt);
+  // the earliest of equal values is the front, as max/min of aggregation
+  ASSERT_EQ(5, slide(0, 1, true));
+  ASSERT_EQ(2, deque_.idxs_.count() - deque_.begin_);
+  ASSERT_EQ(0, deque_.idxs_.at(deque_.begin_));
+  ASSERT_EQ(5, slide(1, 3, true));
+  ASSERT_EQ(2, deque_.idxs_.count() - deque_.begin_);
+  ASSERT_EQ(1, deque_.idxs_.at(deque_.begin_));
+  ASSERT_EQ(5, slide(2, 4, true));
+  ASSERT_EQ(3, deque_.idxs_.at(deque_.begin_));
+  ASSERT_EQ(5, slide(4, 6, true));
+  ASSERT_EQ(4, deque_.idxs_.at(deque_.begin_));
+  ASSERT_EQ(1, slide(5, 7, true));
+  ASSERT_EQ(3, deque_.idxs_.count() - deque_.begin_);
+  ASSERT_EQ(2, slide(6, 8, true));
+  ASSERT_EQ(1, deque_.idxs_.count() - deque_.begin_);
+
+  TearDown();
+  ASSERT_EQ(5, slide(0, 1, false));
+  ASSERT_EQ(0, deque_.idxs_.at(deque_.begin_));
+  ASSERT_EQ(3, slide(0, 2, false));
+  ASSERT_EQ(1, slide(3, 7, false));
+  ASSERT_EQ(3, deque_.idxs_.count() - deque_.begin_);
+  ASSERT_EQ(5, deque_.idxs_.at(deque_.begin_));
+  ASSERT_EQ(1, slide(7, 8, false));
+  ASSERT_EQ(2, deque_.idxs_.count() - deque_.begin_);
+  ASSERT_EQ(7, deque_.idxs_.at(deque_.begin_));
+  ASSERT_EQ(2, slide(8, 8, false));
+}
+
+TEST_F(TestExtremumDeque, compact)
+{
+  const int64_t cnt = ValueGetter::MAX_ROW_CNT;
+  int64_t values[cnt];
+  for (int64_t i = 0; i < cnt; ++i) {
+    values[i] = cnt - i;
+  }
+  getter_.set_values(values, cnt);
+  // popped front items are released when they exceed alive items
+  for (int64_t i = 0; i < cnt; ++i) {
+    check_slide(MAX(0, i - 9), i, true);
+    ASSERT_LE(deque_.begin_, ExtremumDeque::COMPACT_THRESHOLD + 1);
+  }
+  ASSERT_LT(deque_.idxs_.count(), cnt);
+  // only the pushed value is copied
+  ASSERT_EQ(static_cast<int64_t>(sizeof(int64_t)), deque_.buf_size_);
+}
+
+TEST_F(TestExtremumDeque, random)
+{
+  const int64_t cnt = 2000;
+  int64_t values[cnt];
+  ObRandom random;
+  for (int64_t i = 0; i < cnt; ++i) {
+    // small domain for duplicated values
+    values[i] = random.get(0, 9) < 2 ? NULL_VAL : random.get(0, 20);
+  }
+  getter_.set_values(values, cnt);
+  for (int64_t k = 0; k < 2; ++k) {
+    const bool is_max = 0 == k;
+    TearDown();
+    int64_t head = 0;
+    int64_t tail = 0;
+    while (tail < cnt) {
+      check_slide(head, tail, is_max);
+      if (0 == random.get(0, 49)) {
+        // backward
+        head = random.get(0, head);
+        tail = random.get(head, tail);
+      } else {
+        tail = tail + random.get(0, 3);
+        head = MIN(tail, head + random.get(0, 3));
+      }
+    }
+  }
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_extremum_deque.log*");
+  OB_LOGGER.set_file_name("test_extremum_deque.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -85,10 +85,21 @@ public:
 
   void basic_filter_pushdown_bt_test();
 
+  void basic_filter_pushdown_like_test();
+
   void filter_pushdown_comaprison_neg_test();
 
   void batch_decode_to_datum_test(bool is_condensed = false);
 
+  void int_sum_test();
+
+  void integer_delta_test();
+
+  void integer_delta_data_version_test();
+
+  // FLOAT_DECIMAL is expected to be chosen only if data_version supports it
+  void float_decimal_test(const int64_t data_version = DATA_VERSION_4_2_0_0);
+
   void batch_get_row_perf_test();
 
   void set_encoding_type(ObColumnHeader::Type type);
@@ -182,7 +193,9 @@ void TestColumnDecoder::set_column_type_string()
 
 void TestColumnDecoder::SetUp()
 {
-  if (column_encoding_type_ == ObColumnHeader::Type::INTEGER_BASE_DIFF) {
+  if (column_encoding_type_ == ObColumnHeader::Type::INTEGER_BASE_DIFF
+      || column_encoding_type_ == ObColumnHeader::Type::INTEGER_DELTA
+      || column_encoding_type_ == ObColumnHeader::Type::FLOAT_DECIMAL) {
     set_column_type_integer();
   } else if (column_encoding_type_ == ObColumnHeader::Type::HEX_PACKING
       || column_encoding_type_ == ObColumnHeader::Type::STRING_DIFF
@@ -256,6 +269,11 @@ void TestColumnDecoder::SetUp()
   ctx_.column_cnt_ = column_cnt_ + extra_rowkey_cnt_;
   ctx_.col_descs_ = &col_descs_;
   ctx_.row_store_type_ = common::ENCODING_ROW_STORE;
+  if (ObColumnHeader::Type::INTEGER_DELTA == column_encoding_type_
+      || ObColumnHeader::Type::FLOAT_DECIMAL == column_encoding_type_) {
+    // chosen only when the data version supports it
+    ctx_.major_working_cluster_version_ = DATA_VERSION_4_2_0_0;
+  }
 
   if (!is_retro_) {
     int64_t *column_encodings = reinterpret_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * ctx_.column_cnt_));
@@ -267,6 +285,10 @@ void TestColumnDecoder::SetUp()
       }
       if (ObColumnHeader::Type::INTEGER_BASE_DIFF == column_encoding_type_) {
         ctx_.column_encodings_[i] = column_encoding_type_;
+      } else if (ObColumnHeader::Type::INTEGER_DELTA == column_encoding_type_
+          || ObColumnHeader::Type::FLOAT_DECIMAL == column_encoding_type_) {
+        // chosen by size, only suitable for part of integer columns
+        ctx_.column_encodings_[i] = ObColumnHeader::Type::RAW;
       } else if (col_obj_types_[i] == ObIntType) {
         ctx_.column_encodings_[i] = ObColumnHeader::Type::DICT;
       } else {
@@ -339,6 +361,8 @@ int TestColumnDecoder::test_filter_pushdown(
   filter.params_ = objs;
   if (sql::WHITE_OP_IN == filter.get_op_type()) {
     filter.init_obj_set();
+  } else if (sql::WHITE_OP_LI == filter.get_op_type()) {
+    filter.init_like_matcher();
   }
 
   if (is_retro) {
@@ -840,6 +864,124 @@ void TestColumnDecoder::basic_filter_pushdown_bt_test()
   }
 }
 
+void TestColumnDecoder::basic_filter_pushdown_like_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t seed_1 = 10001;
+  int64_t seed_2 = 10002;
+  for (int64_t i = 0; i < ROW_CNT - 20; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed_1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 20; i < ROW_CNT - 10; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed_2, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 10; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  int64_t seed1_count = ROW_CNT - 20;
+  int64_t seed2_count = 10;
+
+  char* buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    } else if (ObVarcharType != row_generate_.column_list_.at(i).col_type_.get_type()) {
+      continue;
+    }
+    ObObj ref_obj_1;
+    setup_obj(ref_obj_1, i, seed_1);
+    const ObString str_1 = ref_obj_1.get_string();
+    const int64_t len = str_1.length();
+    ASSERT_GT(len, 8);
+    // string of seed_1 and seed_2 only differs in the last few digits
+    struct LikeCase {
+      ObString pattern_;
+      int64_t expect_cnt_;
+    } cases[8];
+    char *pattern_buf = static_cast<char *>(allocator_.alloc(8 * (len + 2)));
+    ASSERT_TRUE(nullptr != pattern_buf);
+    char *p = pattern_buf;
+    int64_t case_cnt = 0;
+    // exact
+    MEMCPY(p, str_1.ptr(), len);
+    cases[case_cnt++] = {ObString(len, p), seed1_count};
+    p += len;
+    // all
+    p[0] = '%';
+    cases[case_cnt++] = {ObString(1, p), seed1_count + seed2_count};
+    p += 1;
+    // prefix, common by both seeds
+    MEMCPY(p, str_1.ptr(), len / 2);
+    p[len / 2] = '%';
+    cases[case_cnt++] = {ObString(len / 2 + 1, p), seed1_count + seed2_count};
+    p += len / 2 + 1;
+    // prefix of whole string
+    MEMCPY(p, str_1.ptr(), len);
+    p[len] = '%';
+    cases[case_cnt++] = {ObString(len + 1, p), seed1_count};
+    p += len + 1;
+    // suffix
+    p[0] = '%';
+    MEMCPY(p + 1, str_1.ptr() + len - 4, 4);
+    cases[case_cnt++] = {ObString(5, p), seed1_count};
+    p += 5;
+    // substring
+    p[0] = '%';
+    MEMCPY(p + 1, str_1.ptr() + len - 4, 4);
+    p[5] = '%';
+    cases[case_cnt++] = {ObString(6, p), seed1_count};
+    p += 6;
+    // general pattern with '_'
+    p[0] = '_';
+    MEMCPY(p + 1, str_1.ptr() + 1, len - 1);
+    cases[case_cnt++] = {ObString(len, p), seed1_count};
+    p += len;
+    // no match
+    MEMCPY(p, "x%", 2);
+    cases[case_cnt++] = {ObString(2, p), 0};
+
+    const ObCollationType cs_types[2] = {CS_TYPE_UTF8MB4_BIN, CS_TYPE_UTF8MB4_GENERAL_CI};
+    for (int64_t k = 0; k < 2; ++k) {
+      for (int64_t j = 0; j < case_cnt; ++j) {
+        sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+        white_filter.op_type_ = sql::WHITE_OP_LI;
+        ObMalloc mallocer;
+        mallocer.set_label("ColumnDecoder");
+        ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 2);
+        objs.init(2);
+        ObObj pattern_obj;
+        ObObj escape_obj;
+        pattern_obj.set_varchar(cases[j].pattern_);
+        pattern_obj.set_collation_type(cs_types[k]);
+        escape_obj.set_varchar("\\");
+        escape_obj.set_collation_type(cs_types[k]);
+        objs.push_back(pattern_obj);
+        objs.push_back(escape_obj);
+
+        ObBitmap result_bitmap(allocator_);
+        result_bitmap.init(ROW_CNT);
+        ASSERT_EQ(0, result_bitmap.popcnt());
+        ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(i, is_retro_, decoder, white_filter, result_bitmap, objs));
+        ASSERT_EQ(cases[j].expect_cnt_, result_bitmap.popcnt())
+            << "pattern: " << std::string(cases[j].pattern_.ptr(), cases[j].pattern_.length()) << " cs_type: " << cs_types[k] << std::endl;
+      }
+    }
+  }
+}
+
 void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
 {
   ObDatumRow row;
@@ -937,6 +1079,350 @@ void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
   }
 }
 
+void TestColumnDecoder::int_sum_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t seed0 = 10000;
+  int64_t seed1 = 10001;
+  for (int64_t i = 0; i < ROW_CNT - 35; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed0, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 35; i < ROW_CNT - 32; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 32; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  const char *row_data = nullptr;
+  int64_t row_len = 0;
+  void *datum_buf = allocator_.alloc(sizeof(int8_t) * 128 * ROW_CNT);
+  int64_t summed_col_cnt = 0;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    const ObObjTypeStoreClass sc =
+        get_store_class_map()[col_descs_.at(i).col_type_.get_type_class()];
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    } else if (ObIntSC != sc && ObUIntSC != sc) {
+      continue;
+    }
+    const bool is_unsigned = ObUIntSC == sc;
+    ObDatum datums[ROW_CNT];
+    int64_t row_ids[ROW_CNT];
+    // sum every second row
+    const int64_t row_cap = ROW_CNT / 2;
+    for (int64_t j = 0; j < row_cap; ++j) {
+      datums[j].ptr_ = reinterpret_cast<char *>(datum_buf) + j * 128;
+      row_ids[j] = j * 2 + 1;
+    }
+    ObEncodingIntSum sum(is_unsigned);
+    int ret = decoder.get_int_sum(i, row_ids, row_cap, datums, sum);
+    if (OB_NOT_SUPPORTED == ret || sum.overflow_) {
+      continue;
+    }
+    ASSERT_EQ(OB_SUCCESS, ret);
+    ObEncodingIntSum expected(is_unsigned);
+    for (int64_t j = 0; j < row_cap; ++j) {
+      ObObj obj;
+      ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(row_ids[j], row_data, row_len));
+      ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+      ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].decode(obj, row_ids[j], bs, row_data, row_len));
+      if (!obj.is_null()) {
+        expected.add(obj.v_.uint64_, 1);
+      }
+    }
+    STORAGE_LOG(INFO, "int sum", K(i), K(col_descs_.at(i)), K(sum), K(expected));
+    ASSERT_FALSE(expected.overflow_);
+    ASSERT_EQ(expected.get_count(), sum.get_count());
+    ASSERT_EQ(expected.get_uint(), sum.get_uint());
+    ++summed_col_cnt;
+  }
+  ASSERT_GT(summed_col_cnt, 0);
+}
+
+void TestColumnDecoder::integer_delta_test()
+{
+  // more rows than one checkpoint interval of delta encoding
+  const int64_t row_cnt = ObIntegerDeltaHeader::CHECKPOINT_INTERVAL * 2 + 44;
+  const int64_t null_begin = ObIntegerDeltaHeader::CHECKPOINT_INTERVAL - 2;
+  const int64_t null_end = null_begin + 4;
+  const int64_t seed_base = 10000;
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    if (i >= null_begin && i < null_end) {
+      for (int64_t j = 0; j < full_column_cnt_; ++j) {
+        row.storage_datums_[j].set_null();
+      }
+    } else {
+      ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed_base + i, row));
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  const char *row_data = nullptr;
+  int64_t row_len = 0;
+  const char **cell_datas = static_cast<const char **>(allocator_.alloc(sizeof(char *) * row_cnt));
+  ObDatum *datums = static_cast<ObDatum *>(allocator_.alloc(sizeof(ObDatum) * row_cnt));
+  int64_t *row_ids = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * row_cnt));
+  char *datum_buf = static_cast<char *>(allocator_.alloc(sizeof(int8_t) * 128 * row_cnt));
+  ASSERT_TRUE(nullptr != cell_datas && nullptr != datums && nullptr != row_ids && nullptr != datum_buf);
+  int64_t delta_col_cnt = 0;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    } else if (ObColumnHeader::Type::INTEGER_DELTA != decoder.decoders_[i].decoder_->get_type()) {
+      continue;
+    }
+    STORAGE_LOG(INFO, "integer delta col", K(i), K(col_descs_.at(i)));
+    ++delta_col_cnt;
+    // batch decode every third row, crossing checkpoints and null rows
+    int64_t row_cap = 0;
+    for (int64_t j = 0; j < row_cnt; j += 3) {
+      new (&datums[row_cap]) ObDatum();
+      datums[row_cap].ptr_ = datum_buf + row_cap * 128;
+      row_ids[row_cap++] = j;
+    }
+    ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].batch_decode(
+        decoder.row_index_, row_ids, cell_datas, row_cap, datums));
+    for (int64_t j = 0; j < row_cap; ++j) {
+      ObObj expected;
+      if (row_ids[j] >= null_begin && row_ids[j] < null_end) {
+        expected.set_null();
+      } else {
+        setup_obj(expected, i, seed_base + row_ids[j]);
+      }
+      ObObj obj;
+      ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(row_ids[j], row_data, row_len));
+      ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+      ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].decode(obj, row_ids[j], bs, row_data, row_len));
+      ObObj obj_cast_from_datum;
+      ASSERT_EQ(OB_SUCCESS, datums[j].to_obj(obj_cast_from_datum, col_descs_.at(i).col_type_));
+      ASSERT_EQ(expected, obj) << "row: " << row_ids[j];
+      ASSERT_EQ(expected, obj_cast_from_datum) << "row: " << row_ids[j];
+    }
+
+    // range filters pruned by checkpoints
+    sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+    ObMalloc mallocer;
+    mallocer.set_label("ColumnDecoder");
+    ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 2);
+    objs.init(2);
+    ObObj ref_obj;
+    ObObj upper_obj;
+    setup_obj(ref_obj, i, seed_base + ObIntegerDeltaHeader::CHECKPOINT_INTERVAL + 10);
+    setup_obj(upper_obj, i, seed_base + ObIntegerDeltaHeader::CHECKPOINT_INTERVAL * 2 + 20);
+    int64_t gt_cnt = 0;
+    int64_t le_cnt = 0;
+    int64_t bt_cnt = 0;
+    for (int64_t j = 0; j < row_cnt; ++j) {
+      if (j < null_begin || j >= null_end) {
+        ObObj expected;
+        setup_obj(expected, i, seed_base + j);
+        gt_cnt += expected > ref_obj ? 1 : 0;
+        le_cnt += expected <= ref_obj ? 1 : 0;
+        bt_cnt += (expected >= ref_obj && expected <= upper_obj) ? 1 : 0;
+      }
+    }
+    ObBitmap result_bitmap(allocator_);
+    result_bitmap.init(row_cnt);
+
+    objs.push_back(ref_obj);
+    white_filter.op_type_ = sql::WHITE_OP_GT;
+    ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(i, is_retro_, decoder, white_filter, result_bitmap, objs));
+    ASSERT_EQ(gt_cnt, result_bitmap.popcnt());
+
+    white_filter.op_type_ = sql::WHITE_OP_LE;
+    result_bitmap.reuse();
+    ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(i, is_retro_, decoder, white_filter, result_bitmap, objs));
+    ASSERT_EQ(le_cnt, result_bitmap.popcnt());
+
+    objs.push_back(upper_obj);
+    white_filter.op_type_ = sql::WHITE_OP_BT;
+    result_bitmap.reuse();
+    ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(i, is_retro_, decoder, white_filter, result_bitmap, objs));
+    ASSERT_EQ(bt_cnt, result_bitmap.popcnt());
+  }
+  ASSERT_GT(delta_col_cnt, 0);
+}
+
+void TestColumnDecoder::integer_delta_data_version_test()
+{
+  // the same sorted rows as integer_delta_test, but encoded by data version before 4.2.0.0
+  encoder_.reset();
+  ctx_.major_working_cluster_version_ = DATA_VERSION_4_1_0_0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.init(ctx_));
+  const int64_t row_cnt = ObIntegerDeltaHeader::CHECKPOINT_INTERVAL * 2 + 44;
+  const int64_t seed_base = 10000;
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed_base + i, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    ASSERT_NE(ObColumnHeader::Type::INTEGER_DELTA, decoder.decoders_[i].decoder_->get_type()) << "col: " << i;
+  }
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ObDatumRow read_row;
+    ASSERT_EQ(OB_SUCCESS, read_row.init(allocator_, full_column_cnt_));
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed_base + i, row));
+    ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, read_row));
+    for (int64_t j = 0; j < full_column_cnt_; ++j) {
+      ASSERT_TRUE(ObDatum::binary_equal(row.storage_datums_[j], read_row.storage_datums_[j]))
+          << "row: " << i << " col: " << j;
+    }
+  }
+}
+
+void TestColumnDecoder::float_decimal_test(const int64_t data_version)
+{
+  if (data_version != ctx_.major_working_cluster_version_) {
+    encoder_.reset();
+    ctx_.major_working_cluster_version_ = data_version;
+    ASSERT_EQ(OB_SUCCESS, encoder_.init(ctx_));
+  }
+  const bool expect_float_decimal = data_version >= DATA_VERSION_4_2_0_0;
+  const int64_t row_cnt = 300;
+  const int64_t null_begin = 50;
+  const int64_t null_end = 53;
+  const int64_t exception_row = 7;
+  // two decimal digits, except one row which can not be scaled exactly, differs between
+  // columns to avoid column equal encoding
+  auto gen_value = [&](const int64_t col_idx, const int64_t row_id) -> double {
+    return exception_row == row_id
+        ? 1.0 / 3 + col_idx
+        : static_cast<double>((row_id + col_idx * 11) * 37 % 1000) / 100;
+  };
+  auto set_value = [&](const int64_t col_idx, const int64_t row_id, ObObj &obj) {
+    obj.set_meta_type(col_descs_.at(col_idx).col_type_);
+    if (row_id >= null_begin && row_id < null_end) {
+      obj.set_null();
+    } else if (ObFloatTC == col_descs_.at(col_idx).col_type_.get_type_class()) {
+      obj.set_float_value(static_cast<float>(gen_value(col_idx, row_id)));
+    } else {
+      obj.set_double_value(gen_value(col_idx, row_id));
+    }
+  };
+  auto is_float_col = [&](const int64_t col_idx) -> bool {
+    const ObObjTypeClass tc = col_descs_.at(col_idx).col_type_.get_type_class();
+    return (ObFloatTC == tc || ObDoubleTC == tc)
+        && !(col_idx >= rowkey_cnt_ && col_idx < read_info_.get_rowkey_count());
+  };
+
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i, row));
+    for (int64_t j = 0; j < full_column_cnt_; ++j) {
+      if (is_float_col(j)) {
+        ObObj obj;
+        set_value(j, i, obj);
+        ASSERT_EQ(OB_SUCCESS, row.storage_datums_[j].from_obj_enhance(obj));
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  const char *row_data = nullptr;
+  int64_t row_len = 0;
+  const char **cell_datas = static_cast<const char **>(allocator_.alloc(sizeof(char *) * row_cnt));
+  ObDatum *datums = static_cast<ObDatum *>(allocator_.alloc(sizeof(ObDatum) * row_cnt));
+  int64_t *row_ids = static_cast<int64_t *>(allocator_.alloc(sizeof(int64_t) * row_cnt));
+  char *datum_buf = static_cast<char *>(allocator_.alloc(sizeof(int8_t) * 128 * row_cnt));
+  ASSERT_TRUE(nullptr != cell_datas && nullptr != datums && nullptr != row_ids && nullptr != datum_buf);
+  int64_t float_col_cnt = 0;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (!is_float_col(i)) {
+      continue;
+    }
+    STORAGE_LOG(INFO, "float decimal col", K(i), K(col_descs_.at(i)));
+    ASSERT_EQ(expect_float_decimal,
+              ObColumnHeader::Type::FLOAT_DECIMAL == decoder.decoders_[i].decoder_->get_type());
+    ++float_col_cnt;
+    for (int64_t j = 0; j < row_cnt; ++j) {
+      new (&datums[j]) ObDatum();
+      datums[j].ptr_ = datum_buf + j * 128;
+      row_ids[j] = j;
+    }
+    ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].batch_decode(
+        decoder.row_index_, row_ids, cell_datas, row_cnt, datums));
+    for (int64_t j = 0; j < row_cnt; ++j) {
+      ObObj expected;
+      set_value(i, j, expected);
+      ObObj obj;
+      ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(j, row_data, row_len));
+      ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+      ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].decode(obj, j, bs, row_data, row_len));
+      ObObj obj_cast_from_datum;
+      ASSERT_EQ(OB_SUCCESS, datums[j].to_obj(obj_cast_from_datum, col_descs_.at(i).col_type_));
+      ASSERT_EQ(expected, obj) << "row: " << j;
+      ASSERT_EQ(expected, obj_cast_from_datum) << "row: " << j;
+    }
+
+    sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+    ObMalloc mallocer;
+    mallocer.set_label("ColumnDecoder");
+    ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 1);
+    objs.init(1);
+    ObObj ref_obj;
+    set_value(i, 100, ref_obj);
+    objs.push_back(ref_obj);
+    int64_t gt_cnt = 0;
+    for (int64_t j = 0; j < row_cnt; ++j) {
+      ObObj expected;
+      set_value(i, j, expected);
+      gt_cnt += (!expected.is_null() && expected > ref_obj) ? 1 : 0;
+    }
+    ObBitmap result_bitmap(allocator_);
+    result_bitmap.init(row_cnt);
+    white_filter.op_type_ = sql::WHITE_OP_GT;
+    ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(i, is_retro_, decoder, white_filter, result_bitmap, objs));
+    ASSERT_EQ(gt_cnt, result_bitmap.popcnt());
+
+    white_filter.op_type_ = sql::WHITE_OP_NU;
+    result_bitmap.reuse();
+    objs.clear();
+    ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(i, is_retro_, decoder, white_filter, result_bitmap, objs));
+    ASSERT_EQ(null_end - null_begin, result_bitmap.popcnt());
+  }
+  ASSERT_GT(float_col_cnt, 0);
+}
+
 // void TestColumnDecoder::batch_get_row_perf_test()
 // {
 //   ObDatumRow row;
@@ -588,6 +588,73 @@ TEST_F(TestConstDecoder, filter_push_down_in)
   }
 }
 
+TEST_F(TestConstDecoder, filter_push_down_like)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  int64_t seed_1 = 10001;
+  int64_t seed_2 = 10002;
+  for (int64_t i = 0; i < ROW_CNT - 3; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed_1, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t i = ROW_CNT - 3; i < ROW_CNT - 1; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed_2, row));
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  for (int64_t j = 0; j < full_column_cnt_; ++j) {
+    row.storage_datums_[j].set_null();
+  }
+  for (int64_t i = ROW_CNT - 1; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  int64_t seed1_count = ROW_CNT - 3;
+  int64_t seed2_count = 2;
+
+  char* buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (i >= rowkey_cnt_ && i < read_info_.get_rowkey_count()) {
+      continue;
+    } else if (ObVarcharType != row_generate_.column_list_.at(i).col_type_.get_type()) {
+      continue;
+    }
+    ObObj ref_obj_1, ref_obj_2;
+    setup_obj(ref_obj_1, i, seed_1);
+    setup_obj(ref_obj_2, i, seed_2);
+    // const value matched, exception value matched, all and none
+    const ObString patterns[] = { ref_obj_1.get_string(), ref_obj_2.get_string(), "%", "x%" };
+    const int64_t expect_cnts[] = { seed1_count, seed2_count, seed1_count + seed2_count, 0 };
+    for (int64_t j = 0; j < ARRAYSIZEOF(patterns); ++j) {
+      sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+      white_filter.op_type_ = sql::WHITE_OP_LI;
+      ObMalloc mallocer;
+      mallocer.set_label("ConstDecoder");
+      ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 2);
+      objs.init(2);
+      ObObj pattern_obj;
+      ObObj escape_obj;
+      pattern_obj.set_varchar(patterns[j]);
+      pattern_obj.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+      escape_obj.set_varchar("\\");
+      escape_obj.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+      objs.push_back(pattern_obj);
+      objs.push_back(escape_obj);
+
+      ObBitmap result_bitmap(allocator_);
+      result_bitmap.init(ROW_CNT);
+      ASSERT_EQ(0, result_bitmap.popcnt());
+      ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(i, false, decoder, white_filter, result_bitmap, objs));
+      ASSERT_EQ(expect_cnts[j], result_bitmap.popcnt()) << "col: " << i << " pattern: " << j << std::endl;
+    }
+  }
+}
+
 TEST_F(TestConstDecoder, batch_decode_to_datum_test_without_expection)
 {
   ObDatumRow row;
@@ -53,6 +53,20 @@ public:
   virtual ~TestIntBaseDiffDecoder() {}
 };
 
+class TestIntDeltaDecoder : public TestColumnDecoder
+{
+public:
+  TestIntDeltaDecoder() : TestColumnDecoder(ObColumnHeader::Type::INTEGER_DELTA) {}
+  virtual ~TestIntDeltaDecoder() {}
+};
+
+class TestFloatDecimalDecoder : public TestColumnDecoder
+{
+public:
+  TestFloatDecimalDecoder() : TestColumnDecoder(ObColumnHeader::Type::FLOAT_DECIMAL) {}
+  virtual ~TestFloatDecimalDecoder() {}
+};
+
 class TestRetroPDDecoder : public TestColumnDecoder
 {
 public:
@@ -91,6 +105,26 @@ PUSHDOWN_GENERAL_TEST(TestDictDecoder);
 PUSHDOWN_GENERAL_TEST(TestRLEDecoder);
 PUSHDOWN_GENERAL_TEST(TestIntBaseDiffDecoder);
 
+TEST_F(TestRetroPDDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
+TEST_F(TestDictDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
+TEST_F(TestStringPrefixDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
+TEST_F(TestRLEDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
 TEST_F(TestHexDecoder, basic_filter_pushdown_op_test_eq_ne_nu_nn)
 {
   basic_filter_pushdown_eq_ne_nu_nn_test();
@@ -116,6 +150,46 @@ TEST_F(TestIntBaseDiffDecoder, batch_decode_to_datum_test)
   batch_decode_to_datum_test();
 }
 
+TEST_F(TestDictDecoder, int_sum_test)
+{
+  int_sum_test();
+}
+
+TEST_F(TestRLEDecoder, int_sum_test)
+{
+  int_sum_test();
+}
+
+TEST_F(TestIntBaseDiffDecoder, int_sum_test)
+{
+  int_sum_test();
+}
+
+TEST_F(TestIntDeltaDecoder, integer_delta_test)
+{
+  integer_delta_test();
+}
+
+TEST_F(TestIntDeltaDecoder, int_sum_test)
+{
+  int_sum_test();
+}
+
+TEST_F(TestIntDeltaDecoder, integer_delta_data_version_test)
+{
+  integer_delta_data_version_test();
+}
+
+TEST_F(TestFloatDecimalDecoder, float_decimal_test)
+{
+  float_decimal_test();
+}
+
+TEST_F(TestFloatDecimalDecoder, float_decimal_data_version_test)
+{
+  float_decimal_test(DATA_VERSION_4_1_0_0);
+}
+
 TEST_F(TestHexDecoder, batch_decode_to_datum_test)
 {
   batch_decode_to_datum_test();
@@ -321,6 +321,75 @@ TEST_F(TestColumnEqualExceptionList, test_column_equal_ext_offset_overflow)
 
 }
 
+class TestCachedDecoders : public TestIColumnEncoder
+{
+public:
+  static const int64_t TEST_COLUMN_CNT = 64;
+  TestCachedDecoders()
+  {
+    rowkey_cnt_ = 1;
+    column_cnt_ = TEST_COLUMN_CNT;
+    col_types_ = reinterpret_cast<ObObjType *>(allocator_.alloc(sizeof(ObObjType) * column_cnt_));
+    for (int64_t i = 0; i < column_cnt_; ++i) {
+      col_types_[i] = 0 == i % 2 ? ObIntType : ObVarcharType;
+    }
+  }
+  virtual ~TestCachedDecoders()
+  {
+    allocator_.free(col_types_);
+  }
+};
+
+TEST_F(TestCachedDecoders, test_cache_decoders_of_wide_block)
+{
+  ObMicroBlockEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, column_cnt_));
+  const int64_t row_cnt = 100;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(row));
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row));
+  }
+  const int64_t encoder_checksum = encoder.get_micro_block_checksum();
+  char *buf = nullptr;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder.build_block(buf, size));
+
+  // decoders of part of columns fit into the default cache size
+  int64_t default_size = 0;
+  int64_t full_size = 0;
+  const int64_t max_size = ObMicroBlockDecoder::get_max_decoder_cache_size(
+      column_cnt_, ObMicroBlockDecoder::MAX_CACHED_DECODER_BUF_SIZE_LIMIT);
+  ASSERT_LE(max_size, ObMicroBlockDecoder::MAX_CACHED_DECODER_BUF_SIZE_LIMIT);
+  ASSERT_EQ(OB_SUCCESS, ObMicroBlockDecoder::get_decoder_cache_size(
+      buf, size, ObMicroBlockDecoder::MAX_CACHED_DECODER_BUF_SIZE, default_size));
+  ASSERT_EQ(OB_SUCCESS, ObMicroBlockDecoder::get_decoder_cache_size(buf, size, max_size, full_size));
+  ASSERT_LE(default_size, ObMicroBlockDecoder::MAX_CACHED_DECODER_BUF_SIZE);
+  ASSERT_LT(default_size, full_size);
+  ASSERT_LE(full_size, max_size);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObMicroBlockDecoder::get_decoder_cache_size(
+      buf, size, ObMicroBlockDecoder::MAX_CACHED_DECODER_BUF_SIZE_LIMIT + 1, full_size));
+
+  char *cache_buf = static_cast<char *>(allocator_.alloc(full_size));
+  ASSERT_NE(nullptr, cache_buf);
+  ASSERT_EQ(OB_SUCCESS, ObMicroBlockDecoder::cache_decoders(cache_buf, full_size, buf, size));
+
+  // rows decoded by cached decoders are the same
+  ObMicroBlockData micro_data(buf, size, cache_buf, full_size, ObMicroBlockData::DATA_BLOCK);
+  ObMicroBlockDecoder decoder;
+  ObDatumRow read_row;
+  ASSERT_EQ(OB_SUCCESS, read_row.init(column_cnt_));
+  ASSERT_EQ(OB_SUCCESS, decoder.init(micro_data, nullptr));
+  ASSERT_EQ(0, decoder.need_release_decoder_cnt_);
+  int64_t new_checksum = 0;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, decoder.get_row(i, read_row));
+    new_checksum = ObIMicroBlockWriter::cal_row_checksum(read_row, new_checksum);
+  }
+  ASSERT_EQ(encoder_checksum, new_checksum);
+}
+
 class TestEncodingRowBufHolder : public ::testing::Test
 {
 public:
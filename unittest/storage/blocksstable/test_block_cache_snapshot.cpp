@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "storage/blocksstable/ob_block_cache_snapshot.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/file/ob_file.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+
+namespace unittest
+{
+static const char *SNAPSHOT_FILE = "test_block_cache_snapshot.snap";
+
+class TestBlockCacheSnapshot : public ::testing::Test
+{
+public:
+  TestBlockCacheSnapshot() = default;
+  void SetUp()
+  {
+    ::remove(SNAPSHOT_FILE);
+    ASSERT_EQ(OB_SUCCESS, snapshot_.init(SNAPSHOT_FILE, data_block_cache_, index_block_cache_));
+  }
+  void TearDown()
+  {
+    snapshot_.destroy();
+    ::remove(SNAPSHOT_FILE);
+  }
+  static void make_records(const int64_t cnt, ObBlockCacheSnapshot::BlockRecordArray &records)
+  {
+    records.reset();
+    for (int64_t i = 0; i < cnt; ++i) {
+      ObBlockCacheSnapshot::BlockRecord record;
+      record.tenant_id_ = 1001;
+      record.macro_first_id_ = 1;
+      record.macro_second_id_ = 100 + i / 4;
+      record.macro_third_id_ = 0;
+      record.offset_ = static_cast<int32_t>(4096 + (i % 4) * 16384);
+      record.size_ = 16384;
+      record.cache_type_ = i % 2;
+      record.get_cnt_ = cnt - i;
+      ASSERT_EQ(OB_SUCCESS, records.push_back(record));
+    }
+  }
+  // overwrite one byte of the snapshot file
+  static void corrupt_file(const int64_t offset)
+  {
+    int fd = ::open(SNAPSHOT_FILE, O_RDWR);
+    ASSERT_TRUE(fd >= 0);
+    char byte = 0;
+    ASSERT_EQ(1, unintr_pread(fd, &byte, 1, offset));
+    byte = static_cast<char>(~byte);
+    ASSERT_EQ(1, unintr_pwrite(fd, &byte, 1, offset));
+    ASSERT_EQ(0, ::close(fd));
+  }
+
+protected:
+  ObDataMicroBlockCache data_block_cache_;
+  ObIndexMicroBlockCache index_block_cache_;
+  ObBlockCacheSnapshot snapshot_;
+};
+
+TEST_F(TestBlockCacheSnapshot, init)
+{
+  ObBlockCacheSnapshot snapshot;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, snapshot.init("", data_block_cache_, index_block_cache_));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, snapshot.init(nullptr, data_block_cache_, index_block_cache_));
+  ASSERT_EQ(OB_NOT_INIT, snapshot.warm_up());
+  ASSERT_EQ(OB_NOT_INIT, snapshot.start());
+  ASSERT_EQ(OB_NOT_INIT, snapshot.dump());
+  ASSERT_EQ(OB_INIT_TWICE, snapshot_.init(SNAPSHOT_FILE, data_block_cache_, index_block_cache_));
+  ASSERT_EQ(&data_block_cache_, snapshot_.get_cache(ObBlockCacheSnapshot::DATA_BLOCK_CACHE));
+  ASSERT_EQ(&index_block_cache_, snapshot_.get_cache(ObBlockCacheSnapshot::INDEX_BLOCK_CACHE));
+  ASSERT_EQ(nullptr, snapshot_.get_cache(ObBlockCacheSnapshot::MAX_CACHE_TYPE));
+}
+
+TEST_F(TestBlockCacheSnapshot, file_format)
+{
+  ObBlockCacheSnapshot::BlockRecordArray records;
+  ObBlockCacheSnapshot::BlockRecordArray read_records;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, snapshot_.read_file(read_records));
+
+  make_records(10, records);
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(records));
+  // written to a temporary file and renamed
+  bool is_exist = false;
+  ASSERT_EQ(OB_SUCCESS, FileDirectoryUtils::is_exists("test_block_cache_snapshot.snap.tmp", is_exist));
+  ASSERT_FALSE(is_exist);
+  int64_t file_size = 0;
+  ASSERT_EQ(OB_SUCCESS, FileDirectoryUtils::get_file_size(SNAPSHOT_FILE, file_size));
+  ASSERT_EQ(sizeof(ObBlockCacheSnapshot::FileHeader) + 10 * sizeof(ObBlockCacheSnapshot::BlockRecord),
+      file_size);
+
+  ASSERT_EQ(OB_SUCCESS, snapshot_.read_file(read_records));
+  ASSERT_EQ(records.count(), read_records.count());
+  ASSERT_EQ(0, MEMCMP(&records.at(0), &read_records.at(0),
+      records.count() * sizeof(ObBlockCacheSnapshot::BlockRecord)));
+
+  // overwrite with an empty snapshot
+  records.reset();
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(records));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.read_file(read_records));
+  ASSERT_EQ(0, read_records.count());
+}
+
+TEST_F(TestBlockCacheSnapshot, checksum_error)
+{
+  ObBlockCacheSnapshot::BlockRecordArray records;
+  ObBlockCacheSnapshot::BlockRecordArray read_records;
+  make_records(8, records);
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(records));
+  corrupt_file(sizeof(ObBlockCacheSnapshot::FileHeader) + 3 * sizeof(ObBlockCacheSnapshot::BlockRecord) + 5);
+  ASSERT_EQ(OB_CHECKSUM_ERROR, snapshot_.read_file(read_records));
+  ASSERT_EQ(0, read_records.count());
+}
+
+TEST_F(TestBlockCacheSnapshot, invalid_file)
+{
+  ObBlockCacheSnapshot::BlockRecordArray records;
+  ObBlockCacheSnapshot::BlockRecordArray read_records;
+  make_records(4, records);
+
+  // bad magic
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(records));
+  corrupt_file(0);
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.read_file(read_records));
+
+  // unknown version
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(records));
+  corrupt_file(offsetof(ObBlockCacheSnapshot::FileHeader, version_));
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.read_file(read_records));
+
+  // truncated records
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(records));
+  ASSERT_EQ(0, ::truncate(SNAPSHOT_FILE,
+      sizeof(ObBlockCacheSnapshot::FileHeader) + 3 * sizeof(ObBlockCacheSnapshot::BlockRecord)));
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.read_file(read_records));
+
+  // truncated header
+  ASSERT_EQ(0, ::truncate(SNAPSHOT_FILE, sizeof(ObBlockCacheSnapshot::FileHeader) / 2));
+  ASSERT_EQ(OB_IO_ERROR, snapshot_.read_file(read_records));
+  ASSERT_EQ(0, read_records.count());
+}
+
+TEST_F(TestBlockCacheSnapshot, warm_up_stopped)
+{
+  ObBlockCacheSnapshot::BlockRecordArray records;
+  make_records(4, records);
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(records));
+  // thread is not running, warm up returns before loading any macro block
+  ASSERT_TRUE(snapshot_.has_set_stop());
+  const int64_t start_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, snapshot_.warm_up());
+  ASSERT_LT(ObTimeUtility::current_time() - start_ts, ObBlockCacheSnapshot::CHECK_STOP_INTERVAL_US * 10);
+
+  // broken snapshot does not fail warm up
+  corrupt_file(0);
+  ASSERT_EQ(OB_SUCCESS, snapshot_.warm_up());
+  ::remove(SNAPSHOT_FILE);
+  ASSERT_EQ(OB_SUCCESS, snapshot_.warm_up());
+}
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_block_cache_snapshot.log*");
+  OB_LOGGER.set_file_name("test_block_cache_snapshot.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
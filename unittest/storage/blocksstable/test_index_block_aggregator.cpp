@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "storage/blocksstable/ob_macro_block_meta.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+
+namespace unittest
+{
+class TestIndexBlockAggregator : public ::testing::Test
+{
+public:
+  TestIndexBlockAggregator() = default;
+  void SetUp() {}
+  void TearDown() {}
+  static void SetUpTestCase() {}
+  static void TearDownTestCase() {}
+  static void make_int_meta(
+      const int64_t col_idx,
+      const int64_t min,
+      const int64_t max,
+      const int64_t sum,
+      const int64_t null_count,
+      ObSkipIndexColMeta &meta)
+  {
+    meta.reset();
+    meta.col_idx_ = col_idx;
+    meta.obj_type_ = ObIntType;
+    meta.flag_ = ObSkipIndexColMeta::HAS_MIN_MAX | ObSkipIndexColMeta::HAS_SUM;
+    meta.null_count_ = null_count;
+    meta.min_.int_ = min;
+    meta.max_.int_ = max;
+    meta.sum_.int_ = sum;
+  }
+};
+
+TEST_F(TestIndexBlockAggregator, col_meta_serialize)
+{
+  ObSkipIndexColMeta meta;
+  make_int_meta(3, -10, 100, 500, 2, meta);
+  const int64_t buf_len = 128;
+  char buf[buf_len] = {0};
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, meta.serialize(buf, buf_len, pos));
+  ASSERT_EQ(meta.get_serialize_size(), pos);
+
+  ObSkipIndexColMeta des_meta;
+  const int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, des_meta.deserialize(buf, data_len, pos));
+  ASSERT_EQ(data_len, pos);
+  ASSERT_EQ(0, MEMCMP(&meta, &des_meta, sizeof(meta)));
+
+  ObObj min_obj;
+  ObObj max_obj;
+  ASSERT_EQ(OB_SUCCESS, des_meta.get_min_obj(min_obj));
+  ASSERT_EQ(OB_SUCCESS, des_meta.get_max_obj(max_obj));
+  ASSERT_EQ(-10, min_obj.get_int());
+  ASSERT_EQ(100, max_obj.get_int());
+}
+
+TEST_F(TestIndexBlockAggregator, aggregate_index_data)
+{
+  ObSkipIndexColMeta child1[2];
+  ObSkipIndexColMeta child2[2];
+  make_int_meta(1, 5, 20, 100, 0, child1[0]);
+  make_int_meta(2, 0, 1, 1, 3, child1[1]);
+  make_int_meta(1, -3, 10, 50, 1, child2[0]);
+  // column 2 has different type in the second child
+  make_int_meta(2, 0, 1, 1, 0, child2[1]);
+  child2[1].obj_type_ = ObUInt64Type;
+
+  ObSkipIndexData data1(child1, 2);
+  ObSkipIndexData data2(child2, 2);
+  ObSkipIndexColMeta found_meta;
+  ASSERT_TRUE(data1.find(2, found_meta));
+  ASSERT_EQ(0, MEMCMP(&child1[1], &found_meta, sizeof(found_meta)));
+  ASSERT_FALSE(data1.find(4, found_meta));
+
+  ObSkipIndexAggregator aggregator;
+  ObSkipIndexData agg_data;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init());
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(data1));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(data2));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_data(agg_data));
+  ASSERT_EQ(1, agg_data.col_cnt_);
+  ObSkipIndexColMeta meta;
+  ASSERT_TRUE(agg_data.find(1, meta));
+  ASSERT_EQ(-3, meta.min_.int_);
+  ASSERT_EQ(20, meta.max_.int_);
+  ASSERT_EQ(150, meta.sum_.int_);
+  ASSERT_EQ(1, meta.null_count_);
+  ASSERT_TRUE(meta.has_sum());
+
+  // child without skip index disables aggregation
+  aggregator.reuse();
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(data1));
+  aggregator.set_not_aggregated();
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_data(agg_data));
+  ASSERT_FALSE(agg_data.is_valid());
+}
+
+TEST_F(TestIndexBlockAggregator, sum_overflow)
+{
+  ObSkipIndexColMeta child1;
+  ObSkipIndexColMeta child2;
+  make_int_meta(0, 0, INT64_MAX, INT64_MAX, 0, child1);
+  make_int_meta(0, 0, 1, 1, 0, child2);
+  ObSkipIndexAggregator aggregator;
+  ObSkipIndexData agg_data;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init());
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(ObSkipIndexData(&child1, 1)));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(ObSkipIndexData(&child2, 1)));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_data(agg_data));
+  ASSERT_EQ(1, agg_data.col_cnt_);
+  ObSkipIndexColMeta meta;
+  agg_data.get_col_meta(0, meta);
+  ASSERT_TRUE(meta.has_min_max());
+  ASSERT_FALSE(meta.has_sum());
+}
+
+TEST_F(TestIndexBlockAggregator, unaligned_index_data)
+{
+  ObSkipIndexColMeta child[2];
+  make_int_meta(1, 5, 20, 100, 0, child[0]);
+  make_int_meta(7, -1, 1, 0, 4, child[1]);
+  // col metas inside index row data are not aligned
+  char buf[sizeof(ObSkipIndexHeader) + sizeof(child) + 1] = {0};
+  char *data_buf = buf + 1;
+  ObSkipIndexHeader header;
+  header.version_ = ObSkipIndexHeader::SKIP_INDEX_HEADER_V1;
+  header.col_cnt_ = 2;
+  header.reserved_ = 0;
+  MEMCPY(data_buf, &header, sizeof(header));
+  MEMCPY(data_buf + sizeof(header), child, sizeof(child));
+
+  const ObSkipIndexHeader *parsed_header = reinterpret_cast<const ObSkipIndexHeader *>(data_buf);
+  ObSkipIndexData data(parsed_header->get_col_metas_buf(), parsed_header->col_cnt_);
+  ASSERT_TRUE(data.is_valid());
+  ASSERT_EQ(sizeof(child), data.get_col_metas_size());
+  ObSkipIndexColMeta meta;
+  ASSERT_TRUE(data.find(7, meta));
+  ASSERT_EQ(0, MEMCMP(&child[1], &meta, sizeof(meta)));
+  ASSERT_FALSE(data.find(2, meta));
+
+  ObSkipIndexAggregator aggregator;
+  ObSkipIndexData agg_data;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init());
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(data));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(ObSkipIndexData(child, 2)));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_data(agg_data));
+  ASSERT_EQ(2, agg_data.col_cnt_);
+  ASSERT_TRUE(agg_data.find(7, meta));
+  ASSERT_EQ(8, meta.null_count_);
+  ASSERT_EQ(-1, meta.min_.int_);
+}
+
+TEST_F(TestIndexBlockAggregator, data_block_meta_version)
+{
+  ObArenaAllocator allocator;
+  ObDataBlockMetaVal meta_val(allocator);
+  meta_val.rowkey_count_ = 1;
+  meta_val.column_count_ = 2;
+  meta_val.micro_block_count_ = 1;
+  meta_val.occupy_size_ = 100;
+  meta_val.original_size_ = 100;
+  meta_val.data_zsize_ = 100;
+  meta_val.logic_id_.tablet_id_ = 1;
+  meta_val.logic_id_.logic_version_ = 1;
+  meta_val.macro_id_.set_block_index(100);
+  meta_val.compressor_type_ = ObCompressorType::NONE_COMPRESSOR;
+  meta_val.row_store_type_ = ObRowStoreType::FLAT_ROW_STORE;
+  ASSERT_TRUE(meta_val.is_valid());
+
+  const int64_t buf_len = 4096;
+  char buf[buf_len];
+  int64_t pos = 0;
+  // meta without skip index keeps V1 format
+  ASSERT_EQ(OB_SUCCESS, meta_val.serialize(buf, buf_len, pos));
+  ASSERT_EQ(ObDataBlockMetaVal::DATA_BLOCK_META_VAL_VERSION, meta_val.version_);
+  ASSERT_EQ(meta_val.get_serialize_size(), pos);
+  ObDataBlockMetaVal des_val(allocator);
+  int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, des_val.deserialize(buf, data_len, pos));
+  ASSERT_EQ(ObDataBlockMetaVal::DATA_BLOCK_META_VAL_VERSION, des_val.version_);
+  ASSERT_TRUE(des_val.skip_index_col_metas_.empty());
+
+  ObSkipIndexColMeta col_meta;
+  make_int_meta(1, 0, 10, 55, 0, col_meta);
+  ASSERT_EQ(OB_SUCCESS, meta_val.skip_index_col_metas_.push_back(col_meta));
+  const int64_t v2_size = meta_val.get_serialize_size();
+  ASSERT_GT(v2_size, data_len);
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, meta_val.serialize(buf, buf_len, pos));
+  ASSERT_EQ(ObDataBlockMetaVal::DATA_BLOCK_META_VAL_VERSION_V2, meta_val.version_);
+  ASSERT_EQ(v2_size, pos);
+  data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, des_val.deserialize(buf, data_len, pos));
+  ASSERT_EQ(ObDataBlockMetaVal::DATA_BLOCK_META_VAL_VERSION_V2, des_val.version_);
+  ASSERT_EQ(1, des_val.skip_index_col_metas_.count());
+  ASSERT_EQ(0, MEMCMP(&col_meta, &des_val.skip_index_col_metas_.at(0), sizeof(col_meta)));
+
+  // unknown version is rejected
+  int32_t bad_version = ObDataBlockMetaVal::DATA_BLOCK_META_VAL_VERSION_V2 + 1;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, serialization::encode_i32(buf, buf_len, pos, bad_version));
+  pos = 0;
+  ASSERT_EQ(OB_NOT_SUPPORTED, des_val.deserialize(buf, data_len, pos));
+}
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_index_block_aggregator.log*");
+  OB_LOGGER.set_file_name("test_index_block_aggregator.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
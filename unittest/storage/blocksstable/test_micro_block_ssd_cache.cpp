@@ -0,0 +1,307 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#define protected public
+#define private public
+#include "storage/blocksstable/ob_micro_block_ssd_cache.h"
+#include "lib/checksum/ob_crc64.h"
+#include "ob_data_file_prepare.h"
+#include "share/ob_simple_mem_limit_getter.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+
+static ObSimpleMemLimitGetter getter;
+
+namespace unittest
+{
+static const char *SSD_CACHE_FILE = "test_micro_block_ssd_cache.data";
+
+class TestMicroBlockSSDCache : public TestDataFilePrepare
+{
+public:
+  typedef ObMicroBlockSSDCache::RecordHeader RecordHeader;
+  typedef ObMicroBlockSSDCache::Location Location;
+  typedef ObMicroBlockSSDCache::WriteBuffer WriteBuffer;
+  static const int64_t BLOCK_SIZE = 4096;
+  static const int64_t SEGMENT_CNT = ObMicroBlockSSDCache::MIN_SEGMENT_CNT;
+
+  TestMicroBlockSSDCache()
+    : TestDataFilePrepare(&getter, "TestMicroBlockSSDCache", 2 * 1024 * 1024, 64)
+  {}
+  virtual void SetUp()
+  {
+    TestDataFilePrepare::SetUp();
+    ::remove(SSD_CACHE_FILE);
+    ASSERT_EQ(OB_SUCCESS, ssd_cache_.init(SSD_CACHE_FILE, SEGMENT_CNT * ObMicroBlockSSDCache::SEGMENT_SIZE));
+    // segments are written by the test, stop the writer thread
+    ssd_cache_.stop();
+    ssd_cache_.wait();
+    MEMSET(&write_buffer_, 0, sizeof(write_buffer_));
+    write_buffer_.buf_ = static_cast<char *>(ob_malloc_align(DIO_ALIGN_SIZE,
+        ObMicroBlockSSDCache::SEGMENT_SIZE, ObMemAttr(OB_SERVER_TENANT_ID, "TestSSDCache")));
+    ASSERT_NE(nullptr, write_buffer_.buf_);
+  }
+  virtual void TearDown()
+  {
+    ob_free_align(write_buffer_.buf_);
+    ssd_cache_.destroy();
+    ::remove(SSD_CACHE_FILE);
+    TestDataFilePrepare::TearDown();
+  }
+  static ObMicroBlockCacheKey make_key(const int64_t i)
+  {
+    return ObMicroBlockCacheKey(OB_SERVER_TENANT_ID, MacroBlockId(0, 100 + i / 16, 0),
+        (i % 16) * BLOCK_SIZE, BLOCK_SIZE);
+  }
+  static void make_block(const int64_t i, char *block)
+  {
+    for (int64_t j = 0; j < BLOCK_SIZE; ++j) {
+      block[j] = static_cast<char>(i + j);
+    }
+  }
+  // fill write buffer with records of block [start, start + cnt) and write the next segment
+  void write_segment(const int64_t start, const int64_t cnt)
+  {
+    char block[BLOCK_SIZE];
+    write_buffer_.pos_ = 0;
+    for (int64_t i = start; i < start + cnt; ++i) {
+      make_block(i, block);
+      RecordHeader *header = new (write_buffer_.buf_ + write_buffer_.pos_) RecordHeader();
+      header->magic_ = RecordHeader::RECORD_MAGIC;
+      header->data_size_ = BLOCK_SIZE;
+      header->data_checksum_ = static_cast<int64_t>(ob_crc64(block, BLOCK_SIZE));
+      header->set_key(make_key(i));
+      MEMCPY(write_buffer_.buf_ + write_buffer_.pos_ + sizeof(RecordHeader), block, BLOCK_SIZE);
+      write_buffer_.pos_ += upper_align(
+          static_cast<int64_t>(sizeof(RecordHeader)) + BLOCK_SIZE, ObMicroBlockSSDCache::RECORD_ALIGN_SIZE);
+    }
+    ASSERT_EQ(OB_SUCCESS, ssd_cache_.write_segment(write_buffer_));
+  }
+  // return OB_SUCCESS only if the block read back is the one written
+  int get_block(const int64_t i)
+  {
+    int ret = OB_SUCCESS;
+    char block[BLOCK_SIZE];
+    ObIOHandle io_handle;
+    const char *block_buf = nullptr;
+    int64_t block_size = 0;
+    make_block(i, block);
+    if (OB_FAIL(ssd_cache_.get(make_key(i), io_handle, block_buf, block_size))) {
+    } else if (BLOCK_SIZE != block_size || 0 != MEMCMP(block, block_buf, BLOCK_SIZE)) {
+      ret = OB_ERR_UNEXPECTED;
+    }
+    return ret;
+  }
+
+protected:
+  ObMicroBlockSSDCache ssd_cache_;
+  WriteBuffer write_buffer_;
+};
+
+TEST_F(TestMicroBlockSSDCache, init)
+{
+  ObMicroBlockSSDCache ssd_cache;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ssd_cache.init(nullptr, SEGMENT_CNT * ObMicroBlockSSDCache::SEGMENT_SIZE));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ssd_cache.init(SSD_CACHE_FILE, ObMicroBlockSSDCache::SEGMENT_SIZE));
+  ASSERT_FALSE(ssd_cache.is_inited());
+  ASSERT_EQ(OB_INIT_TWICE, ssd_cache_.init(SSD_CACHE_FILE, SEGMENT_CNT * ObMicroBlockSSDCache::SEGMENT_SIZE));
+  ASSERT_EQ(SEGMENT_CNT, ssd_cache_.segment_cnt_);
+}
+
+TEST_F(TestMicroBlockSSDCache, admission)
+{
+  char block[BLOCK_SIZE];
+  make_block(0, block);
+  ObMicroBlockCacheValue value(block, BLOCK_SIZE);
+  const ObMicroBlockCacheKey key = make_key(0);
+
+  // first eviction only sets the doorkeeper bit
+  ssd_cache_.on_evict(key, value);
+  ASSERT_EQ(0, ssd_cache_.admit_cnt_);
+  ASSERT_EQ(1, ssd_cache_.doorkeeper_set_cnt_);
+  // second eviction admits
+  ssd_cache_.on_evict(key, value);
+  ASSERT_EQ(1, ssd_cache_.admit_cnt_);
+  ASSERT_NE(nullptr, ssd_cache_.cur_buffer_);
+  ASSERT_EQ(upper_align(static_cast<int64_t>(sizeof(RecordHeader)) + BLOCK_SIZE,
+      ObMicroBlockSSDCache::RECORD_ALIGN_SIZE), ssd_cache_.cur_buffer_->pos_);
+
+  // block still in cache is not admitted again
+  ASSERT_EQ(OB_SUCCESS, ssd_cache_.index_.set_refactored(key, Location(0, 0, 0, BLOCK_SIZE)));
+  ASSERT_FALSE(ssd_cache_.admit(key));
+  // block of an overwritten segment can be admitted again
+  ssd_cache_.segment_seqs_[0] = 1;
+  ASSERT_TRUE(ssd_cache_.admit(key));
+
+  // doorkeeper is reset before half of the bits are set
+  for (int64_t i = 1; i <= ssd_cache_.doorkeeper_bits_; ++i) {
+    ssd_cache_.admit(make_key(i));
+    ASSERT_LE(ssd_cache_.doorkeeper_set_cnt_, ssd_cache_.doorkeeper_bits_ / 2);
+  }
+
+  // oversized block is never admitted
+  const int64_t admit_cnt = ssd_cache_.admit_cnt_;
+  ObMicroBlockCacheValue big_value(write_buffer_.buf_, ObMicroBlockSSDCache::SEGMENT_SIZE);
+  ssd_cache_.on_evict(make_key(1), big_value);
+  ssd_cache_.on_evict(make_key(1), big_value);
+  ASSERT_EQ(admit_cnt, ssd_cache_.admit_cnt_);
+}
+
+TEST_F(TestMicroBlockSSDCache, drop_when_buffers_full)
+{
+  char block[BLOCK_SIZE];
+  make_block(0, block);
+  const int64_t record_size = upper_align(static_cast<int64_t>(sizeof(RecordHeader)) + BLOCK_SIZE,
+      ObMicroBlockSSDCache::RECORD_ALIGN_SIZE);
+  const int64_t records_per_buffer = ObMicroBlockSSDCache::SEGMENT_SIZE / record_size;
+  // writer thread is stopped, all write buffers become full
+  for (int64_t i = 0; i < (ObMicroBlockSSDCache::WRITE_BUFFER_CNT + 1) * records_per_buffer; ++i) {
+    ssd_cache_.append(make_key(i), block, BLOCK_SIZE);
+  }
+  ASSERT_EQ(ObMicroBlockSSDCache::WRITE_BUFFER_CNT * records_per_buffer, ssd_cache_.admit_cnt_);
+  ASSERT_EQ(records_per_buffer, ssd_cache_.drop_cnt_);
+  ASSERT_EQ(0, ssd_cache_.free_buffer_cnt_);
+}
+
+TEST_F(TestMicroBlockSSDCache, wraparound_eviction)
+{
+  const int64_t block_cnt = 8;
+  Location location;
+  for (int64_t seg = 0; seg < SEGMENT_CNT; ++seg) {
+    write_segment(seg * block_cnt, block_cnt);
+    ASSERT_EQ(1, ssd_cache_.segment_seqs_[seg]);
+  }
+  for (int64_t i = 0; i < SEGMENT_CNT * block_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, get_block(i));
+  }
+  ASSERT_EQ(SEGMENT_CNT * block_cnt, ssd_cache_.index_.size());
+  ASSERT_EQ(block_cnt, ssd_cache_.segment_keys_.at(0).count());
+  ASSERT_EQ(OB_SUCCESS, ssd_cache_.locate(make_key(0), location));
+  ASSERT_EQ(0, location.segment_idx_);
+  ASSERT_EQ(1, location.segment_seq_);
+
+  // ring wraps around, the oldest segment is evicted and overwritten
+  const int64_t new_start = SEGMENT_CNT * block_cnt;
+  write_segment(new_start, block_cnt);
+  ASSERT_EQ(2, ssd_cache_.segment_seqs_[0]);
+  ASSERT_EQ(1, ssd_cache_.next_segment_idx_);
+  ASSERT_EQ(SEGMENT_CNT * block_cnt, ssd_cache_.index_.size());
+  // keys of the evicted segment are replaced by the new records
+  ASSERT_EQ(block_cnt, ssd_cache_.segment_keys_.at(0).count());
+  ASSERT_TRUE(make_key(new_start) == ssd_cache_.segment_keys_.at(0).at(0));
+  for (int64_t i = 0; i < block_cnt; ++i) {
+    ASSERT_EQ(OB_ENTRY_NOT_EXIST, get_block(i));
+    ASSERT_EQ(OB_SUCCESS, get_block(new_start + i));
+  }
+  for (int64_t i = block_cnt; i < SEGMENT_CNT * block_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, get_block(i));
+  }
+
+  // location left in index by a failed eviction is ignored by sequence check
+  ASSERT_EQ(OB_SUCCESS, ssd_cache_.index_.set_refactored(make_key(0), location, 1 /* overwrite */));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, ssd_cache_.locate(make_key(0), location));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, get_block(0));
+}
+
+TEST_F(TestMicroBlockSSDCache, check_record)
+{
+  const int64_t record_size = upper_align(static_cast<int64_t>(sizeof(RecordHeader)) + BLOCK_SIZE,
+      ObMicroBlockSSDCache::RECORD_ALIGN_SIZE);
+  const char *block_buf = nullptr;
+  int64_t block_size = 0;
+  write_segment(0, 2);
+  char *record = write_buffer_.buf_;
+
+  ASSERT_EQ(OB_SUCCESS, ssd_cache_.check_record(make_key(0), 0, 1, record, record_size, block_buf, block_size));
+  ASSERT_EQ(record + sizeof(RecordHeader), block_buf);
+  ASSERT_EQ(BLOCK_SIZE, block_size);
+  // record is unaligned in io buffer
+  char *unaligned = static_cast<char *>(ob_malloc(record_size + 1, ObMemAttr(OB_SERVER_TENANT_ID, "TestSSDCache")));
+  ASSERT_NE(nullptr, unaligned);
+  MEMCPY(unaligned + 1, record, record_size);
+  ASSERT_EQ(OB_SUCCESS, ssd_cache_.check_record(make_key(0), 0, 1, unaligned + 1, record_size, block_buf, block_size));
+  ob_free(unaligned);
+
+  // segment is overwritten while reading
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, ssd_cache_.check_record(make_key(0), 0, 0, record, record_size, block_buf, block_size));
+  ASSERT_EQ(nullptr, block_buf);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ssd_cache_.check_record(make_key(0), SEGMENT_CNT, 1, record, record_size, block_buf, block_size));
+  // record of another block
+  ASSERT_EQ(OB_CHECKSUM_ERROR, ssd_cache_.check_record(make_key(1), 0, 1, record, record_size, block_buf, block_size));
+  // truncated record
+  ASSERT_EQ(OB_CHECKSUM_ERROR, ssd_cache_.check_record(make_key(0), 0, 1, record, sizeof(RecordHeader) - 1, block_buf, block_size));
+  ASSERT_EQ(OB_CHECKSUM_ERROR, ssd_cache_.check_record(make_key(0), 0, 1, record, record_size / 2, block_buf, block_size));
+  // corrupted data
+  record[sizeof(RecordHeader) + 10] = static_cast<char>(~record[sizeof(RecordHeader) + 10]);
+  ASSERT_EQ(OB_CHECKSUM_ERROR, ssd_cache_.check_record(make_key(0), 0, 1, record, record_size, block_buf, block_size));
+  ASSERT_EQ(nullptr, block_buf);
+  ASSERT_EQ(0, block_size);
+}
+
+TEST_F(TestMicroBlockSSDCache, concurrent_get_and_overwrite)
+{
+  const int64_t block_cnt = 8;
+  const int64_t round_cnt = SEGMENT_CNT * 4;
+  const int64_t reader_cnt = 4;
+  bool stop = false;
+  int64_t hit_cnt = 0;
+  int64_t error_cnt = 0;
+  for (int64_t seg = 0; seg < SEGMENT_CNT; ++seg) {
+    write_segment(seg * block_cnt, block_cnt);
+  }
+  std::vector<std::thread> readers;
+  for (int64_t t = 0; t < reader_cnt; ++t) {
+    readers.push_back(std::thread([&, t]() {
+      int64_t i = t;
+      while (!ATOMIC_LOAD(&stop)) {
+        const int ret = get_block(i % ((round_cnt + SEGMENT_CNT) * block_cnt));
+        if (OB_SUCCESS == ret) {
+          ATOMIC_INC(&hit_cnt);
+        } else if (OB_ENTRY_NOT_EXIST != ret) {
+          // a reader never sees a block of another key or a torn record
+          ATOMIC_INC(&error_cnt);
+        }
+        i += reader_cnt;
+      }
+    }));
+  }
+  for (int64_t round = 0; round < round_cnt; ++round) {
+    write_segment((SEGMENT_CNT + round) * block_cnt, block_cnt);
+  }
+  ATOMIC_STORE(&stop, true);
+  for (int64_t t = 0; t < reader_cnt; ++t) {
+    readers.at(t).join();
+  }
+  ASSERT_EQ(0, error_cnt);
+  ASSERT_GT(hit_cnt, 0);
+  // only the last ring of blocks is left
+  for (int64_t i = 0; i < (round_cnt + SEGMENT_CNT) * block_cnt; ++i) {
+    ASSERT_EQ(i < round_cnt * block_cnt ? OB_ENTRY_NOT_EXIST : OB_SUCCESS, get_block(i));
+  }
+}
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_ssd_cache.log*");
+  OB_LOGGER.set_file_name("test_micro_block_ssd_cache.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
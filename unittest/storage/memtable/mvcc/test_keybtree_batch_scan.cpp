@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "storage/memtable/mvcc/ob_keybtree.h"
+#include "storage/memtable/ob_memtable_key.h"
+#include "storage/memtable/mvcc/ob_mvcc_row.h"
+#include "common/rowkey/ob_store_rowkey.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/random/ob_random.h"
+
+namespace oceanbase
+{
+namespace unittest
+{
+using namespace common;
+using namespace keybtree;
+using namespace memtable;
+
+typedef ObStoreRowkeyWrapper BtreeKey;
+typedef ObMvccRow *BtreeVal;
+typedef ObKeyBtree<BtreeKey, BtreeVal> Btree;
+typedef BtreeNodeAllocator<BtreeKey, BtreeVal> NodeAllocator;
+typedef Iterator<BtreeKey, BtreeVal> BtreeLeafIterator;
+typedef BtreeIterator<BtreeKey, BtreeVal> BtreeScanIterator;
+typedef BtreeKV<BtreeKey, BtreeVal> KV;
+
+class FakeAllocator : public ObIAllocator
+{
+public:
+  void *alloc(int64_t size) override { return ob_malloc(size, ObModIds::TEST); }
+  void *alloc(const int64_t size, const ObMemAttr &attr) override
+  {
+    UNUSED(attr);
+    return alloc(size);
+  }
+  void free(void *ptr) override { ob_free(ptr); }
+};
+
+// keys are 0, 2, 4, ..., so that bounds can be set on or between keys
+class TestKeyBtreeBatchScan : public ::testing::Test
+{
+public:
+  static const int64_t KEY_CNT = 1000;
+  static const int64_t MAX_VAL = 2 * KEY_CNT;
+  TestKeyBtreeBatchScan() : node_allocator_(allocator_), btree_(node_allocator_) {}
+  void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, btree_.init());
+    // bound keys range from -1 to MAX_VAL
+    for (int64_t i = 0; i <= MAX_VAL + 1; ++i) {
+      objs_[i].set_int(i - 1);
+      new (&rowkeys_[i]) ObStoreRowkey(&objs_[i], 1);
+    }
+    // insert in random order so that leafs are split at different positions
+    int64_t order[KEY_CNT];
+    for (int64_t i = 0; i < KEY_CNT; ++i) {
+      order[i] = i;
+    }
+    for (int64_t i = KEY_CNT - 1; i > 0; --i) {
+      std::swap(order[i], order[ObRandom::rand(0, i)]);
+    }
+    for (int64_t i = 0; i < KEY_CNT; ++i) {
+      const int64_t v = order[i] * 2;
+      BtreeVal val = get_val(v);
+      ASSERT_EQ(OB_SUCCESS, btree_.insert(get_key(v), val));
+    }
+    ASSERT_EQ(KEY_CNT, btree_.size());
+  }
+  void TearDown()
+  {
+    ASSERT_EQ(OB_SUCCESS, btree_.destroy());
+  }
+  BtreeKey get_key(const int64_t v) { return BtreeKey(&rowkeys_[v + 1]); }
+  static BtreeVal get_val(const int64_t v) { return reinterpret_cast<BtreeVal>((v + 1) << 3); }
+  static int64_t get_v(const BtreeKey &key)
+  {
+    int64_t v = INT64_MIN;
+    EXPECT_EQ(OB_SUCCESS, key.get_rowkey()->get_obj_ptr()[0].get_int(v));
+    return v;
+  }
+  // existing keys in the range, in scan order
+  void get_expected(const int64_t start, const bool start_exclude,
+                    const int64_t end, const bool end_exclude, ObIArray<int64_t> &expected)
+  {
+    expected.reset();
+    const bool is_backward = end < start;
+    const int64_t step = is_backward ? -1 : 1;
+    for (int64_t v = start; is_backward ? v >= end : v <= end; v += step) {
+      if (v < 0 || v >= MAX_VAL || 0 != v % 2) {
+      } else if ((start_exclude && v == start) || (end_exclude && v == end)) {
+      } else {
+        ASSERT_EQ(OB_SUCCESS, expected.push_back(v));
+      }
+    }
+  }
+  void check_batch_scan(const int64_t start, const bool start_exclude,
+                        const int64_t end, const bool end_exclude, const int64_t capacity)
+  {
+    ObSEArray<int64_t, 64> expected;
+    get_expected(start, start_exclude, end, end_exclude, expected);
+    BtreeLeafIterator iter(btree_);
+    KV kvs[256];
+    int64_t count = 0;
+    int64_t idx = 0;
+    int ret = OB_SUCCESS;
+    ASSERT_LE(capacity, ARRAYSIZEOF(kvs));
+    ASSERT_EQ(OB_SUCCESS, iter.set_key_range(get_key(start), start_exclude, get_key(end), end_exclude, INT64_MAX));
+    while (OB_SUCC(iter.get_next_batch(kvs, capacity, count))) {
+      ASSERT_GT(count, 0);
+      ASSERT_LE(count, capacity);
+      for (int64_t i = 0; i < count; ++i, ++idx) {
+        ASSERT_LT(idx, expected.count()) << "range: " << start << ", " << end << ", capacity: " << capacity;
+        ASSERT_EQ(expected.at(idx), get_v(kvs[i].key_)) << "range: " << start << ", " << end << ", capacity: " << capacity;
+        ASSERT_EQ(get_val(expected.at(idx)), kvs[i].val_);
+      }
+    }
+    ASSERT_EQ(OB_ITER_END, ret);
+    ASSERT_EQ(0, count);
+    ASSERT_EQ(expected.count(), idx) << "range: " << start << ", " << end << ", capacity: " << capacity;
+    // leaf reference is released at the end
+    ASSERT_EQ(UINT64_MAX, iter.scan_handle_.qc_slot_);
+    // stays at the end
+    ASSERT_EQ(OB_ITER_END, iter.get_next_batch(kvs, capacity, count));
+    ASSERT_EQ(0, count);
+    ASSERT_EQ(UINT64_MAX, iter.scan_handle_.qc_slot_);
+  }
+  void check_scan(const int64_t start, const bool start_exclude, const int64_t end, const bool end_exclude)
+  {
+    ObSEArray<int64_t, 64> expected;
+    get_expected(start, start_exclude, end, end_exclude, expected);
+    BtreeScanIterator iter;
+    BtreeKey key;
+    BtreeVal val = nullptr;
+    int64_t idx = 0;
+    int ret = OB_SUCCESS;
+    ASSERT_EQ(OB_SUCCESS, btree_.set_key_range(iter, get_key(start), start_exclude, get_key(end), end_exclude, INT64_MAX));
+    while (OB_SUCC(iter.get_next(key, val))) {
+      ASSERT_LT(idx, expected.count());
+      ASSERT_EQ(expected.at(idx), get_v(key));
+      ASSERT_EQ(get_val(expected.at(idx)), val);
+      ++idx;
+    }
+    ASSERT_EQ(OB_ITER_END, ret);
+    ASSERT_EQ(expected.count(), idx);
+    iter.reset();
+  }
+
+protected:
+  FakeAllocator allocator_;
+  NodeAllocator node_allocator_;
+  Btree btree_;
+  ObObj objs_[MAX_VAL + 2];
+  ObStoreRowkey rowkeys_[MAX_VAL + 2];
+};
+
+TEST_F(TestKeyBtreeBatchScan, cross_leaf_boundary)
+{
+  // keys span many leafs of at most NODE_KEY_COUNT keys, capacities end in the middle of,
+  // at the end of and beyond a leaf
+  const int64_t capacities[] = { 1, 2, NODE_KEY_COUNT - 1, NODE_KEY_COUNT, NODE_KEY_COUNT + 1, 100, 256 };
+  for (int64_t i = 0; i < ARRAYSIZEOF(capacities); ++i) {
+    const int64_t capacity = capacities[i];
+    // whole tree
+    check_batch_scan(-1, false, MAX_VAL, false, capacity);
+    check_batch_scan(MAX_VAL, false, -1, false, capacity);
+    // bounds on keys
+    for (int64_t flag = 0; flag < 4; ++flag) {
+      const bool start_exclude = flag & 1;
+      const bool end_exclude = flag & 2;
+      check_batch_scan(0, start_exclude, MAX_VAL - 2, end_exclude, capacity);
+      check_batch_scan(MAX_VAL - 2, start_exclude, 0, end_exclude, capacity);
+      check_batch_scan(100, start_exclude, 400, end_exclude, capacity);
+      check_batch_scan(400, start_exclude, 100, end_exclude, capacity);
+      // bounds between keys
+      check_batch_scan(101, start_exclude, 399, end_exclude, capacity);
+      check_batch_scan(399, start_exclude, 101, end_exclude, capacity);
+    }
+  }
+}
+
+TEST_F(TestKeyBtreeBatchScan, small_range)
+{
+  for (int64_t capacity = 1; capacity <= NODE_KEY_COUNT + 1; ++capacity) {
+    // single key
+    check_batch_scan(10, false, 10, false, capacity);
+    check_batch_scan(10, true, 10, false, capacity);
+    check_batch_scan(10, false, 10, true, capacity);
+    // no key in range
+    check_batch_scan(11, false, 11, false, capacity);
+    check_batch_scan(11, false, 11, true, capacity);
+    check_batch_scan(10, true, 12, true, capacity);
+    check_batch_scan(12, true, 10, true, capacity);
+    check_batch_scan(MAX_VAL, false, MAX_VAL, false, capacity);
+    check_batch_scan(-1, false, -1, false, capacity);
+    // two keys
+    check_batch_scan(10, false, 12, false, capacity);
+    check_batch_scan(12, false, 10, false, capacity);
+  }
+}
+
+TEST_F(TestKeyBtreeBatchScan, random_range)
+{
+  for (int64_t i = 0; i < 500; ++i) {
+    const int64_t start = ObRandom::rand(-1, MAX_VAL);
+    const int64_t end = ObRandom::rand(-1, MAX_VAL);
+    const bool start_exclude = ObRandom::rand(0, 1);
+    const bool end_exclude = ObRandom::rand(0, 1);
+    const int64_t capacity = ObRandom::rand(1, 3 * NODE_KEY_COUNT);
+    check_batch_scan(start, start_exclude, end, end_exclude, capacity);
+  }
+}
+
+TEST_F(TestKeyBtreeBatchScan, btree_iterator)
+{
+  // scanned by batch of the kv queue, refilled many times
+  for (int64_t flag = 0; flag < 4; ++flag) {
+    const bool start_exclude = flag & 1;
+    const bool end_exclude = flag & 2;
+    check_scan(-1, start_exclude, MAX_VAL, end_exclude);
+    check_scan(MAX_VAL, start_exclude, -1, end_exclude);
+    check_scan(0, start_exclude, MAX_VAL - 2, end_exclude);
+    check_scan(MAX_VAL - 2, start_exclude, 0, end_exclude);
+    check_scan(33, start_exclude, 1501, end_exclude);
+    check_scan(1500, start_exclude, 32, end_exclude);
+    check_scan(20, start_exclude, 20, end_exclude);
+  }
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_keybtree_batch_scan.log*");
+  OB_LOGGER.set_file_name("test_keybtree_batch_scan.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -314,6 +314,46 @@ public:
 
     return mt.set_(tm_->iter_param_, context, tm_->columns_, write_row, NULL, NULL);
   }
+  int multi_write(const int64_t *keys, const int64_t cnt, ObMemtable &mt, int64_t snapshot_version = 1000) {
+    ObStoreCtx store_ctx;
+    ObTxSnapshot snapshot;
+    ObTxTableGuard tx_table_guard;
+    concurrent_control::ObWriteFlag write_flag;
+    tx_table_guard.init((ObTxTable*)0x100);
+    snapshot.version_.convert_for_gts(snapshot_version);
+    store_ctx.mvcc_acc_ctx_.init_write(trans_ctx_,
+                                       mem_ctx_,
+                                       tx_desc_.tx_id_,
+                                       1000,
+                                       tx_desc_,
+                                       tx_table_guard,
+                                       snapshot,
+                                       INT64_MAX,
+                                       INT64_MAX,
+                                       write_flag);
+    ObTableStoreIterator table_iter;
+    store_ctx.table_iter_ = &table_iter;
+    ObStoreRow write_rows[MAX_MULTI_WRITE_CNT];
+    for (int64_t i = 0; i < cnt; ++i) {
+      ObDatumRowkey row_key;
+      tm_->mock_row(keys[i], keys[i] * 10, row_key, write_rows[i]);
+    }
+
+    ObArenaAllocator allocator;
+    ObTableAccessContext context;
+    ObVersionRange trans_version_range;
+    ObQueryFlag query_flag;
+
+    trans_version_range.base_version_ = 0;
+    trans_version_range.multi_version_start_ = 0;
+    trans_version_range.snapshot_version_ = EXIST_READ_SNAPSHOT_VERSION;
+    query_flag.use_row_cache_ = ObQueryFlag::DoNotUseCache;
+    query_flag.read_latest_ = ObQueryFlag::OBSF_MASK_READ_LATEST;
+
+    context.init(query_flag, store_ctx, allocator, trans_version_range);
+
+    return mt.multi_set_(tm_->iter_param_, context, tm_->columns_, write_rows, cnt);
+  }
   int write(int64_t key, int64_t val, ObMemtable &mt, int64_t snapshot_version = 1000) {
     ObDatumRowkey row_key;
     return write(key, val, mt, row_key, snapshot_version);
@@ -376,6 +416,7 @@ public:
     return ret;
   }
 
+  static const int64_t MAX_MULTI_WRITE_CNT = 16;
   TestMemtable *tm_;
   ObPartTransCtx trans_ctx_;
   ObMemtableCtx mem_ctx_;
@@ -519,6 +560,34 @@ TEST_F(TestMemtable, multi_key)
 }
 
 
+TEST_F(TestMemtable, multi_set)
+{
+  ObMemtable mt;
+  EXPECT_EQ(OB_SUCCESS, init_memtable(mt));
+
+  RunCtxGuard rg;
+  EXPECT_EQ(OB_SUCCESS, rg.init(1, this));
+
+  const int64_t keys[] = {5, 3, 8, 1, 3, 7};
+  EXPECT_EQ(OB_SUCCESS, rg.multi_write(keys, 6, mt));
+  EXPECT_EQ(6, rg.mem_ctx_.trans_mgr_.get_main_list_length());
+
+  int64_t val = 0;
+  EXPECT_EQ(OB_SUCCESS, rg.read(1, val, mt, 1));
+  EXPECT_EQ(OB_SUCCESS, rg.read(3, val, mt, 1));
+  EXPECT_EQ(OB_SUCCESS, rg.read(8, val, mt, 1));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, rg.read(2, val, mt, 1));
+
+  RunCtxGuard rg2;
+  EXPECT_EQ(OB_SUCCESS, rg2.init(2, this));
+  const int64_t conflict_keys[] = {9, 7};
+  EXPECT_EQ(OB_ERR_EXCLUSIVE_LOCK_CONFLICT, rg2.multi_write(conflict_keys, 2, mt));
+
+  share::SCN val_1000;
+  val_1000.convert_for_logservice(1000);
+  EXPECT_EQ(OB_SUCCESS, rg.mem_ctx_.do_trans_end(true, val_1000, val_1000, 0));
+}
+
 }// end of oceanbase
 
 
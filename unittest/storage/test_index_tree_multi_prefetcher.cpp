@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "storage/access/ob_index_tree_prefetcher.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+
+namespace unittest
+{
+typedef ObIndexTreeMultiPrefetcher Prefetcher;
+
+class TestIndexTreeMultiPrefetcher : public ::testing::Test
+{
+public:
+  TestIndexTreeMultiPrefetcher() = default;
+  void SetUp()
+  {
+    prefetcher_.access_ctx_ = &access_ctx_;
+    prefetcher_.data_block_cache_ = &data_block_cache_;
+    for (int64_t i = 0; i < BLOCK_CNT; ++i) {
+      // default macro id is invalid, so that ios of pending blocks can never be submitted
+      headers_[i].macro_id_ = MacroBlockId();
+      headers_[i].block_offset_ = static_cast<int32_t>(4096 * (i + 1));
+      headers_[i].block_size_ = 4096;
+      infos_[i].row_header_ = &headers_[i];
+    }
+  }
+  void TearDown()
+  {
+    prefetcher_.reset_pending_block_io(false /* reset_handles */);
+    prefetcher_.access_ctx_ = nullptr;
+    prefetcher_.data_block_cache_ = nullptr;
+  }
+  void check_pending(const int64_t info_cnt, const int64_t handle_cnt)
+  {
+    ASSERT_EQ(info_cnt, prefetcher_.pending_io_infos_.count());
+    ASSERT_EQ(handle_cnt, prefetcher_.pending_io_handles_.count());
+    ASSERT_EQ(handle_cnt, prefetcher_.pending_io_info_idxs_.count());
+  }
+
+protected:
+  static const int64_t BLOCK_CNT = Prefetcher::MAX_MULTIGET_MICRO_DATA_HANDLE_CNT + 1;
+  ObTableAccessContext access_ctx_;
+  ObDataMicroBlockCache data_block_cache_;
+  Prefetcher prefetcher_;
+  ObIndexBlockRowHeader headers_[BLOCK_CNT];
+  ObMicroIndexInfo infos_[BLOCK_CNT];
+  ObMicroBlockDataHandle handles_[BLOCK_CNT * 2];
+};
+
+TEST_F(TestIndexTreeMultiPrefetcher, defer_data_block_io)
+{
+  const uint64_t tenant_id = OB_SERVER_TENANT_ID;
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[0], handles_[0], true));
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[1], handles_[1], true));
+  check_pending(2, 2);
+  for (int64_t i = 0; i < 2; ++i) {
+    ASSERT_EQ(ObSSTableMicroBlockState::IN_BLOCK_IO, handles_[i].block_state_);
+    ASSERT_EQ(tenant_id, handles_[i].tenant_id_);
+    ASSERT_TRUE(handles_[i].io_handle_.is_empty());
+    ASSERT_EQ(i, prefetcher_.pending_io_info_idxs_.at(i));
+  }
+  // row header is copied, index block data may be released before submit
+  ASSERT_NE(infos_[0].row_header_, prefetcher_.pending_io_infos_.at(0).row_header_);
+  ASSERT_EQ(&prefetcher_.pending_io_headers_[1], prefetcher_.pending_io_infos_.at(1).row_header_);
+  headers_[1].block_offset_ = 0;
+  ASSERT_EQ(4096 * 2, prefetcher_.pending_io_infos_.at(1).get_block_offset());
+}
+
+TEST_F(TestIndexTreeMultiPrefetcher, dedup_pending_block)
+{
+  const uint64_t tenant_id = OB_SERVER_TENANT_ID;
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[0], handles_[0], true));
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[1], handles_[1], true));
+  // micro block of another rowkey is pending already, read by the same io
+  ObMicroIndexInfo dup_info = infos_[0];
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, dup_info, handles_[2], true));
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[1], handles_[3], true));
+  check_pending(2, 4);
+  ASSERT_EQ(0, prefetcher_.pending_io_info_idxs_.at(2));
+  ASSERT_EQ(1, prefetcher_.pending_io_info_idxs_.at(3));
+  ASSERT_EQ(ObSSTableMicroBlockState::IN_BLOCK_IO, handles_[2].block_state_);
+  ASSERT_EQ(ObSSTableMicroBlockState::IN_BLOCK_IO, handles_[3].block_state_);
+
+  // same macro block but another micro block
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[2], handles_[4], true));
+  check_pending(3, 5);
+  ASSERT_EQ(2, prefetcher_.pending_io_info_idxs_.at(4));
+}
+
+TEST_F(TestIndexTreeMultiPrefetcher, dedup_when_pending_full)
+{
+  const uint64_t tenant_id = OB_SERVER_TENANT_ID;
+  const int64_t max_cnt = Prefetcher::MAX_MULTIGET_MICRO_DATA_HANDLE_CNT;
+  for (int64_t i = 0; i < max_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[i], handles_[i], true));
+  }
+  check_pending(max_cnt, max_cnt);
+  // pending block is still shared when no more block can be deferred
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[max_cnt - 1], handles_[max_cnt], true));
+  check_pending(max_cnt, max_cnt + 1);
+  ASSERT_EQ(max_cnt - 1, prefetcher_.pending_io_info_idxs_.at(max_cnt));
+  // a new block is submitted directly, which fails on the invalid macro id
+  ASSERT_NE(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[max_cnt], handles_[max_cnt + 1], true));
+  check_pending(max_cnt, max_cnt + 1);
+  ASSERT_EQ(ObSSTableMicroBlockState::UNKNOWN_STATE, handles_[max_cnt + 1].block_state_);
+}
+
+TEST_F(TestIndexTreeMultiPrefetcher, submit_error)
+{
+  const uint64_t tenant_id = OB_SERVER_TENANT_ID;
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_pending_block_io());
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[i], handles_[i], true));
+  }
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[0], handles_[3], true));
+  check_pending(3, 4);
+  // no handle is left in IN_BLOCK_IO without io if the batch fails to submit
+  ASSERT_NE(OB_SUCCESS, prefetcher_.submit_pending_block_io());
+  check_pending(0, 0);
+  for (int64_t i = 0; i < 4; ++i) {
+    ASSERT_EQ(ObSSTableMicroBlockState::UNKNOWN_STATE, handles_[i].block_state_);
+    ASSERT_TRUE(handles_[i].io_handle_.is_empty());
+  }
+}
+
+TEST_F(TestIndexTreeMultiPrefetcher, prefetch_error)
+{
+  const uint64_t tenant_id = OB_SERVER_TENANT_ID;
+  for (int64_t i = 0; i < 2; ++i) {
+    ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[i], handles_[i], true));
+  }
+  // multi_prefetch fails before submit, pending handles are reset
+  prefetcher_.reset_pending_block_io(true /* reset_handles */);
+  check_pending(0, 0);
+  ASSERT_EQ(ObSSTableMicroBlockState::UNKNOWN_STATE, handles_[0].block_state_);
+  ASSERT_EQ(ObSSTableMicroBlockState::UNKNOWN_STATE, handles_[1].block_state_);
+
+  // handles are kept when the prefetcher is reused after a successful submit
+  ASSERT_EQ(OB_SUCCESS, prefetcher_.submit_block_io(tenant_id, infos_[0], handles_[0], true));
+  prefetcher_.reset_pending_block_io(false /* reset_handles */);
+  check_pending(0, 0);
+  ASSERT_EQ(ObSSTableMicroBlockState::IN_BLOCK_IO, handles_[0].block_state_);
+}
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_index_tree_multi_prefetcher.log*");
+  OB_LOGGER.set_file_name("test_index_tree_multi_prefetcher.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
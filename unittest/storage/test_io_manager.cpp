@@ -559,6 +559,78 @@ TEST_F(TestIOStruct, MClockQueue)
   }
 }
 
+TEST_F(TestIOStruct, BandwidthClock)
+{
+  const int64_t MB = 1024L * 1024L;
+  const int64_t large_size = 1 * MB;
+  const int64_t small_size = 4096;
+  const int64_t current_ts = 1000L * 1000L; // us
+  ObTenantIOConfig::UnitConfig unit_config;
+  unit_config.min_iops_ = 100;
+  unit_config.max_iops_ = 10000L;
+  unit_config.min_bandwidth_ = 1 * MB;
+  unit_config.max_bandwidth_ = 10 * MB;
+  ASSERT_TRUE(unit_config.is_valid());
+  ObTenantIOClock tenant_clock;
+  tenant_clock.update_bandwidth_clocks(unit_config);
+
+  // first io is tagged now, a large io holds back following ios by size / bandwidth
+  ObPhyQueue phy_queue;
+  phy_queue.reservation_ts_ = INT64_MAX;
+  phy_queue.tenant_limitation_ts_ = 0;
+  tenant_clock.calc_bandwidth_clock(current_ts, large_size, &phy_queue);
+  ASSERT_EQ(current_ts, phy_queue.reservation_ts_);
+  ASSERT_EQ(current_ts, phy_queue.tenant_limitation_ts_);
+
+  phy_queue.reservation_ts_ = INT64_MAX;
+  phy_queue.tenant_limitation_ts_ = 0;
+  tenant_clock.calc_bandwidth_clock(current_ts, large_size, &phy_queue);
+  ASSERT_EQ(current_ts + 1000L * 1000L, phy_queue.reservation_ts_); // 1M at 1M/s
+  ASSERT_EQ(current_ts + 100L * 1000L, phy_queue.tenant_limitation_ts_); // 1M at 10M/s
+
+  // small io costs little
+  phy_queue.reservation_ts_ = INT64_MAX;
+  phy_queue.tenant_limitation_ts_ = 0;
+  tenant_clock.calc_bandwidth_clock(current_ts, small_size, &phy_queue);
+  ASSERT_EQ(current_ts + 1000L * 1000L + 3906L, phy_queue.reservation_ts_); // 4K at 1M/s
+  ASSERT_EQ(current_ts + 100L * 1000L + 390L, phy_queue.tenant_limitation_ts_); // 4K at 10M/s, in ns 390625
+
+  // reservation tag is the earlier of iops and bandwidth, limitation tag the later
+  const int64_t iops_reservation_ts = current_ts + 10;
+  const int64_t iops_limitation_ts = current_ts + 10L * 1000L * 1000L;
+  phy_queue.reservation_ts_ = iops_reservation_ts;
+  phy_queue.tenant_limitation_ts_ = iops_limitation_ts;
+  tenant_clock.calc_bandwidth_clock(current_ts, large_size, &phy_queue);
+  ASSERT_EQ(iops_reservation_ts, phy_queue.reservation_ts_);
+  ASSERT_EQ(iops_limitation_ts, phy_queue.tenant_limitation_ts_);
+
+  // clocks catch up with current time after idle
+  const int64_t idle_ts = current_ts + 100L * 1000L * 1000L;
+  phy_queue.reservation_ts_ = INT64_MAX;
+  phy_queue.tenant_limitation_ts_ = 0;
+  tenant_clock.calc_bandwidth_clock(idle_ts, large_size, &phy_queue);
+  ASSERT_EQ(idle_ts, phy_queue.reservation_ts_);
+  ASSERT_EQ(idle_ts, phy_queue.tenant_limitation_ts_);
+
+  // no bandwidth reservation or limitation, tags of iops are kept
+  unit_config.min_bandwidth_ = 0;
+  unit_config.max_bandwidth_ = 0;
+  ASSERT_TRUE(unit_config.is_valid());
+  tenant_clock.update_bandwidth_clocks(unit_config);
+  phy_queue.reservation_ts_ = iops_limitation_ts;
+  phy_queue.tenant_limitation_ts_ = iops_reservation_ts;
+  tenant_clock.calc_bandwidth_clock(idle_ts, large_size, &phy_queue);
+  ASSERT_EQ(iops_limitation_ts, phy_queue.reservation_ts_);
+  ASSERT_EQ(iops_reservation_ts, phy_queue.tenant_limitation_ts_);
+  tenant_clock.calc_bandwidth_clock(idle_ts, 0, &phy_queue);
+  ASSERT_EQ(iops_limitation_ts, phy_queue.reservation_ts_);
+
+  // max bandwidth less than min bandwidth
+  unit_config.min_bandwidth_ = 10 * MB;
+  unit_config.max_bandwidth_ = 1 * MB;
+  ASSERT_FALSE(unit_config.is_valid());
+}
+
 TEST_F(TestIOStruct, IOCallbackManager)
 {
   // test init
@@ -796,6 +868,85 @@ TEST_F(TestIOManager, simple)
   ASSERT_SUCC(THE_IO_DEVICE->close(fd));
 }
 
+TEST_F(TestIOManager, batch_read)
+{
+  ObIOFd fd;
+  ASSERT_SUCC(THE_IO_DEVICE->open(TEST_ROOT_DIR "/test_io_batch_file", O_CREAT | O_DIRECT | O_TRUNC | O_RDWR, 0644, fd));
+  ASSERT_TRUE(fd.is_valid());
+  ObIOManager &io_mgr = ObIOManager::get_instance();
+  const int64_t FILE_SIZE = 4 * 1024 * 1024;
+  ASSERT_SUCC(THE_IO_DEVICE->fallocate(fd, 0, 0, FILE_SIZE));
+
+  // write pattern data
+  const int64_t io_timeout_ms = 1000L * 5L;
+  const int64_t write_io_size = DIO_READ_ALIGN_SIZE * 4;
+  char buf[write_io_size] = { 0 };
+  for (int64_t i = 0; i < write_io_size; ++i) {
+    buf[i] = static_cast<char>(i % 251);
+  }
+  ObIOInfo write_info;
+  write_info.tenant_id_ = OB_SERVER_TENANT_ID;
+  write_info.fd_ = fd;
+  write_info.flag_.set_write();
+  write_info.flag_.set_group_id(0);
+  write_info.flag_.set_wait_event(100);
+  write_info.offset_ = 0;
+  write_info.size_ = write_io_size;
+  write_info.buf_ = buf;
+  ASSERT_SUCC(io_mgr.write(write_info, io_timeout_ms));
+
+  // adjacent, nearby, far away and no callback reads
+  const int64_t READ_CNT = 5;
+  const int64_t offsets[READ_CNT] = { 5096, 4096, 10000, FILE_SIZE - DIO_READ_ALIGN_SIZE, 4200 };
+  const int64_t sizes[READ_CNT] = { 3000, 1000, 500, 100, 100 };
+  ObArenaAllocator allocator;
+  int64_t tmp_number = 0;
+  TestIOCallback callbacks[READ_CNT];
+  ObSEArray<ObIOInfo, READ_CNT> io_infos;
+  ObSEArray<ObIOHandle, READ_CNT> io_handles;
+  for (int64_t i = 0; i < READ_CNT; ++i) {
+    ObIOInfo io_info = write_info;
+    io_info.flag_.set_read();
+    io_info.buf_ = nullptr;
+    io_info.offset_ = offsets[i];
+    io_info.size_ = sizes[i];
+    if (i < READ_CNT - 1) {
+      callbacks[i].number_ = &tmp_number;
+      callbacks[i].allocator_ = &allocator;
+      io_info.callback_ = &callbacks[i];
+    }
+    ASSERT_SUCC(io_infos.push_back(io_info));
+  }
+  ASSERT_SUCC(io_mgr.aio_read_batch(io_infos, io_handles));
+  ASSERT_EQ(READ_CNT, io_handles.count());
+  for (int64_t i = 0; i < READ_CNT; ++i) {
+    ObIOHandle &io_handle = io_handles.at(i);
+    ASSERT_SUCC(io_handle.wait(io_timeout_ms));
+    ASSERT_NE(nullptr, io_handle.get_buffer());
+    ASSERT_EQ(sizes[i], io_handle.get_data_size());
+    if (offsets[i] < write_io_size) {
+      ASSERT_EQ(0, memcmp(buf + offsets[i], io_handle.get_buffer(), sizes[i]));
+    }
+  }
+  ASSERT_EQ(400, tmp_number); // callback process called
+  io_handles.reset();
+  ASSERT_EQ(40, tmp_number); // callback destructor called
+
+  // range of a request without batch callback
+  ObIOHandle io_handle;
+  ObIOHandle range_handle;
+  ObIOInfo io_info = io_infos.at(0);
+  io_info.callback_ = &callbacks[0];
+  ASSERT_SUCC(io_mgr.read(io_info, io_handle, io_timeout_ms));
+  ASSERT_EQ(OB_NOT_SUPPORTED, io_handle.get_range_handle(0, range_handle));
+  io_handle.range_idx_ = 0;
+  ASSERT_EQ(nullptr, io_handle.get_buffer());
+  ASSERT_EQ(0, io_handle.get_data_size());
+  io_handle.reset();
+
+  ASSERT_SUCC(THE_IO_DEVICE->close(fd));
+}
+
 
 struct IOPerfDevice
 {
@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <thread>
+#include <vector>
+
+#define USING_LOG_PREFIX STORAGE
+
+#define protected public
+#define private public
+
+#include "lib/oblog/ob_log.h"
+#include "lib/utility/ob_tracepoint.h"
+#include "share/ob_io_uring.h"
+#include "share/ob_local_device.h"
+#include "share/config/ob_server_config.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+
+namespace unittest
+{
+static const char *TEST_FILE = "test_io_uring.data";
+static const int64_t BLOCK_SIZE = 4096;
+static const int64_t BLOCK_CNT = 256;
+
+class TestIOUring : public ::testing::Test
+{
+public:
+  TestIOUring() : fd_(-1), buf_(nullptr) {}
+  void SetUp()
+  {
+    fd_ = ::open(TEST_FILE, O_CREAT | O_TRUNC | O_RDWR | O_DIRECT, 0644);
+    if (fd_ < 0 && EINVAL == errno) {
+      // file system without direct io
+      fd_ = ::open(TEST_FILE, O_CREAT | O_TRUNC | O_RDWR, 0644);
+    }
+    ASSERT_TRUE(fd_ >= 0);
+    ASSERT_EQ(0, ::ftruncate(fd_, BLOCK_SIZE * BLOCK_CNT));
+    ASSERT_EQ(0, ::posix_memalign(reinterpret_cast<void **>(&buf_), BLOCK_SIZE, BLOCK_SIZE * BLOCK_CNT * 2));
+    for (int64_t i = 0; i < BLOCK_CNT; ++i) {
+      MEMSET(buf_ + i * BLOCK_SIZE, static_cast<int>('a' + i % 26), BLOCK_SIZE);
+    }
+    MEMSET(read_buf(0), 0, BLOCK_SIZE * BLOCK_CNT);
+  }
+  void TearDown()
+  {
+    uring_.destroy();
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+    ::free(buf_);
+    ::remove(TEST_FILE);
+  }
+  // io_uring may be unavailable on the kernel or forbidden in the container
+  bool init_uring(const uint32_t max_events)
+  {
+    int ret = uring_.init(max_events, false /*sqpoll*/);
+    if (OB_FAIL(ret)) {
+      LOG_WARN("io_uring is not available, skip", K(ret));
+    }
+    return OB_SUCCESS == ret;
+  }
+  char *write_buf(const int64_t idx) { return buf_ + idx * BLOCK_SIZE; }
+  char *read_buf(const int64_t idx) { return buf_ + (BLOCK_CNT + idx) * BLOCK_SIZE; }
+  void prep_write(const int64_t idx, struct iocb &cb)
+  {
+    io_prep_pwrite(&cb, fd_, write_buf(idx), BLOCK_SIZE, idx * BLOCK_SIZE);
+    cb.data = reinterpret_cast<void *>(idx + 1);
+  }
+  void prep_read(const int64_t idx, struct iocb &cb)
+  {
+    io_prep_pread(&cb, fd_, read_buf(idx), BLOCK_SIZE, idx * BLOCK_SIZE);
+    cb.data = reinterpret_cast<void *>(idx + 1);
+  }
+  // reap @cnt completions of blocks [0, cnt), each of them is completed once
+  void wait_all(const int64_t cnt)
+  {
+    struct io_event events[BLOCK_CNT];
+    struct timespec timeout = { 1, 0 };
+    bool completed[BLOCK_CNT] = { false };
+    int64_t complete_cnt = 0;
+    int64_t total_cnt = 0;
+    for (int64_t loop = 0; total_cnt < cnt && loop < 100; ++loop) {
+      ASSERT_EQ(OB_SUCCESS, uring_.get_events(1, BLOCK_CNT, &timeout, events, complete_cnt));
+      for (int64_t i = 0; i < complete_cnt; ++i) {
+        const int64_t idx = reinterpret_cast<int64_t>(events[i].data) - 1;
+        ASSERT_TRUE(idx >= 0 && idx < cnt);
+        ASSERT_FALSE(completed[idx]);
+        ASSERT_EQ(BLOCK_SIZE, static_cast<int64_t>(events[i].res));
+        completed[idx] = true;
+      }
+      total_cnt += complete_cnt;
+    }
+    ASSERT_EQ(cnt, total_cnt);
+  }
+
+protected:
+  int fd_;
+  char *buf_;
+  ObIOUring uring_;
+};
+
+TEST_F(TestIOUring, init)
+{
+  struct iocb cb;
+  struct io_event events[4];
+  int64_t complete_cnt = 0;
+  prep_read(0, cb);
+  ASSERT_EQ(OB_NOT_INIT, uring_.submit(cb));
+  ASSERT_EQ(OB_NOT_INIT, uring_.get_events(0, 4, nullptr, events, complete_cnt));
+  ASSERT_NE(OB_SUCCESS, uring_.init(0, false));
+  ASSERT_FALSE(uring_.is_inited());
+  if (init_uring(8)) {
+    ASSERT_EQ(OB_INIT_TWICE, uring_.init(8, false));
+    ASSERT_EQ(8, uring_.sq_entries_);
+    ASSERT_EQ(OB_INVALID_ARGUMENT, uring_.get_events(-1, 4, nullptr, events, complete_cnt));
+    ASSERT_EQ(OB_INVALID_ARGUMENT, uring_.get_events(4, 2, nullptr, events, complete_cnt));
+    ASSERT_EQ(OB_INVALID_ARGUMENT, uring_.get_events(0, 4, nullptr, nullptr, complete_cnt));
+    io_prep_fsync(&cb, fd_);
+    ASSERT_EQ(OB_NOT_SUPPORTED, uring_.submit(cb));
+    // nothing to reap
+    ASSERT_EQ(OB_SUCCESS, uring_.get_events(0, 4, nullptr, events, complete_cnt));
+    ASSERT_EQ(0, complete_cnt);
+    uring_.destroy();
+    ASSERT_FALSE(uring_.is_inited());
+    ASSERT_EQ(OB_SUCCESS, uring_.init(8, false));
+  }
+}
+
+TEST_F(TestIOUring, submit_and_reap)
+{
+  if (init_uring(32)) {
+    const int64_t cnt = 16;
+    struct iocb cbs[cnt];
+    for (int64_t i = 0; i < cnt; ++i) {
+      prep_write(i, cbs[i]);
+      ASSERT_EQ(OB_SUCCESS, uring_.submit(cbs[i]));
+    }
+    wait_all(cnt);
+    for (int64_t i = 0; i < cnt; ++i) {
+      prep_read(i, cbs[i]);
+      ASSERT_EQ(OB_SUCCESS, uring_.submit(cbs[i]));
+    }
+    wait_all(cnt);
+    ASSERT_EQ(0, MEMCMP(write_buf(0), read_buf(0), cnt * BLOCK_SIZE));
+    ASSERT_EQ(0, uring_.unsubmitted_cnt_);
+    ASSERT_FALSE(uring_.is_flushing_);
+  }
+}
+
+TEST_F(TestIOUring, full_queue)
+{
+  if (init_uring(4)) {
+    const int64_t sq_entries = uring_.sq_entries_;
+    struct iocb cbs[BLOCK_CNT];
+    // another thread is entering kernel, requests are left in submission queue
+    uring_.is_flushing_ = true;
+    for (int64_t i = 0; i < sq_entries; ++i) {
+      prep_write(i, cbs[i]);
+      ASSERT_EQ(OB_SUCCESS, uring_.submit(cbs[i]));
+    }
+    prep_write(sq_entries, cbs[sq_entries]);
+    ASSERT_EQ(OB_EAGAIN, uring_.submit(cbs[sq_entries]));
+    ASSERT_EQ(sq_entries, uring_.unsubmitted_cnt_);
+
+    // requests left by the failed flush are submitted by reaper
+    uring_.is_flushing_ = false;
+    wait_all(sq_entries);
+    ASSERT_EQ(0, uring_.unsubmitted_cnt_);
+    ASSERT_EQ(OB_SUCCESS, uring_.submit(cbs[sq_entries]));
+    struct io_event events[4];
+    struct timespec timeout = { 5, 0 };
+    int64_t complete_cnt = 0;
+    ASSERT_EQ(OB_SUCCESS, uring_.get_events(1, 4, &timeout, events, complete_cnt));
+    ASSERT_EQ(1, complete_cnt);
+    ASSERT_EQ(sq_entries + 1, reinterpret_cast<int64_t>(events[0].data));
+  }
+}
+
+TEST_F(TestIOUring, concurrent_submit)
+{
+  if (init_uring(16)) {
+    const int64_t thread_cnt = 4;
+    const int64_t cnt_per_thread = BLOCK_CNT / thread_cnt;
+    struct iocb cbs[BLOCK_CNT];
+    bool reaped = false;
+    int64_t eagain_cnt = 0;
+    std::vector<std::thread> threads;
+    for (int64_t t = 0; t < thread_cnt; ++t) {
+      threads.push_back(std::thread([&, t]() {
+        for (int64_t i = t * cnt_per_thread; i < (t + 1) * cnt_per_thread; ++i) {
+          prep_write(i, cbs[i]);
+          int ret = OB_SUCCESS;
+          while (OB_EAGAIN == (ret = uring_.submit(cbs[i]))) {
+            ATOMIC_INC(&eagain_cnt);
+            sched_yield();
+          }
+          ASSERT_EQ(OB_SUCCESS, ret);
+        }
+        // requests of exited thread are canceled by kernel
+        while (!ATOMIC_LOAD(&reaped)) {
+          usleep(1000);
+        }
+      }));
+    }
+    wait_all(BLOCK_CNT);
+    ATOMIC_STORE(&reaped, true);
+    for (int64_t t = 0; t < thread_cnt; ++t) {
+      threads[t].join();
+    }
+    LOG_INFO("concurrent submit", K(eagain_cnt), K_(uring));
+    ASSERT_EQ(0, uring_.unsubmitted_cnt_);
+    ASSERT_EQ(static_cast<ssize_t>(BLOCK_SIZE * BLOCK_CNT),
+        ::pread(fd_, read_buf(0), BLOCK_SIZE * BLOCK_CNT, 0));
+    ASSERT_EQ(0, MEMCMP(write_buf(0), read_buf(0), BLOCK_SIZE * BLOCK_CNT));
+  }
+}
+
+// io context of local device falls back to libaio if io_uring can not be set up
+TEST_F(TestIOUring, local_device_fallback)
+{
+  ObLocalDevice device;
+  const ObMemAttr mem_attr(OB_SYS_TENANT_ID, "test_io_uring");
+  ASSERT_EQ(OB_SUCCESS, device.allocator_.init(lib::ObMallocAllocator::get_instance(),
+      OB_MALLOC_MIDDLE_BLOCK_SIZE, mem_attr));
+  device.is_inited_ = true;
+  struct io_event io_events[4];
+  ObLocalIOEvents events;
+  events.io_events_ = io_events;
+  events.max_event_cnt_ = 4;
+  struct timespec timeout = { 5, 0 };
+
+  for (int64_t i = 0; i < 3; ++i) {
+    ObIOContext *io_context = nullptr;
+    ObLocalIOCB iocb;
+    if (0 == i) {
+      GCONF._enable_io_uring.set_value("False");
+    } else if (1 == i) {
+      GCONF._enable_io_uring.set_value("True");
+#ifdef ERRSIM
+      TP_SET_EVENT(EventTable::EN_IO_SETUP, OB_IO_ERROR, 0, 1);
+#else
+      continue;
+#endif
+    } else {
+      // with or without io_uring support
+      GCONF._enable_io_uring.set_value("True");
+    }
+    ASSERT_EQ(OB_SUCCESS, device.io_setup(4, io_context));
+#ifdef ERRSIM
+    TP_SET_EVENT(EventTable::EN_IO_SETUP, OB_SUCCESS, 0, 0);
+#endif
+    ObLocalIOContext *local_context = static_cast<ObLocalIOContext *>(io_context);
+    if (i < 2) {
+      ASSERT_FALSE(local_context->uring_.is_inited());
+    }
+    prep_write(i, iocb.iocb_);
+    ASSERT_EQ(OB_SUCCESS, device.io_submit(io_context, &iocb));
+    ASSERT_EQ(OB_SUCCESS, device.io_getevents(io_context, 1, &events, &timeout));
+    ASSERT_EQ(1, events.get_complete_cnt());
+    ASSERT_EQ(BLOCK_SIZE, events.get_ith_ret_bytes(0));
+    ASSERT_EQ(reinterpret_cast<void *>(i + 1), events.get_ith_data(0));
+    ASSERT_EQ(OB_SUCCESS, device.io_destroy(io_context));
+  }
+  GCONF._enable_io_uring.set_value("False");
+  device.is_inited_ = false;
+  device.allocator_.reset();
+}
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_io_uring.log*");
+  OB_LOGGER.set_file_name("test_io_uring.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
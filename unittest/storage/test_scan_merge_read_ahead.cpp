@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "storage/access/ob_multiple_scan_merge.h"
+#include "observer/ob_server_struct.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+
+namespace unittest
+{
+// each round of prefetch adds @round_size_ bytes in flight
+class MockReadAheadIter : public ObStoreRowIterator
+{
+public:
+  MockReadAheadIter(const bool is_sstable, const int64_t round_size)
+    : prefetch_cnt_(0), prefetching_size_(0), round_size_(round_size), ret_(OB_SUCCESS)
+  {
+    is_sstable_iter_ = is_sstable;
+  }
+  virtual int prefetch_ahead() override
+  {
+    if (OB_SUCCESS == ret_) {
+      ++prefetch_cnt_;
+      prefetching_size_ += round_size_;
+    }
+    return ret_;
+  }
+  virtual int64_t get_prefetching_size() const override { return prefetching_size_; }
+  int64_t prefetch_cnt_;
+  int64_t prefetching_size_;
+  int64_t round_size_;
+  int ret_;
+};
+
+class TestScanMergeReadAhead : public ::testing::Test
+{
+public:
+  TestScanMergeReadAhead()
+    : sstable1_(true, 16 << 10), sstable2_(true, 16 << 10), sstable3_(true, 16 << 10), memtable_(false, 16 << 10)
+  {}
+  void SetUp()
+  {
+    merge_.access_ctx_ = &access_ctx_;
+  }
+  void TearDown()
+  {
+    merge_.iters_.reset();
+  }
+  void add_iters(MockReadAheadIter **iters, const int64_t cnt)
+  {
+    merge_.iters_.reset();
+    for (int64_t i = 0; i < cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, merge_.iters_.push_back(iters[i]));
+    }
+  }
+
+protected:
+  ObTableAccessContext access_ctx_;
+  ObMultipleScanMerge merge_;
+  MockReadAheadIter sstable1_;
+  MockReadAheadIter sstable2_;
+  MockReadAheadIter sstable3_;
+  MockReadAheadIter memtable_;
+};
+
+TEST_F(TestScanMergeReadAhead, init)
+{
+  const int64_t read_ahead_size = GCONF._scan_merge_read_ahead_size;
+  MockReadAheadIter *one_sstable[] = { &memtable_, &sstable1_ };
+  add_iters(one_sstable, 2);
+  merge_.init_read_ahead();
+  ASSERT_EQ(0, merge_.read_ahead_size_);
+
+  MockReadAheadIter *two_sstables[] = { &sstable1_, &memtable_, &sstable2_ };
+  add_iters(two_sstables, 3);
+  merge_.init_read_ahead();
+  ASSERT_EQ(MAX(0, read_ahead_size), merge_.read_ahead_size_);
+
+  // not for daily merge
+  access_ctx_.query_flag_.daily_merge_ = 1;
+  merge_.init_read_ahead();
+  ASSERT_EQ(0, merge_.read_ahead_size_);
+  access_ctx_.query_flag_.daily_merge_ = 0;
+
+  // disabled read ahead does nothing
+  merge_.read_ahead_size_ = 0;
+  ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(1, merge_.read_ahead_row_cnt_));
+  ASSERT_EQ(0, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(0, sstable2_.prefetch_cnt_);
+}
+
+TEST_F(TestScanMergeReadAhead, row_and_batch_interval)
+{
+  MockReadAheadIter *iters[] = { &sstable1_, &sstable2_ };
+  add_iters(iters, 2);
+  merge_.read_ahead_size_ = 1 << 30;
+  const int64_t row_interval = ObMultipleScanMerge::READ_AHEAD_ROW_INTERVAL;
+  const int64_t batch_interval = ObMultipleScanMerge::READ_AHEAD_BATCH_INTERVAL;
+  for (int64_t i = 0; i < row_interval * 2 + 1; ++i) {
+    ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(row_interval, merge_.read_ahead_row_cnt_));
+  }
+  ASSERT_EQ(3, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(3, sstable2_.prefetch_cnt_);
+
+  // batches are counted separately, the first batch reads ahead at once
+  for (int64_t i = 0; i < batch_interval * 2; ++i) {
+    ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(batch_interval, merge_.read_ahead_batch_cnt_));
+  }
+  ASSERT_EQ(5, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(5, sstable2_.prefetch_cnt_);
+  ASSERT_EQ(row_interval * 2 + 1, merge_.read_ahead_row_cnt_);
+  ASSERT_EQ(batch_interval * 2, merge_.read_ahead_batch_cnt_);
+
+  // rows do not move batch counter
+  for (int64_t i = 0; i < row_interval - 1; ++i) {
+    ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(row_interval, merge_.read_ahead_row_cnt_));
+  }
+  ASSERT_EQ(5, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(batch_interval, merge_.read_ahead_batch_cnt_));
+  ASSERT_EQ(6, sstable1_.prefetch_cnt_);
+}
+
+TEST_F(TestScanMergeReadAhead, inflight_budget)
+{
+  MockReadAheadIter *iters[] = { &sstable1_, &memtable_, &sstable2_, &sstable3_ };
+  add_iters(iters, 4);
+  merge_.read_ahead_size_ = 40 << 10;
+  // 48K in flight after one round of each sstable
+  ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(1, merge_.read_ahead_row_cnt_));
+  ASSERT_EQ(1, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(1, sstable2_.prefetch_cnt_);
+  ASSERT_EQ(1, sstable3_.prefetch_cnt_);
+  ASSERT_EQ(0, memtable_.prefetch_cnt_);
+
+  // over budget
+  ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(1, merge_.read_ahead_row_cnt_));
+  ASSERT_EQ(1, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(1, sstable2_.prefetch_cnt_);
+  ASSERT_EQ(1, sstable3_.prefetch_cnt_);
+
+  // blocks of sstable1 fetched, 32K in flight, only one more round fits
+  sstable1_.prefetching_size_ = 0;
+  ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(1, merge_.read_ahead_row_cnt_));
+  ASSERT_EQ(1, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(2, sstable2_.prefetch_cnt_);
+  ASSERT_EQ(1, sstable3_.prefetch_cnt_);
+
+  // all fetched, start from the next sstable in turn
+  sstable2_.prefetching_size_ = 0;
+  sstable3_.prefetching_size_ = 0;
+  ASSERT_EQ(OB_SUCCESS, merge_.read_ahead(1, merge_.read_ahead_row_cnt_));
+  ASSERT_EQ(2, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(3, sstable2_.prefetch_cnt_);
+  ASSERT_EQ(2, sstable3_.prefetch_cnt_);
+  ASSERT_EQ(0, memtable_.prefetch_cnt_);
+  ASSERT_EQ(48 << 10, sstable1_.prefetching_size_ + sstable2_.prefetching_size_ + sstable3_.prefetching_size_);
+}
+
+TEST_F(TestScanMergeReadAhead, prefetch_error)
+{
+  MockReadAheadIter *iters[] = { &sstable1_, &sstable2_, &sstable3_ };
+  add_iters(iters, 3);
+  merge_.read_ahead_size_ = 1 << 30;
+  sstable2_.ret_ = OB_IO_ERROR;
+  ASSERT_EQ(OB_IO_ERROR, merge_.read_ahead(1, merge_.read_ahead_row_cnt_));
+  ASSERT_EQ(1, sstable1_.prefetch_cnt_);
+  ASSERT_EQ(0, sstable3_.prefetch_cnt_);
+}
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_scan_merge_read_ahead.log*");
+  OB_LOGGER.set_file_name("test_scan_merge_read_ahead.log", true, false);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}